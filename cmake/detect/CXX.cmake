@@ -44,8 +44,20 @@ set(NOEXCEPT_CODE
      void Foo( const std::vector<int>& x ) noexcept { }
      int main()
      { return 0; }")
+set(MMAP_CODE
+    "#include <sys/mman.h>
+     #include <fcntl.h>
+     #include <unistd.h>
+     int main()
+     {
+         void* buffer = mmap( 0, 4096, PROT_READ, MAP_SHARED, 0, 0 );
+         madvise( buffer, 4096, MADV_SEQUENTIAL );
+         munmap( buffer, 4096 );
+         return 0;
+     }")
 check_cxx_source_compiles("${STEADYCLOCK_CODE}" EL_HAVE_STEADYCLOCK)
 check_cxx_source_compiles("${NOEXCEPT_CODE}" EL_HAVE_NOEXCEPT)
+check_cxx_source_compiles("${MMAP_CODE}" EL_HAVE_MMAP)
 
 # C++11 random number generation
 # ==============================
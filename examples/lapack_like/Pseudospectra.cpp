@@ -89,6 +89,10 @@ main( int argc, char* argv[] )
           El::Input("--maxIts","maximum pseudospec iter's",200);
         const Real psTol =
           El::Input("--psTol","tolerance for pseudospectra",1e-6);
+        const El::Int teamSize =
+          El::Input("--teamSize","processes per team of shifts",0);
+        const El::Int batchSize =
+          El::Input("--batchSize","shifts per team batch",0);
         // Uniform options
         const Real uniformRealCenter =
           El::Input("--uniformRealCenter","real center of uniform dist",0.);
@@ -276,6 +280,8 @@ main( int argc, char* argv[] )
         psCtrl.deflate = deflate;
         psCtrl.arnoldi = arnoldi;
         psCtrl.basisSize = basisSize;
+        psCtrl.teamSize = teamSize;
+        psCtrl.batchSize = batchSize;
         psCtrl.progress = progress;
         psCtrl.schurCtrl.hessSchurCtrl.scalapack = false;
         psCtrl.schurCtrl.hessSchurCtrl.fullTriangle = true;
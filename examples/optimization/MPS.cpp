@@ -61,6 +61,7 @@ void SparseLoadAndSolve
   bool minimize,
   bool keepNonnegativeWithZeroUpperBounds,
   bool metadataSummary,
+  bool presolve,
   bool print )
 {
     EL_DEBUG_CSE
@@ -86,6 +87,8 @@ void SparseLoadAndSolve
     El::AffineLPSolution<El::Matrix<Real>> solution;
     El::lp::affine::Ctrl<Real> ctrl;
     ctrl.mehrotraCtrl.print = true;
+    ctrl.presolveCtrl.enable = presolve;
+    ctrl.presolveCtrl.print = true;
     El::LP( problem, solution, ctrl );
     El::Output("Solving took ",timer.Stop()," seconds");
     if( print )
@@ -121,24 +124,44 @@ int main( int argc, char* argv[] )
           El::Input("--testDense","test with dense matrices?",false);
         const bool testDouble =
           El::Input("--testDouble","test double-precision?",true);
+        const bool presolve =
+          El::Input("--presolve","presolve the sparse problems?",false);
         const bool print = El::Input("--print","print matrices?",false);
+        const std::string cacheFilename =
+          El::Input
+          ("--cacheFilename","if nonempty, load through this binary cache",
+           std::string(""));
         El::ProcessInput();
         El::PrintInputReport();
 
+        std::string loadFilename = filename;
+        bool loadCompressed = compressed;
+        if( cacheFilename != "" && !compressed )
+        {
+            El::Timer timer;
+            timer.Start();
+            El::CompressMPS
+            ( filename, cacheFilename,
+              minimize, keepNonnegativeWithZeroUpperBounds );
+            El::Output("Caching took ",timer.Stop()," seconds");
+            loadFilename = cacheFilename;
+            loadCompressed = true;
+        }
+
         if( testDense )
         {
             if( testDouble )
                 DenseLoadAndSolve<double>
-                ( filename, compressed,
+                ( loadFilename, loadCompressed,
                   minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
                   print );
 #ifdef EL_HAVE_QD
             DenseLoadAndSolve<El::DoubleDouble>
-            ( filename, compressed,
+            ( loadFilename, loadCompressed,
               minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
               print );
             DenseLoadAndSolve<El::QuadDouble>
-            ( filename, compressed,
+            ( loadFilename, loadCompressed,
               minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
               print );
 #endif
@@ -146,18 +169,18 @@ int main( int argc, char* argv[] )
 
         if( testDouble )
             SparseLoadAndSolve<double>
-            ( filename, compressed,
+            ( loadFilename, loadCompressed,
               minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
-              print );
+              presolve, print );
 #ifdef EL_HAVE_QD
         SparseLoadAndSolve<El::DoubleDouble>
-        ( filename, compressed,
+        ( loadFilename, loadCompressed,
           minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
-          print );
+          presolve, print );
         SparseLoadAndSolve<El::QuadDouble>
-        ( filename, compressed,
+        ( loadFilename, loadCompressed,
           minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
-          print );
+          presolve, print );
 #endif
     }
     catch( std::exception& e ) { El::ReportException(e); }
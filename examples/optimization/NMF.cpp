@@ -21,6 +21,8 @@ main( int argc, char* argv[] )
         const El::Int n = El::Input("--n","matrix width",50);
         const El::Int k = El::Input("--k","rank of approximation",3);
         const El::Int maxIter = El::Input("--maxIter","max. iterations",20);
+        const El::Int approachInt =
+          El::Input("--approach","0: ADMM, 1: QP, 2: SOCP, 3: active set",3);
         const bool display = El::Input("--display","display matrices?",false);
         const bool print = El::Input("--print","print matrices",false);
         El::ProcessInput();
@@ -40,7 +42,7 @@ main( int argc, char* argv[] )
             El::Display( A, "A" );
 
         El::NMFCtrl<Real> ctrl;
-        ctrl.nnlsCtrl.approach = El::NNLS_QP;
+        ctrl.nnlsCtrl.approach = static_cast<El::NNLSApproach>(approachInt);
         ctrl.nnlsCtrl.qpCtrl.mehrotraCtrl.print = false;
         ctrl.nnlsCtrl.qpCtrl.mehrotraCtrl.time = false;
         ctrl.nnlsCtrl.socpCtrl.mehrotraCtrl.print = false;
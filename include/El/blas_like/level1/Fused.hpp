@@ -0,0 +1,456 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_FUSED_HPP
+#define EL_BLAS_FUSED_HPP
+
+// Lazily-evaluated entrywise expressions
+// ======================================
+// Chains of entrywise updates such as
+//
+//   X = Z; X -= U; X *= rho; X -= S;
+//
+// make one pass over memory per operation. Building the expression instead,
+//
+//   fused::Assign( X, rho*(fused::Ref(Z)-fused::Ref(U)) - fused::Ref(S) );
+//
+// evaluates it in a single (threaded and vectorized) loop without forming
+// temporaries. Reductions, e.g., fused::FrobeniusNorm(Ref(X)-Ref(Z)), are
+// likewise evaluated in a single pass.
+//
+// The operands may be Matrix instances of the same size or ElementalMatrix
+// instances with the same distribution and alignments (in which case the
+// expression acts upon the local data). Since entry (i,j) of an expression
+// only depends upon entry (i,j) of its operands, the target of an assignment
+// may also be one of the operands, but it may not otherwise overlap them.
+
+namespace El {
+namespace fused {
+
+template<class Derived>
+struct Expression
+{
+    const Derived& Self() const { return static_cast<const Derived&>(*this); }
+};
+
+// A reference to the (local) entries of a matrix
+template<typename T>
+class MatrixRef : public Expression<MatrixRef<T>>
+{
+public:
+    typedef T Type;
+
+    MatrixRef( const Matrix<T>& A )
+    : buf_(A.LockedBuffer()), ldim_(A.LDim()),
+      height_(A.Height()), width_(A.Width()), dist_(nullptr)
+    { }
+
+    MatrixRef( const ElementalMatrix<T>& A )
+    : buf_(A.LockedBuffer()), ldim_(A.LDim()),
+      height_(A.LocalHeight()), width_(A.LocalWidth()), dist_(&A)
+    { }
+
+    T operator()( Int i, Int j ) const { return buf_[i+j*ldim_]; }
+
+    Int Height() const { return height_; }
+    Int Width() const { return width_; }
+
+    const ElementalMatrix<T>* DistLeaf() const { return dist_; }
+
+    bool Conforms( const DistData& distData ) const
+    { return dist_ == nullptr || DistData(*dist_) == distData; }
+
+private:
+    const T* buf_;
+    Int ldim_, height_, width_;
+    const ElementalMatrix<T>* dist_;
+};
+
+template<typename T>
+MatrixRef<T> Ref( const Matrix<T>& A ) { return MatrixRef<T>( A ); }
+template<typename T>
+MatrixRef<T> Ref( const ElementalMatrix<T>& A ) { return MatrixRef<T>( A ); }
+
+template<class Op,class E>
+class UnaryNode : public Expression<UnaryNode<Op,E>>
+{
+public:
+    typedef decltype(std::declval<Op>()(std::declval<typename E::Type>()))
+      Type;
+
+    UnaryNode( const E& e, const Op& op ) : e_(e), op_(op) { }
+
+    Type operator()( Int i, Int j ) const { return op_(e_(i,j)); }
+
+    Int Height() const { return e_.Height(); }
+    Int Width() const { return e_.Width(); }
+
+    auto DistLeaf() const -> decltype(std::declval<E>().DistLeaf())
+    { return e_.DistLeaf(); }
+
+    bool Conforms( const DistData& distData ) const
+    { return e_.Conforms( distData ); }
+
+private:
+    const E e_;
+    const Op op_;
+};
+
+template<class Op,class E1,class E2>
+class BinaryNode : public Expression<BinaryNode<Op,E1,E2>>
+{
+public:
+    typedef typename E1::Type Type;
+
+    BinaryNode( const E1& e1, const E2& e2, const Op& op )
+    : e1_(e1), e2_(e2), op_(op)
+    {
+        if( e1.Height() != e2.Height() || e1.Width() != e2.Width() )
+            LogicError
+            ("Nonconformal fused expression: ",e1.Height()," x ",e1.Width(),
+             " and ",e2.Height()," x ",e2.Width());
+    }
+
+    Type operator()( Int i, Int j ) const
+    { return op_(e1_(i,j),e2_(i,j)); }
+
+    Int Height() const { return e1_.Height(); }
+    Int Width() const { return e1_.Width(); }
+
+    auto DistLeaf() const -> decltype(std::declval<E1>().DistLeaf())
+    {
+        auto leaf = e1_.DistLeaf();
+        return leaf != nullptr ? leaf : e2_.DistLeaf();
+    }
+
+    bool Conforms( const DistData& distData ) const
+    { return e1_.Conforms( distData ) && e2_.Conforms( distData ); }
+
+private:
+    const E1 e1_;
+    const E2 e2_;
+    const Op op_;
+};
+
+// Entrywise operations
+// ====================
+struct SumOp
+{
+    template<typename T>
+    T operator()( const T& alpha, const T& beta ) const { return alpha+beta; }
+};
+
+struct DifferenceOp
+{
+    template<typename T>
+    T operator()( const T& alpha, const T& beta ) const { return alpha-beta; }
+};
+
+struct HadamardOp
+{
+    template<typename T>
+    T operator()( const T& alpha, const T& beta ) const { return alpha*beta; }
+};
+
+struct NegationOp
+{
+    template<typename T>
+    T operator()( const T& alpha ) const { return -alpha; }
+};
+
+template<typename T>
+struct ScaleOp
+{
+    T scale;
+    T operator()( const T& alpha ) const { return scale*alpha; }
+};
+
+template<typename T>
+struct ShiftOp
+{
+    T shift;
+    T operator()( const T& alpha ) const { return alpha+shift; }
+};
+
+template<typename T>
+struct SoftThresholdOp
+{
+    Base<T> tau;
+    T operator()( const T& alpha ) const
+    {
+        const Base<T> scale = Abs(alpha);
+        return ( scale <= tau ? T(0) : alpha-(alpha/scale)*tau );
+    }
+};
+
+template<typename Real>
+struct ClipOp
+{
+    Real lowerBound, upperBound;
+    Real operator()( const Real& alpha ) const
+    { return Max(lowerBound,Min(upperBound,alpha)); }
+};
+
+template<class E1,class E2>
+BinaryNode<SumOp,E1,E2>
+operator+( const Expression<E1>& A, const Expression<E2>& B )
+{ return BinaryNode<SumOp,E1,E2>( A.Self(), B.Self(), SumOp() ); }
+
+template<class E1,class E2>
+BinaryNode<DifferenceOp,E1,E2>
+operator-( const Expression<E1>& A, const Expression<E2>& B )
+{
+    return BinaryNode<DifferenceOp,E1,E2>
+      ( A.Self(), B.Self(), DifferenceOp() );
+}
+
+template<class E>
+UnaryNode<NegationOp,E>
+operator-( const Expression<E>& A )
+{ return UnaryNode<NegationOp,E>( A.Self(), NegationOp() ); }
+
+template<typename S,class E,
+         typename=EnableIf<IsScalar<S>>>
+UnaryNode<ScaleOp<typename E::Type>,E>
+operator*( const S& alpha, const Expression<E>& A )
+{
+    typedef typename E::Type T;
+    return UnaryNode<ScaleOp<T>,E>( A.Self(), ScaleOp<T>{T(alpha)} );
+}
+
+template<typename S,class E,
+         typename=EnableIf<IsScalar<S>>>
+UnaryNode<ScaleOp<typename E::Type>,E>
+operator*( const Expression<E>& A, const S& alpha )
+{ return alpha*A; }
+
+template<typename S,class E,
+         typename=EnableIf<IsScalar<S>>>
+UnaryNode<ShiftOp<typename E::Type>,E>
+operator+( const Expression<E>& A, const S& alpha )
+{
+    typedef typename E::Type T;
+    return UnaryNode<ShiftOp<T>,E>( A.Self(), ShiftOp<T>{T(alpha)} );
+}
+
+template<typename S,class E,
+         typename=EnableIf<IsScalar<S>>>
+UnaryNode<ShiftOp<typename E::Type>,E>
+operator-( const Expression<E>& A, const S& alpha )
+{
+    typedef typename E::Type T;
+    return UnaryNode<ShiftOp<T>,E>( A.Self(), ShiftOp<T>{-T(alpha)} );
+}
+
+// alpha A + B
+template<typename S,class E1,class E2>
+auto Axpy( const S& alpha, const Expression<E1>& A, const Expression<E2>& B )
+-> decltype(alpha*A+B)
+{ return alpha*A + B; }
+
+template<class E1,class E2>
+BinaryNode<HadamardOp,E1,E2>
+Hadamard( const Expression<E1>& A, const Expression<E2>& B )
+{ return BinaryNode<HadamardOp,E1,E2>( A.Self(), B.Self(), HadamardOp() ); }
+
+// The (inlinable) function is applied to each entry
+template<class E,class Function>
+UnaryNode<Function,E>
+EntrywiseMap( const Expression<E>& A, const Function& func )
+{ return UnaryNode<Function,E>( A.Self(), func ); }
+
+template<class E>
+UnaryNode<SoftThresholdOp<typename E::Type>,E>
+SoftThreshold( const Expression<E>& A, const Base<typename E::Type>& tau )
+{
+    typedef typename E::Type T;
+    return UnaryNode<SoftThresholdOp<T>,E>
+      ( A.Self(), SoftThresholdOp<T>{tau} );
+}
+
+template<class E>
+UnaryNode<ClipOp<typename E::Type>,E>
+Clip
+( const Expression<E>& A,
+  const typename E::Type& lowerBound,
+  const typename E::Type& upperBound )
+{
+    typedef typename E::Type Real;
+    return UnaryNode<ClipOp<Real>,E>
+      ( A.Self(), ClipOp<Real>{lowerBound,upperBound} );
+}
+
+// Evaluation
+// ==========
+template<typename T,class E>
+void Assign( Matrix<T>& A, const Expression<E>& expr )
+{
+    EL_DEBUG_CSE
+    const E& e = expr.Self();
+    const Int height = e.Height();
+    const Int width = e.Width();
+    A.Resize( height, width );
+    const Int ALDim = A.LDim();
+    T* ABuf = A.Buffer();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+    {
+        EL_SIMD
+        for( Int i=0; i<height; ++i )
+            ABuf[i+j*ALDim] = e(i,j);
+    }
+}
+
+// The target must already have the size, distribution, and alignments of the
+// operands
+template<typename T,class E>
+void Assign( ElementalMatrix<T>& A, const Expression<E>& expr )
+{
+    EL_DEBUG_CSE
+    const E& e = expr.Self();
+    if( !e.Conforms( A.DistData() ) )
+        LogicError("Operands of fused assignment must be distributed alike");
+    if( e.Height() != A.LocalHeight() || e.Width() != A.LocalWidth() )
+        LogicError("Nonconformal fused assignment");
+    Assign( A.Matrix(), expr );
+}
+
+// Reductions
+// ==========
+// The entries are split into one contiguous (column-major) chunk per thread,
+// each chunk is reduced independently, and the partial results are combined
+// afterwards
+inline Int NumReductionChunks( Int numEntries )
+{
+#ifdef EL_HYBRID
+    return Max( Min( Int(omp_get_max_threads()), numEntries ), Int(1) );
+#else
+    return 1;
+#endif
+}
+
+template<class E,class Function>
+void ReduceChunk( const E& e, Int chunk, Int numChunks, Function& func )
+{
+    const Int height = e.Height();
+    const Int numEntries = height*e.Width();
+    const Int chunkSize = numEntries/numChunks;
+    const Int remainder = numEntries % numChunks;
+    const Int beg = chunk*chunkSize + Min(chunk,remainder);
+    const Int end = beg + chunkSize + ( chunk < remainder ? 1 : 0 );
+    if( beg == end )
+        return;
+    for( Int j=beg/height; j*height<end; ++j )
+    {
+        const Int iBeg = Max( beg-j*height, Int(0) );
+        const Int iEnd = Min( end-j*height, height );
+        for( Int i=iBeg; i<iEnd; ++i )
+            func( e(i,j) );
+    }
+}
+
+template<class E>
+Base<typename E::Type> FrobeniusNorm( const Expression<E>& expr )
+{
+    EL_DEBUG_CSE
+    typedef typename E::Type T;
+    typedef Base<T> Real;
+    const E& e = expr.Self();
+    const auto dist = e.DistLeaf();
+    if( dist != nullptr && !e.Conforms( dist->DistData() ) )
+        LogicError("Operands of fused reduction must be distributed alike");
+
+    Real norm = 0;
+    if( dist == nullptr || dist->Participating() )
+    {
+        const Int numChunks = NumReductionChunks( e.Height()*e.Width() );
+        vector<Real> scales(numChunks,Real(0)),
+                     scaledSquares(numChunks,Real(1));
+        EL_PARALLEL_FOR
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            Real chunkScale = 0;
+            Real chunkScaledSquare = 1;
+            auto update = [&]( const T& alpha )
+              { UpdateScaledSquare( alpha, chunkScale, chunkScaledSquare ); };
+            ReduceChunk( e, chunk, numChunks, update );
+            scales[chunk] = chunkScale;
+            scaledSquares[chunk] = chunkScaledSquare;
+        }
+
+        // Equilibrate the partial scaled squares to the maximum scale
+        Real scale = 0;
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+            scale = Max( scale, scales[chunk] );
+        Real scaledSquare = 1;
+        if( scale != Real(0) )
+        {
+            scaledSquare = 0;
+            for( Int chunk=0; chunk<numChunks; ++chunk )
+            {
+                const Real relScale = scales[chunk]/scale;
+                scaledSquare += scaledSquares[chunk]*relScale*relScale;
+            }
+        }
+        if( dist == nullptr )
+            return scale*Sqrt(scaledSquare);
+
+        // Equilibrate the local scaled squares to the maximum scale
+        const Real maxScale =
+          mpi::AllReduce( scale, mpi::MAX, dist->DistComm() );
+        if( maxScale != Real(0) )
+        {
+            const Real relScale = scale/maxScale;
+            scaledSquare *= relScale*relScale;
+            scaledSquare = mpi::AllReduce( scaledSquare, dist->DistComm() );
+            norm = maxScale*Sqrt(scaledSquare);
+        }
+    }
+    mpi::Broadcast( norm, dist->Root(), dist->CrossComm() );
+    return norm;
+}
+
+template<class E>
+Base<typename E::Type> MaxNorm( const Expression<E>& expr )
+{
+    EL_DEBUG_CSE
+    typedef typename E::Type T;
+    typedef Base<T> Real;
+    const E& e = expr.Self();
+    const auto dist = e.DistLeaf();
+    if( dist != nullptr && !e.Conforms( dist->DistData() ) )
+        LogicError("Operands of fused reduction must be distributed alike");
+
+    Real norm = 0;
+    if( dist == nullptr || dist->Participating() )
+    {
+        const Int numChunks = NumReductionChunks( e.Height()*e.Width() );
+        vector<Real> maxAbs(numChunks,Real(0));
+        EL_PARALLEL_FOR
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            Real chunkMax = 0;
+            auto update = [&]( const T& alpha )
+              { chunkMax = Max( chunkMax, Abs(alpha) ); };
+            ReduceChunk( e, chunk, numChunks, update );
+            maxAbs[chunk] = chunkMax;
+        }
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+            norm = Max( norm, maxAbs[chunk] );
+        if( dist == nullptr )
+            return norm;
+        norm = mpi::AllReduce( norm, mpi::MAX, dist->DistComm() );
+    }
+    mpi::Broadcast( norm, dist->Root(), dist->CrossComm() );
+    return norm;
+}
+
+} // namespace fused
+} // namespace El
+
+#endif // ifndef EL_BLAS_FUSED_HPP
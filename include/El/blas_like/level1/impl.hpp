@@ -29,6 +29,7 @@
 #include <El/blas_like/level1/Fill.hpp>
 #include <El/blas_like/level1/FillDiagonal.hpp>
 #include <El/blas_like/level1/Full.hpp>
+#include <El/blas_like/level1/Fused.hpp>
 #include <El/blas_like/level1/GetDiagonal.hpp>
 #include <El/blas_like/level1/GetMappedDiagonal.hpp>
 #include <El/blas_like/level1/GetSubmatrix.hpp>
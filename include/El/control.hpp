@@ -13,6 +13,24 @@
 
 namespace El {
 
+// Control structure for the Sylvester and Lyapunov solvers which, unless
+// 'useSign' is true, follow the Bartels-Stewart approach: the coefficient
+// matrices are reduced to (quasi-)triangular form by Schur decompositions and
+// the resulting triangular Sylvester equation is solved recursively. Unlike
+// the sign-function approach, this only requires that the spectra of A and -B
+// be disjoint.
+template<typename Real>
+struct SylvesterCtrl
+{
+    bool useSign=false;
+    SignCtrl<Real> signCtrl;
+    SchurCtrl<Real> schurCtrl;
+
+    // Subproblems whose dimensions are both at most 'cutoff' are solved
+    // directly (and, in the distributed case, redundantly)
+    Int cutoff=64;
+};
+
 // Lyapunov
 // ========
 template<typename F>
@@ -28,6 +46,37 @@ void Lyapunov
         ElementalMatrix<F>& X,
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+template<typename F>
+void Lyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+template<typename F>
+void Lyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+
+// Solve A X + X A^H = C given the Schur decomposition A = Q T Q^H so that
+// the decomposition may be reused for many right-hand sides
+// (e.g., when forming the Gramians of a system)
+template<typename F>
+void LyapunovFromSchur
+( const Matrix<F>& T,
+  const Matrix<F>& Q,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl=SylvesterCtrl<Base<F>>() );
+template<typename F>
+void LyapunovFromSchur
+( const ElementalMatrix<F>& T,
+  const ElementalMatrix<F>& Q,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl=SylvesterCtrl<Base<F>>() );
+
 // Riccati
 // =======
 template<typename F>
@@ -82,6 +131,41 @@ void Sylvester
         ElementalMatrix<F>& X, 
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+template<typename F>
+void Sylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+template<typename F>
+void Sylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+
+// Triangular Sylvester
+// ====================
+// Overwrite C with the solution Y of A Y + Y op(B) = C, where A and B are
+// upper-triangular (or, for real fields, upper quasi-triangular in the
+// standard form produced by the real Schur decomposition).
+template<typename F>
+void TriangularSylvester
+( Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& C,
+  Int cutoff=64 );
+template<typename F>
+void TriangularSylvester
+( Orientation orientB,
+  const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+        ElementalMatrix<F>& C,
+  Int cutoff=64 );
+
 } // namespace El
 
 #endif // ifndef EL_CONTROL_HPP
@@ -284,6 +284,7 @@ class DistMatrix;
 #include <El/core/Grid.hpp>
 #include <El/core/DistMatrix.hpp>
 #include <El/core/Proxy.hpp>
+#include <El/core/MappedFile.hpp>
 
 // Implement the intertwined parts of the library
 #include <El/core/Element/impl.hpp>
@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_MAPPEDFILE_HPP
+#define EL_CORE_MAPPEDFILE_HPP
+
+namespace El {
+
+namespace MappedFileModeNS {
+enum MappedFileMode
+{
+    MAPPED_READ_ONLY,  // map an existing file without write access
+    MAPPED_READ_WRITE, // map an existing file and write through to it
+    MAPPED_CREATE      // create (or truncate) a file of the requested size
+};
+}
+using namespace MappedFileModeNS;
+
+namespace MappedAccessNS {
+enum MappedAccess
+{
+    NORMAL_ACCESS,
+    SEQUENTIAL_ACCESS, // e.g., streaming column panels from left to right
+    RANDOM_ACCESS
+};
+}
+using namespace MappedAccessNS;
+
+// A memory-mapped file which can back the storage of a Matrix (or the local
+// portion of a DistMatrix) that is too large to keep in memory. The mapping
+// is owned by this object, and so it must outlive any matrix attached to it.
+class MappedFile
+{
+public:
+    MappedFile();
+    MappedFile
+    ( const string& filename,
+      MappedFileMode mode=MAPPED_READ_ONLY, size_t numBytes=0 );
+    ~MappedFile();
+
+    void Open
+    ( const string& filename,
+      MappedFileMode mode=MAPPED_READ_ONLY, size_t numBytes=0 );
+    void Close();
+
+    // Flush any modified pages back to the file
+    void Sync();
+
+    // Hint at the access pattern of the entire mapping
+    void Advise( MappedAccess access );
+    // Request that the pages overlapping the given range be read ahead
+    void Prefetch( const void* buffer, size_t numBytes );
+    // Allow the pages overlapping the given range to be dropped from memory
+    void Evict( const void* buffer, size_t numBytes );
+
+    // Apply the above to the pages spanned by a view of an attached matrix
+    template<typename T> void Prefetch( const Matrix<T>& A );
+    template<typename T> void Evict( const Matrix<T>& A );
+
+    const string& Filename() const EL_NO_EXCEPT;
+    bool Mapped() const EL_NO_EXCEPT;
+    bool Writable() const EL_NO_EXCEPT;
+    size_t Size() const EL_NO_EXCEPT;
+    byte* Buffer( size_t offset=0 ) EL_NO_RELEASE_EXCEPT;
+    const byte* LockedBuffer( size_t offset=0 ) const EL_NO_RELEASE_EXCEPT;
+
+private:
+    string filename_;
+    bool writable_=false;
+    int fileDesc_=-1;
+    size_t size_=0;
+    byte* buffer_=nullptr;
+
+    MappedFile( const MappedFile& ) = delete;
+    MappedFile& operator=( const MappedFile& ) = delete;
+};
+
+// Attach a column-major (i.e., BINARY_FLAT) matrix stored at the given byte
+// offset of the file; read-only mappings result in a locked view
+template<typename T>
+void AttachToFile
+( Matrix<T>& A, Int height, Int width, MappedFile& file, size_t offset=0 );
+
+// Attach the local portion of a distributed matrix to a process-specific
+// file containing the column-major local matrix (with a leading dimension
+// equal to the local height)
+template<typename T>
+void AttachToFile
+( ElementalMatrix<T>& A, Int height, Int width, MappedFile& file,
+  int colAlign=0, int rowAlign=0, size_t offset=0 );
+
+// Implementations
+// ===============
+
+template<typename T>
+void MappedFile::Prefetch( const Matrix<T>& A )
+{
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    const T* begin = A.LockedBuffer();
+    const T* end = A.LockedBuffer(0,A.Width()-1) + A.Height();
+    Prefetch( begin, (end-begin)*sizeof(T) );
+}
+
+template<typename T>
+void MappedFile::Evict( const Matrix<T>& A )
+{
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    const T* begin = A.LockedBuffer();
+    const T* end = A.LockedBuffer(0,A.Width()-1) + A.Height();
+    Evict( begin, (end-begin)*sizeof(T) );
+}
+
+template<typename T>
+void AttachToFile
+( Matrix<T>& A, Int height, Int width, MappedFile& file, size_t offset )
+{
+    EL_DEBUG_CSE
+    const size_t numBytes = size_t(height)*width*sizeof(T);
+    if( offset+numBytes > file.Size() )
+        LogicError
+        ("Attaching a ",height," x ",width," matrix at offset ",offset,
+         " requires more than the ",file.Size()," bytes of ",file.Filename());
+    const Int ldim = Max(height,1);
+    if( file.Writable() )
+        A.Attach( height, width, (T*)file.Buffer(offset), ldim );
+    else
+        A.LockedAttach
+        ( height, width, (const T*)file.LockedBuffer(offset), ldim );
+}
+
+template<typename T>
+void AttachToFile
+( ElementalMatrix<T>& A, Int height, Int width, MappedFile& file,
+  int colAlign, int rowAlign, size_t offset )
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = A.Grid();
+    Int localHeight=0, localWidth=0;
+    if( A.Participating() )
+    {
+        localHeight = Length( height, A.ColRank(), colAlign, A.ColStride() );
+        localWidth = Length( width, A.RowRank(), rowAlign, A.RowStride() );
+    }
+    const size_t numBytes = size_t(localHeight)*localWidth*sizeof(T);
+    if( offset+numBytes > file.Size() )
+        LogicError
+        ("Attaching a ",localHeight," x ",localWidth," local matrix at ",
+         "offset ",offset," requires more than the ",file.Size()," bytes of ",
+         file.Filename());
+    const Int ldim = Max(localHeight,1);
+    if( file.Writable() )
+        A.Attach
+        ( height, width, grid, colAlign, rowAlign,
+          (T*)file.Buffer(offset), ldim );
+    else
+        A.LockedAttach
+        ( height, width, grid, colAlign, rowAlign,
+          (const T*)file.LockedBuffer(offset), ldim );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_MAPPEDFILE_HPP
@@ -83,6 +83,8 @@ typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
 typedef MPI_Status Status;
 typedef MPI_User_function UserFunction;
+typedef MPI_File File;
+typedef MPI_Offset Offset;
 
 template<typename T>
 struct Request
@@ -131,6 +133,10 @@ const Op LOGICAL_XOR = MPI_LXOR;
 const Op BINARY_AND = MPI_BAND;
 const Op BINARY_OR = MPI_BOR;
 const Op BINARY_XOR = MPI_BXOR;
+const int MODE_RDONLY = MPI_MODE_RDONLY;
+const int MODE_WRONLY = MPI_MODE_WRONLY;
+const int MODE_RDWR = MPI_MODE_RDWR;
+const int MODE_CREATE = MPI_MODE_CREATE;
 
 template<typename T>
 struct Types
@@ -228,6 +234,17 @@ void Create( UserFunction* func, bool commutes, Op& op ) EL_NO_RELEASE_EXCEPT;
 void Free( Op& op ) EL_NO_RELEASE_EXCEPT;
 void Free( Datatype& type ) EL_NO_RELEASE_EXCEPT;
 
+// Derived datatypes
+void Commit( Datatype& type ) EL_NO_RELEASE_EXCEPT;
+void CreateContiguous
+( int count, Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void CreateVector
+( int count, int blocklength, int stride,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void CreateHVector
+( int count, int blocklength, Aint stride,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+
 // Communicator manipulation
 int Rank( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
 int Size( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
@@ -285,6 +302,23 @@ void Translate
 // Utilities
 void Barrier( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
 
+// Parallel file I/O
+// NOTE: Since a failed file operation does not abort, errors (including
+//       short reads and writes) are always reported, even in release mode
+void FileOpen
+( Comm comm, const std::string& filename, int amode, File& file );
+void FileClose( File& file );
+Offset FileSize( File file );
+void FileSetSize( File file, Offset size );
+void FileSetView
+( File file, Offset disp, Datatype etype, Datatype filetype );
+void FileReadAt
+( File file, Offset offset, void* buf, int count, Datatype type );
+void FileWriteAt
+( File file, Offset offset, const void* buf, int count, Datatype type );
+void FileReadAll( File file, void* buf, int count, Datatype type );
+void FileWriteAll( File file, const void* buf, int count, Datatype type );
+
 template<typename T>
 void Wait( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
 
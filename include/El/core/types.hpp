@@ -498,6 +498,7 @@ enum FileFormat
     ASCII_MATLAB,
     BINARY,
     BINARY_FLAT,
+    BINARY_SPARSE,
     BMP,
     JPG,
     JPEG,
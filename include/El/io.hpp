@@ -146,8 +146,19 @@ void Write
 ( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
   FileFormat format=BINARY, string title="" );
 
+template<typename T>
+void Write
+( const SparseMatrix<T>& A, string basename="SparseMatrix",
+  FileFormat format=BINARY_SPARSE );
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename="DistSparseMatrix",
+  FileFormat format=BINARY_SPARSE );
+
 } // namespace El
 
+#include <El/io/Checkpoint.hpp>
+
 #ifdef EL_HAVE_QT5
 
 #include <El/io/DisplayWidget.hpp>
@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_CHECKPOINT_HPP
+#define EL_IO_CHECKPOINT_HPP
+
+namespace El {
+
+// A checkpoint consists of a text manifest, '<basename>.manifest', and one
+// binary file per process, '<basename>.<generation>.<rank>', which holds the
+// portion of each object owned by that process along with its global indices.
+//
+// Every commit writes a new generation of per-process files and only then
+// replaces the manifest, so that an interruption while writing leaves the
+// previous checkpoint intact. Since the global indices are stored, a
+// checkpoint may be read back onto a different number of processes, grid
+// shape, or distribution; when the layout is unchanged, each process simply
+// reads its own file.
+//
+// All of the member functions are collective over the communicator which
+// the checkpoint was opened with, which should be the (viewing) communicator
+// of the grids of the distributed objects.
+
+class CheckpointWriter
+{
+public:
+    CheckpointWriter
+    ( const string& basename, mpi::Comm comm=mpi::COMM_WORLD );
+    ~CheckpointWriter();
+
+    template<typename T>
+    void Write( const string& name, const Matrix<T>& A );
+    template<typename T>
+    void Write( const string& name, const AbstractDistMatrix<T>& A );
+    template<typename T>
+    void Write( const string& name, const DistMultiVec<T>& X );
+    template<typename T>
+    void Write( const string& name, const DistSparseMatrix<T>& A );
+
+    // Scalar state (e.g., an iteration count) which should be restored along
+    // with the objects. Only the value provided by the root is stored.
+    template<typename T>
+    void SetState( const string& name, const T& value );
+
+    // Write the manifest and remove the files of the previous generation
+    void Commit();
+
+private:
+    struct Record
+    {
+        string name, kind, type;
+        Int height, width;
+        Int offset;
+    };
+
+    string basename_;
+    mpi::Comm comm_;
+    Int generation_=0, prevGeneration_=-1;
+    int prevNumProcesses_=0;
+    std::ofstream file_;
+    vector<Record> records_;
+    vector<std::pair<string,string>> states_;
+    bool committed_=false;
+
+    // Record the location of a new section (or its absence on this process)
+    void AddRecord
+    ( const string& name, const string& kind, const string& type,
+      Int height, Int width, bool hasSection=true );
+    void AddState( const string& name, const string& value );
+    string Filename( Int generation, int rank ) const;
+};
+
+class CheckpointReader
+{
+public:
+    // Returns whether a committed checkpoint with the given basename exists
+    static bool Exists
+    ( const string& basename, mpi::Comm comm=mpi::COMM_WORLD );
+
+    CheckpointReader
+    ( const string& basename, mpi::Comm comm=mpi::COMM_WORLD );
+
+    bool Has( const string& name ) const;
+
+    // The target objects are resized but otherwise retain their grids and
+    // distributions
+    template<typename T>
+    void Read( const string& name, Matrix<T>& A ) const;
+    template<typename T>
+    void Read( const string& name, AbstractDistMatrix<T>& A ) const;
+    template<typename T>
+    void Read( const string& name, DistMultiVec<T>& X ) const;
+    template<typename T>
+    void Read( const string& name, DistSparseMatrix<T>& A ) const;
+
+    template<typename T>
+    T State( const string& name ) const;
+
+private:
+    struct Record
+    {
+        string name, kind, type;
+        Int height, width;
+        vector<Int> offsets;
+    };
+
+    string basename_;
+    mpi::Comm comm_;
+    Int generation_=0;
+    int numProcesses_=0;
+    vector<Record> records_;
+    vector<std::pair<string,string>> states_;
+
+    const Record& Find
+    ( const string& name, const string& kind, const string& type ) const;
+    string Filename( int rank ) const;
+    const string& StateString( const string& name ) const;
+};
+
+template<typename T>
+void CheckpointWriter::SetState( const string& name, const T& value )
+{
+    std::ostringstream os;
+    os.precision( std::numeric_limits<double>::max_digits10 );
+    os << value;
+    AddState( name, os.str() );
+}
+
+template<typename T>
+T CheckpointReader::State( const string& name ) const
+{
+    std::istringstream is( StateString(name) );
+    T value;
+    is >> value;
+    if( is.fail() )
+        RuntimeError("Could not parse checkpoint state ",name);
+    return value;
+}
+
+} // namespace El
+
+#endif // ifndef EL_IO_CHECKPOINT_HPP
@@ -86,6 +86,88 @@ void ApplyP
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Two-stage reduction to bidiagonal form
+// --------------------------------------
+// A = Q1 B P1^H, where B is upper-triangular with the requested bandwidth, is
+// computed with level-3 BLAS, and then B = Q2 T P2^H is computed by chasing
+// bulges down the band. A must be at least as tall as it is wide. On exit,
+// the main diagonal and superdiagonal of A contain the upper bidiagonal
+// matrix T, the reflectors of Q1 are packed below the diagonal of A, the
+// reflectors of P1 are packed to the right of the 'bandwidth'-th
+// superdiagonal, and the reflectors of Q2 and P2 are returned in
+// 'bulgeReflectors'.
+
+template<typename Field>
+struct BulgeReflectors
+{
+    Int bandwidth=1;
+
+    // The j'th sweep annihilates row j to the right of its superdiagonal and
+    // chases the resulting bulges down the band; the s'th left and right
+    // reflectors of the sweep have their unit-diagonal heads at index
+    // j+1+s*bandwidth and are stored (without the head) in column
+    // sweepOffsets[j]+s of 'reflectorsQ' and 'reflectorsP'
+    vector<Int> sweepOffsets;
+    Matrix<Field> reflectorsQ, householderScalarsQ;
+    Matrix<Field> reflectorsP, householderScalarsP;
+
+    // The distributed reduction instead spreads the roughly n^2 reflector
+    // entries over the processes, where they are stored in the same columns
+    // of 'distReflectorsQ' and 'distReflectorsP' (and rows of the scalars)
+    DistMatrix<Field,STAR,VR> distReflectorsQ, distReflectorsP;
+    DistMatrix<Field,VR,STAR> distHouseholderScalarsQ, distHouseholderScalarsP;
+};
+
+template<typename Field>
+void TwoStage
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalarsP,
+  Matrix<Field>& householderScalarsQ,
+  BulgeReflectors<Field>& bulgeReflectors,
+  Int bandwidth=0 );
+template<typename Field>
+void TwoStage
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalarsP,
+  AbstractDistMatrix<Field>& householderScalarsQ,
+  BulgeReflectors<Field>& bulgeReflectors,
+  Int bandwidth=0 );
+
+// Only overwrite A with its bidiagonal form, without keeping any of the
+// reflectors, e.g., when only the singular values are needed
+template<typename Field>
+void TwoStage( Matrix<Field>& A, Int bandwidth=0 );
+template<typename Field>
+void TwoStage( AbstractDistMatrix<Field>& A, Int bandwidth=0 );
+
+// B := Q1 Q2 B, e.g., to backtransform the left singular vectors of T
+template<typename Field>
+void TwoStageApplyQ
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalarsQ,
+  const BulgeReflectors<Field>& bulgeReflectors,
+        Matrix<Field>& B );
+template<typename Field>
+void TwoStageApplyQ
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalarsQ,
+  const BulgeReflectors<Field>& bulgeReflectors,
+        AbstractDistMatrix<Field>& B );
+
+// B := P1 P2 B, e.g., to backtransform the right singular vectors of T
+template<typename Field>
+void TwoStageApplyP
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalarsP,
+  const BulgeReflectors<Field>& bulgeReflectors,
+        Matrix<Field>& B );
+template<typename Field>
+void TwoStageApplyP
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalarsP,
+  const BulgeReflectors<Field>& bulgeReflectors,
+        AbstractDistMatrix<Field>& B );
+
 } // namespace bidiag
 
 // HermitianTridiag
@@ -107,6 +189,14 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+
+    // Reduce to a band of width 'bandwidth' with level-3 BLAS before chasing
+    // the band down to tridiagonal form (see herm_tridiag::TwoStage). This
+    // is only used by ExplicitCondensed and HermitianEig, as the result
+    // cannot be expressed in the packed format of HermitianTridiag. A
+    // bandwidth of zero selects the algorithmic blocksize.
+    bool twoStage=false;
+    Int bandwidth=0;
 };
 
 template<typename Field>
@@ -122,7 +212,9 @@ void HermitianTridiag
 namespace herm_tridiag {
 
 template<typename Field>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<Field>& A );
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<Field>& A,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
 template<typename Field>
 void ExplicitCondensed
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
@@ -141,6 +233,64 @@ void ApplyQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Two-stage reduction to tridiagonal form
+// ---------------------------------------
+// A = Q1 B Q1^H, where B has the requested bandwidth, is computed with
+// level-3 BLAS, and then B = Q2 T Q2^H is computed by chasing bulges down the
+// band. On exit, the main diagonal and the first sub- and super-diagonals of
+// A contain T, the reflectors of Q1 are packed below the 'bandwidth'-th
+// subdiagonal of A (regardless of 'uplo'), and the reflectors of Q2 are
+// returned in 'bulgeReflectors'.
+
+template<typename Field>
+struct BulgeReflectors
+{
+    Int bandwidth=1;
+
+    // The j'th sweep annihilates column j and chases the resulting bulge down
+    // the band; its s'th reflector has the unit-diagonal head at row
+    // j+1+s*bandwidth and is stored (without the head) in column
+    // sweepOffsets[j]+s of 'reflectors'
+    vector<Int> sweepOffsets;
+    Matrix<Field> reflectors;
+    Matrix<Field> householderScalars;
+
+    // The distributed reduction instead spreads the roughly n^2/2 reflector
+    // entries over the processes, where they are stored in the same columns
+    // of 'distReflectors' (and rows of 'distHouseholderScalars')
+    DistMatrix<Field,STAR,VR> distReflectors;
+    DistMatrix<Field,VR,STAR> distHouseholderScalars;
+};
+
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  BulgeReflectors<Field>& bulgeReflectors,
+  Int bandwidth=0 );
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  BulgeReflectors<Field>& bulgeReflectors,
+  Int bandwidth=0 );
+
+// B := Q1 Q2 B, e.g., to backtransform the eigenvectors of T
+template<typename Field>
+void TwoStageApplyQ
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const BulgeReflectors<Field>& bulgeReflectors,
+        Matrix<Field>& B );
+template<typename Field>
+void TwoStageApplyQ
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const BulgeReflectors<Field>& bulgeReflectors,
+        AbstractDistMatrix<Field>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -57,6 +57,31 @@ void HPSDCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
 
+// Out-of-core factorization
+// -------------------------
+// The matrix is attached to 'file' (see AttachToFile), and, for a DistMatrix,
+// each process attaches its local matrix to its own file. Column panels are
+// streamed through memory in a left-looking fashion, with the next panel
+// prefetched while the current one is updated, and the factor is written back
+// into the file.
+struct OutOfCoreCtrl
+{
+    // If positive, the number of columns in each streamed panel; otherwise,
+    // the panels are made as wide as possible while keeping three of them
+    // within 'memoryBudget' bytes (per process)
+    Int panelWidth=0;
+    size_t memoryBudget=size_t(1)<<30;
+};
+
+template<typename Field>
+void Cholesky
+( UpperOrLower uplo, Matrix<Field>& A, MappedFile& file,
+  const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+template<typename Field>
+void Cholesky
+( UpperOrLower uplo, DistMatrix<Field>& A, MappedFile& file,
+  const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+
 namespace cholesky {
 
 template<typename Field>
@@ -87,6 +112,25 @@ void SolveAfter
   const DistPermutation& P,
         AbstractDistMatrix<Field>& B );
 
+// Solve using an out-of-core factor, which is streamed in one column panel
+// at a time for each of the two triangular solves
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        MappedFile& file,
+        Matrix<Field>& B,
+  const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const DistMatrix<Field>& A,
+        MappedFile& file,
+        AbstractDistMatrix<Field>& B,
+  const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+
 } // namespace cholesky
 
 // LDL
@@ -377,6 +421,20 @@ void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
 
+// Out-of-core LU with partial pivoting
+// ------------------------------------
+// See the out-of-core Cholesky factorization for the storage requirements.
+// The row swaps from each panel are applied to the previously-factored
+// panels the next time that they are streamed in.
+template<typename Field>
+void LU
+( Matrix<Field>& A, Permutation& P, MappedFile& file,
+  const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+template<typename Field>
+void LU
+( DistMatrix<Field>& A, DistPermutation& P, MappedFile& file,
+  const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+
 // LU with full pivoting
 // ---------------------
 // P A Q^T = L U
@@ -443,6 +501,25 @@ void SolveAfter
   const DistPermutation& P,
         AbstractDistMatrix<Field>& B );
 
+// Solve linear systems using an out-of-core partially-pivoted LU factorization
+// ----------------------------------------------------------------------------
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Permutation& P,
+        MappedFile& file,
+        Matrix<Field>& B,
+  const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const DistMatrix<Field>& A,
+  const DistPermutation& P,
+        MappedFile& file,
+        AbstractDistMatrix<Field>& B,
+  const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+
 // Solve linear systems using an implicit fully-pivoted LU factorization
 // ---------------------------------------------------------------------
 template<typename Field>
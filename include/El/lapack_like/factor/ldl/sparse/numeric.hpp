@@ -511,6 +511,9 @@ public:
     void MultiplyWithD
     ( Orientation orientation, ldl::MatrixNode<Field>& B ) const;
 
+    // Return the inertia of the (Hermitian) factored matrix.
+    InertiaType Inertia() const;
+
     // TODO(poulson): Apply permutation?
 
     bool Factored() const;
@@ -633,6 +636,9 @@ public:
     void MultiplyWithD
     ( Orientation orientation, ldl::DistMatrixNode<Field>& B ) const;
 
+    // Return the inertia of the (Hermitian) factored matrix.
+    InertiaType Inertia() const;
+
     // TODO(poulson): Apply permutation?
 
     bool Factored() const;
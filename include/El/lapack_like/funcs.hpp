@@ -44,14 +44,91 @@ struct SquareRootCtrl
 
 // Hermitian function
 // ==================
+
+// Rather than forming an eigendecomposition, a real-valued function of a
+// Hermitian matrix can be approximated with a Chebyshev expansion,
+//
+//   f(A) ~= sum_{k=0}^{d} c_k T_k((A - center I) / radius),
+//
+// over an interval [center-radius,center+radius] containing the spectrum of
+// A, which only requires products with A.
+template<typename Real>
+struct HermitianFunctionCtrl
+{
+    // Use a Chebyshev expansion within HermitianFunction rather than an
+    // eigendecomposition? ApplyHermitianFunction always uses the expansion.
+    // An expansion of degree d is formed with roughly 2 sqrt(d) matrix-matrix
+    // products (via the Paterson-Stockmeyer scheme), but sqrt(d) copies of A
+    // must be stored.
+    bool chebyshev=false;
+
+    // The degree of the expansion. If zero, the degree is chosen so that the
+    // neglected coefficients are at most 'tol' times the largest coefficient
+    // (up to 'maxDegree').
+    Int degree=0;
+    Int maxDegree=1000;
+    Real tol=Real(0); // If zero, epsilon is used
+
+    // Damp the coefficients with the Jackson kernel in order to suppress the
+    // Gibbs oscillations of functions which are not smooth
+    bool jackson=false;
+
+    // An interval containing the spectrum of A. If lowerBound >= upperBound,
+    // the union of the Gershgorin discs of A is used, which is guaranteed to
+    // contain the spectrum but can be pessimistic. If basisSize is positive,
+    // the union is further intersected with the extremal Ritz values (widened
+    // by their residuals) of a Lanczos decomposition of the given size, which
+    // is much tighter but can leave eigenvalues just outside of the interval
+    // when the Ritz values have not converged.
+    Real lowerBound=Real(0);
+    Real upperBound=Real(0);
+    Int basisSize=0;
+
+    bool progress=false;
+};
+
 template<typename Field>
 void HermitianFunction
 ( UpperOrLower uplo, Matrix<Field>& A,
-  function<Base<Field>(const Base<Field>&)> func );
+  function<Base<Field>(const Base<Field>&)> func,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl=
+        HermitianFunctionCtrl<Base<Field>>() );
 template<typename Field>
 void HermitianFunction
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
-  function<Base<Field>(const Base<Field>&)> func );
+  function<Base<Field>(const Base<Field>&)> func,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl=
+        HermitianFunctionCtrl<Base<Field>>() );
+
+// B := f(A) B using a Chebyshev expansion of f
+template<typename Field>
+void ApplyHermitianFunction
+( UpperOrLower uplo, const Matrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+  Matrix<Field>& B,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl=
+        HermitianFunctionCtrl<Base<Field>>() );
+template<typename Field>
+void ApplyHermitianFunction
+( UpperOrLower uplo, const AbstractDistMatrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+  AbstractDistMatrix<Field>& B,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl=
+        HermitianFunctionCtrl<Base<Field>>() );
+template<typename Field>
+void ApplyHermitianFunction
+( const SparseMatrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+  Matrix<Field>& B,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl=
+        HermitianFunctionCtrl<Base<Field>>() );
+template<typename Field>
+void ApplyHermitianFunction
+( const DistSparseMatrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+  DistMultiVec<Field>& B,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl=
+        HermitianFunctionCtrl<Base<Field>>() );
 
 template<typename Real>
 void HermitianFunction
@@ -228,12 +228,35 @@ typedef struct {
 } ElHermitianSDCCtrl_d;
 EL_EXPORT ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl );
 
+/* HermitianSliceCtrl */
+typedef struct {
+  ElInt numSlices;
+  ElInt teamSize;
+  ElInt degree;
+  ElInt maxIts;
+  float tol;
+  bool progress;
+} ElHermitianSliceCtrl_s;
+EL_EXPORT ElError ElHermitianSliceCtrlDefault_s( ElHermitianSliceCtrl_s* ctrl );
+
+typedef struct {
+  ElInt numSlices;
+  ElInt teamSize;
+  ElInt degree;
+  ElInt maxIts;
+  double tol;
+  bool progress;
+} ElHermitianSliceCtrl_d;
+EL_EXPORT ElError ElHermitianSliceCtrlDefault_d( ElHermitianSliceCtrl_d* ctrl );
+
 /* HermitianEigCtrl */
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianTridiagEigCtrl_s tridiagEigCtrl;
   ElHermitianSDCCtrl_s sdcCtrl;
+  ElHermitianSliceCtrl_s sliceCtrl;
   bool useSDC;
+  bool useSlicing;
 } ElHermitianEigCtrl_s;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl );
 
@@ -241,7 +264,9 @@ typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianTridiagEigCtrl_d tridiagEigCtrl;
   ElHermitianSDCCtrl_d sdcCtrl;
+  ElHermitianSliceCtrl_d sliceCtrl;
   bool useSDC;
+  bool useSlicing;
 } ElHermitianEigCtrl_d;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl );
 
@@ -249,7 +274,9 @@ typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianTridiagEigCtrl_s tridiagEigCtrl;
   ElHermitianSDCCtrl_s sdcCtrl;
+  ElHermitianSliceCtrl_s sliceCtrl;
   bool useSDC;
+  bool useSlicing;
 } ElHermitianEigCtrl_c;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_c( ElHermitianEigCtrl_c* ctrl );
 
@@ -257,7 +284,9 @@ typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianTridiagEigCtrl_d tridiagEigCtrl;
   ElHermitianSDCCtrl_d sdcCtrl;
+  ElHermitianSliceCtrl_d sliceCtrl;
   bool useSDC;
+  bool useSlicing;
 } ElHermitianEigCtrl_z;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_z( ElHermitianEigCtrl_z* ctrl );
 
@@ -507,10 +536,21 @@ typedef struct {
 } ElQDWHCtrl;
 EL_EXPORT ElError ElQDWHCtrlDefault( ElQDWHCtrl* ctrl );
 
+/* ZoloCtrl */
+typedef struct {
+  ElInt numTerms;
+  ElInt numSubgrids;
+  ElInt maxIts;
+  bool progress;
+} ElZoloCtrl;
+EL_EXPORT ElError ElZoloCtrlDefault( ElZoloCtrl* ctrl );
+
 /* PolarCtrl */
 typedef struct {
   bool qdwh;
   ElQDWHCtrl qdwhCtrl;
+  bool zolo;
+  ElZoloCtrl zoloCtrl;
 } ElPolarCtrl;
 EL_EXPORT ElError ElPolarCtrlDefault( ElPolarCtrl* ctrl );
 
@@ -521,9 +561,18 @@ typedef struct {
   ElInt numCholIts;
 } ElQDWHInfo;
 
+/* ZoloInfo */
+typedef struct {
+  ElInt numIts;
+  ElInt numTerms;
+  ElInt numQRIts;
+  ElInt numCholIts;
+} ElZoloInfo;
+
 /* PolarInfo */
 typedef struct {
   ElQDWHInfo qdwhInfo;
+  ElZoloInfo zoloInfo;
 } ElPolarInfo;
 
 /* Compute just the polar factor
@@ -800,6 +849,23 @@ EL_EXPORT ElError ElBidiagSVDCtrlDefault_d( ElBidiagSVDCtrl_d* ctrl );
 /* Singular Value Decomposition (SVD)
    ================================== */
 
+/* JacobiSVDCtrl */
+typedef struct {
+  ElInt blocksize;
+  ElInt maxSweeps;
+  float tol;
+  bool progress;
+} ElJacobiSVDCtrl_s;
+EL_EXPORT ElError ElJacobiSVDCtrlDefault_s( ElJacobiSVDCtrl_s* ctrl );
+
+typedef struct {
+  ElInt blocksize;
+  ElInt maxSweeps;
+  double tol;
+  bool progress;
+} ElJacobiSVDCtrl_d;
+EL_EXPORT ElError ElJacobiSVDCtrlDefault_d( ElJacobiSVDCtrl_d* ctrl );
+
 /* SVDCtrl */
 typedef struct {
   bool overwrite;
@@ -811,6 +877,12 @@ typedef struct {
   double valChanRatio;
   double fullChanRatio;
 
+  bool twoStageBidiag;
+  ElInt bidiagBandwidth;
+
+  bool useJacobi;
+  ElJacobiSVDCtrl_s jacobiCtrl;
+
   ElBidiagSVDCtrl_s bidiagSVDCtrl;
 } ElSVDCtrl_s;
 EL_EXPORT ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl );
@@ -825,6 +897,12 @@ typedef struct {
   double valChanRatio;
   double fullChanRatio;
 
+  bool twoStageBidiag;
+  ElInt bidiagBandwidth;
+
+  bool useJacobi;
+  ElJacobiSVDCtrl_d jacobiCtrl;
+
   ElBidiagSVDCtrl_d bidiagSVDCtrl;
 } ElSVDCtrl_d;
 EL_EXPORT ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl );
@@ -1045,6 +1123,9 @@ typedef struct {
   ElInt basisSize;
   bool reorthog;
 
+  ElInt teamSize;
+  ElInt batchSize;
+
   bool progress;
 
   ElSnapshotCtrl snapCtrl;
@@ -1070,6 +1151,9 @@ typedef struct {
   ElInt basisSize;
   bool reorthog;
 
+  ElInt teamSize;
+  ElInt batchSize;
+
   bool progress;
 
   ElSnapshotCtrl snapCtrl;
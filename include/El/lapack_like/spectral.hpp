@@ -407,14 +407,35 @@ struct HermitianSDCCtrl
     bool progress=false;
 };
 
+// Spectrum slicing splits the value range of a subset into slices whose
+// eigenvalues are counted using the inertia of A - sigma I. The processes
+// are split into teams of teamSize processes, which each hold a copy of A and
+// compute the eigenpairs of their slices using Chebyshev-filtered subspace
+// iteration (rather than reducing the entire matrix to tridiagonal form).
+// Since each of the numSlices+1 inertias is a dense O(n^3) factorization,
+// slicing only pays off when the slices are few.
+template<typename Real>
+struct HermitianSliceCtrl
+{
+    Int numSlices=0; // 0 selects one slice per team
+    Int teamSize=0; // 0 selects a single team containing every process
+    Int degree=0; // 0 selects the filter degree from the width of each slice
+    Int maxIts=20;
+    Real tol=Real(0); // 0 selects eps^(3/4)
+    bool progress=false;
+};
+
 template<typename Field>
 struct HermitianEigCtrl
 {
     HermitianTridiagCtrl<Field> tridiagCtrl;
     HermitianTridiagEigCtrl<Base<Field>> tridiagEigCtrl;
     HermitianSDCCtrl<Base<Field>> sdcCtrl;
+    HermitianSliceCtrl<Base<Field>> sliceCtrl;
     bool useScaLAPACK=false;
     bool useSDC=false;
+    // Only used for distributed eigenpair computations with a value range
+    bool useSlicing=false;
     bool timeStages=false;
 };
 
@@ -589,10 +610,27 @@ struct QDWHCtrl
     Int maxIts=20;
 };
 
+// The Zolotarev-based polar decomposition (Zolo-PD) requires only one or two
+// iterations, each of which applies numTerms independent QR or Cholesky-based
+// updates. The distributed implementation computes the terms concurrently on
+// up to numSubgrids subgrids.
+struct ZoloCtrl
+{
+    // If zero, the smallest number of terms (at most eight) which is
+    // predicted to converge in two iterations is used
+    Int numTerms=0;
+    // If zero, one subgrid is used per term (when possible)
+    Int numSubgrids=0;
+    Int maxIts=20;
+    bool progress=false;
+};
+
 struct PolarCtrl
 {
     bool qdwh=false;
     QDWHCtrl qdwhCtrl;
+    bool zolo=false;
+    ZoloCtrl zoloCtrl;
 };
 
 struct QDWHInfo
@@ -602,9 +640,18 @@ struct QDWHInfo
     Int numCholIts=0;
 };
 
+struct ZoloInfo
+{
+    Int numIts=0;
+    Int numTerms=0;
+    Int numQRIts=0;
+    Int numCholIts=0;
+};
+
 struct PolarInfo
 {
     QDWHInfo qdwhInfo;
+    ZoloInfo zoloInfo;
 };
 
 template<typename Field>
@@ -1214,6 +1261,25 @@ struct SVDInfo
     BidiagSVDInfo bidiagSVDInfo;
 };
 
+// Blocked one-sided Jacobi
+// ------------------------
+template<typename Real>
+struct JacobiSVDCtrl
+{
+    // The number of columns in each block. The blocks are widened if needed
+    // so that there are at most two per process, and zero selects the
+    // narrowest such width.
+    Int blocksize=0;
+
+    Int maxSweeps=30;
+
+    // A pair of blocks is considered orthogonal once the largest cosine
+    // between their columns is at most 'tol'. If zero, n eps is used.
+    Real tol=Real(0);
+
+    bool progress=false;
+};
+
 template<typename Real>
 struct SVDCtrl
 {
@@ -1237,6 +1303,26 @@ struct SVDCtrl
     // decomposition when computing a full SVD
     double fullChanRatio=1.5;
 
+    // Golub-Reinsch
+    // -------------
+
+    // Reduce to an upper-triangular band of width 'bidiagBandwidth' with
+    // level-3 BLAS before chasing the band down to bidiagonal form (see
+    // bidiag::TwoStage). This is currently only used when A is at least as
+    // tall as it is wide. A bandwidth of zero selects the algorithmic
+    // blocksize.
+    bool twoStageBidiag=false;
+    Int bidiagBandwidth=0;
+
+    // Blocked one-sided Jacobi
+    // ------------------------
+
+    // Compute distributed SVDs by preconditioning with a column-pivoted QR
+    // decomposition and then orthogonalizing the columns of R with a blocked
+    // one-sided Jacobi method (see svd::Jacobi) rather than bidiagonalizing
+    bool useJacobi=false;
+    JacobiSVDCtrl<Real> jacobiCtrl;
+
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
 };
 
@@ -1488,6 +1574,103 @@ Base<Field> LanczosDecomp
         DistMultiVec<Field>& v,
         Int basisSize=15 );
 
+// Thick-restart block Lanczos
+// ---------------------------
+// Compute the 'numEigs' eigenpairs from one end of the spectrum of the
+// (explicitly) Hermitian matrix A using a block Krylov subspace which is
+// restarted with the wanted Ritz vectors (and as many of their neighbors as
+// fit in half of the free space) whenever the basis is full. Each block is
+// orthonormalized against the entire basis (twice) and then with CholeskyQR2.
+// The number of restarts is returned.
+
+template<typename Real>
+struct BlockLanczosCtrl
+{
+    Int blockSize=4;
+
+    // The maximum number of basis vectors. Zero selects
+    // max(2 numEigs,numEigs+3 blockSize).
+    Int basisSize=0;
+
+    Int maxRestarts=100;
+
+    // A Ritz pair (theta,x) has converged once
+    //
+    //   || A x - theta x ||_2 <= tol max_i |theta_i|,
+    //
+    // where the maximum is over all of the Ritz values computed so far. Zero
+    // selects eps^{3/4}.
+    Real tol=Real(0);
+
+    // Compute the smallest (rather than the largest) eigenvalues?
+    bool smallest=true;
+
+    bool progress=false;
+};
+
+template<typename Field>
+Int BlockLanczos
+( const SparseMatrix<Field>& A,
+        Int numEigs,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() );
+template<typename Field>
+Int BlockLanczos
+( const DistSparseMatrix<Field>& A,
+        Int numEigs,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() );
+
+// Spectrum slicing
+// ----------------
+// Compute the eigenpairs of a (explicitly) Hermitian sparse matrix whose
+// eigenvalues lie in the half-open interval [lowerBound,upperBound) without
+// forming A densely. The interval is split into slices of equal length, the
+// number of eigenvalues in each slice is counted from the inertia of sparse
+// LDL^H factorizations of A shifted by the slice boundaries, and then the
+// eigenpairs of each slice are computed with block Lanczos on the inverse of
+// A shifted by the lower boundary of the slice. A slice is only accepted once
+// each of its eigenpairs satisfies || A x - lambda x ||_2 <= tol || A ||_1,
+// where tol is that of lanczosCtrl, and it is otherwise recomputed with a
+// smaller Lanczos tolerance.
+//
+// The processes are split into teams which each redundantly store A and
+// process a disjoint subset of the slices; each team only forms a single
+// nested dissection, which is reused for every shift. The eigenvalues are
+// returned in ascending order.
+
+template<typename Real>
+struct HermitianSliceEigCtrl
+{
+    // Zero selects one slice per team
+    Int numSlices=0;
+
+    // The number of processes in each team, which must evenly divide the
+    // number of processes. Zero selects a single team.
+    Int teamSize=0;
+
+    LDLFrontType frontType=LDL_2D;
+    BisectCtrl bisectCtrl;
+
+    // The 'smallest' member is ignored, as the eigenvalues of each slice
+    // correspond to the largest eigenvalues of the shifted inverse
+    BlockLanczosCtrl<Real> lanczosCtrl;
+
+    bool progress=false;
+};
+
+template<typename Field>
+void HermitianSliceEig
+( const DistSparseMatrix<Field>& A,
+        Base<Field> lowerBound,
+        Base<Field> upperBound,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const HermitianSliceEigCtrl<Base<Field>>& ctrl=
+        HermitianSliceEigCtrl<Base<Field>>() );
+
 // Product Lanczos
 // ===============
 // Form the product Lanczos decomposition
@@ -1606,6 +1789,13 @@ struct PseudospecCtrl
     Int basisSize=10;
     bool reorthog=true; // only matters for IRL, which isn't currently used
 
+    // If teamSize is neither zero nor the size of the grid, the processes are
+    // split into teams of teamSize processes which each hold a copy of the
+    // (quasi-)triangular or Hessenberg matrix and handle batches of batchSize
+    // shifts at a time (batchSize=0 selects roughly four batches per team)
+    Int teamSize=0;
+    Int batchSize=0;
+
     // Whether or not to print progress information at each iteration
     bool progress=false;
 
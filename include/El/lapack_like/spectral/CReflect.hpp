@@ -382,6 +382,57 @@ inline HermitianSDCCtrl<double> CReflect( const ElHermitianSDCCtrl_d& ctrlC )
     return ctrl;
 }
 
+/* HermitianSliceCtrl */
+inline ElHermitianSliceCtrl_s
+CReflect( const HermitianSliceCtrl<float>& ctrl )
+{
+    ElHermitianSliceCtrl_s ctrlC;
+    ctrlC.numSlices = ctrl.numSlices;
+    ctrlC.teamSize = ctrl.teamSize;
+    ctrlC.degree = ctrl.degree;
+    ctrlC.maxIts = ctrl.maxIts;
+    ctrlC.tol = ctrl.tol;
+    ctrlC.progress = ctrl.progress;
+    return ctrlC;
+}
+inline ElHermitianSliceCtrl_d
+CReflect( const HermitianSliceCtrl<double>& ctrl )
+{
+    ElHermitianSliceCtrl_d ctrlC;
+    ctrlC.numSlices = ctrl.numSlices;
+    ctrlC.teamSize = ctrl.teamSize;
+    ctrlC.degree = ctrl.degree;
+    ctrlC.maxIts = ctrl.maxIts;
+    ctrlC.tol = ctrl.tol;
+    ctrlC.progress = ctrl.progress;
+    return ctrlC;
+}
+
+inline HermitianSliceCtrl<float>
+CReflect( const ElHermitianSliceCtrl_s& ctrlC )
+{
+    HermitianSliceCtrl<float> ctrl;
+    ctrl.numSlices = ctrlC.numSlices;
+    ctrl.teamSize = ctrlC.teamSize;
+    ctrl.degree = ctrlC.degree;
+    ctrl.maxIts = ctrlC.maxIts;
+    ctrl.tol = ctrlC.tol;
+    ctrl.progress = ctrlC.progress;
+    return ctrl;
+}
+inline HermitianSliceCtrl<double>
+CReflect( const ElHermitianSliceCtrl_d& ctrlC )
+{
+    HermitianSliceCtrl<double> ctrl;
+    ctrl.numSlices = ctrlC.numSlices;
+    ctrl.teamSize = ctrlC.teamSize;
+    ctrl.degree = ctrlC.degree;
+    ctrl.maxIts = ctrlC.maxIts;
+    ctrl.tol = ctrlC.tol;
+    ctrl.progress = ctrlC.progress;
+    return ctrl;
+}
+
 /* HermitianEigCtrl */
 inline ElHermitianEigCtrl_s CReflect( const HermitianEigCtrl<float>& ctrl )
 {
@@ -389,7 +440,9 @@ inline ElHermitianEigCtrl_s CReflect( const HermitianEigCtrl<float>& ctrl )
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.tridiagEigCtrl = CReflect( ctrl.tridiagEigCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.sliceCtrl = CReflect( ctrl.sliceCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useSlicing = ctrl.useSlicing;
     return ctrlC;
 }
 
@@ -399,7 +452,9 @@ inline ElHermitianEigCtrl_d CReflect( const HermitianEigCtrl<double>& ctrl )
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.tridiagEigCtrl = CReflect( ctrl.tridiagEigCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.sliceCtrl = CReflect( ctrl.sliceCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useSlicing = ctrl.useSlicing;
     return ctrlC;
 }
 inline ElHermitianEigCtrl_c
@@ -409,7 +464,9 @@ CReflect( const HermitianEigCtrl<Complex<float>>& ctrl )
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.tridiagEigCtrl = CReflect( ctrl.tridiagEigCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.sliceCtrl = CReflect( ctrl.sliceCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useSlicing = ctrl.useSlicing;
     return ctrlC;
 }
 inline ElHermitianEigCtrl_z
@@ -419,7 +476,9 @@ CReflect( const HermitianEigCtrl<Complex<double>>& ctrl )
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.tridiagEigCtrl = CReflect( ctrl.tridiagEigCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.sliceCtrl = CReflect( ctrl.sliceCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useSlicing = ctrl.useSlicing;
     return ctrlC;
 }
 
@@ -429,7 +488,9 @@ inline HermitianEigCtrl<float> CReflect( const ElHermitianEigCtrl_s& ctrlC )
     ctrl.tridiagCtrl = CReflect<float>( ctrlC.tridiagCtrl );
     ctrl.tridiagEigCtrl = CReflect( ctrlC.tridiagEigCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.sliceCtrl = CReflect( ctrlC.sliceCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useSlicing = ctrlC.useSlicing;
     return ctrl;
 }
 inline HermitianEigCtrl<double> CReflect( const ElHermitianEigCtrl_d& ctrlC )
@@ -438,7 +499,9 @@ inline HermitianEigCtrl<double> CReflect( const ElHermitianEigCtrl_d& ctrlC )
     ctrl.tridiagCtrl = CReflect<double>( ctrlC.tridiagCtrl );
     ctrl.tridiagEigCtrl = CReflect( ctrlC.tridiagEigCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.sliceCtrl = CReflect( ctrlC.sliceCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useSlicing = ctrlC.useSlicing;
     return ctrl;
 }
 inline HermitianEigCtrl<Complex<float>>
@@ -448,7 +511,9 @@ CReflect( const ElHermitianEigCtrl_c& ctrlC )
     ctrl.tridiagCtrl = CReflect<Complex<float>>( ctrlC.tridiagCtrl );
     ctrl.tridiagEigCtrl = CReflect( ctrlC.tridiagEigCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.sliceCtrl = CReflect( ctrlC.sliceCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useSlicing = ctrlC.useSlicing;
     return ctrl;
 }
 inline HermitianEigCtrl<Complex<double>>
@@ -458,7 +523,9 @@ CReflect( const ElHermitianEigCtrl_z& ctrlC )
     ctrl.tridiagCtrl = CReflect<Complex<double>>( ctrlC.tridiagCtrl );
     ctrl.tridiagEigCtrl = CReflect( ctrlC.tridiagEigCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.sliceCtrl = CReflect( ctrlC.sliceCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useSlicing = ctrlC.useSlicing;
     return ctrl;
 }
 
@@ -479,12 +546,35 @@ inline QDWHCtrl CReflect( const ElQDWHCtrl& ctrlC )
     return ctrl;
 }
 
+/* ZoloCtrl */
+inline ElZoloCtrl CReflect( const ZoloCtrl& ctrl )
+{
+    ElZoloCtrl ctrlC;
+    ctrlC.numTerms = ctrl.numTerms;
+    ctrlC.numSubgrids = ctrl.numSubgrids;
+    ctrlC.maxIts = ctrl.maxIts;
+    ctrlC.progress = ctrl.progress;
+    return ctrlC;
+}
+
+inline ZoloCtrl CReflect( const ElZoloCtrl& ctrlC )
+{
+    ZoloCtrl ctrl;
+    ctrl.numTerms = ctrlC.numTerms;
+    ctrl.numSubgrids = ctrlC.numSubgrids;
+    ctrl.maxIts = ctrlC.maxIts;
+    ctrl.progress = ctrlC.progress;
+    return ctrl;
+}
+
 /* PolarCtrl */
 inline ElPolarCtrl CReflect( const PolarCtrl& ctrl )
 {
     ElPolarCtrl ctrlC;
     ctrlC.qdwh = ctrl.qdwh;
     ctrlC.qdwhCtrl = CReflect(ctrl.qdwhCtrl);
+    ctrlC.zolo = ctrl.zolo;
+    ctrlC.zoloCtrl = CReflect(ctrl.zoloCtrl);
     return ctrlC;
 }
 
@@ -493,6 +583,8 @@ inline PolarCtrl CReflect( const ElPolarCtrl& ctrlC )
     PolarCtrl ctrl;
     ctrl.qdwh = ctrlC.qdwh;
     ctrl.qdwhCtrl = CReflect(ctrlC.qdwhCtrl);
+    ctrl.zolo = ctrlC.zolo;
+    ctrl.zoloCtrl = CReflect(ctrlC.zoloCtrl);
     return ctrl;
 }
 
@@ -515,11 +607,33 @@ inline QDWHInfo CReflect( const ElQDWHInfo& infoC )
     return info;
 }
 
+/* ZoloInfo */
+inline ElZoloInfo CReflect( const ZoloInfo& info )
+{
+    ElZoloInfo infoC;
+    infoC.numIts = info.numIts;
+    infoC.numTerms = info.numTerms;
+    infoC.numQRIts = info.numQRIts;
+    infoC.numCholIts = info.numCholIts;
+    return infoC;
+}
+
+inline ZoloInfo CReflect( const ElZoloInfo& infoC )
+{
+    ZoloInfo info;
+    info.numIts = infoC.numIts;
+    info.numTerms = infoC.numTerms;
+    info.numQRIts = infoC.numQRIts;
+    info.numCholIts = infoC.numCholIts;
+    return info;
+}
+
 /* PolarInfo */
 inline ElPolarInfo CReflect( const PolarInfo& info )
 {
     ElPolarInfo infoC;
     infoC.qdwhInfo = CReflect(info.qdwhInfo);
+    infoC.zoloInfo = CReflect(info.zoloInfo);
     return infoC;
 }
 
@@ -527,6 +641,7 @@ inline PolarInfo CReflect( const ElPolarInfo& infoC )
 {
     PolarInfo info;
     info.qdwhInfo = CReflect(infoC.qdwhInfo);
+    info.zoloInfo = CReflect(infoC.zoloInfo);
     return info;
 }
 
@@ -676,6 +791,47 @@ inline ElBidiagSVDCtrl_d CReflect( const BidiagSVDCtrl<double>& ctrl )
     return ctrlC;
 }
 
+/* JacobiSVDCtrl */
+inline JacobiSVDCtrl<float> CReflect( const ElJacobiSVDCtrl_s& ctrlC )
+{
+    JacobiSVDCtrl<float> ctrl;
+    ctrl.blocksize = ctrlC.blocksize;
+    ctrl.maxSweeps = ctrlC.maxSweeps;
+    ctrl.tol = ctrlC.tol;
+    ctrl.progress = ctrlC.progress;
+    return ctrl;
+}
+
+inline JacobiSVDCtrl<double> CReflect( const ElJacobiSVDCtrl_d& ctrlC )
+{
+    JacobiSVDCtrl<double> ctrl;
+    ctrl.blocksize = ctrlC.blocksize;
+    ctrl.maxSweeps = ctrlC.maxSweeps;
+    ctrl.tol = ctrlC.tol;
+    ctrl.progress = ctrlC.progress;
+    return ctrl;
+}
+
+inline ElJacobiSVDCtrl_s CReflect( const JacobiSVDCtrl<float>& ctrl )
+{
+    ElJacobiSVDCtrl_s ctrlC;
+    ctrlC.blocksize = ctrl.blocksize;
+    ctrlC.maxSweeps = ctrl.maxSweeps;
+    ctrlC.tol = ctrl.tol;
+    ctrlC.progress = ctrl.progress;
+    return ctrlC;
+}
+
+inline ElJacobiSVDCtrl_d CReflect( const JacobiSVDCtrl<double>& ctrl )
+{
+    ElJacobiSVDCtrl_d ctrlC;
+    ctrlC.blocksize = ctrl.blocksize;
+    ctrlC.maxSweeps = ctrl.maxSweeps;
+    ctrlC.tol = ctrl.tol;
+    ctrlC.progress = ctrl.progress;
+    return ctrlC;
+}
+
 /* SVDCtrl */
 inline SVDCtrl<float> CReflect( const ElSVDCtrl_s& ctrlC )
 { SVDCtrl<float> ctrl;
@@ -685,6 +841,10 @@ inline SVDCtrl<float> CReflect( const ElSVDCtrl_s& ctrlC )
     ctrl.useScaLAPACK = ctrlC.useScaLAPACK;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
+    ctrl.twoStageBidiag = ctrlC.twoStageBidiag;
+    ctrl.bidiagBandwidth = ctrlC.bidiagBandwidth;
+    ctrl.useJacobi = ctrlC.useJacobi;
+    ctrl.jacobiCtrl = CReflect(ctrlC.jacobiCtrl);
     ctrl.bidiagSVDCtrl = CReflect(ctrlC.bidiagSVDCtrl);
     return ctrl;
 }
@@ -698,6 +858,10 @@ inline SVDCtrl<double> CReflect( const ElSVDCtrl_d& ctrlC )
     ctrl.useScaLAPACK = ctrlC.useScaLAPACK;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
+    ctrl.twoStageBidiag = ctrlC.twoStageBidiag;
+    ctrl.bidiagBandwidth = ctrlC.bidiagBandwidth;
+    ctrl.useJacobi = ctrlC.useJacobi;
+    ctrl.jacobiCtrl = CReflect(ctrlC.jacobiCtrl);
     ctrl.bidiagSVDCtrl = CReflect(ctrlC.bidiagSVDCtrl);
     return ctrl;
 }
@@ -711,6 +875,10 @@ inline ElSVDCtrl_s CReflect( const SVDCtrl<float>& ctrl )
     ctrlC.useScaLAPACK = ctrl.useScaLAPACK;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
+    ctrlC.twoStageBidiag = ctrl.twoStageBidiag;
+    ctrlC.bidiagBandwidth = ctrl.bidiagBandwidth;
+    ctrlC.useJacobi = ctrl.useJacobi;
+    ctrlC.jacobiCtrl = CReflect(ctrl.jacobiCtrl);
     ctrlC.bidiagSVDCtrl = CReflect(ctrl.bidiagSVDCtrl);
     return ctrlC;
 }
@@ -724,6 +892,10 @@ inline ElSVDCtrl_d CReflect( const SVDCtrl<double>& ctrl )
     ctrlC.useScaLAPACK = ctrl.useScaLAPACK;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
+    ctrlC.twoStageBidiag = ctrl.twoStageBidiag;
+    ctrlC.bidiagBandwidth = ctrl.bidiagBandwidth;
+    ctrlC.useJacobi = ctrl.useJacobi;
+    ctrlC.jacobiCtrl = CReflect(ctrl.jacobiCtrl);
     ctrlC.bidiagSVDCtrl = CReflect(ctrl.bidiagSVDCtrl);
     return ctrlC;
 }
@@ -964,6 +1136,8 @@ inline ElPseudospecCtrl_s CReflect( const PseudospecCtrl<float>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.teamSize = ctrl.teamSize;
+    ctrlC.batchSize = ctrl.batchSize;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -983,6 +1157,8 @@ inline ElPseudospecCtrl_d CReflect( const PseudospecCtrl<double>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.teamSize = ctrl.teamSize;
+    ctrlC.batchSize = ctrl.batchSize;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -1003,6 +1179,8 @@ inline PseudospecCtrl<float> CReflect( const ElPseudospecCtrl_s& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.teamSize = ctrlC.teamSize;
+    ctrl.batchSize = ctrlC.batchSize;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
@@ -1022,6 +1200,8 @@ inline PseudospecCtrl<double> CReflect( const ElPseudospecCtrl_d& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.teamSize = ctrlC.teamSize;
+    ctrl.batchSize = ctrlC.batchSize;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
@@ -344,6 +344,320 @@ Base<Field> LanczosDecomp
     return beta;
 }
 
+namespace lanczos {
+
+// Overwrite W with an orthonormal basis for its column space using two passes
+// of Cholesky-based QR, where each process owns a subset of the rows of W,
+// and return the triangular factor R in W = Q R. False is returned if W was
+// numerically rank-deficient.
+template<typename Field>
+bool CholeskyQR2( Matrix<Field>& W, Matrix<Field>& R, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int p = W.Width();
+    Identity( R, p, p );
+    Matrix<Field> S;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Zeros( S, p, p );
+        Herk( UPPER, ADJOINT, Real(1), W, Real(0), S );
+        El::AllReduce( S, comm );
+        try { El::Cholesky( UPPER, S ); }
+        catch( const NonHPDMatrixException& ) { return false; }
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), S, W );
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), S, R );
+    }
+    return true;
+}
+
+// W := W - V (V^H W), twice, with the accumulated coefficients returned in H
+template<typename Field>
+void Orthogonalize
+( const Matrix<Field>& V, Matrix<Field>& W, Matrix<Field>& H, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> Z;
+    Zeros( H, V.Width(), W.Width() );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), V, W, Z );
+        El::AllReduce( Z, comm );
+        Gemm( NORMAL, NORMAL, Field(-1), V, Z, Field(1), W );
+        H += Z;
+    }
+}
+
+// Store an orthonormal basis for the next block of the Krylov subspace in the
+// p columns of V following its first j columns, given the block W, which is
+// orthogonal to those j columns, and return R in W = Q R. If W is numerically
+// rank-deficient (e.g., once the basis contains an invariant subspace), the
+// Gram matrix of W is diagonalized so that its numerically nonzero directions
+// are kept, along with their coupling in R, and only the deficient directions
+// are replaced with random directions orthogonal to the basis.
+template<typename Field>
+void ExtendBasis
+(       Matrix<Field>& V,
+        Int j,
+  const Matrix<Field>& W,
+        Matrix<Field>& R,
+        Base<Field> normA,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int localHeight = W.Height();
+    const Int p = W.Width();
+    auto QNext = V( ALL, IR(j,j+p) );
+    QNext = W;
+    if( CholeskyQR2( QNext, R, comm ) )
+        return;
+
+    // W^H W = U diag(sigma)^2 U^H
+    Matrix<Field> G, U;
+    Matrix<Real> sigmaSq;
+    Zeros( G, p, p );
+    Herk( LOWER, ADJOINT, Real(1), W, Real(0), G );
+    El::AllReduce( G, comm );
+    HermitianEig( LOWER, G, sigmaSq, U );
+    Real sigmaMax = 0;
+    for( Int k=0; k<p; ++k )
+        sigmaMax = Max( sigmaMax, Sqrt(Max(sigmaSq(k),Real(0))) );
+
+    // Directions below sqrt(eps) times the largest cannot be resolved from
+    // the Gram matrix, and the block is entirely deficient if it is
+    // negligible relative to || A ||
+    const Real minSigma = Max( Sqrt(eps)*sigmaMax, eps*normA );
+    vector<Int> keepInds;
+    for( Int k=0; k<p; ++k )
+        if( Sqrt(Max(sigmaSq(k),Real(0))) > minSigma )
+            keepInds.push_back( k );
+    const Int rank = keepInds.size();
+    if( rank > 0 )
+    {
+        Matrix<Field> UKeep, RKeep;
+        Zeros( UKeep, p, rank );
+        for( Int k=0; k<rank; ++k )
+        {
+            auto uKeep = UKeep( ALL, IR(k) );
+            uKeep = U( ALL, IR(keepInds[k]) );
+        }
+        auto QKeep = V( ALL, IR(j,j+rank) );
+        Gemm( NORMAL, NORMAL, Field(1), W, UKeep, Field(0), QKeep );
+        if( !CholeskyQR2( QKeep, RKeep, comm ) )
+            RuntimeError("Could not orthogonalize the Krylov block");
+    }
+    if( rank < p )
+    {
+        Matrix<Field> F, H;
+        Gaussian( F, localHeight, p-rank );
+        Orthogonalize( V( ALL, IR(0,j+rank) ), F, H, comm );
+        if( !CholeskyQR2( F, H, comm ) )
+            RuntimeError("Could not extend the Krylov basis");
+        auto QFill = V( ALL, IR(j+rank,j+p) );
+        QFill = F;
+    }
+
+    // Project W onto the new block to recover the coupling of the retained
+    // directions
+    Zeros( R, p, p );
+    Gemm( ADJOINT, NORMAL, Field(1), QNext, W, Field(0), R );
+    El::AllReduce( R, comm );
+}
+
+// The shared implementation of BlockLanczos, where 'applyA' maps the local
+// rows of a block of vectors to the local rows of its image under A
+template<typename Field,class ApplyLocalType>
+Int ThickRestart
+(       Int n,
+        Int localHeight,
+  const ApplyLocalType& applyA,
+        Int numEigs,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& XLoc,
+        mpi::Comm comm,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol == Real(0) ? Pow(eps,Real(0.75)) : ctrl.tol );
+    const Int p = ctrl.blockSize;
+    const Int m =
+      ( ctrl.basisSize == 0 ? Min(Max(2*numEigs,numEigs+3*p),n-p) :
+        ctrl.basisSize );
+    if( numEigs < 1 )
+        LogicError("At least one eigenpair must be requested");
+    if( p < 1 )
+        LogicError("The block size must be positive");
+    if( m+p > n )
+        LogicError("The basis cannot contain more than n-blockSize vectors");
+    if( numEigs+p > m )
+        LogicError("The basis must contain at least numEigs+blockSize vectors");
+    const Int keepMax = Min(numEigs+(m-numEigs)/2,m-p);
+
+    // The basis occupies the first j columns of V, and the next block of the
+    // Krylov subspace occupies the following p columns
+    Matrix<Field> V, T;
+    Zeros( V, localHeight, m+p );
+    Zeros( T, m+p, m+p );
+    Matrix<Field> W, R, H;
+    {
+        auto V0 = V( ALL, IR(0,p) );
+        Gaussian( V0, localHeight, p );
+        if( !CholeskyQR2( V0, R, comm ) )
+            RuntimeError("The initial block was rank-deficient");
+    }
+
+    Matrix<Field> TSub, Y, Z, VNew;
+    Matrix<Real> theta;
+    Real normEst = 0;
+    Int j = 0;
+    for( Int restart=0; ; ++restart )
+    {
+        // Expand the basis until it is full
+        for( ; j+p<=m; j+=p )
+        {
+            auto Q = V( ALL, IR(j,j+p) );
+            auto VBasis = V( ALL, IR(0,j+p) );
+            applyA( Q, W );
+            Orthogonalize( VBasis, W, H, comm );
+
+            auto TR = T( IR(0,j+p), IR(j,j+p) );
+            auto TB = T( IR(j,j+p), IR(0,j+p) );
+            TR = H;
+            Adjoint( H, TB );
+            auto TD = T( IR(j,j+p), IR(j,j+p) );
+            MakeHermitian( LOWER, TD );
+
+            ExtendBasis( V, j+p, W, R, Max(normEst,FrobeniusNorm(H)), comm );
+            auto TNextB = T( IR(j+p,j+2*p), IR(j,j+p) );
+            auto TNextR = T( IR(j,j+p), IR(j+p,j+2*p) );
+            TNextB = R;
+            Adjoint( R, TNextR );
+        }
+
+        // A V_j = V_j T_j + Q C, where Q is the next block and C = T(j:j+p,0:j)
+        TSub = T( IR(0,j), IR(0,j) );
+        HermitianEig( LOWER, TSub, theta, Y );
+        auto C = T( IR(j,j+p), IR(0,j) );
+        Gemm( NORMAL, NORMAL, Field(1), C, Y, Z );
+        for( Int i=0; i<j; ++i )
+            normEst = Max( normEst, Abs(theta(i)) );
+
+        // Order the Ritz pairs starting from the wanted end of the spectrum
+        auto sel = [&]( Int i ) { return ctrl.smallest ? i : j-1-i; };
+        Int numConverged=0;
+        for( ; numConverged<numEigs; ++numConverged )
+        {
+            auto z = Z( ALL, IR(sel(numConverged)) );
+            if( FrobeniusNorm( z ) > tol*normEst )
+                break;
+        }
+        if( ctrl.progress && mpi::Rank(comm) == 0 )
+            Output
+            ("restart ",restart,": ",numConverged," of ",numEigs,
+             " Ritz pairs converged");
+        if( numConverged == numEigs )
+        {
+            w.Resize( numEigs, 1 );
+            Zeros( XLoc, localHeight, numEigs );
+            auto VBasis = V( ALL, IR(0,j) );
+            for( Int i=0; i<numEigs; ++i )
+            {
+                w(i) = theta(sel(i));
+                auto x = XLoc( ALL, IR(i) );
+                Gemv( NORMAL, Field(1), VBasis, Y(ALL,IR(sel(i))), x );
+            }
+            return restart;
+        }
+        if( restart == ctrl.maxRestarts )
+            RuntimeError("Block Lanczos did not converge");
+
+        // Thickly restart with the Ritz vectors closest to the wanted end
+        const Int keep = keepMax;
+        Matrix<Field> YKeep, ZKeep;
+        Zeros( YKeep, j, keep );
+        Zeros( ZKeep, p, keep );
+        for( Int i=0; i<keep; ++i )
+        {
+            auto yKeep = YKeep( ALL, IR(i) );
+            auto zKeep = ZKeep( ALL, IR(i) );
+            yKeep = Y( ALL, IR(sel(i)) );
+            zKeep = Z( ALL, IR(sel(i)) );
+        }
+        auto VBasis = V( ALL, IR(0,j) );
+        Gemm( NORMAL, NORMAL, Field(1), VBasis, YKeep, VNew );
+        W = V( ALL, IR(j,j+p) );
+        auto VKeep = V( ALL, IR(0,keep) );
+        auto QKeep = V( ALL, IR(keep,keep+p) );
+        VKeep = VNew;
+        QKeep = W;
+
+        Zero( T );
+        for( Int i=0; i<keep; ++i )
+            T(i,i) = theta(sel(i));
+        auto TKeepB = T( IR(keep,keep+p), IR(0,keep) );
+        auto TKeepR = T( IR(0,keep), IR(keep,keep+p) );
+        TKeepB = ZKeep;
+        Adjoint( ZKeep, TKeepR );
+        j = keep;
+    }
+}
+
+} // namespace lanczos
+
+template<typename Field,class ApplyAType>
+Int BlockLanczos
+(       Int n,
+  const ApplyAType& applyA,
+        Int numEigs,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    return lanczos::ThickRestart
+      ( n, n, applyA, numEigs, w, X, mpi::COMM_SELF, ctrl );
+}
+
+template<typename Field,class ApplyAType>
+Int BlockLanczos
+(       Int n,
+  const ApplyAType& applyA,
+        Int numEigs,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        DistMultiVec<Field>& X,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& w = wProx.Get();
+    const Grid& grid = X.Grid();
+
+    // Every process redundantly stores the Rayleigh quotient and owns a
+    // subset of the rows of the Krylov basis
+    DistMultiVec<Field> QDist(grid), WDist(grid);
+    Zeros( X, n, numEigs );
+    auto applyLocal =
+      [&]( const Matrix<Field>& QLoc, Matrix<Field>& WLoc )
+      {
+          Zeros( QDist, n, QLoc.Width() );
+          QDist.Matrix() = QLoc;
+          applyA( QDist, WDist );
+          WLoc = WDist.LockedMatrix();
+      };
+    Matrix<Real> wLoc;
+    const Int numRestarts = lanczos::ThickRestart
+      ( n, X.LocalHeight(), applyLocal, numEigs, wLoc, X.Matrix(),
+        grid.Comm(), ctrl );
+    w.Resize( numEigs, 1 );
+    w.Matrix() = wLoc;
+    return numRestarts;
+}
+
 } // namespace El
 
 #endif // ifndef EL_SPECTRAL_LANCZOS
@@ -566,7 +566,8 @@ EL_EXPORT ElError ElNNLSDistSparse_d
 typedef enum {
   EL_NNLS_ADMM,
   EL_NNLS_QP,
-  EL_NNLS_SOCP
+  EL_NNLS_SOCP,
+  EL_NNLS_ACTIVE_SET
 } ElNNLSApproach;
 
 typedef struct {
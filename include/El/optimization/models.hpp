@@ -35,6 +35,7 @@ struct ADMMCtrl {
   bool usePinv=false;
   Real pinvTol=0;
   bool progress=true;
+  ADMMAccelCtrl<Real> accelCtrl;
 };
 
 } // namespace bp
@@ -251,17 +252,34 @@ namespace NNLSApproachNS {
 enum NNLSApproach {
     NNLS_ADMM, // The ADMM implementation is still a prototype
     NNLS_QP,
-    NNLS_SOCP
+    NNLS_SOCP,
+    NNLS_ACTIVE_SET // Only supported for dense matrices
 };
 } // namespace NNLSApproachNS
 using namespace NNLSApproachNS;
 
+namespace nnls {
+
+// Control structure for the block principal pivoting (active-set) method,
+// which shares the Gram matrix A^T A amongst all of the right-hand sides and
+// solves the columns with identical passive sets together
+template<typename Real>
+struct ActiveSetCtrl {
+  Int maxIter=500;
+  // Dual infeasibilities are ignored below tol times || A^T b ||_max
+  Real tol=Pow(limits::Epsilon<Real>(),Real(0.75));
+  bool progress=false;
+};
+
+} // namespace nnls
+
 template<typename Real>
 struct NNLSCtrl {
   NNLSApproach approach=NNLS_SOCP;
   ADMMCtrl<Real> admmCtrl;
   qp::direct::Ctrl<Real> qpCtrl;
   socp::affine::Ctrl<Real> socpCtrl;
+  nnls::ActiveSetCtrl<Real> activeSetCtrl;
 };
 
 template<typename Real>
@@ -354,6 +372,10 @@ template<typename Real>
 struct NMFCtrl {
   NNLSCtrl<Real> nnlsCtrl;
   Int maxIter=20;
+
+  // The many small NNLS problems are most cheaply solved with the active-set
+  // method
+  NMFCtrl() { nnlsCtrl.approach = NNLS_ACTIVE_SET; }
 };
 
 template<typename Real>
@@ -387,6 +409,7 @@ struct ADMMCtrl {
   Real relTol=Real(1e-4);
   bool inv=true;
   bool progress=true;
+  ADMMAccelCtrl<Real> accelCtrl;
 };
 
 } // namespace bpdn
@@ -479,6 +502,12 @@ struct RPCACtrl
     Int numPivSteps=75;
     Int maxIts=1000;
 
+    // Use a randomized subspace iteration for the singular value
+    // thresholding which is warm-started from the previous iteration's
+    // singular subspace (and takes precedence over 'usePivQR')
+    bool useRandomizedSVT=false;
+    RandomizedSVTCtrl<Real> randSVTCtrl;
+
     Real tau=Real(0);
     Real beta=Real(1);
     Real rho=Real(6);
@@ -587,28 +616,46 @@ void SVM
 //   min (1/2) || b - x ||_2^2 + lambda 1^T y
 //   s.t. -y <= D x <= y,
 //
-// where x is in R^n and y is in R^(n-1).
+// where x is in R^n and y is in R^(n-1). Unless such Interior Point Method
+// controls are provided, the (exact) direct algorithm of TVProx is instead
+// used.
 //
 // TODO(poulson): Generalize to complex now that there is SOCP support.
 
+template<typename Real>
+void TV
+( const AbstractDistMatrix<Real>& b,
+        Real lambda,
+        AbstractDistMatrix<Real>& x );
+template<typename Real>
+void TV
+( const Matrix<Real>& b,
+        Real lambda,
+        Matrix<Real>& x );
+template<typename Real>
+void TV
+( const DistMultiVec<Real>& b,
+        Real lambda,
+        DistMultiVec<Real>& x );
+
 template<typename Real>
 void TV
 ( const AbstractDistMatrix<Real>& b,
         Real lambda,
         AbstractDistMatrix<Real>& x,
-  const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
+  const qp::affine::Ctrl<Real>& ctrl );
 template<typename Real>
 void TV
 ( const Matrix<Real>& b,
         Real lambda,
         Matrix<Real>& x,
-  const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
+  const qp::affine::Ctrl<Real>& ctrl );
 template<typename Real>
 void TV
 ( const DistMultiVec<Real>& b,
         Real lambda,
         DistMultiVec<Real>& x,
-  const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
+  const qp::affine::Ctrl<Real>& ctrl );
 
 // Long-only portfolio optimization
 // ================================
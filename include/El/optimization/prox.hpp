@@ -78,6 +78,20 @@ template<typename Real>
 void LogisticProx
 ( AbstractDistMatrix<Real>& A, const Real& rho, Int numIts=5 );
 
+// 1D total variation proximal map
+// -------------------------------
+// Overwrites each column b of A with the solution to
+//     arg min (1/2) || b - x ||_2^2 + lambda || D x ||_1,
+//        x
+// where D is the 1D finite-difference operator, using the direct algorithm
+// of Condat. The distributed versions gather full columns onto each process.
+template<typename Real>
+void TVProx( Matrix<Real>& A, const Real& lambda );
+template<typename Real>
+void TVProx( AbstractDistMatrix<Real>& A, const Real& lambda );
+template<typename Real>
+void TVProx( DistMultiVec<Real>& A, const Real& lambda );
+
 // Singular-value soft thresholding
 // --------------------------------
 template<typename Field>
@@ -108,6 +122,28 @@ Int SVT
   const Base<Field>& rho,
   bool relative=false );
 
+// Controls for singular-value soft thresholding via a randomized subspace
+// iteration which is warm-started from the right singular subspace of the
+// previous call (see svt::Randomized)
+template<typename Real>
+struct RandomizedSVTCtrl
+{
+    // The number of columns sampled beyond the rank estimate
+    Int oversample=10;
+
+    // The number of subspace (power) iterations applied to the sample
+    Int numPowerIts=1;
+
+    // The rank estimate used when no warm-start subspace is available
+    Int initialRank=10;
+
+    // The factor by which the rank estimate is grown when the sample was too
+    // small to capture every singular value above the threshold
+    Real growthFactor=Real(2);
+
+    bool relative=false;
+};
+
 namespace svt {
 
 // TODO(poulson): Add SVT control structure
@@ -158,6 +194,25 @@ Int TSQR
   const Base<Field>& rho,
   bool relative=false );
 
+// On input, the columns of V (if it has A.Width() rows) seed the sample, and
+// on output, they hold the right singular vectors of the retained singular
+// values, so that repeated calls on slowly-changing matrices (e.g., within
+// RPCA) are warm-started. The rank of the result is returned.
+template<typename Field>
+Int Randomized
+( Matrix<Field>& A,
+  const Base<Field>& rho,
+  Matrix<Field>& V,
+  const RandomizedSVTCtrl<Base<Field>>& ctrl=
+        RandomizedSVTCtrl<Base<Field>>() );
+template<typename Field>
+Int Randomized
+( AbstractDistMatrix<Field>& A,
+  const Base<Field>& rho,
+  AbstractDistMatrix<Field>& V,
+  const RandomizedSVTCtrl<Base<Field>>& ctrl=
+        RandomizedSVTCtrl<Base<Field>>() );
+
 } // namespace svt
 
 // Soft-thresholding
@@ -43,6 +43,9 @@ struct Ctrl
     ADMMCtrl<Real> admmCtrl;
     MehrotraCtrl<Real> mehrotraCtrl;
 
+    // Only used by the sparse Interior Point Methods
+    PresolveCtrl<Real> presolveCtrl;
+
     Ctrl( bool isSparse )
     { mehrotraCtrl.system = ( isSparse ? AUGMENTED_KKT : NORMAL_KKT ); }
 };
@@ -67,6 +70,9 @@ struct Ctrl
 {
     LPApproach approach=LP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+
+    // Only used by the sparse Interior Point Methods
+    PresolveCtrl<Real> presolveCtrl;
 };
 
 } // namespace affine
@@ -582,7 +588,11 @@ void LP
 // -------------------------------
 
 // Load an affine conic form LP stored in the Mathematical Programming System
-// (MPS) format.
+// (MPS) format. If 'compressed' is true, the file is instead assumed to be a
+// binary cache produced by 'CompressMPS' (in which case 'minimize' and
+// 'keepNonnegativeWithZeroUpperBound' were fixed when the cache was built).
+// Distributed problems are parsed on a single process and then routed to
+// their owners.
 template<class MatrixType,class VectorType>
 void ReadMPS
 ( AffineLPProblem<MatrixType,VectorType>& problem,
@@ -604,8 +614,14 @@ void WriteMPS
   const string& filename,
   bool compressed=false );
 
+// Parse an MPS file once and store the resulting affine LP in a compact
+// binary cache (using the native endianness) which can be quickly reloaded
+// via 'ReadMPS' with 'compressed=true'.
 void CompressMPS
-( const string& filename, const string& compressedFilename );
+( const string& filename,
+  const string& compressedFilename,
+  bool minimize=true,
+  bool keepNonnegativeWithZeroUpperBound=true );
 void DecompressMPS
 ( const string& filename, const string& decompressedFilename );
 
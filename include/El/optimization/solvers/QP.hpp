@@ -42,6 +42,9 @@ struct Ctrl
     QPApproach approach=QP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
 
+    // Only used by the sparse Interior Point Methods
+    PresolveCtrl<Real> presolveCtrl;
+
     Ctrl() { mehrotraCtrl.system = AUGMENTED_KKT; }
 };
 
@@ -65,6 +68,9 @@ struct Ctrl
 {
     QPApproach approach=QP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+
+    // Only used by the sparse Interior Point Methods
+    PresolveCtrl<Real> presolveCtrl;
 };
 
 } // namespace affine
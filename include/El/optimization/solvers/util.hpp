@@ -32,6 +32,9 @@ inline Real MehrotraCentrality
 ( Real mu, Real muAff, Real alphaAffPri, Real alphaAffDual )
 { return Min(Pow(muAff/mu,Real(3)),Real(1)); }
 
+template<typename Real>
+struct IPMWorkspace;
+
 template<typename Real>
 struct MehrotraCtrl
 {
@@ -64,14 +67,27 @@ struct MehrotraCtrl
 
     // For configuring how many reductions of the first-order optimality
     // conditions should be performed before solving a linear system.
-    // For problems with 'affine' cone constraints, i.e., (h - G x) in K,
-    // this should remain as FULL_KKT. For sparse problems with 'direct' cone
-    // constraints, i.e., x in K, both AUGMENTED_KKT (use a QSD solver) and
-    // NORMAL_KKT (use a Cholesky solver) are also possible. The latter should
-    // be avoided when the normal equations are sufficiently denser than the
-    // (larger) augmented formulation.
+    // For sparse problems with 'direct' cone constraints, i.e., x in K, both
+    // AUGMENTED_KKT (use a QSD solver) and NORMAL_KKT (use a Cholesky solver)
+    // are also possible. The latter should be avoided when the normal
+    // equations are sufficiently denser than the (larger) augmented
+    // formulation. For sequential sparse LPs and QPs with 'affine' cone
+    // constraints, i.e., (h - G x) in K, NORMAL_KKT eliminates the rows of G
+    // with at most one nonzero and then the primal variables, which requires
+    // a diagonal Q (otherwise, and for the remaining problem types, FULL_KKT
+    // is used).
     KKTSystem system=FULL_KKT;
 
+    // When forming normal equations for 'affine' cone constraints, columns of
+    // the constraint matrix with more than
+    // max(denseColMin,denseColRatio*height) nonzeros are treated as dense and
+    // applied through a Sherman-Morrison-Woodbury correction rather than
+    // within the sparse factorization. At most 'maxDenseCols' of the densest
+    // such columns are split off.
+    Real denseColRatio=Real(0.1);
+    Int denseColMin=10;
+    Int maxDenseCols=100;
+
     // Use Mehrotra's second-order corrector?
     // TODO(poulson): Add support for Gondzio's correctors
     bool mehrotra=true;
@@ -115,6 +131,34 @@ struct MehrotraCtrl
     // Time the components of the Interior Point Method?
     bool time=false;
 
+    // If positive, the (equilibrated) iterates are written to the checkpoint
+    // 'checkpointBasename' every 'checkpointFreq' iterations (see
+    // CheckpointWriter). If 'restart' is true and such a checkpoint exists,
+    // the Interior Point Method resumes from it rather than from the usual
+    // initialization. Restarting requires the same problem and equilibration.
+    // When a sequential solver is run within a multi-process job, the rank
+    // within mpi::COMM_WORLD is appended to the basename so that concurrent
+    // solves do not overwrite each other's checkpoints.
+    Int checkpointFreq=0;
+    string checkpointBasename="Mehrotra";
+    bool restart=false;
+
+    // If non-null, the sparse Interior Point Methods for affine LPs and QPs
+    // keep the ordering and symbolic analysis of the KKT system, as well as
+    // their final iterates, in this workspace. A subsequent solve with the
+    // same workspace reuses the analysis if the sparsity pattern of the KKT
+    // system is unchanged and, unless 'primalInit' or 'dualInit' is set,
+    // warm-starts from the stored iterates if the problem sizes match.
+    IPMWorkspace<Real>* workspace=nullptr;
+
+    // Before warm-starting, each entry of s and z is raised to at least
+    // 'warmStartShift' times the max norm of the vector (or one, if larger),
+    // and then the smaller member of each pair (s_i,z_i) is increased so that
+    // s_i z_i >= warmStartCentrality*mu, where mu is the average
+    // complementarity.
+    Real warmStartShift=Pow(limits::Epsilon<Real>(),Real(0.25));
+    Real warmStartCentrality=Real(0.1);
+
     // A lower bound on the maximum entry in the Nesterov-Todd scaling point
     // before ad-hoc procedures to enforce the cone constraints should be
     // employed.
@@ -161,8 +205,103 @@ struct MehrotraCtrl
     // replace the default, (muAff/mu)^3
 };
 
+// Persistent state of the sparse Interior Point Methods
+// =====================================================
+// For sequences of problems which only differ in b, c, h, or in the values
+// (but not the sparsity patterns) of Q, A, and G, e.g.:
+//
+//   IPMWorkspace<double> workspace;
+//   ctrl.mehrotraCtrl.workspace = &workspace;
+//   for( ... ) { ...; LP( problem, solution, ctrl ); }
+//
+// The members are managed by the Interior Point Methods.
+template<typename Real>
+struct IPMWorkspace
+{
+    // The reordering and symbolic factorization of the KKT system
+    bool analyzed=false;
+    SparseLDLFactorization<Real> sparseLDLFact;
+    DistSparseLDLFactorization<Real> distSparseLDLFact;
+
+    // The (local portion of the) sparsity pattern of the static KKT matrix
+    // which was analyzed
+    bool kktDistributed=false;
+    Int kktHeight=-1;
+    vector<Int> kktSources, kktTargets;
+
+    // The iterates returned by the last solve
+    bool haveSolution=false;
+    Matrix<Real> x, y, z, s;
+    DistMultiVec<Real> xDist, yDist, zDist, sDist;
+
+    // Forget both the analysis and the stored iterates
+    void Clear()
+    {
+        analyzed = false;
+        kktDistributed = false;
+        kktHeight = -1;
+        kktSources.clear();
+        kktTargets.clear();
+        haveSolution = false;
+    }
+};
+
+// Presolve
+// ========
+// Removes empty and singleton rows and columns, fixed variables, duplicate
+// rows, dominated columns and looser duplicate bounds, free column singletons,
+// and forcing and redundant constraints from sparse problems before handing
+// the (shifted) reduced problem to an Interior Point Method. The solution of
+// the original problem, including its dual variables, is then recovered by
+// replaying the reductions in reverse.
+//
+// Presolve is currently sequential, and so the distributed solvers gather
+// the entire problem onto a single process when it is enabled.
+template<typename Real>
+struct PresolveCtrl
+{
+    bool enable=false;
+
+    // The relative tolerance for deciding that bounds coincide, that a
+    // constraint is forcing, or that rows are proportional
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    // The maximum number of passes over the rows and columns
+    Int maxPasses=20;
+
+    // Print a summary of the reductions?
+    bool print=false;
+};
+
 // Alternating Direction Method of Multipliers
 // ===========================================
+
+// Adaptation of the penalty parameter and acceleration of the iterates
+template<typename Real>
+struct ADMMAccelCtrl
+{
+    // Residual balancing: if the primal residual norm exceeds the dual
+    // residual norm by more than a factor of 'balanceRatio' (or vice versa),
+    // then rho is multiplied (divided) by 'rhoFactor' and the scaled dual
+    // variable is rescaled accordingly. So that convergence is still
+    // guaranteed, rho is only adapted during the first 'maxAdaptIter'
+    // iterations. Solvers whose x-update depends upon rho then cache an
+    // eigendecomposition (rather than a Cholesky factorization) so that
+    // changes of rho are cheap, and so this is off by default.
+    bool adaptiveRho=false;
+    Real balanceRatio=Real(10);
+    Real rhoFactor=Real(2);
+    Int maxAdaptIter=100;
+
+    // If positive, the number of previous iterates used for (type-II)
+    // Anderson acceleration of the fixed-point iteration in (z,u). The
+    // history is discarded whenever rho changes or an accelerated step
+    // increases the fixed-point residual by more than 'andersonSafeguard'.
+    Int andersonMemory=0;
+    Real andersonReg=Pow(limits::Epsilon<Real>(),Real(0.5));
+    Real andersonSafeguard=Real(1);
+};
+
 template<typename Real>
 struct ADMMCtrl
 {
@@ -174,6 +313,7 @@ struct ADMMCtrl
     Real relTol=Real(1e-4);
     bool inv=true;
     bool print=true;
+    ADMMAccelCtrl<Real> accelCtrl;
 };
 
 } // namespace El
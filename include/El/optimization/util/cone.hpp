@@ -12,6 +12,45 @@
 namespace El {
 namespace cone {
 
+// Distribution metadata for products of cones stored in a DistMultiVec
+// ====================================================================
+// DistMultiVec assigns a contiguous block of rows to each process and the
+// members of each cone are contiguous, so each process owns all of its cones
+// entirely except for (at most) the cone containing its first row, which may
+// have its root on an earlier process, and the cone containing its last row,
+// which may continue onto later processes. This metadata locates those cones so
+// that each cone-wise reduction or broadcast requires at most a single
+// AllGather of two entries per process, and no communication at all if no cone
+// straddles a process boundary.
+struct DistConeMeta
+{
+    bool ready=false;
+
+    // Whether any cone straddles a process boundary
+    bool straddling=true;
+
+    Int firstLocalRow=0, localHeight=0;
+
+    // The cone containing the first local row, if its root is not local
+    bool hasTopCone=false;
+    Int topConeLocalEnd=0;
+    int topConeRootOwner=0, topConeLastOwner=0;
+
+    // The cone containing the last local row, if its root is local and it
+    // continues onto a later process
+    bool hasBottomCone=false;
+    Int bottomConeLocalBeg=0;
+    int bottomConeLastOwner=0;
+
+    // Only the first and last local entries of 'orders' and 'firstInds' are
+    // inspected. If 'checkStraddling' is true, an AllReduce determines whether
+    // any communication is required; otherwise it is assumed to be.
+    void Initialize
+    ( const DistMultiVec<Int>& orders,
+      const DistMultiVec<Int>& firstInds,
+      bool checkStraddling=true );
+};
+
 // Broadcast
 // =========
 // Replicate the entry in the root position in each cone over the entire cone
@@ -30,6 +69,12 @@ void Broadcast
 (       DistMultiVec<Field>& x,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds, Int cutoff=1000 );
+template<typename Field>
+void Broadcast
+(       DistMultiVec<Field>& x,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const DistConeMeta& meta );
 
 // AllReduce
 // =========
@@ -52,6 +97,13 @@ void AllReduce
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   mpi::Op op=mpi::SUM, Int cutoff=1000 );
+template<typename Field>
+void AllReduce
+(       DistMultiVec<Field>& x,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const DistConeMeta& meta,
+  mpi::Op op=mpi::SUM );
 
 // A specialization of Ruiz scaling which respects a product of cones
 // ==================================================================
@@ -42,6 +42,15 @@ void Apply
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
         Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Apply
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta );
 
 // Overwrite y with x o y
 // ----------------------
@@ -68,6 +77,14 @@ void Apply
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Apply
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta );
 
 // Apply the quadratic representation of a product of SOCs to a vector
 // ===================================================================
@@ -97,6 +114,15 @@ void ApplyQuadratic
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void ApplyQuadratic
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta );
 
 // Overwrite y with Q_x y
 // ----------------------
@@ -123,6 +149,14 @@ void ApplyQuadratic
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void ApplyQuadratic
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta );
 
 // Degree
 // ======
@@ -155,6 +189,14 @@ void Dets
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Dets
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& d,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta );
 
 // Dot products of sequences of second-order cones
 // ===============================================
@@ -184,6 +226,15 @@ void Dots
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Dots
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta );
 
 // Embedding maps
 // ==============
@@ -254,6 +305,14 @@ void Inverse
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Inverse
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& xInv,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta );
 
 // Lower norms
 // ===========
@@ -280,6 +339,14 @@ void LowerNorms
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void LowerNorms
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& lowerNorms,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta );
 
 // Max eigenvalues
 // ===============
@@ -356,6 +423,15 @@ Real MaxStep
   const DistMultiVec<Int>& firstInds,
   Real upperBound=limits::Max<Real>(),
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Real MaxStep
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real upperBound,
+  const cone::DistConeMeta& meta );
 
 // Min eigenvalues
 // ===============
@@ -434,6 +510,15 @@ void NesterovTodd
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void NesterovTodd
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& w,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta );
 
 // Number of non-SOC members
 // =========================
@@ -484,6 +569,14 @@ void PushInto
   const DistMultiVec<Int>& firstInds,
   Real minDist=0,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void PushInto
+(       DistMultiVec<Real>& x,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real minDist,
+  const cone::DistConeMeta& meta );
 
 // Push pair into SOC
 // ==================
@@ -516,6 +609,16 @@ void PushPairInto
   const DistMultiVec<Int>& firstInds,
   Real wMaxNormLimit,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void PushPairInto
+(       DistMultiVec<Real>& s,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& w,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real wMaxNormLimit,
+  const cone::DistConeMeta& meta );
 
 // Reflect
 // =======
@@ -588,6 +691,14 @@ void SquareRoot
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void SquareRoot
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& xRoot,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta );
 
 } // namespace soc
 } // namespace El
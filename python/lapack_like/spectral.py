@@ -829,6 +829,24 @@ class BidiagSVDCtrl_d(ctypes.Structure):
 # Singular value decomposition
 # ============================
 
+lib.ElJacobiSVDCtrlDefault_s.argtypes = [c_void_p]
+class JacobiSVDCtrl_s(ctypes.Structure):
+  _fields_ = [("blocksize",iType),
+              ("maxSweeps",iType),
+              ("tol",sType),
+              ("progress",bType)]
+  def __init__(self):
+    lib.ElJacobiSVDCtrlDefault_s(pointer(self))
+
+lib.ElJacobiSVDCtrlDefault_d.argtypes = [c_void_p]
+class JacobiSVDCtrl_d(ctypes.Structure):
+  _fields_ = [("blocksize",iType),
+              ("maxSweeps",iType),
+              ("tol",dType),
+              ("progress",bType)]
+  def __init__(self):
+    lib.ElJacobiSVDCtrlDefault_d(pointer(self))
+
 class SVDCtrl_s(ctypes.Structure):
   _fields_ = [("overwrite",bType),
               ("time",bType),
@@ -836,6 +854,10 @@ class SVDCtrl_s(ctypes.Structure):
               ("useScaLAPACK",bType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
+              ("twoStageBidiag",bType),
+              ("bidiagBandwidth",iType),
+              ("useJacobi",bType),
+              ("jacobiCtrl",JacobiSVDCtrl_s),
               ("bidiagSVDCtrl",BidiagSVDCtrl_s)]
   def __init__(self):
     lib.ElSVDCtrlDefault_s(pointer(self))
@@ -847,6 +869,10 @@ class SVDCtrl_d(ctypes.Structure):
               ("useScaLAPACK",bType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
+              ("twoStageBidiag",bType),
+              ("bidiagBandwidth",iType),
+              ("useJacobi",bType),
+              ("jacobiCtrl",JacobiSVDCtrl_d),
               ("bidiagSVDCtrl",BidiagSVDCtrl_d)]
   def __init__(self):
     lib.ElSVDCtrlDefault_d(pointer(self))
@@ -1137,6 +1163,8 @@ class PseudospecCtrl_s(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("teamSize",iType),
+              ("batchSize",iType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl),
               ("center",cType),
@@ -1163,6 +1191,8 @@ class PseudospecCtrl_d(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("teamSize",iType),
+              ("batchSize",iType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl),
               ("center",zType),
@@ -622,7 +622,7 @@ def RNNLS(A,b,rho,ctrl=None):
 lib.ElNNLSCtrlDefault_s.argtypes = \
 lib.ElNNLSCtrlDefault_d.argtypes = \
   [c_void_p]
-(NNLS_ADMM,NNLS_QP,NNLS_SOCP)=(0,1,2)
+(NNLS_ADMM,NNLS_QP,NNLS_SOCP,NNLS_ACTIVE_SET)=(0,1,2,3)
 class NNLSCtrl_s(ctypes.Structure):
   _fields_ = [("approach",c_uint),
               ("admmCtrl",ADMMCtrl_s),
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
 #include <El/control.hpp>
 
 namespace El {
@@ -72,6 +73,109 @@ void Lyapunov
     Sylvester( m, W, X, ctrl );
 }
 
+// Given the Schur decomposition A = Q T Q^H, the equation A X + X A^H = C
+// becomes
+//   T Y + Y T^H = Q^H C Q,
+// where X = Q Y Q^H. Unlike the sign-based approach, this only requires that
+// lambda_i + conj(lambda_j) be nonzero for all eigenvalues of A.
+
+template<typename F>
+void LyapunovFromSchur
+( const Matrix<F>& T,
+  const Matrix<F>& Q,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( T.Height() != T.Width() )
+          LogicError("T must be square");
+      if( Q.Height() != T.Height() || Q.Width() != T.Height() )
+          LogicError("Q must conform with T");
+      if( C.Height() != T.Height() || C.Width() != T.Height() )
+          LogicError("C must conform with T");
+    )
+    Matrix<F> Z;
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, Q, X );
+    TriangularSylvester( ADJOINT, T, T, X, ctrl.cutoff );
+    Gemm( NORMAL, NORMAL, F(1), Q, X, Z );
+    Gemm( NORMAL, ADJOINT, F(1), Z, Q, X );
+}
+
+template<typename F>
+void LyapunovFromSchur
+( const ElementalMatrix<F>& T,
+  const ElementalMatrix<F>& Q,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( T.Height() != T.Width() )
+          LogicError("T must be square");
+      if( Q.Height() != T.Height() || Q.Width() != T.Height() )
+          LogicError("Q must conform with T");
+      if( C.Height() != T.Height() || C.Width() != T.Height() )
+          LogicError("C must conform with T");
+      AssertSameGrids( T, Q, C );
+    )
+    const Grid& g = T.Grid();
+    DistMatrix<F> Y(g), Z(g);
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, Q, Y );
+    TriangularSylvester( ADJOINT, T, T, Y, ctrl.cutoff );
+    Gemm( NORMAL, NORMAL, F(1), Q, Y, Z );
+    Gemm( NORMAL, ADJOINT, F(1), Z, Q, Y );
+    Copy( Y, X );
+}
+
+template<typename F>
+void Lyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.useSign )
+    {
+        Lyapunov( A, C, X, ctrl.signCtrl );
+        return;
+    }
+    auto schurCtrl = ctrl.schurCtrl;
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+    Matrix<F> T( A ), Q;
+    Matrix<Complex<Base<F>>> w;
+    Schur( T, w, Q, schurCtrl );
+    LyapunovFromSchur( T, Q, C, X, ctrl );
+}
+
+template<typename F>
+void Lyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.useSign )
+    {
+        Lyapunov( A, C, X, ctrl.signCtrl );
+        return;
+    }
+    const Grid& g = A.Grid();
+    auto schurCtrl = ctrl.schurCtrl;
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+    DistMatrix<F> T(g), Q(g);
+    DistMatrix<Complex<Base<F>>,VR,STAR> w(g);
+    T = A;
+    Schur( T, w, Q, schurCtrl );
+    LyapunovFromSchur( T, Q, C, X, ctrl );
+}
+
 #define PROTO(F) \
   template void Lyapunov \
   ( const Matrix<F>& A, \
@@ -82,7 +186,29 @@ void Lyapunov
   ( const ElementalMatrix<F>& A, \
     const ElementalMatrix<F>& C, \
           ElementalMatrix<F>& X, \
-    SignCtrl<Base<F>> ctrl );
+    SignCtrl<Base<F>> ctrl ); \
+  template void Lyapunov \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& C, \
+          Matrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void Lyapunov \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void LyapunovFromSchur \
+  ( const Matrix<F>& T, \
+    const Matrix<F>& Q, \
+    const Matrix<F>& C, \
+          Matrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void LyapunovFromSchur \
+  ( const ElementalMatrix<F>& T, \
+    const ElementalMatrix<F>& Q, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
 #include <El/lapack_like/funcs.hpp>
 #include <El/control.hpp>
 
@@ -155,6 +156,94 @@ void Sylvester
     Sylvester( m, W, X, ctrl );
 }
 
+// The Bartels-Stewart approach: given the Schur decompositions
+// A = QA TA QA^H and B = QB TB QB^H, the equation A X + X B = C becomes
+//   TA Y + Y TB = QA^H C QB,
+// where X = QA Y QB^H, which is then solved with TriangularSylvester.
+
+template<typename F>
+void Sylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.useSign )
+    {
+        Sylvester( A, B, C, X, ctrl.signCtrl );
+        return;
+    }
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != B.Width() )
+          LogicError("B must be square");
+      if( C.Height() != A.Height() || C.Width() != B.Height() )
+          LogicError("C must conform with A and B");
+    )
+    typedef Base<F> Real;
+    auto schurCtrl = ctrl.schurCtrl;
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+
+    Matrix<F> TA( A ), TB( B ), QA, QB;
+    Matrix<Complex<Real>> w;
+    Schur( TA, w, QA, schurCtrl );
+    Schur( TB, w, QB, schurCtrl );
+
+    Matrix<F> Z;
+    Gemm( ADJOINT, NORMAL, F(1), QA, C, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, QB, X );
+    TriangularSylvester( NORMAL, TA, TB, X, ctrl.cutoff );
+    Gemm( NORMAL, NORMAL, F(1), QA, X, Z );
+    Gemm( NORMAL, ADJOINT, F(1), Z, QB, X );
+}
+
+template<typename F>
+void Sylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.useSign )
+    {
+        Sylvester( A, B, C, X, ctrl.signCtrl );
+        return;
+    }
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != B.Width() )
+          LogicError("B must be square");
+      if( C.Height() != A.Height() || C.Width() != B.Height() )
+          LogicError("C must conform with A and B");
+      AssertSameGrids( A, B, C );
+    )
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    auto schurCtrl = ctrl.schurCtrl;
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+
+    DistMatrix<F> TA(g), TB(g), QA(g), QB(g);
+    DistMatrix<Complex<Real>,VR,STAR> w(g);
+    TA = A;
+    TB = B;
+    Schur( TA, w, QA, schurCtrl );
+    Schur( TB, w, QB, schurCtrl );
+
+    DistMatrix<F> Y(g), Z(g);
+    Gemm( ADJOINT, NORMAL, F(1), QA, C, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, QB, Y );
+    TriangularSylvester( NORMAL, TA, TB, Y, ctrl.cutoff );
+    Gemm( NORMAL, NORMAL, F(1), QA, Y, Z );
+    Gemm( NORMAL, ADJOINT, F(1), Z, QB, Y );
+    Copy( Y, X );
+}
+
 #define PROTO(F) \
   template void Sylvester \
   ( Int m, \
@@ -177,7 +266,19 @@ void Sylvester
     const ElementalMatrix<F>& B, \
     const ElementalMatrix<F>& C, \
           ElementalMatrix<F>& X, \
-    SignCtrl<Base<F>> ctrl );
+    SignCtrl<Base<F>> ctrl ); \
+  template void Sylvester \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& B, \
+    const Matrix<F>& C, \
+          Matrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void Sylvester \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
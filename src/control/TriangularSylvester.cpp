@@ -0,0 +1,291 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/control.hpp>
+
+// Solve A Y + Y op(B) = C for upper (quasi-)triangular A and B via the
+// recursive blocked approach of
+//
+//   Isak Jonsson and Bo Kagstrom,
+//   "Recursive blocked algorithms for solving triangular systems -- Part I:
+//    One-sided and coupled Sylvester-type matrix equations",
+//   ACM Trans. Math. Software, Vol. 28, No. 4, pp. 392--415, 2002.
+//
+// The larger of the two dimensions is halved at each level so that nearly
+// all of the work is performed within Gemm, and the leaves are solved with
+// the column-oriented Bartels-Stewart back substitution (redundantly in the
+// distributed case).
+
+namespace El {
+
+namespace sylvester {
+
+// Return the offsets of the diagonal blocks of the upper (quasi-)triangular
+// matrix T, followed by its height
+template<typename F>
+vector<Int> DiagonalBlockOffsets( const Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    const Int n = T.Height();
+    vector<Int> offsets;
+    Int k = 0;
+    while( k < n )
+    {
+        offsets.push_back( k );
+        k += ( k+1 < n && T(k+1,k) != F(0) ? 2 : 1 );
+    }
+    offsets.push_back( n );
+    return offsets;
+}
+
+// Overwrite the 1x1, 1x2, 2x1, or 2x2 matrix C with the solution of
+// A Y + Y op(B) = C
+template<typename Real>
+void SmallSolve
+( Orientation orientB,
+  const Matrix<Real>& A,
+  const Matrix<Real>& B,
+        Matrix<Real>& C )
+{
+    EL_DEBUG_CSE
+    const BlasInt m = C.Height();
+    const BlasInt n = C.Width();
+    Real scale, YInfNorm;
+    Real Y[4];
+    lapack::SmallSylvester
+    ( false, orientB != NORMAL, false, m, n,
+      A.LockedBuffer(), A.LDim(),
+      B.LockedBuffer(), B.LDim(),
+      C.LockedBuffer(), C.LDim(),
+      scale, Y, 2, YInfNorm );
+    // Rather than rescaling the entire right-hand side in order to avoid
+    // overflow, as in LAPACK's trsyl, simply undo the scaling
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            C(i,j) = Y[i+j*2] / scale;
+}
+
+template<typename Real>
+void SmallSolve
+( Orientation orientB,
+  const Matrix<Complex<Real>>& A,
+  const Matrix<Complex<Real>>& B,
+        Matrix<Complex<Real>>& C )
+{
+    EL_DEBUG_CSE
+    const Complex<Real> beta =
+      ( orientB == ADJOINT ? Conj(B(0,0)) : B(0,0) );
+    C(0,0) /= A(0,0) + beta;
+}
+
+template<typename F>
+void Leaf
+( Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& C )
+{
+    EL_DEBUG_CSE
+    const Int n = C.Width();
+    const auto AOffsets = DiagonalBlockOffsets( A );
+    const auto BOffsets = DiagonalBlockOffsets( B );
+    const Int numABlocks = AOffsets.size()-1;
+    const Int numBBlocks = BOffsets.size()-1;
+
+    // op(B) is lower-triangular when B is (conjugate-)transposed, and so the
+    // block columns of C must then be solved for in reverse order
+    for( Int step=0; step<numBBlocks; ++step )
+    {
+        const Int l = ( orientB == NORMAL ? step : numBBlocks-1-step );
+        const Range<Int> indL( BOffsets[l], BOffsets[l+1] );
+        auto CL = C( ALL, indL );
+        auto BLL = B( indL, indL );
+
+        for( Int k=numABlocks-1; k>=0; --k )
+        {
+            const Range<Int> ind0( 0, AOffsets[k] ),
+                             indK( AOffsets[k], AOffsets[k+1] );
+            auto CKL = C( indK, indL );
+            SmallSolve( orientB, A(indK,indK), BLL, CKL );
+            if( AOffsets[k] > 0 )
+            {
+                auto C0L = C( ind0, indL );
+                Gemm( NORMAL, NORMAL, F(-1), A(ind0,indK), CKL, F(1), C0L );
+            }
+        }
+
+        if( orientB == NORMAL && BOffsets[l+1] < n )
+        {
+            const Range<Int> indR( BOffsets[l+1], n );
+            auto CR = C( ALL, indR );
+            Gemm( NORMAL, NORMAL, F(-1), CL, B(indL,indR), F(1), CR );
+        }
+        else if( orientB != NORMAL && BOffsets[l] > 0 )
+        {
+            const Range<Int> indR( 0, BOffsets[l] );
+            auto CR = C( ALL, indR );
+            Gemm( NORMAL, orientB, F(-1), CL, B(indR,indL), F(1), CR );
+        }
+    }
+}
+
+template<typename F>
+void Leaf
+( Orientation orientB,
+  const DistMatrix<F>& A,
+  const DistMatrix<F>& B,
+        DistMatrix<F>& C )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B ),
+                            C_STAR_STAR( C );
+    Leaf
+    ( orientB, A_STAR_STAR.LockedMatrix(), B_STAR_STAR.LockedMatrix(),
+      C_STAR_STAR.Matrix() );
+    C = C_STAR_STAR;
+}
+
+// Return an index near the middle of the upper (quasi-)triangular matrix T
+// which does not split one of its 2x2 diagonal blocks
+template<typename F,class MatrixType>
+Int SplitPoint( const MatrixType& T )
+{
+    EL_DEBUG_CSE
+    Int k = T.Height() / 2;
+    if( T.Get(k,k-1) != F(0) )
+        ++k;
+    return k;
+}
+
+template<typename F,class MatrixType>
+void Recursive
+( Orientation orientB,
+  const MatrixType& A,
+  const MatrixType& B,
+        MatrixType& C,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    if( Max(m,n) <= cutoff )
+    {
+        Leaf( orientB, A, B, C );
+        return;
+    }
+
+    if( m >= n )
+    {
+        // | A11 A12 | | Y1 | + | Y1 | op(B) = | C1 |
+        // |  0  A22 | | Y2 |   | Y2 |         | C2 |
+        const Int k = SplitPoint<F>( A );
+        const Range<Int> ind1( 0, k ), ind2( k, m );
+        auto C1 = C( ind1, ALL );
+        auto C2 = C( ind2, ALL );
+
+        Recursive<F>( orientB, A(ind2,ind2), B, C2, cutoff );
+        Gemm( NORMAL, NORMAL, F(-1), A(ind1,ind2), C2, F(1), C1 );
+        Recursive<F>( orientB, A(ind1,ind1), B, C1, cutoff );
+    }
+    else
+    {
+        // A | Y1 Y2 | + | Y1 Y2 | op(| B11 B12 |) = | C1 C2 |
+        //                            |  0  B22 |
+        const Int k = SplitPoint<F>( B );
+        const Range<Int> ind1( 0, k ), ind2( k, n );
+        auto C1 = C( ALL, ind1 );
+        auto C2 = C( ALL, ind2 );
+
+        if( orientB == NORMAL )
+        {
+            Recursive<F>( orientB, A, B(ind1,ind1), C1, cutoff );
+            Gemm( NORMAL, NORMAL, F(-1), C1, B(ind1,ind2), F(1), C2 );
+            Recursive<F>( orientB, A, B(ind2,ind2), C2, cutoff );
+        }
+        else
+        {
+            Recursive<F>( orientB, A, B(ind2,ind2), C2, cutoff );
+            Gemm( NORMAL, orientB, F(-1), C2, B(ind1,ind2), F(1), C1 );
+            Recursive<F>( orientB, A, B(ind1,ind1), C1, cutoff );
+        }
+    }
+}
+
+} // namespace sylvester
+
+template<typename F>
+void TriangularSylvester
+( Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& C,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != B.Width() )
+          LogicError("B must be square");
+      if( C.Height() != A.Height() || C.Width() != B.Height() )
+          LogicError("C must conform with A and B");
+    )
+    // Splitting a matrix of size two could only isolate a 2x2 block
+    sylvester::Recursive<F>( orientB, A, B, C, Max(cutoff,Int(2)) );
+}
+
+template<typename F>
+void TriangularSylvester
+( Orientation orientB,
+  const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& BPre,
+        ElementalMatrix<F>& CPre,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( BPre.Height() != BPre.Width() )
+          LogicError("B must be square");
+      if( CPre.Height() != APre.Height() || CPre.Width() != BPre.Height() )
+          LogicError("C must conform with A and B");
+      AssertSameGrids( APre, BPre, CPre );
+    )
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+    sylvester::Recursive<F>( orientB, A, B, C, Max(cutoff,Int(2)) );
+}
+
+#define PROTO(F) \
+  template void TriangularSylvester \
+  ( Orientation orientB, \
+    const Matrix<F>& A, \
+    const Matrix<F>& B, \
+          Matrix<F>& C, \
+    Int cutoff ); \
+  template void TriangularSylvester \
+  ( Orientation orientB, \
+    const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+          ElementalMatrix<F>& C, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
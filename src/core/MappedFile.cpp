@@ -0,0 +1,208 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#ifdef EL_HAVE_MMAP
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace El {
+
+namespace {
+
+#ifdef EL_HAVE_MMAP
+// Expand [buffer,buffer+numBytes) to the enclosing page boundaries, as
+// required by madvise. Ranges outside of the mapping (e.g., those of a matrix
+// which was never attached to it) result in an empty range.
+void PageAlign
+( const byte* base, size_t size, const void* buffer, size_t numBytes,
+  byte*& alignedBuffer, size_t& alignedNumBytes )
+{
+    const size_t pageSize = sysconf( _SC_PAGESIZE );
+    const byte* bufferBytes = static_cast<const byte*>(buffer);
+    if( bufferBytes < base || bufferBytes >= base+size )
+    {
+        alignedBuffer = const_cast<byte*>(base);
+        alignedNumBytes = 0;
+        return;
+    }
+    const size_t beg = bufferBytes - base;
+    const size_t end = Min( beg+numBytes, size );
+    const size_t alignedBeg = (beg/pageSize)*pageSize;
+    alignedBuffer = const_cast<byte*>(base) + alignedBeg;
+    alignedNumBytes = ( end > alignedBeg ? end-alignedBeg : 0 );
+}
+#endif
+
+} // anonymous namespace
+
+MappedFile::MappedFile() { }
+
+MappedFile::MappedFile
+( const string& filename, MappedFileMode mode, size_t numBytes )
+{ Open( filename, mode, numBytes ); }
+
+MappedFile::~MappedFile()
+{
+    try { Close(); }
+    catch( std::exception& e ) { ReportException(e); }
+}
+
+void MappedFile::Open
+( const string& filename, MappedFileMode mode, size_t numBytes )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MMAP
+    Close();
+    filename_ = filename;
+    writable_ = ( mode != MAPPED_READ_ONLY );
+
+    int flags = ( writable_ ? O_RDWR : O_RDONLY );
+    if( mode == MAPPED_CREATE )
+        flags |= O_CREAT | O_TRUNC;
+    fileDesc_ = ::open( filename.c_str(), flags, 0644 );
+    if( fileDesc_ < 0 )
+        RuntimeError("Could not open ",filename);
+
+    if( mode == MAPPED_CREATE )
+    {
+        if( ftruncate( fileDesc_, numBytes ) != 0 )
+            RuntimeError
+            ("Could not resize ",filename," to ",numBytes," bytes");
+        size_ = numBytes;
+    }
+    else
+    {
+        struct stat fileStat;
+        if( fstat( fileDesc_, &fileStat ) != 0 )
+            RuntimeError("Could not determine the size of ",filename);
+        size_ = fileStat.st_size;
+        if( numBytes != 0 && numBytes != size_ )
+            RuntimeError
+            ("Expected ",filename," to be ",numBytes," bytes but found ",
+             size_);
+    }
+
+    if( size_ > 0 )
+    {
+        const int prot = ( writable_ ? PROT_READ|PROT_WRITE : PROT_READ );
+        void* buffer = mmap( 0, size_, prot, MAP_SHARED, fileDesc_, 0 );
+        if( buffer == MAP_FAILED )
+            RuntimeError("Could not map ",filename);
+        buffer_ = static_cast<byte*>(buffer);
+    }
+#else
+    LogicError("Memory-mapped files are not supported on this platform");
+#endif
+}
+
+void MappedFile::Close()
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MMAP
+    if( buffer_ != nullptr )
+    {
+        if( writable_ )
+            msync( buffer_, size_, MS_SYNC );
+        munmap( buffer_, size_ );
+        buffer_ = nullptr;
+    }
+    if( fileDesc_ >= 0 )
+    {
+        ::close( fileDesc_ );
+        fileDesc_ = -1;
+    }
+#endif
+    size_ = 0;
+    writable_ = false;
+    filename_.clear();
+}
+
+void MappedFile::Sync()
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MMAP
+    if( buffer_ != nullptr && writable_ )
+        if( msync( buffer_, size_, MS_SYNC ) != 0 )
+            RuntimeError("Could not synchronize ",filename_);
+#endif
+}
+
+void MappedFile::Advise( MappedAccess access )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MMAP
+    if( buffer_ == nullptr )
+        return;
+    int advice = MADV_NORMAL;
+    if( access == SEQUENTIAL_ACCESS )
+        advice = MADV_SEQUENTIAL;
+    else if( access == RANDOM_ACCESS )
+        advice = MADV_RANDOM;
+    // NOTE: Advice is only a hint, and so failures are ignored
+    madvise( buffer_, size_, advice );
+#endif
+}
+
+void MappedFile::Prefetch( const void* buffer, size_t numBytes )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MMAP
+    if( buffer_ == nullptr || numBytes == 0 )
+        return;
+    byte* alignedBuffer;
+    size_t alignedNumBytes;
+    PageAlign
+    ( buffer_, size_, buffer, numBytes, alignedBuffer, alignedNumBytes );
+    if( alignedNumBytes > 0 )
+        madvise( alignedBuffer, alignedNumBytes, MADV_WILLNEED );
+#endif
+}
+
+void MappedFile::Evict( const void* buffer, size_t numBytes )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MMAP
+    if( buffer_ == nullptr || numBytes == 0 )
+        return;
+    byte* alignedBuffer;
+    size_t alignedNumBytes;
+    PageAlign
+    ( buffer_, size_, buffer, numBytes, alignedBuffer, alignedNumBytes );
+    if( alignedNumBytes == 0 )
+        return;
+    // Modified pages must reach the file before they are dropped
+    if( writable_ )
+        msync( alignedBuffer, alignedNumBytes, MS_ASYNC );
+    madvise( alignedBuffer, alignedNumBytes, MADV_DONTNEED );
+#endif
+}
+
+const string& MappedFile::Filename() const EL_NO_EXCEPT { return filename_; }
+bool MappedFile::Mapped() const EL_NO_EXCEPT { return buffer_ != nullptr; }
+bool MappedFile::Writable() const EL_NO_EXCEPT { return writable_; }
+size_t MappedFile::Size() const EL_NO_EXCEPT { return size_; }
+
+byte* MappedFile::Buffer( size_t offset ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_ONLY(
+      if( !writable_ )
+          LogicError("Cannot modify the read-only mapping of ",filename_);
+    )
+    return buffer_ + offset;
+}
+
+const byte* MappedFile::LockedBuffer( size_t offset ) const
+EL_NO_RELEASE_EXCEPT
+{ return buffer_ + offset; }
+
+} // namespace El
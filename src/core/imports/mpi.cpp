@@ -32,6 +32,34 @@ SafeMpi( int mpiError ) EL_NO_RELEASE_EXCEPT
     )
 }
 
+// Unlike communication, a failed file operation (with the default
+// MPI_ERRORS_RETURN handler for files) leaves garbage data rather than
+// aborting, so its error codes are checked even in release mode
+inline void
+SafeMpiIO( int mpiError, const char* routine )
+{
+    if( mpiError != MPI_SUCCESS )
+    {
+        char errorString[MPI_MAX_ERROR_STRING];
+        int lengthOfErrorString;
+        MPI_Error_string( mpiError, errorString, &lengthOfErrorString );
+        El::RuntimeError(routine," failed: ",std::string(errorString));
+    }
+}
+
+// Ensure that a file read or write transferred all of the requested entries
+inline void
+CheckIOCount
+( const MPI_Status& status, MPI_Datatype type, int count,
+  const char* routine )
+{
+    int transferred;
+    SafeMpiIO( MPI_Get_count( &status, type, &transferred ), routine );
+    if( transferred != count )
+        El::RuntimeError
+        (routine," only transferred ",transferred," of ",count," entries");
+}
+
 template<typename T>
 MPI_Op NativeOp( const El::mpi::Op& op )
 {
@@ -129,6 +157,40 @@ void Free( Datatype& type ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Type_free( &type ) );
 }
 
+// Derived datatypes
+// =================
+void Commit( Datatype& type ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Type_commit( &type ) );
+}
+
+void CreateContiguous
+( int count, Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Type_contiguous( count, oldType, &newType ) );
+}
+
+void CreateVector
+( int count, int blocklength, int stride,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Type_vector( count, blocklength, stride, oldType, &newType ) );
+}
+
+void CreateHVector
+( int count, int blocklength, Aint stride,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Type_create_hvector
+      ( count, blocklength, stride, oldType, &newType ) );
+}
+
 // Communicator manipulation
 // =========================
 int Rank( Comm comm ) EL_NO_RELEASE_EXCEPT
@@ -401,6 +463,95 @@ void Barrier( Comm comm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Barrier( comm.comm ) );
 }
 
+// Parallel file I/O
+// =================
+
+void FileOpen
+( Comm comm, const std::string& filename, int amode, File& file )
+{
+    EL_DEBUG_CSE
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), amode,
+        MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+}
+
+void FileClose( File& file )
+{
+    EL_DEBUG_CSE
+    SafeMpiIO( MPI_File_close( &file ), "MPI_File_close" );
+}
+
+Offset FileSize( File file )
+{
+    EL_DEBUG_CSE
+    Offset size;
+    SafeMpiIO( MPI_File_get_size( file, &size ), "MPI_File_get_size" );
+    return size;
+}
+
+void FileSetSize( File file, Offset size )
+{
+    EL_DEBUG_CSE
+    SafeMpiIO( MPI_File_set_size( file, size ), "MPI_File_set_size" );
+}
+
+void FileSetView
+( File file, Offset disp, Datatype etype, Datatype filetype )
+{
+    EL_DEBUG_CSE
+    SafeMpiIO
+    ( MPI_File_set_view
+      ( file, disp, etype, filetype, const_cast<char*>("native"),
+        MPI_INFO_NULL ), "MPI_File_set_view" );
+}
+
+void FileReadAt
+( File file, Offset offset, void* buf, int count, Datatype type )
+{
+    EL_DEBUG_CSE
+    Status status;
+    SafeMpiIO
+    ( MPI_File_read_at( file, offset, buf, count, type, &status ),
+      "MPI_File_read_at" );
+    CheckIOCount( status, type, count, "MPI_File_read_at" );
+}
+
+void FileWriteAt
+( File file, Offset offset, const void* buf, int count, Datatype type )
+{
+    EL_DEBUG_CSE
+    Status status;
+    SafeMpiIO
+    ( MPI_File_write_at
+      ( file, offset, const_cast<void*>(buf), count, type, &status ),
+      "MPI_File_write_at" );
+    CheckIOCount( status, type, count, "MPI_File_write_at" );
+}
+
+void FileReadAll( File file, void* buf, int count, Datatype type )
+{
+    EL_DEBUG_CSE
+    Status status;
+    SafeMpiIO
+    ( MPI_File_read_all( file, buf, count, type, &status ),
+      "MPI_File_read_all" );
+    CheckIOCount( status, type, count, "MPI_File_read_all" );
+}
+
+void FileWriteAll( File file, const void* buf, int count, Datatype type )
+{
+    EL_DEBUG_CSE
+    Status status;
+    SafeMpiIO
+    ( MPI_File_write_all
+      ( file, const_cast<void*>(buf), count, type, &status ),
+      "MPI_File_write_all" );
+    CheckIOCount( status, type, count, "MPI_File_write_all" );
+}
+
 // Test for completion
 template<typename T>
 bool Test( Request<T>& request ) EL_NO_RELEASE_EXCEPT
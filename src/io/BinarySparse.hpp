@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_BINARYSPARSE_HPP
+#define EL_IO_BINARYSPARSE_HPP
+
+namespace El {
+namespace binary_sparse {
+
+// The BINARY_SPARSE format stores a matrix in Compressed Sparse Row form as
+//
+//   [header][row offsets][column indices][values]
+//
+// where the header occupies exactly 64 bytes and each of the three arrays
+// begins on a 64-byte boundary, so that the file may be memory-mapped and
+// each section reinterpreted in place. Since the (height+1) row offsets are
+// global, any contiguous block of rows -- e.g., the local rows of a
+// DistSparseMatrix -- can be read independently of the rest of the file.
+
+const char magic[8] = { 'E', 'l', 'C', 'S', 'R', '\0', '\0', '\0' };
+const long long version = 1;
+const long long alignment = 64;
+
+struct Header
+{
+    char magic[8];
+    long long version;
+    long long indexBytes;
+    long long valueBytes;
+    long long isComplex;
+    long long height;
+    long long width;
+    long long numEntries;
+};
+static_assert( sizeof(Header) == 64, "Expected a 64-byte header" );
+
+struct Layout
+{
+    long long offsetsPos;
+    long long targetsPos;
+    long long valuesPos;
+    long long numBytes;
+};
+
+inline long long Align( long long pos )
+{ return ((pos+alignment-1)/alignment)*alignment; }
+
+template<typename T>
+inline Header BuildHeader( Int height, Int width, Int numEntries )
+{
+    Header header;
+    MemCopy( header.magic, magic, 8 );
+    header.version = version;
+    header.indexBytes = sizeof(Int);
+    header.valueBytes = sizeof(T);
+    header.isComplex = ( IsComplex<T>::value ? 1 : 0 );
+    header.height = height;
+    header.width = width;
+    header.numEntries = numEntries;
+    return header;
+}
+
+template<typename T>
+inline void CheckHeader( const Header& header, const string filename )
+{
+    EL_DEBUG_CSE
+    for( Int k=0; k<8; ++k )
+        if( header.magic[k] != magic[k] )
+            RuntimeError(filename," is not a BINARY_SPARSE file");
+    if( header.version != version )
+        RuntimeError
+        ("Unsupported BINARY_SPARSE version ",header.version," in ",filename);
+    if( header.indexBytes != Int(sizeof(Int)) )
+        RuntimeError
+        (filename," was written with ",header.indexBytes,"-byte indices but "
+         "Elemental was configured with ",sizeof(Int),"-byte indices");
+    if( header.valueBytes != Int(sizeof(T)) ||
+        header.isComplex != (IsComplex<T>::value ? 1 : 0) )
+        RuntimeError(filename," does not match the requested scalar type");
+    if( header.height < 0 || header.width < 0 || header.numEntries < 0 )
+        RuntimeError("Invalid dimensions in the header of ",filename);
+}
+
+template<typename T>
+inline Layout ComputeLayout( const Header& header )
+{
+    Layout layout;
+    layout.offsetsPos = sizeof(Header);
+    layout.targetsPos =
+      Align( layout.offsetsPos + (header.height+1)*header.indexBytes );
+    layout.valuesPos =
+      Align( layout.targetsPos + header.numEntries*header.indexBytes );
+    layout.numBytes = layout.valuesPos + header.numEntries*header.valueBytes;
+    return layout;
+}
+
+inline Header
+ReadHeader( std::ifstream& file, const string filename )
+{
+    EL_DEBUG_CSE
+    Header header;
+    file.read( (char*)&header, sizeof(header) );
+    if( !file )
+        RuntimeError("Could not read the header of ",filename);
+    return header;
+}
+
+// Read the entries of rows [firstRow,firstRow+numRows) into the already
+// sized source, target, offset, and value buffers of a (Dist)SparseMatrix.
+// The offsets are shifted so that they are relative to the first entry.
+// Since the offsets and column indices determine buffer sizes and insertion
+// locations, they are validated before being used.
+template<typename T>
+inline void ReadRows
+( std::ifstream& file,
+  const Header& header,
+  const Layout& layout,
+  Int firstRow, Int numRows,
+  Int* offsetBuf, Int* sourceBuf, Int* targetBuf, T* valueBuf )
+{
+    EL_DEBUG_CSE
+    file.seekg( layout.offsetsPos + firstRow*sizeof(Int) );
+    file.read( (char*)offsetBuf, (numRows+1)*sizeof(Int) );
+    if( !file )
+        RuntimeError("Could not read the requested row offsets");
+    if( firstRow == 0 && offsetBuf[0] != 0 )
+        RuntimeError("The first row offset was ",offsetBuf[0],", not 0");
+    if( firstRow+numRows == header.height &&
+        offsetBuf[numRows] != header.numEntries )
+        RuntimeError
+        ("The last row offset was ",offsetBuf[numRows],", not ",
+         header.numEntries);
+    if( offsetBuf[0] < 0 || offsetBuf[numRows] > header.numEntries )
+        RuntimeError("The row offsets were out of bounds");
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+        if( offsetBuf[iLoc] > offsetBuf[iLoc+1] )
+            RuntimeError("The row offsets were not monotone");
+
+    const Int firstEntry = offsetBuf[0];
+    const Int numEntries = offsetBuf[numRows] - firstEntry;
+    file.seekg( layout.targetsPos + firstEntry*sizeof(Int) );
+    file.read( (char*)targetBuf, numEntries*sizeof(Int) );
+    file.seekg( layout.valuesPos + firstEntry*sizeof(T) );
+    file.read( (char*)valueBuf, numEntries*sizeof(T) );
+    if( !file )
+        RuntimeError("Could not read the requested rows");
+    for( Int e=0; e<numEntries; ++e )
+        if( targetBuf[e] < 0 || targetBuf[e] >= header.width )
+            RuntimeError
+            ("Column index ",targetBuf[e]," was not in [0,",header.width,")");
+
+    for( Int iLoc=0; iLoc<=numRows; ++iLoc )
+        offsetBuf[iLoc] -= firstEntry;
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+            sourceBuf[e] = firstRow + iLoc;
+}
+
+} // namespace binary_sparse
+} // namespace El
+
+#endif // ifndef EL_IO_BINARYSPARSE_HPP
@@ -0,0 +1,688 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+const string manifestMagic = "ElementalCheckpoint";
+const Int manifestVersion = 1;
+
+bool ValidName( const string& name )
+{ return !name.empty() && name.find_first_of(" \t\r\n") == string::npos; }
+
+// Entries are stored in their native binary representation, except for the
+// arbitrary-precision types, which are serialized
+template<typename T>
+void Put( std::ofstream& file, const T* buf, Int n )
+{ file.write( reinterpret_cast<const char*>(buf), n*sizeof(T) ); }
+
+template<typename T>
+void Get( std::ifstream& file, T* buf, Int n )
+{ file.read( reinterpret_cast<char*>(buf), n*sizeof(T) ); }
+
+#ifdef EL_HAVE_MPC
+template<typename T>
+void PutSerialized( std::ofstream& file, const T* buf, Int n )
+{
+    vector<byte> packed;
+    Serialize( n, buf, packed );
+    file.write( reinterpret_cast<const char*>(packed.data()), packed.size() );
+}
+
+template<typename T>
+void GetSerialized( std::ifstream& file, T* buf, Int n )
+{
+    vector<byte> packed;
+    ReserveSerialized( n, buf, packed );
+    file.read( reinterpret_cast<char*>(packed.data()), packed.size() );
+    Deserialize( n, packed.data(), buf );
+}
+
+void Put( std::ofstream& file, const BigInt* buf, Int n )
+{ PutSerialized( file, buf, n ); }
+void Put( std::ofstream& file, const BigFloat* buf, Int n )
+{ PutSerialized( file, buf, n ); }
+void Put( std::ofstream& file, const Complex<BigFloat>* buf, Int n )
+{ PutSerialized( file, buf, n ); }
+
+void Get( std::ifstream& file, BigInt* buf, Int n )
+{ GetSerialized( file, buf, n ); }
+void Get( std::ifstream& file, BigFloat* buf, Int n )
+{ GetSerialized( file, buf, n ); }
+void Get( std::ifstream& file, Complex<BigFloat>* buf, Int n )
+{ GetSerialized( file, buf, n ); }
+#endif // ifdef EL_HAVE_MPC
+
+template<typename T>
+void PutMatrix( std::ofstream& file, const Matrix<T>& A )
+{
+    for( Int j=0; j<A.Width(); ++j )
+        Put( file, A.LockedBuffer(0,j), A.Height() );
+}
+
+template<typename T>
+void GetMatrix( std::ifstream& file, Matrix<T>& A )
+{
+    for( Int j=0; j<A.Width(); ++j )
+        Get( file, A.Buffer(0,j), A.Height() );
+}
+
+void OpenSection( std::ifstream& file, const string& filename, Int offset )
+{
+    file.open( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.seekg( offset );
+}
+
+void CheckSection( const std::ifstream& file, const string& filename )
+{
+    if( file.fail() )
+        RuntimeError("Could not read checkpoint data from ",filename);
+}
+
+// The 'DistMatrix' sections store the local dimensions and global indices of
+// the entries owned by the process before the entries themselves
+template<typename T>
+void GetDistMatrixSection
+( std::ifstream& file, vector<Int>& rows, vector<Int>& cols, Matrix<T>& ALoc )
+{
+    Int dims[2];
+    Get( file, dims, 2 );
+    rows.resize( dims[0] );
+    cols.resize( dims[1] );
+    Get( file, rows.data(), dims[0] );
+    Get( file, cols.data(), dims[1] );
+    ALoc.Resize( dims[0], dims[1] );
+    GetMatrix( file, ALoc );
+}
+
+} // anonymous namespace
+
+// CheckpointWriter
+// ================
+
+CheckpointWriter::CheckpointWriter( const string& basename, mpi::Comm comm )
+: basename_(basename), comm_(comm)
+{
+    EL_DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+
+    // Determine the previous generation (if any) so that its files can be
+    // removed once this one has been committed
+    Int prevInfo[2] = { -1, 0 };
+    if( commRank == 0 )
+    {
+        std::ifstream manifest( (basename+".manifest").c_str() );
+        string line;
+        while( std::getline( manifest, line ) )
+        {
+            std::istringstream ls( line );
+            string key;
+            ls >> key;
+            if( key == "generation" )
+                ls >> prevInfo[0];
+            else if( key == "processes" )
+                ls >> prevInfo[1];
+        }
+    }
+    mpi::Broadcast( prevInfo, 2, 0, comm );
+    prevGeneration_ = prevInfo[0];
+    prevNumProcesses_ = prevInfo[1];
+    generation_ = prevGeneration_ + 1;
+
+    const string filename = Filename( generation_, commRank );
+    file_.open( filename.c_str(), std::ios::binary|std::ios::trunc );
+    if( !file_.is_open() )
+        RuntimeError("Could not open ",filename);
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+    // An uncommitted generation is never referenced by a manifest
+    if( !committed_ )
+    {
+        file_.close();
+        std::remove( Filename(generation_,mpi::Rank(comm_)).c_str() );
+    }
+}
+
+string CheckpointWriter::Filename( Int generation, int rank ) const
+{ return BuildString(basename_,".",generation,".",rank); }
+
+void CheckpointWriter::AddRecord
+( const string& name, const string& kind, const string& type,
+  Int height, Int width, bool hasSection )
+{
+    EL_DEBUG_CSE
+    if( committed_ )
+        LogicError("Cannot add ",name," to a committed checkpoint");
+    if( !ValidName(name) )
+        LogicError("Invalid checkpoint object name \"",name,"\"");
+    for( const auto& record : records_ )
+        if( record.name == name )
+            LogicError("Checkpoint already contains ",name);
+    const Int offset = ( hasSection ? Int(file_.tellp()) : Int(-1) );
+    records_.push_back( Record{name,kind,type,height,width,offset} );
+}
+
+void CheckpointWriter::AddState( const string& name, const string& value )
+{
+    EL_DEBUG_CSE
+    if( committed_ )
+        LogicError("Cannot add ",name," to a committed checkpoint");
+    if( !ValidName(name) || value.find('\n') != string::npos )
+        LogicError("Invalid checkpoint state \"",name,"\"");
+    for( const auto& state : states_ )
+        if( state.first == name )
+            LogicError("Checkpoint already contains state ",name);
+    states_.emplace_back( name, value );
+}
+
+template<typename T>
+void CheckpointWriter::Write( const string& name, const Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    const bool root = ( mpi::Rank(comm_) == 0 );
+    AddRecord( name, "Matrix", TypeName<T>(), A.Height(), A.Width(), root );
+    if( root )
+        PutMatrix( file_, A );
+}
+
+template<typename T>
+void CheckpointWriter::Write
+( const string& name, const AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    AddRecord( name, "DistMatrix", TypeName<T>(), A.Height(), A.Width() );
+
+    // Only one member of each redundant team stores its entries
+    const bool owner = A.Participating() && A.RedundantRank() == 0;
+    const Int localHeight = ( owner ? A.LocalHeight() : 0 );
+    const Int localWidth = ( owner ? A.LocalWidth() : 0 );
+    vector<Int> rows(localHeight), cols(localWidth);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rows[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        cols[jLoc] = A.GlobalCol(jLoc);
+
+    const Int dims[2] = { localHeight, localWidth };
+    Put( file_, dims, 2 );
+    Put( file_, rows.data(), localHeight );
+    Put( file_, cols.data(), localWidth );
+    if( owner )
+        PutMatrix( file_, A.LockedMatrix() );
+}
+
+template<typename T>
+void CheckpointWriter::Write( const string& name, const DistMultiVec<T>& X )
+{
+    EL_DEBUG_CSE
+    AddRecord( name, "DistMultiVec", TypeName<T>(), X.Height(), X.Width() );
+    const Int header[2] = { X.FirstLocalRow(), X.LocalHeight() };
+    Put( file_, header, 2 );
+    PutMatrix( file_, X.LockedMatrix() );
+}
+
+template<typename T>
+void CheckpointWriter::Write
+( const string& name, const DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( !A.LocallyConsistent() )
+        LogicError("Sparse matrix must be consistent to be checkpointed");
+    AddRecord( name, "DistSparseMatrix", TypeName<T>(), A.Height(), A.Width() );
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int header[3] = { A.FirstLocalRow(), localHeight, numLocalEntries };
+    Put( file_, header, 3 );
+    Put( file_, A.LockedOffsetBuffer(), localHeight+1 );
+    Put( file_, A.LockedTargetBuffer(), numLocalEntries );
+    Put( file_, A.LockedValueBuffer(), numLocalEntries );
+}
+
+void CheckpointWriter::Commit()
+{
+    EL_DEBUG_CSE
+    if( committed_ )
+        LogicError("Checkpoint was already committed");
+    const int commRank = mpi::Rank( comm_ );
+    const int commSize = mpi::Size( comm_ );
+
+    // Make sure that every process has successfully written its file before
+    // any manifest refers to it
+    file_.close();
+    const int wroteFile = !file_.fail();
+    if( !mpi::AllReduce( wroteFile, mpi::MIN, comm_ ) )
+        RuntimeError("Could not write checkpoint ",basename_);
+
+    const Int numRecords = records_.size();
+    vector<Int> offsets(numRecords), allOffsets;
+    for( Int k=0; k<numRecords; ++k )
+        offsets[k] = records_[k].offset;
+    if( commRank == 0 )
+        allOffsets.resize( numRecords*commSize );
+    mpi::Gather
+    ( offsets.data(), numRecords, allOffsets.data(), numRecords, 0, comm_ );
+
+    // Atomically replace the manifest. Any failure on the root is reported
+    // through the broadcast so that every process throws together.
+    int wroteManifest = 1;
+    string error;
+    if( commRank == 0 )
+    {
+        const string manifestName = basename_ + ".manifest";
+        const string tmpName = manifestName + ".tmp";
+        try
+        {
+            std::ofstream manifest( tmpName.c_str() );
+            manifest << manifestMagic << " " << manifestVersion << "\n"
+                     << "generation " << generation_ << "\n"
+                     << "processes " << commSize << "\n";
+            for( const auto& state : states_ )
+                manifest << "state " << state.first << " "
+                         << state.second << "\n";
+            for( Int k=0; k<numRecords; ++k )
+            {
+                const auto& record = records_[k];
+                manifest << "object " << record.name << " " << record.kind
+                         << " " << record.type << " " << record.height
+                         << " " << record.width << "\n" << "offsets";
+                for( int q=0; q<commSize; ++q )
+                    manifest << " " << allOffsets[k+q*numRecords];
+                manifest << "\n";
+            }
+            manifest.close();
+            wroteManifest = !manifest.fail();
+        }
+        catch( std::exception& e )
+        {
+            error = e.what();
+            wroteManifest = 0;
+        }
+        if( wroteManifest )
+            wroteManifest =
+              ( std::rename( tmpName.c_str(), manifestName.c_str() ) == 0 );
+        else
+            std::remove( tmpName.c_str() );
+    }
+    mpi::Broadcast( wroteManifest, 0, comm_ );
+    if( !wroteManifest )
+    {
+        if( !error.empty() )
+            RuntimeError
+            ("Could not write the manifest of ",basename_,": ",error);
+        RuntimeError("Could not write the manifest of ",basename_);
+    }
+    committed_ = true;
+
+    // The previous generation is no longer referenced
+    if( prevGeneration_ >= 0 )
+    {
+        if( commRank < prevNumProcesses_ )
+            std::remove( Filename(prevGeneration_,commRank).c_str() );
+        if( commRank == 0 )
+            for( int q=commSize; q<prevNumProcesses_; ++q )
+                std::remove( Filename(prevGeneration_,q).c_str() );
+    }
+}
+
+// CheckpointReader
+// ================
+
+bool CheckpointReader::Exists( const string& basename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    int exists = 0;
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ifstream manifest( (basename+".manifest").c_str() );
+        exists = manifest.is_open();
+    }
+    mpi::Broadcast( exists, 0, comm );
+    return exists;
+}
+
+CheckpointReader::CheckpointReader( const string& basename, mpi::Comm comm )
+: basename_(basename), comm_(comm)
+{
+    EL_DEBUG_CSE
+    // Read the manifest on the root and broadcast its contents
+    int found = 0;
+    vector<byte> contents;
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ifstream manifest( (basename+".manifest").c_str() );
+        if( manifest.is_open() )
+        {
+            found = 1;
+            std::ostringstream os;
+            os << manifest.rdbuf();
+            const string str = os.str();
+            contents.assign( str.begin(), str.end() );
+        }
+    }
+    mpi::Broadcast( found, 0, comm );
+    if( !found )
+        RuntimeError("Could not open ",basename,".manifest");
+    int numBytes = contents.size();
+    mpi::Broadcast( numBytes, 0, comm );
+    contents.resize( numBytes );
+    mpi::Broadcast( contents.data(), numBytes, 0, comm );
+
+    std::istringstream is( string(contents.begin(),contents.end()) );
+    string magic;
+    Int version;
+    is >> magic >> version;
+    if( magic != manifestMagic || version != manifestVersion )
+        RuntimeError(basename,".manifest is not a checkpoint manifest");
+    string line;
+    std::getline( is, line );
+    while( std::getline( is, line ) )
+    {
+        std::istringstream ls( line );
+        string key;
+        ls >> key;
+        if( key.empty() )
+            continue;
+        else if( key == "generation" )
+            ls >> generation_;
+        else if( key == "processes" )
+            ls >> numProcesses_;
+        else if( key == "state" )
+        {
+            string name, value;
+            ls >> name >> std::ws;
+            std::getline( ls, value );
+            states_.emplace_back( name, value );
+        }
+        else if( key == "object" )
+        {
+            Record record;
+            ls >> record.name >> record.kind >> record.type
+               >> record.height >> record.width;
+            records_.push_back( record );
+        }
+        else if( key == "offsets" && !records_.empty() )
+        {
+            Int offset;
+            while( ls >> offset )
+                records_.back().offsets.push_back( offset );
+        }
+        else
+            RuntimeError("Unrecognized entry in ",basename,".manifest: ",line);
+    }
+    for( const auto& record : records_ )
+        if( Int(record.offsets.size()) != numProcesses_ )
+            RuntimeError("Missing offsets for ",record.name);
+}
+
+bool CheckpointReader::Has( const string& name ) const
+{
+    for( const auto& record : records_ )
+        if( record.name == name )
+            return true;
+    return false;
+}
+
+const CheckpointReader::Record& CheckpointReader::Find
+( const string& name, const string& kind, const string& type ) const
+{
+    EL_DEBUG_CSE
+    for( const auto& record : records_ )
+    {
+        if( record.name != name )
+            continue;
+        if( record.kind != kind || record.type != type )
+            LogicError
+            ("Checkpointed ",name," is a ",record.kind,"<",record.type,
+             "> rather than a ",kind,"<",type,">");
+        return record;
+    }
+    LogicError("Checkpoint ",basename_," does not contain ",name);
+    return records_.front();
+}
+
+string CheckpointReader::Filename( int rank ) const
+{ return BuildString(basename_,".",generation_,".",rank); }
+
+const string& CheckpointReader::StateString( const string& name ) const
+{
+    for( const auto& state : states_ )
+        if( state.first == name )
+            return state.second;
+    LogicError("Checkpoint ",basename_," does not contain the state ",name);
+    return states_.front().second;
+}
+
+template<typename T>
+void CheckpointReader::Read( const string& name, Matrix<T>& A ) const
+{
+    EL_DEBUG_CSE
+    const auto& record = Find( name, "Matrix", TypeName<T>() );
+    A.Resize( record.height, record.width );
+    std::ifstream file;
+    const string filename = Filename(0);
+    OpenSection( file, filename, record.offsets[0] );
+    GetMatrix( file, A );
+    CheckSection( file, filename );
+}
+
+template<typename T>
+void CheckpointReader::Read
+( const string& name, AbstractDistMatrix<T>& A ) const
+{
+    EL_DEBUG_CSE
+    const auto& record = Find( name, "DistMatrix", TypeName<T>() );
+    const int commRank = mpi::Rank( comm_ );
+    const int commSize = mpi::Size( comm_ );
+    A.Resize( record.height, record.width );
+
+    vector<Int> rows, cols;
+    Matrix<T> ALoc;
+
+    // If every process would own exactly the entries it stored, then the
+    // local matrices can be read in place
+    if( numProcesses_ == commSize )
+    {
+        std::ifstream file;
+        const string filename = Filename(commRank);
+        OpenSection( file, filename, record.offsets[commRank] );
+        GetDistMatrixSection( file, rows, cols, ALoc );
+        CheckSection( file, filename );
+
+        const bool owner = A.Participating() && A.RedundantRank() == 0;
+        const Int localHeight = ( A.Participating() ? A.LocalHeight() : 0 );
+        const Int localWidth = ( A.Participating() ? A.LocalWidth() : 0 );
+        bool match;
+        if( owner )
+        {
+            match = ( ALoc.Height() == localHeight &&
+                      ALoc.Width() == localWidth );
+            for( Int iLoc=0; match && iLoc<localHeight; ++iLoc )
+                match = ( rows[iLoc] == A.GlobalRow(iLoc) );
+            for( Int jLoc=0; match && jLoc<localWidth; ++jLoc )
+                match = ( cols[jLoc] == A.GlobalCol(jLoc) );
+        }
+        else
+            match = ( localHeight*localWidth == 0 );
+        if( mpi::AllReduce( int(match), mpi::MIN, comm_ ) )
+        {
+            if( owner )
+                A.Matrix() = ALoc;
+            return;
+        }
+    }
+
+    // Otherwise, each process reads a subset of the files and sends each
+    // entry to its new owner(s)
+    Zero( A );
+    const Int numRounds = (numProcesses_+commSize-1) / commSize;
+    for( Int round=0; round<numRounds; ++round )
+    {
+        const Int q = round*commSize + commRank;
+        if( q < numProcesses_ )
+        {
+            std::ifstream file;
+            const string filename = Filename(q);
+            OpenSection( file, filename, record.offsets[q] );
+            GetDistMatrixSection( file, rows, cols, ALoc );
+            CheckSection( file, filename );
+
+            A.Reserve( ALoc.Height()*ALoc.Width() );
+            for( Int jLoc=0; jLoc<ALoc.Width(); ++jLoc )
+                for( Int iLoc=0; iLoc<ALoc.Height(); ++iLoc )
+                    A.QueueUpdate( rows[iLoc], cols[jLoc], ALoc(iLoc,jLoc) );
+        }
+        A.ProcessQueues();
+    }
+}
+
+template<typename T>
+void CheckpointReader::Read( const string& name, DistMultiVec<T>& X ) const
+{
+    EL_DEBUG_CSE
+    const auto& record = Find( name, "DistMultiVec", TypeName<T>() );
+    const int commRank = mpi::Rank( comm_ );
+    const int commSize = mpi::Size( comm_ );
+    const Int width = record.width;
+    X.Resize( record.height, width );
+
+    Int header[2];
+    Matrix<T> XLoc;
+    if( numProcesses_ == commSize )
+    {
+        std::ifstream file;
+        const string filename = Filename(commRank);
+        OpenSection( file, filename, record.offsets[commRank] );
+        Get( file, header, 2 );
+        CheckSection( file, filename );
+        const bool match = ( header[0] == X.FirstLocalRow() &&
+                             header[1] == X.LocalHeight() );
+        if( mpi::AllReduce( int(match), mpi::MIN, comm_ ) )
+        {
+            GetMatrix( file, X.Matrix() );
+            CheckSection( file, filename );
+            return;
+        }
+    }
+
+    Zero( X );
+    const Int numRounds = (numProcesses_+commSize-1) / commSize;
+    for( Int round=0; round<numRounds; ++round )
+    {
+        const Int q = round*commSize + commRank;
+        if( q < numProcesses_ )
+        {
+            std::ifstream file;
+            const string filename = Filename(q);
+            OpenSection( file, filename, record.offsets[q] );
+            Get( file, header, 2 );
+            XLoc.Resize( header[1], width );
+            GetMatrix( file, XLoc );
+            CheckSection( file, filename );
+
+            X.Reserve( header[1]*width );
+            for( Int j=0; j<width; ++j )
+                for( Int iLoc=0; iLoc<header[1]; ++iLoc )
+                    X.QueueUpdate( header[0]+iLoc, j, XLoc(iLoc,j) );
+        }
+        X.ProcessQueues();
+    }
+}
+
+template<typename T>
+void CheckpointReader::Read
+( const string& name, DistSparseMatrix<T>& A ) const
+{
+    EL_DEBUG_CSE
+    const auto& record = Find( name, "DistSparseMatrix", TypeName<T>() );
+    const int commRank = mpi::Rank( comm_ );
+    const int commSize = mpi::Size( comm_ );
+    A.Resize( record.height, record.width );
+
+    Int header[3];
+    vector<Int> offsets, targets;
+    vector<T> values;
+    auto getSection = [&]( int q )
+    {
+        std::ifstream file;
+        const string filename = Filename(q);
+        OpenSection( file, filename, record.offsets[q] );
+        Get( file, header, 3 );
+        offsets.resize( header[1]+1 );
+        targets.resize( header[2] );
+        values.resize( header[2] );
+        Get( file, offsets.data(), header[1]+1 );
+        Get( file, targets.data(), header[2] );
+        Get( file, values.data(), header[2] );
+        CheckSection( file, filename );
+    };
+
+    // When the row distribution is unchanged, the entries are all local
+    if( numProcesses_ == commSize )
+    {
+        getSection( commRank );
+        const bool match = ( header[0] == A.FirstLocalRow() &&
+                             header[1] == A.LocalHeight() );
+        if( mpi::AllReduce( int(match), mpi::MIN, comm_ ) )
+        {
+            A.Reserve( header[2] );
+            for( Int iLoc=0; iLoc<header[1]; ++iLoc )
+                for( Int e=offsets[iLoc]; e<offsets[iLoc+1]; ++e )
+                    A.QueueLocalUpdate( iLoc, targets[e], values[e] );
+            A.ProcessLocalQueues();
+            return;
+        }
+    }
+
+    const Int numRounds = (numProcesses_+commSize-1) / commSize;
+    for( Int round=0; round<numRounds; ++round )
+    {
+        const Int q = round*commSize + commRank;
+        if( q < numProcesses_ )
+        {
+            getSection( q );
+            A.Reserve( header[2], header[2] );
+            for( Int iLoc=0; iLoc<header[1]; ++iLoc )
+                for( Int e=offsets[iLoc]; e<offsets[iLoc+1]; ++e )
+                    A.QueueUpdate( header[0]+iLoc, targets[e], values[e] );
+        }
+        A.ProcessQueues();
+    }
+}
+
+#define PROTO(T) \
+  template void CheckpointWriter::Write \
+  ( const string& name, const Matrix<T>& A ); \
+  template void CheckpointWriter::Write \
+  ( const string& name, const AbstractDistMatrix<T>& A ); \
+  template void CheckpointWriter::Write \
+  ( const string& name, const DistMultiVec<T>& X ); \
+  template void CheckpointWriter::Write \
+  ( const string& name, const DistSparseMatrix<T>& A ); \
+  template void CheckpointReader::Read \
+  ( const string& name, Matrix<T>& A ) const; \
+  template void CheckpointReader::Read \
+  ( const string& name, AbstractDistMatrix<T>& A ) const; \
+  template void CheckpointReader::Read \
+  ( const string& name, DistMultiVec<T>& X ) const; \
+  template void CheckpointReader::Read \
+  ( const string& name, DistSparseMatrix<T>& A ) const;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
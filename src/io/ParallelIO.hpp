@@ -0,0 +1,171 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_PARALLELIO_HPP
+#define EL_IO_PARALLELIO_HPP
+
+namespace El {
+namespace parallel_io {
+
+// For an element-wise distribution, the local entries of A are
+//
+//   A(colShift+iLoc*colStride,rowShift+jLoc*rowStride),
+//
+// so that, within a column-major file, they form 'localWidth' equally-spaced
+// copies of a strided vector of length 'localHeight'. This allows each
+// process to describe its portion of the file with a single MPI file view
+// and to read or write it with a single collective call.
+
+template<typename T>
+inline mpi::Datatype ElementType()
+{
+    mpi::Datatype elemType;
+    mpi::CreateContiguous( sizeof(T), mpi::TypeMap<byte>(), elemType );
+    mpi::Commit( elemType );
+    return elemType;
+}
+
+// A failed file operation might only be detected by some of the processes,
+// so the failure is agreed upon (and the file closed) before any process
+// throws, rather than leaving the others blocked in the next collective
+inline void CheckForFailure
+( const string& error, mpi::File file, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int numFailed = mpi::AllReduce( int(!error.empty()), comm );
+    if( numFailed == 0 )
+        return;
+    try { mpi::FileClose( file ); }
+    catch( std::exception& e ) { }
+    if( !error.empty() )
+        RuntimeError(error);
+    RuntimeError("A file operation failed on ",numFailed," other process(es)");
+}
+
+template<typename T>
+inline bool ActiveProcess( const AbstractDistMatrix<T>& A, bool writing )
+{
+    return A.Participating() &&
+           (!writing || A.RedundantRank() == 0) &&
+           A.LocalHeight() > 0 && A.LocalWidth() > 0;
+}
+
+// NOTE: This routine is collective over the communicator used to open 'file'
+template<typename T>
+inline void TransferLocal
+( mpi::File file, Int metaBytes, const AbstractDistMatrix<T>& A,
+  T* buffer, bool writing )
+{
+    EL_DEBUG_CSE
+    if( A.Wrap() != ELEMENT )
+        LogicError("Parallel I/O requires an element-wise distribution");
+    mpi::Datatype elemType = ElementType<T>();
+    string error;
+    try
+    {
+        if( ActiveProcess( A, writing ) )
+        {
+            const Int height = A.Height();
+            const Int localHeight = A.LocalHeight();
+            const Int localWidth = A.LocalWidth();
+
+            mpi::Datatype colType, fileType, memType;
+            mpi::CreateVector
+            ( localHeight, 1, A.ColStride(), elemType, colType );
+            mpi::CreateHVector
+            ( localWidth, 1, mpi::Aint(A.RowStride())*height*sizeof(T),
+              colType, fileType );
+            mpi::Commit( fileType );
+            mpi::CreateVector
+            ( localWidth, localHeight, A.LDim(), elemType, memType );
+            mpi::Commit( memType );
+
+            const mpi::Offset disp =
+              metaBytes +
+              (A.ColShift()+mpi::Offset(A.RowShift())*height)*sizeof(T);
+            try
+            {
+                mpi::FileSetView( file, disp, elemType, fileType );
+                if( writing )
+                    mpi::FileWriteAll( file, buffer, 1, memType );
+                else
+                    mpi::FileReadAll( file, buffer, 1, memType );
+            }
+            catch( std::exception& e ) { error = e.what(); }
+
+            mpi::Free( memType );
+            mpi::Free( fileType );
+            mpi::Free( colType );
+        }
+        else
+        {
+            // Participate in the collective with an empty request
+            mpi::FileSetView( file, metaBytes, elemType, elemType );
+            if( writing )
+                mpi::FileWriteAll( file, buffer, 0, elemType );
+            else
+                mpi::FileReadAll( file, buffer, 0, elemType );
+        }
+    }
+    catch( std::exception& e ) { error = e.what(); }
+    mpi::Free( elemType );
+    CheckForFailure( error, file, A.Grid().ViewingComm() );
+}
+
+template<typename T>
+inline void ReadLocal
+( mpi::File file, Int metaBytes, AbstractDistMatrix<T>& A )
+{ TransferLocal( file, metaBytes, A, A.Buffer(), false ); }
+
+template<typename T>
+inline void WriteLocal
+( mpi::File file, Int metaBytes, const AbstractDistMatrix<T>& A )
+{
+    T* buffer = const_cast<T*>(A.LockedBuffer());
+    TransferLocal( file, metaBytes, A, buffer, true );
+}
+
+// The (height,width) metadata of a BINARY file is read by the root of the
+// viewing communicator and then broadcast
+inline void ReadDimensions
+( mpi::File file, Int& height, Int& width, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    Int dims[2];
+    string error;
+    if( mpi::Rank(comm) == 0 )
+    {
+        try { mpi::FileReadAt( file, 0, dims, 2, mpi::TypeMap<Int>() ); }
+        catch( std::exception& e ) { error = e.what(); }
+    }
+    CheckForFailure( error, file, comm );
+    mpi::Broadcast( dims, 2, 0, comm );
+    height = dims[0];
+    width = dims[1];
+}
+
+// Every process sees the same file size, so they all close the file and
+// throw together when it does not match
+inline void CheckFileSize
+( mpi::File file, mpi::Offset numBytesExp )
+{
+    EL_DEBUG_CSE
+    const mpi::Offset numBytes = mpi::FileSize( file );
+    if( numBytes != numBytesExp )
+    {
+        try { mpi::FileClose( file ); }
+        catch( std::exception& e ) { }
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
+}
+
+} // namespace parallel_io
+} // namespace El
+
+#endif // ifndef EL_IO_PARALLELIO_HPP
@@ -12,6 +12,7 @@
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
 #include "./Read/BinaryFlat.hpp"
+#include "./Read/BinarySparse.hpp"
 #include "./Read/MatrixMarket.hpp"
 
 namespace El {
@@ -111,6 +112,9 @@ void Read( SparseMatrix<T>& A, const string filename, FileFormat format )
 
     switch( format )
     {
+    case BINARY_SPARSE:
+        read::BinarySparse( A, filename );
+        break;
     case MATRIX_MARKET:
         read::MatrixMarket( A, filename );
         break;
@@ -128,6 +132,9 @@ void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
 
     switch( format )
     {
+    case BINARY_SPARSE:
+        read::BinarySparse( A, filename );
+        break;
     case MATRIX_MARKET:
         read::MatrixMarket( A, filename );
         break;
@@ -9,6 +9,8 @@
 #ifndef EL_READ_BINARY_HPP
 #define EL_READ_BINARY_HPP
 
+#include "../ParallelIO.hpp"
+
 namespace El {
 namespace read {
 
@@ -24,17 +26,19 @@ Binary( Matrix<T>& A, const string filename )
     Int height, width;
     file.read( (char*)&height, sizeof(Int) );
     file.read( (char*)&width,  sizeof(Int) );
-    const Int numBytes = FileSize( file );
+    const std::streamoff numBytes = FileSize( file );
     const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
+    const std::streamoff dataBytes =
+      std::streamoff(height)*width*sizeof(T);
+    const std::streamoff numBytesExp = metaBytes + dataBytes;
     if( numBytes != numBytesExp )
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
 
     A.Resize( height, width );
     if( A.Height() == A.LDim() )
-        file.read( (char*)A.Buffer(), height*width*sizeof(T) );
+        file.read
+        ( (char*)A.Buffer(), std::streamsize(height)*width*sizeof(T) );
     else
         for( Int j=0; j<width; ++j )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
@@ -45,6 +49,23 @@ inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
+    if( A.Wrap() == ELEMENT )
+    {
+        // Every process collectively reads its own entries via MPI-IO
+        mpi::Comm comm = A.Grid().ViewingComm();
+        mpi::File file;
+        mpi::FileOpen( comm, filename, mpi::MODE_RDONLY, file );
+        Int height, width;
+        parallel_io::ReadDimensions( file, height, width, comm );
+        const Int metaBytes = 2*sizeof(Int);
+        parallel_io::CheckFileSize
+        ( file, metaBytes+mpi::Offset(height)*width*sizeof(T) );
+        A.Resize( height, width );
+        parallel_io::ReadLocal( file, metaBytes, A );
+        mpi::FileClose( file );
+        return;
+    }
+
     std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
@@ -52,10 +73,11 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
     Int height, width;
     file.read( (char*)&height, sizeof(Int) );
     file.read( (char*)&width,  sizeof(Int) );
-    const Int numBytes = FileSize( file );
+    const std::streamoff numBytes = FileSize( file );
     const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
+    const std::streamoff dataBytes =
+      std::streamoff(height)*width*sizeof(T);
+    const std::streamoff numBytesExp = metaBytes + dataBytes;
     if( numBytes != numBytesExp )
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
@@ -66,7 +88,9 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
     if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
+            file.read
+            ( (char*)A.Buffer(),
+              std::streamsize(height)*width*sizeof(T) );
         else
             for( Int j=0; j<width; ++j )
                 file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
@@ -77,7 +101,7 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
         {
             const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
+            const std::streamoff localIndex = std::streamoff(j)*height;
             const std::streamoff pos = metaBytes + localIndex*sizeof(T);
             file.seekg( pos );
             file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
@@ -93,7 +117,7 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
             for( Int iLoc=0; iLoc<localHeight; ++iLoc )
             {
                 const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
+                const std::streamoff localIndex = i+std::streamoff(j)*height;
                 const std::streamoff pos = metaBytes + localIndex*sizeof(T);
                 file.seekg( pos );
                 file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
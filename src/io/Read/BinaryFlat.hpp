@@ -9,6 +9,8 @@
 #ifndef EL_READ_BINARYFLAT_HPP
 #define EL_READ_BINARYFLAT_HPP
 
+#include "../ParallelIO.hpp"
+
 namespace El {
 namespace read {
 
@@ -21,15 +23,17 @@ BinaryFlat( Matrix<T>& A, Int height, Int width, const string filename )
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    const Int numBytes = FileSize( file );
-    const Int numBytesExp = height*width*sizeof(T);
+    const std::streamoff numBytes = FileSize( file );
+    const std::streamoff numBytesExp =
+      std::streamoff(height)*width*sizeof(T);
     if( numBytes != numBytesExp )
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
 
     A.Resize( height, width );
     if( A.Height() == A.LDim() )
-        file.read( (char*)A.Buffer(), height*width*sizeof(T) );
+        file.read
+        ( (char*)A.Buffer(), std::streamsize(height)*width*sizeof(T) );
     else
         for( Int j=0; j<width; ++j )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
@@ -41,12 +45,27 @@ BinaryFlat
 ( AbstractDistMatrix<T>& A, Int height, Int width, const string filename )
 {
     EL_DEBUG_CSE
+    if( A.Wrap() == ELEMENT )
+    {
+        // Every process collectively reads its own entries via MPI-IO
+        mpi::File file;
+        mpi::FileOpen
+        ( A.Grid().ViewingComm(), filename, mpi::MODE_RDONLY, file );
+        parallel_io::CheckFileSize
+        ( file, mpi::Offset(height)*width*sizeof(T) );
+        A.Resize( height, width );
+        parallel_io::ReadLocal( file, 0, A );
+        mpi::FileClose( file );
+        return;
+    }
+
     std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    const Int numBytes = FileSize( file );
-    const Int numBytesExp = height*width*sizeof(T);
+    const std::streamoff numBytes = FileSize( file );
+    const std::streamoff numBytesExp =
+      std::streamoff(height)*width*sizeof(T);
     if( numBytes != numBytesExp )
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
@@ -57,7 +76,9 @@ BinaryFlat
         if( A.CrossRank() == A.Root() )
         {
             if( A.Height() == A.LDim() )
-                file.read( (char*)A.Buffer(), height*width*sizeof(T) );
+                file.read
+                ( (char*)A.Buffer(),
+                  std::streamsize(height)*width*sizeof(T) );
             else
                 for( Int j=0; j<width; ++j )
                     file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
@@ -69,7 +90,7 @@ BinaryFlat
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
         {
             const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
+            const std::streamoff localIndex = std::streamoff(j)*height;
             const std::streamoff pos = localIndex*sizeof(T);
             file.seekg( pos );
             file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
@@ -85,7 +106,7 @@ BinaryFlat
             for( Int iLoc=0; iLoc<localHeight; ++iLoc )
             {
                 const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
+                const std::streamoff localIndex = i+std::streamoff(j)*height;
                 const std::streamoff pos = localIndex*sizeof(T);
                 file.seekg( pos );
                 file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_BINARYSPARSE_HPP
+#define EL_READ_BINARYSPARSE_HPP
+
+#include "../BinarySparse.hpp"
+
+namespace El {
+namespace read {
+
+template<typename T>
+inline void
+BinarySparse( SparseMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const auto header = binary_sparse::ReadHeader( file, filename );
+    binary_sparse::CheckHeader<T>( header, filename );
+    const auto layout = binary_sparse::ComputeLayout<T>( header );
+    const Int numBytes = FileSize( file );
+    if( numBytes != layout.numBytes )
+        RuntimeError
+        ("Expected file to be ",layout.numBytes," bytes but found ",numBytes);
+
+    const Int height = header.height;
+    const Int width = header.width;
+    const Int numEntries = header.numEntries;
+    A.Empty( false );
+    A.Resize( height, width );
+    A.ForceNumEntries( numEntries );
+    binary_sparse::ReadRows
+    ( file, header, layout, 0, height,
+      A.OffsetBuffer(), A.SourceBuffer(), A.TargetBuffer(), A.ValueBuffer() );
+    A.ForceConsistency();
+}
+
+// Each process independently reads its contiguous block of rows. Since a
+// corrupt file might only be detected by some of the processes, the failure
+// is agreed upon before any process throws.
+template<typename T>
+inline void
+BinarySparse( DistSparseMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().Comm();
+    string error;
+    try
+    {
+        std::ifstream file( filename.c_str(), std::ios::binary );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+
+        const auto header = binary_sparse::ReadHeader( file, filename );
+        binary_sparse::CheckHeader<T>( header, filename );
+        const auto layout = binary_sparse::ComputeLayout<T>( header );
+        const Int numBytes = FileSize( file );
+        if( numBytes != layout.numBytes )
+            RuntimeError
+            ("Expected file to be ",layout.numBytes," bytes but found ",
+             numBytes);
+
+        A.Empty( false );
+        A.Resize( header.height, header.width );
+        const Int firstLocalRow = A.FirstLocalRow();
+        const Int localHeight = A.LocalHeight();
+
+        // Determine the number of local entries before sizing the buffers
+        Int localBounds[2];
+        file.seekg( layout.offsetsPos + firstLocalRow*sizeof(Int) );
+        file.read( (char*)&localBounds[0], sizeof(Int) );
+        file.seekg
+        ( layout.offsetsPos + (firstLocalRow+localHeight)*sizeof(Int) );
+        file.read( (char*)&localBounds[1], sizeof(Int) );
+        if( !file )
+            RuntimeError("Could not read the row offsets of ",filename);
+        if( localBounds[0] < 0 || localBounds[0] > localBounds[1] ||
+            localBounds[1] > header.numEntries )
+            RuntimeError("The row offsets of ",filename," were invalid");
+
+        A.ForceNumLocalEntries( localBounds[1]-localBounds[0] );
+        binary_sparse::ReadRows
+        ( file, header, layout, firstLocalRow, localHeight,
+          A.OffsetBuffer(), A.SourceBuffer(), A.TargetBuffer(),
+          A.ValueBuffer() );
+    }
+    catch( std::exception& e ) { error = e.what(); }
+
+    const Int numFailed = mpi::AllReduce( Int(!error.empty()), comm );
+    if( !error.empty() )
+        RuntimeError(error);
+    if( numFailed > 0 )
+        RuntimeError
+        ("Reading ",filename," failed on ",numFailed," other process(es)");
+    A.ForceConsistency();
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_BINARYSPARSE_HPP
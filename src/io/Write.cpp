@@ -12,6 +12,7 @@
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
 #include "./Write/BinaryFlat.hpp"
+#include "./Write/BinarySparse.hpp"
 #include "./Write/Image.hpp"
 #include "./Write/MatrixMarket.hpp"
 
@@ -54,6 +55,14 @@ void Write
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
     }
+    else if( A.Wrap() == ELEMENT && format == BINARY )
+    {
+        write::Binary( A, basename );
+    }
+    else if( A.Wrap() == ELEMENT && format == BINARY_FLAT )
+    {
+        write::BinaryFlat( A, basename );
+    }
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
@@ -62,13 +71,58 @@ void Write
     }
 }
 
+template<typename T>
+void Write
+( const SparseMatrix<T>& A, string basename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    switch( format )
+    {
+    case BINARY_SPARSE: write::BinarySparse( A, basename ); break;
+    case MATRIX_MARKET: write::MatrixMarket( A, basename ); break;
+    default:
+        LogicError("Format unsupported for writing a SparseMatrix");
+    }
+}
+
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    switch( format )
+    {
+    case BINARY_SPARSE:
+        write::BinarySparse( A, basename );
+        break;
+    case MATRIX_MARKET:
+    {
+        if( A.Grid().Rank() == 0 )
+        {
+            SparseMatrix<T> ASeq;
+            CopyFromRoot( A, ASeq );
+            write::MatrixMarket( ASeq, basename );
+        }
+        else
+            CopyFromNonRoot( A, 0 );
+        break;
+    }
+    default:
+        LogicError("Format unsupported for writing a DistSparseMatrix");
+    }
+}
+
 #define PROTO(T) \
   template void Write \
   ( const Matrix<T>& A, \
     string basename, FileFormat format, string title ); \
   template void Write \
   ( const AbstractDistMatrix<T>& A, \
-    string basename, FileFormat format, string title );
+    string basename, FileFormat format, string title ); \
+  template void Write \
+  ( const SparseMatrix<T>& A, string basename, FileFormat format ); \
+  template void Write \
+  ( const DistSparseMatrix<T>& A, string basename, FileFormat format );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -9,6 +9,8 @@
 #ifndef EL_WRITE_BINARY_HPP
 #define EL_WRITE_BINARY_HPP
 
+#include "../ParallelIO.hpp"
+
 namespace El {
 namespace write {
 
@@ -29,12 +31,42 @@ Binary( const Matrix<T>& A, string basename="matrix" )
     n = A.Width();
     file.write( (char*)&n, sizeof(Int) );
     if( A.Height() == A.LDim() )
-        file.write( (char*)A.LockedBuffer(), A.Height()*A.Width()*sizeof(T) );
+        file.write
+        ( (char*)A.LockedBuffer(),
+          std::streamsize(A.Height())*A.Width()*sizeof(T) );
     else
         for( Int j=0; j<A.Width(); ++j )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    // Every process collectively writes its own entries via MPI-IO
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_WRONLY|mpi::MODE_CREATE, file );
+    const Int metaBytes = 2*sizeof(Int);
+    string error;
+    try
+    {
+        mpi::FileSetSize
+        ( file, metaBytes+mpi::Offset(A.Height())*A.Width()*sizeof(T) );
+        if( mpi::Rank(comm) == 0 )
+        {
+            const Int dims[2] = { A.Height(), A.Width() };
+            mpi::FileWriteAt( file, 0, dims, 2, mpi::TypeMap<Int>() );
+        }
+    }
+    catch( std::exception& e ) { error = e.what(); }
+    parallel_io::CheckForFailure( error, file, comm );
+    parallel_io::WriteLocal( file, metaBytes, A );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
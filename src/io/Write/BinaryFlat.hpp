@@ -9,6 +9,8 @@
 #ifndef EL_WRITE_BINARYFLAT_HPP
 #define EL_WRITE_BINARYFLAT_HPP
 
+#include "../ParallelIO.hpp"
+
 namespace El {
 namespace write {
 
@@ -24,12 +26,36 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
         RuntimeError("Could not open ",filename);
 
     if( A.Height() == A.LDim() )
-        file.write( (char*)A.LockedBuffer(), A.Height()*A.Width()*sizeof(T) );
+        file.write
+        ( (char*)A.LockedBuffer(),
+          std::streamsize(A.Height())*A.Width()*sizeof(T) );
     else
         for( Int j=0; j<A.Width(); ++j )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    // Every process collectively writes its own entries via MPI-IO
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_WRONLY|mpi::MODE_CREATE, file );
+    string error;
+    try
+    {
+        mpi::FileSetSize
+        ( file, mpi::Offset(A.Height())*A.Width()*sizeof(T) );
+    }
+    catch( std::exception& e ) { error = e.what(); }
+    parallel_io::CheckForFailure( error, file, comm );
+    parallel_io::WriteLocal( file, 0, A );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
@@ -0,0 +1,116 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_BINARYSPARSE_HPP
+#define EL_WRITE_BINARYSPARSE_HPP
+
+#include "../BinarySparse.hpp"
+
+namespace El {
+namespace write {
+
+template<typename T>
+inline void
+BinarySparse( const SparseMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    A.AssertConsistent();
+
+    string filename = basename + "." + FileExtension(BINARY_SPARSE);
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const Int height = A.Height();
+    const Int numEntries = A.NumEntries();
+    const auto header =
+      binary_sparse::BuildHeader<T>( height, A.Width(), numEntries );
+    const auto layout = binary_sparse::ComputeLayout<T>( header );
+
+    // Explicitly zero the padding so that the file contents are deterministic
+    const char padding[binary_sparse::alignment] = { 0 };
+    file.write( (char*)&header, sizeof(header) );
+    file.write( (char*)A.LockedOffsetBuffer(), (height+1)*sizeof(Int) );
+    file.write
+    ( padding, layout.targetsPos-layout.offsetsPos-(height+1)*sizeof(Int) );
+    file.write( (char*)A.LockedTargetBuffer(), numEntries*sizeof(Int) );
+    file.write
+    ( padding, layout.valuesPos-layout.targetsPos-numEntries*sizeof(Int) );
+    file.write( (char*)A.LockedValueBuffer(), numEntries*sizeof(T) );
+    if( !file )
+        RuntimeError("Could not write ",filename);
+}
+
+// Each process writes its contiguous block of rows into a single shared file
+// after the root has created it and written the header
+template<typename T>
+inline void
+BinarySparse( const DistSparseMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    A.AssertConsistent();
+    mpi::Comm comm = A.Grid().Comm();
+    const int commRank = mpi::Rank( comm );
+
+    string filename = basename + "." + FileExtension(BINARY_SPARSE);
+    const Int height = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int numEntries = mpi::AllReduce( numLocalEntries, comm );
+    const Int firstLocalEntry = mpi::Scan( numLocalEntries, comm ) -
+      numLocalEntries;
+    const auto header =
+      binary_sparse::BuildHeader<T>( height, A.Width(), numEntries );
+    const auto layout = binary_sparse::ComputeLayout<T>( header );
+
+    if( commRank == 0 )
+    {
+        ofstream file( filename.c_str(), std::ios::binary );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        file.write( (char*)&header, sizeof(header) );
+        // Extend the file to its full (zero-padded) length up front
+        file.seekp( layout.numBytes-1 );
+        file.put( 0 );
+        file.seekp( layout.offsetsPos + height*sizeof(Int) );
+        file.write( (char*)&numEntries, sizeof(Int) );
+        if( !file )
+            RuntimeError("Could not write ",filename);
+    }
+    mpi::Barrier( comm );
+
+    if( localHeight > 0 )
+    {
+        std::fstream file
+        ( filename.c_str(),
+          std::ios::binary | std::ios::in | std::ios::out );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+
+        vector<Int> offsets( localHeight );
+        const Int* offsetBuf = A.LockedOffsetBuffer();
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            offsets[iLoc] = offsetBuf[iLoc] + firstLocalEntry;
+        file.seekp( layout.offsetsPos + firstLocalRow*sizeof(Int) );
+        file.write( (char*)offsets.data(), localHeight*sizeof(Int) );
+        file.seekp( layout.targetsPos + firstLocalEntry*sizeof(Int) );
+        file.write
+        ( (char*)A.LockedTargetBuffer(), numLocalEntries*sizeof(Int) );
+        file.seekp( layout.valuesPos + firstLocalEntry*sizeof(T) );
+        file.write( (char*)A.LockedValueBuffer(), numLocalEntries*sizeof(T) );
+        if( !file )
+            RuntimeError("Could not write ",filename);
+    }
+    mpi::Barrier( comm );
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_BINARYSPARSE_HPP
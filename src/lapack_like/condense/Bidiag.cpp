@@ -11,6 +11,7 @@
 #include "./Bidiag/Apply.hpp"
 #include "./Bidiag/LowerBlocked.hpp"
 #include "./Bidiag/UpperBlocked.hpp"
+#include "./Bidiag/TwoStage.hpp"
 
 namespace El {
 
@@ -205,6 +206,40 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
   ( LeftOrRight side, Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::TwoStage \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalarsP, \
+    Matrix<F>& householderScalarsQ, \
+    bidiag::BulgeReflectors<F>& bulgeReflectors, \
+    Int bandwidth ); \
+  template void bidiag::TwoStage \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalarsP, \
+    AbstractDistMatrix<F>& householderScalarsQ, \
+    bidiag::BulgeReflectors<F>& bulgeReflectors, \
+    Int bandwidth ); \
+  template void bidiag::TwoStage( Matrix<F>& A, Int bandwidth ); \
+  template void bidiag::TwoStage( AbstractDistMatrix<F>& A, Int bandwidth ); \
+  template void bidiag::TwoStageApplyQ \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& householderScalarsQ, \
+    const bidiag::BulgeReflectors<F>& bulgeReflectors, \
+          Matrix<F>& B ); \
+  template void bidiag::TwoStageApplyQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalarsQ, \
+    const bidiag::BulgeReflectors<F>& bulgeReflectors, \
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::TwoStageApplyP \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& householderScalarsP, \
+    const bidiag::BulgeReflectors<F>& bulgeReflectors, \
+          Matrix<F>& B ); \
+  template void bidiag::TwoStageApplyP \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalarsP, \
+    const bidiag::BulgeReflectors<F>& bulgeReflectors, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
@@ -0,0 +1,698 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_TWOSTAGE_HPP
+#define EL_BIDIAG_TWOSTAGE_HPP
+
+// The first stage reduces A to upper-triangular band form, with b
+// superdiagonals, one panel of b columns/rows at a time: a QR factorization
+// of the panel columns is followed by an LQ factorization of the panel rows
+// starting from their b'th superdiagonal, and the trailing matrix is updated
+// with the compact WY form of each set of reflectors. The reflectors of Q1
+// are packed exactly as those of the one-stage reduction, whereas those of P1
+// have their heads on the b'th (rather than the first) superdiagonal.
+//
+// The second stage chases bulges down the band, with the j'th sweep
+// annihilating A(j,j+2:j+b+1) with a reflector from the right, which creates
+// a bulge below the diagonal whose first column is then annihilated with a
+// reflector from the left. The latter creates a bulge b columns further to
+// the right, and so on. The band is small enough to be redundantly stored and
+// reduced by every process, which costs O(b n^2) flops per process. The
+// reflectors of Q2 and P2, on the other hand, have roughly n^2 entries in
+// total, and so the distributed reduction only keeps those which it owns in a
+// [* ,VR] distribution (about n^2/p entries per process), and the
+// backtransformations gather the reflectors of one group of b sweeps (about
+// b n entries) at a time. No reflectors are kept at all when only the
+// bidiagonal matrix is requested.
+
+namespace El {
+namespace bidiag {
+namespace two_stage {
+
+inline Int Bandwidth( Int n, Int bandwidth )
+{
+    if( bandwidth == 0 )
+        bandwidth = Blocksize();
+    if( bandwidth < 0 )
+        LogicError("The bandwidth must be non-negative");
+    return Max(Min(bandwidth,n-1),Int(1));
+}
+
+template<typename F>
+void ReduceToBand
+( Matrix<F>& A,
+  Matrix<F>& householderScalarsP,
+  Matrix<F>& householderScalarsQ,
+  Int b )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    householderScalarsQ.Resize( n, 1 );
+    householderScalarsP.Resize( Max(n-b,Int(0)), 1 );
+
+    Matrix<F> z, w;
+    for( Int k=0; k<n; k+=b )
+    {
+        const Int nb = Min(b,n-k);
+        const Int nr = Min(nb,n-b-k);
+
+        // Annihilate the panel columns below the diagonal
+        for( Int c=0; c<nb; ++c )
+        {
+            auto alpha = A( IR(k+c),       IR(k+c) );
+            auto x     = A( IR(k+c+1,END), IR(k+c) );
+            auto u     = A( IR(k+c,END),   IR(k+c) );
+            auto APanR = A( IR(k+c,END),   IR(k+c+1,k+nb) );
+
+            const F tau = LeftReflector( alpha, x );
+            householderScalarsQ(k+c) = tau;
+
+            const F beta = alpha(0);
+            alpha(0) = F(1);
+            Zeros( z, APanR.Width(), 1 );
+            Gemv( ADJOINT, F(1), APanR, u, F(0), z );
+            Ger( -tau, u, z, APanR );
+            alpha(0) = beta;
+        }
+        auto QPan = A( IR(k,END), IR(k,k+nb) );
+        auto householderScalarsQPan = householderScalarsQ( IR(k,k+nb), ALL );
+        auto AR = A( IR(k,END), IR(k+nb,END) );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0,
+          QPan, householderScalarsQPan, AR );
+        if( nr <= 0 )
+            continue;
+
+        // Annihilate the panel rows to the right of their b'th superdiagonal
+        for( Int c=0; c<nr; ++c )
+        {
+            auto alpha = A( IR(k+c),      IR(k+b+c) );
+            auto x     = A( IR(k+c),      IR(k+b+c+1,END) );
+            auto u     = A( IR(k+c),      IR(k+b+c,END) );
+            auto APanB = A( IR(k+c+1,k+nb), IR(k+b+c,END) );
+
+            const F tau = RightReflector( alpha, x );
+            householderScalarsP(k+c) = tau;
+
+            const F beta = alpha(0);
+            alpha(0) = F(1);
+            Zeros( w, APanB.Height(), 1 );
+            Gemv( NORMAL, F(1), APanB, u, F(0), w );
+            Ger( -tau, w, u, APanB );
+            alpha(0) = beta;
+        }
+        auto PPan = A( IR(k,k+nr), IR(k+b,END) );
+        auto householderScalarsPPan = householderScalarsP( IR(k,k+nr), ALL );
+        auto AB = A( IR(k+nb,m), IR(k+b,END) );
+        ApplyPackedReflectors
+        ( RIGHT, UPPER, HORIZONTAL, FORWARD, UNCONJUGATED, 0,
+          PPan, householderScalarsPPan, AB );
+    }
+}
+
+template<typename F>
+void ReduceToBand
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalarsP,
+  DistMatrix<F,STAR,STAR>& householderScalarsQ,
+  Int b )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Grid& g = A.Grid();
+    householderScalarsQ.Resize( n, 1 );
+    householderScalarsP.Resize( Max(n-b,Int(0)), 1 );
+
+    DistMatrix<F,MC,STAR> u_MC_STAR(g), w_MC_STAR(g);
+    DistMatrix<F,STAR,MR> u_STAR_MR(g);
+    DistMatrix<F,MR,STAR> z_MR_STAR(g);
+    for( Int k=0; k<n; k+=b )
+    {
+        const Int nb = Min(b,n-k);
+        const Int nr = Min(nb,n-b-k);
+
+        // Annihilate the panel columns below the diagonal
+        for( Int c=0; c<nb; ++c )
+        {
+            auto alpha = A( IR(k+c),       IR(k+c) );
+            auto x     = A( IR(k+c+1,END), IR(k+c) );
+            auto u     = A( IR(k+c,END),   IR(k+c) );
+            auto APanR = A( IR(k+c,END),   IR(k+c+1,k+nb) );
+
+            const F tau = LeftReflector( alpha, x );
+            householderScalarsQ.SetLocal( k+c, 0, tau );
+
+            u_MC_STAR.AlignWith( APanR );
+            Copy( u, u_MC_STAR );
+            u_MC_STAR.Set( 0, 0, F(1) );
+            z_MR_STAR.AlignWith( APanR );
+            Zeros( z_MR_STAR, APanR.Width(), 1 );
+            LocalGemv( ADJOINT, F(1), APanR, u_MC_STAR, F(0), z_MR_STAR );
+            El::AllReduce( z_MR_STAR.Matrix(), APanR.ColComm() );
+            LocalGer( -tau, u_MC_STAR, z_MR_STAR, APanR );
+        }
+        auto QPan = A( IR(k,END), IR(k,k+nb) );
+        auto householderScalarsQPan = householderScalarsQ( IR(k,k+nb), ALL );
+        auto AR = A( IR(k,END), IR(k+nb,END) );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0,
+          QPan, householderScalarsQPan, AR );
+        if( nr <= 0 )
+            continue;
+
+        // Annihilate the panel rows to the right of their b'th superdiagonal
+        for( Int c=0; c<nr; ++c )
+        {
+            auto alpha = A( IR(k+c),        IR(k+b+c) );
+            auto x     = A( IR(k+c),        IR(k+b+c+1,END) );
+            auto u     = A( IR(k+c),        IR(k+b+c,END) );
+            auto APanB = A( IR(k+c+1,k+nb), IR(k+b+c,END) );
+
+            const F tau = RightReflector( alpha, x );
+            householderScalarsP.SetLocal( k+c, 0, tau );
+
+            u_STAR_MR.AlignWith( APanB );
+            Copy( u, u_STAR_MR );
+            u_STAR_MR.Set( 0, 0, F(1) );
+            w_MC_STAR.AlignWith( APanB );
+            Zeros( w_MC_STAR, APanB.Height(), 1 );
+            LocalGemv( NORMAL, F(1), APanB, u_STAR_MR, F(0), w_MC_STAR );
+            El::AllReduce( w_MC_STAR.Matrix(), APanB.RowComm() );
+            LocalGer( -tau, w_MC_STAR, u_STAR_MR, APanB );
+        }
+        auto PPan = A( IR(k,k+nr), IR(k+b,END) );
+        auto householderScalarsPPan = householderScalarsP( IR(k,k+nr), ALL );
+        auto AB = A( IR(k+nb,m), IR(k+b,END) );
+        ApplyPackedReflectors
+        ( RIGHT, UPPER, HORIZONTAL, FORWARD, UNCONJUGATED, 0,
+          PPan, householderScalarsPPan, AB );
+    }
+}
+
+// Form the offsets of the reflectors of each sweep and return their total
+// number (for each side)
+template<typename F>
+Int FormSweepOffsets( Int n, BulgeReflectors<F>& bulges )
+{
+    EL_DEBUG_CSE
+    const Int b = bulges.bandwidth;
+
+    // A band of width one is already bidiagonal (with a real superdiagonal)
+    const Int numSweeps = ( b > 1 ? Max(n-1,Int(0)) : 0 );
+    bulges.sweepOffsets.resize( numSweeps+1 );
+    bulges.sweepOffsets[0] = 0;
+    for( Int j=0; j<numSweeps; ++j )
+        bulges.sweepOffsets[j+1] = bulges.sweepOffsets[j] + (n-1-j+b-1)/b;
+    return bulges.sweepOffsets[numSweeps];
+}
+
+// On entry, A(i,j) is stored in ABand(2b+i-j,j) for 0 <= j-i <= b, ABand
+// must have 3b rows so that there is room for the bulges above and below the
+// band, and the sweep offsets must have been formed. If 'storeReflector' is
+// nonempty, it is passed the side (LEFT for Q2 and RIGHT for P2), index,
+// scalar, and vector (without its unit head) of each reflector, where the
+// vectors of the right reflectors are rows.
+template<typename F>
+void ChaseBulges
+( Matrix<F>& ABand,
+  const BulgeReflectors<F>& bulges,
+  Matrix<Base<F>>& d,
+  Matrix<Base<F>>& e,
+  const function<void(LeftOrRight,Int,const F&,const Matrix<F>&)>&
+    storeReflector )
+{
+    EL_DEBUG_CSE
+    const Int n = ABand.Width();
+    const Int b = bulges.bandwidth;
+    const Int numSweeps = bulges.sweepOffsets.size()-1;
+    EL_DEBUG_ONLY(
+      if( ABand.Height() != 3*b || ABand.LDim() != 3*b )
+          LogicError("ABand must be a contiguous 3b x n matrix");
+    )
+
+    // Since A(i,j) lives at position 2b+i+j*(3b-1) of the buffer, any window
+    // of the (extended) band is a dense matrix with a leading dimension of
+    // 3b-1
+    F* ABuf = ABand.Buffer();
+    const Int windowLDim = 3*b-1;
+    auto window =
+      [&]( Matrix<F>& W, Int i, Int j, Int height, Int width )
+      { W.Attach( height, width, &ABuf[2*b+i+j*windowLDim], windowLDim ); };
+
+    Matrix<F> x, u, AB, AR, z;
+    for( Int j=0; j<numSweeps; ++j )
+    {
+        for( Int s=0, c0=j+1; c0<n; ++s, c0+=b )
+        {
+            const Int c1 = Min(c0+b,n);
+            const Int L = c1-c0;
+            const Int r = ( s == 0 ? j : c0-b );
+            const Int index = bulges.sweepOffsets[j] + s;
+
+            // Annihilate A(r,c0+1:c1) from the right
+            F& alphaP = ABuf[2*b+r+c0*windowLDim];
+            window( x, r, c0+1, 1, L-1 );
+            const F tauP = RightReflector( alphaP, x );
+            if( storeReflector )
+                storeReflector( RIGHT, index, tauP, x );
+            const F betaP = alphaP;
+            alphaP = F(1);
+            window( u, r, c0, 1, L );
+
+            // A(r+1:c1,c0:c1) := A(r+1:c1,c0:c1) G, which creates a bulge
+            // below the diagonal
+            window( AB, r+1, c0, c1-r-1, L );
+            Zeros( z, AB.Height(), 1 );
+            Gemv( NORMAL, F(1), AB, u, F(0), z );
+            Ger( -tauP, z, u, AB );
+            alphaP = betaP;
+            Zero( x );
+
+            // Annihilate A(c0+1:c1,c0) from the left
+            F& alphaQ = ABuf[2*b+c0+c0*windowLDim];
+            window( x, c0+1, c0, L-1, 1 );
+            const F tauQ = LeftReflector( alphaQ, x );
+            if( storeReflector )
+                storeReflector( LEFT, index, tauQ, x );
+            const F betaQ = alphaQ;
+            alphaQ = F(1);
+            window( u, c0, c0, L, 1 );
+
+            // A(c0:c1,c0+1:c1+b) := H A(c0:c1,c0+1:c1+b), which creates the
+            // next bulge above the band
+            const Int bulgeEnd = Min(c1+b,n);
+            if( bulgeEnd > c0+1 )
+            {
+                window( AR, c0, c0+1, L, bulgeEnd-c0-1 );
+                Zeros( z, AR.Width(), 1 );
+                Gemv( ADJOINT, F(1), AR, u, F(0), z );
+                Ger( -tauQ, u, z, AR );
+            }
+            alphaQ = betaQ;
+            Zero( x );
+        }
+    }
+
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,Int(0)), 1 );
+    for( Int j=0; j<n; ++j )
+        d(j) = RealPart(ABand(2*b,j));
+    for( Int j=0; j<n-1; ++j )
+        e(j) = RealPart(ABand(2*b-1,j+1));
+}
+
+// B := Q2 B or B := P2 B
+//
+// The reflectors from the same step of consecutive sweeps are shifted by a
+// single row, and so b of them are applied at once in compact WY form (see
+// herm_tridiag::TwoStageApplyQ). The left reflectors H define Q2 as the
+// product of their adjoints, whereas the right reflectors G directly define
+// P2, hence the different conjugations.
+//
+// The routine 'getGroup' should return copies of the columns of the
+// reflectors (and the entries of the scalars) within the given range, which
+// covers a single group of sweeps.
+template<typename F,class GetGroupType>
+void ApplyBulgeReflectors
+( Int b,
+  const vector<Int>& sweepOffsets,
+  const GetGroupType& getGroup,
+  Conjugation conjugation,
+  Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int numSweeps = sweepOffsets.size()-1;
+    if( numSweeps <= 0 )
+        return;
+    const Int n = numSweeps+1;
+
+    Matrix<F> H, householderScalars, groupReflectors, groupScalars;
+    for( Int jGroup=((numSweeps-1)/b)*b; jGroup>=0; jGroup-=b )
+    {
+        const Int groupOffset = sweepOffsets[jGroup];
+        const Int groupEnd = sweepOffsets[Min(jGroup+b,numSweeps)];
+        getGroup( IR(groupOffset,groupEnd), groupReflectors, groupScalars );
+        for( Int s=0; ; ++s )
+        {
+            const Int r = jGroup+1+s*b;
+            const Int jEnd = Min(Min(jGroup+b,numSweeps),n-1-s*b);
+            if( jEnd <= jGroup )
+                break;
+            const Int numGroup = jEnd-jGroup;
+            const Int height = Min(numGroup+b-1,n-r);
+
+            Zeros( H, height, numGroup );
+            householderScalars.Resize( numGroup, 1 );
+            for( Int c=0; c<numGroup; ++c )
+            {
+                const Int index = sweepOffsets[jGroup+c] + s - groupOffset;
+                const Int L = Min(b,n-(r+c));
+                householderScalars(c) = groupScalars(index);
+                for( Int i=1; i<L; ++i )
+                    H(c+i,c) = groupReflectors(i-1,index);
+            }
+            auto BSub = B( IR(r,r+height), ALL );
+            ApplyPackedReflectors
+            ( LEFT, LOWER, VERTICAL, BACKWARD, conjugation, 0,
+              H, householderScalars, BSub );
+        }
+    }
+}
+
+template<typename F>
+void Reduce
+( Matrix<F>& A,
+  Matrix<F>& householderScalarsP,
+  Matrix<F>& householderScalarsQ,
+  BulgeReflectors<F>& bulgeReflectors,
+  Int bandwidth,
+  bool storeReflectors )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+        LogicError("A must be at least as tall as it is wide");
+    const Int n = A.Width();
+    const Int b = Bandwidth( n, bandwidth );
+    bulgeReflectors.bandwidth = b;
+
+    ReduceToBand( A, householderScalarsP, householderScalarsQ, b );
+
+    Matrix<F> ABand;
+    Zeros( ABand, 3*b, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=Max(j-b,Int(0)); i<=j; ++i )
+            ABand(2*b+i-j,j) = A(i,j);
+
+    const Int numSweepReflectors = FormSweepOffsets( n, bulgeReflectors );
+    const Int numReflectors = ( storeReflectors ? numSweepReflectors : 0 );
+    auto& bulges = bulgeReflectors;
+    Zeros( bulges.reflectorsQ, b-1, numReflectors );
+    Zeros( bulges.householderScalarsQ, numReflectors, 1 );
+    Zeros( bulges.reflectorsP, b-1, numReflectors );
+    Zeros( bulges.householderScalarsP, numReflectors, 1 );
+    function<void(LeftOrRight,Int,const F&,const Matrix<F>&)> storeReflector;
+    if( storeReflectors )
+        storeReflector =
+          [&]( LeftOrRight side, Int index, const F& tau, const Matrix<F>& x )
+          {
+              const bool left = ( side == LEFT );
+              auto& reflectors = ( left ? bulges.reflectorsQ
+                                        : bulges.reflectorsP );
+              auto& scalars = ( left ? bulges.householderScalarsQ
+                                     : bulges.householderScalarsP );
+              scalars(index) = tau;
+              const Int length = ( left ? x.Height() : x.Width() );
+              for( Int i=0; i<length; ++i )
+                  reflectors(i,index) = ( left ? x(i,0) : x(0,i) );
+          };
+    Matrix<Base<F>> d, e;
+    ChaseBulges( ABand, bulgeReflectors, d, e, storeReflector );
+
+    // Overwrite the band with the bidiagonal matrix
+    for( Int j=0; j<n; ++j )
+    {
+        A(j,j) = d(j);
+        if( j < n-1 )
+            A(j,j+1) = e(j);
+        for( Int i=Max(j-b,Int(0)); i<j-1; ++i )
+            A(i,j) = 0;
+    }
+}
+
+template<typename F>
+void Reduce
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPPre,
+  AbstractDistMatrix<F>& householderScalarsQPre,
+  BulgeReflectors<F>& bulgeReflectors,
+  Int bandwidth,
+  bool storeReflectors )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() < APre.Width() )
+        LogicError("A must be at least as tall as it is wide");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsPProx( householderScalarsPPre ),
+      householderScalarsQProx( householderScalarsQPre );
+    auto& A = AProx.Get();
+    auto& householderScalarsP = householderScalarsPProx.Get();
+    auto& householderScalarsQ = householderScalarsQProx.Get();
+
+    const Int n = A.Width();
+    const Int b = Bandwidth( n, bandwidth );
+    bulgeReflectors.bandwidth = b;
+
+    ReduceToBand( A, householderScalarsP, householderScalarsQ, b );
+
+    // Give every process a copy of the band
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    Matrix<F> ABand;
+    Zeros( ABand, 3*b, n );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i <= j && i >= j-b )
+                ABand(2*b+i-j,j) = A.GetLocal(iLoc,jLoc);
+        }
+    }
+    El::AllReduce( ABand, A.DistComm() );
+
+    // Only keep the reflectors which this process owns
+    const Int numSweepReflectors = FormSweepOffsets( n, bulgeReflectors );
+    const Int numReflectors = ( storeReflectors ? numSweepReflectors : 0 );
+    auto& bulges = bulgeReflectors;
+    bulges.distReflectorsQ.SetGrid( A.Grid() );
+    bulges.distReflectorsP.SetGrid( A.Grid() );
+    bulges.distHouseholderScalarsQ.SetGrid( A.Grid() );
+    bulges.distHouseholderScalarsP.SetGrid( A.Grid() );
+    Zeros( bulges.distReflectorsQ, b-1, numReflectors );
+    Zeros( bulges.distReflectorsP, b-1, numReflectors );
+    Zeros( bulges.distHouseholderScalarsQ, numReflectors, 1 );
+    Zeros( bulges.distHouseholderScalarsP, numReflectors, 1 );
+    function<void(LeftOrRight,Int,const F&,const Matrix<F>&)> storeReflector;
+    if( storeReflectors )
+        storeReflector =
+          [&]( LeftOrRight side, Int index, const F& tau, const Matrix<F>& x )
+          {
+              const bool left = ( side == LEFT );
+              auto& reflectors = ( left ? bulges.distReflectorsQ
+                                        : bulges.distReflectorsP );
+              auto& scalars = ( left ? bulges.distHouseholderScalarsQ
+                                     : bulges.distHouseholderScalarsP );
+              if( scalars.IsLocalRow(index) )
+                  scalars.SetLocal( scalars.LocalRow(index), 0, tau );
+              if( reflectors.IsLocalCol(index) )
+              {
+                  const Int indexLoc = reflectors.LocalCol(index);
+                  const Int length = ( left ? x.Height() : x.Width() );
+                  for( Int i=0; i<length; ++i )
+                      reflectors.SetLocal
+                      ( i, indexLoc, ( left ? x(i,0) : x(0,i) ) );
+              }
+          };
+    Matrix<Base<F>> d, e;
+    ChaseBulges( ABand, bulgeReflectors, d, e, storeReflector );
+
+    // Overwrite the band with the bidiagonal matrix
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == j )
+                A.SetLocal( iLoc, jLoc, d(j) );
+            else if( j == i+1 )
+                A.SetLocal( iLoc, jLoc, e(i) );
+            else if( i < j && i >= j-b )
+                A.SetLocal( iLoc, jLoc, F(0) );
+        }
+    }
+}
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStage
+( Matrix<F>& A,
+  Matrix<F>& householderScalarsP,
+  Matrix<F>& householderScalarsQ,
+  BulgeReflectors<F>& bulgeReflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::Reduce
+    ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+      bandwidth, true );
+}
+
+template<typename F>
+void TwoStage
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalarsP,
+  AbstractDistMatrix<F>& householderScalarsQ,
+  BulgeReflectors<F>& bulgeReflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::Reduce
+    ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+      bandwidth, true );
+}
+
+template<typename F>
+void TwoStage( Matrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    Matrix<F> householderScalarsP, householderScalarsQ;
+    BulgeReflectors<F> bulgeReflectors;
+    two_stage::Reduce
+    ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+      bandwidth, false );
+}
+
+template<typename F>
+void TwoStage( AbstractDistMatrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> householderScalarsP(A.Grid()),
+                            householderScalarsQ(A.Grid());
+    BulgeReflectors<F> bulgeReflectors;
+    two_stage::Reduce
+    ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+      bandwidth, false );
+}
+
+template<typename F>
+void TwoStageApplyQ
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalarsQ,
+  const BulgeReflectors<F>& bulgeReflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    auto getGroup =
+      [&]( const Range<Int>& ind,
+           Matrix<F>& groupReflectors, Matrix<F>& groupScalars )
+      {
+          groupReflectors = bulgeReflectors.reflectorsQ( ALL, ind );
+          groupScalars = bulgeReflectors.householderScalarsQ( ind, ALL );
+      };
+    two_stage::ApplyBulgeReflectors
+    ( bulgeReflectors.bandwidth, bulgeReflectors.sweepOffsets, getGroup,
+      CONJUGATED, B );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, 0,
+      A, householderScalarsQ, B );
+}
+
+template<typename F>
+void TwoStageApplyQ
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalarsQ,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    // Every process applies Q2 to its own set of full columns after gathering
+    // the reflectors of each group of sweeps
+    const Grid& g = B.Grid();
+    DistMatrix<F,STAR,STAR> groupReflectors_STAR_STAR(g),
+                            groupScalars_STAR_STAR(g);
+    auto getGroup =
+      [&]( const Range<Int>& ind,
+           Matrix<F>& groupReflectors, Matrix<F>& groupScalars )
+      {
+          groupReflectors_STAR_STAR =
+            bulgeReflectors.distReflectorsQ( ALL, ind );
+          groupScalars_STAR_STAR =
+            bulgeReflectors.distHouseholderScalarsQ( ind, ALL );
+          groupReflectors = groupReflectors_STAR_STAR.Matrix();
+          groupScalars = groupScalars_STAR_STAR.Matrix();
+      };
+    DistMatrix<F,STAR,VR> B_STAR_VR( B );
+    two_stage::ApplyBulgeReflectors
+    ( bulgeReflectors.bandwidth, bulgeReflectors.sweepOffsets, getGroup,
+      CONJUGATED, B_STAR_VR.Matrix() );
+    Copy( B_STAR_VR, B );
+
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, 0,
+      A, householderScalarsQ, B );
+}
+
+template<typename F>
+void TwoStageApplyP
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalarsP,
+  const BulgeReflectors<F>& bulgeReflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    auto getGroup =
+      [&]( const Range<Int>& ind,
+           Matrix<F>& groupReflectors, Matrix<F>& groupScalars )
+      {
+          groupReflectors = bulgeReflectors.reflectorsP( ALL, ind );
+          groupScalars = bulgeReflectors.householderScalarsP( ind, ALL );
+      };
+    two_stage::ApplyBulgeReflectors
+    ( bulgeReflectors.bandwidth, bulgeReflectors.sweepOffsets, getGroup,
+      UNCONJUGATED, B );
+    ApplyPackedReflectors
+    ( LEFT, UPPER, HORIZONTAL, BACKWARD, UNCONJUGATED,
+      bulgeReflectors.bandwidth, A, householderScalarsP, B );
+}
+
+template<typename F>
+void TwoStageApplyP
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalarsP,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    // Every process applies P2 to its own set of full columns after gathering
+    // the reflectors of each group of sweeps
+    const Grid& g = B.Grid();
+    DistMatrix<F,STAR,STAR> groupReflectors_STAR_STAR(g),
+                            groupScalars_STAR_STAR(g);
+    auto getGroup =
+      [&]( const Range<Int>& ind,
+           Matrix<F>& groupReflectors, Matrix<F>& groupScalars )
+      {
+          groupReflectors_STAR_STAR =
+            bulgeReflectors.distReflectorsP( ALL, ind );
+          groupScalars_STAR_STAR =
+            bulgeReflectors.distHouseholderScalarsP( ind, ALL );
+          groupReflectors = groupReflectors_STAR_STAR.Matrix();
+          groupScalars = groupScalars_STAR_STAR.Matrix();
+      };
+    DistMatrix<F,STAR,VR> B_STAR_VR( B );
+    two_stage::ApplyBulgeReflectors
+    ( bulgeReflectors.bandwidth, bulgeReflectors.sweepOffsets, getGroup,
+      UNCONJUGATED, B_STAR_VR.Matrix() );
+    Copy( B_STAR_VR, B );
+
+    ApplyPackedReflectors
+    ( LEFT, UPPER, HORIZONTAL, BACKWARD, UNCONJUGATED,
+      bulgeReflectors.bandwidth, A, householderScalarsP, B );
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_TWOSTAGE_HPP
@@ -47,6 +47,7 @@ void Ger2Sub
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 namespace El {
 
@@ -161,10 +162,22 @@ void HermitianTridiag
 namespace herm_tridiag {
 
 template<typename F>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<F>& A, const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
     Matrix<F> householderScalars;
+    if( ctrl.twoStage )
+    {
+        // There is no need to keep the bulge-chasing reflectors
+        BulgeReflectors<F> bulgeReflectors;
+        two_stage::Reduce
+        ( uplo, A, householderScalars, bulgeReflectors, ctrl.bandwidth,
+          false );
+        MakeTrapezoidal( LOWER, A, 1 );
+        MakeTrapezoidal( UPPER, A, -1 );
+        return;
+    }
     HermitianTridiag( uplo, A, householderScalars );
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
@@ -180,6 +193,17 @@ void ExplicitCondensed
 {
     EL_DEBUG_CSE
     DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
+    if( ctrl.twoStage )
+    {
+        // There is no need to keep the bulge-chasing reflectors
+        BulgeReflectors<F> bulgeReflectors;
+        two_stage::Reduce
+        ( uplo, A, householderScalars, bulgeReflectors, ctrl.bandwidth,
+          false );
+        MakeTrapezoidal( LOWER, A, 1 );
+        MakeTrapezoidal( UPPER, A, -1 );
+        return;
+    }
     HermitianTridiag( uplo, A, householderScalars, ctrl );
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
@@ -200,7 +224,9 @@ void ExplicitCondensed
     AbstractDistMatrix<F>& householderScalars, \
     const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
-  ( UpperOrLower uplo, Matrix<F>& A ); \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
@@ -218,6 +244,28 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    herm_tridiag::BulgeReflectors<F>& bulgeReflectors, \
+    Int bandwidth ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    herm_tridiag::BulgeReflectors<F>& bulgeReflectors, \
+    Int bandwidth ); \
+  template void herm_tridiag::TwoStageApplyQ \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const herm_tridiag::BulgeReflectors<F>& bulgeReflectors, \
+          Matrix<F>& B ); \
+  template void herm_tridiag::TwoStageApplyQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const herm_tridiag::BulgeReflectors<F>& bulgeReflectors, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
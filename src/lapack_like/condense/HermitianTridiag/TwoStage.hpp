@@ -0,0 +1,573 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+// The first stage reduces the lower triangle of A to a band of width b one
+// panel of b columns at a time: the reflectors which annihilate the panel
+// below its b'th subdiagonal are accumulated into the compact WY form
+// Q = I - V S V^H, and the trailing matrix is updated with the single
+// rank-2b update
+//
+//   Q A22 Q^H = A22 - V W^H - W V^H,
+//
+// where X = A22 V S^H and W = X - (1/2) V (S V^H X). Since the j'th reflector
+// has its head on the b'th subdiagonal, the reflectors are packed exactly as
+// those of the one-stage reduction, but with an offset of -b rather than -1.
+//
+// The second stage is the bulge-chasing algorithm of
+//
+//   Azzam Haidar, Hatem Ltaief, and Jack Dongarra, "Parallel reduction to
+//   condensed forms for symmetric eigenvalue problems using aggregated
+//   fine-grained and memory-aware kernels", SC '11,
+//
+// where the j'th sweep annihilates A(j+2:n,j) with a reflector of length b,
+// whose application from the right creates a bulge below the band. Only the
+// first column of each bulge is annihilated before the next bulge is created
+// b rows further down; the remainder of the bulge is annihilated by the
+// following sweep. The band (including room for the bulges) is small enough
+// to be redundantly stored and reduced by every process, which costs O(b n^2)
+// flops per process. The reflectors of Q2, on the other hand, have roughly
+// n^2/2 entries in total, and so the distributed reduction only keeps those
+// which it owns in a [* ,VR] distribution (about n^2/(2p) entries per
+// process). The backtransformation gathers the reflectors of one group of b
+// sweeps (about b n entries) at a time.
+
+namespace El {
+namespace herm_tridiag {
+namespace two_stage {
+
+inline Int Bandwidth( Int n, Int bandwidth )
+{
+    if( bandwidth == 0 )
+        bandwidth = Blocksize();
+    if( bandwidth < 0 )
+        LogicError("The bandwidth must be non-negative");
+    return Max(Min(bandwidth,n-1),Int(1));
+}
+
+template<typename F>
+void ReduceToBand( Matrix<F>& A, Matrix<F>& householderScalars, Int b )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    householderScalars.Resize( Max(n-b,Int(0)), 1 );
+
+    Matrix<F> z, V, SInv, X, Z;
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+        const Range<Int> ind2( k+b, n );
+
+        // Annihilate the panel below its b'th subdiagonal
+        for( Int c=0; c<nb; ++c )
+        {
+            auto alpha = A( IR(k+b+c),       IR(k+c) );
+            auto x     = A( IR(k+b+c+1,END), IR(k+c) );
+            auto u     = A( IR(k+b+c,END),   IR(k+c) );
+            auto APanR = A( IR(k+b+c,END),   IR(k+c+1,k+b) );
+
+            const F tau = LeftReflector( alpha, x );
+            householderScalars(k+c) = tau;
+
+            const F beta = alpha(0);
+            alpha(0) = F(1);
+            Zeros( z, APanR.Width(), 1 );
+            Gemv( ADJOINT, F(1), APanR, u, F(0), z );
+            Ger( -tau, u, z, APanR );
+            alpha(0) = beta;
+        }
+
+        // Form Q = I - V S V^H, where S = inv(SInv)
+        auto APan = A( ind2, IR(k,k+nb) );
+        V = APan;
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        Herk( LOWER, ADJOINT, Base<F>(1), V, SInv );
+        for( Int c=0; c<nb; ++c )
+            SInv(c,c) = F(1)/householderScalars(k+c);
+
+        // X := A22 V S^H
+        auto A22 = A( ind2, ind2 );
+        Zeros( X, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), X );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv, X );
+
+        // W := X - (1/2) V (S V^H X), stored in X
+        Gemm( ADJOINT, NORMAL, F(1), V, X, Z );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv, Z );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, Z, F(1), X );
+
+        // A22 := A22 - V W^H - W V^H
+        Her2k( LOWER, NORMAL, F(-1), V, X, Base<F>(1), A22 );
+    }
+}
+
+template<typename F>
+void ReduceToBand
+( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& householderScalars, Int b )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+    householderScalars.Resize( Max(n-b,Int(0)), 1 );
+
+    DistMatrix<F,MC,STAR> u_MC_STAR(g);
+    DistMatrix<F,MR,STAR> z_MR_STAR(g);
+    DistMatrix<F> V(g), X(g), Z(g);
+    DistMatrix<F,STAR,STAR> SInv(g);
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+        const Range<Int> ind2( k+b, n );
+
+        // Annihilate the panel below its b'th subdiagonal
+        for( Int c=0; c<nb; ++c )
+        {
+            auto alpha = A( IR(k+b+c),       IR(k+c) );
+            auto x     = A( IR(k+b+c+1,END), IR(k+c) );
+            auto u     = A( IR(k+b+c,END),   IR(k+c) );
+            auto APanR = A( IR(k+b+c,END),   IR(k+c+1,k+b) );
+
+            const F tau = LeftReflector( alpha, x );
+            householderScalars.SetLocal( k+c, 0, tau );
+
+            u_MC_STAR.AlignWith( APanR );
+            Copy( u, u_MC_STAR );
+            u_MC_STAR.Set( 0, 0, F(1) );
+            z_MR_STAR.AlignWith( APanR );
+            Zeros( z_MR_STAR, APanR.Width(), 1 );
+            LocalGemv( ADJOINT, F(1), APanR, u_MC_STAR, F(0), z_MR_STAR );
+            El::AllReduce( z_MR_STAR.Matrix(), APanR.ColComm() );
+            LocalGer( -tau, u_MC_STAR, z_MR_STAR, APanR );
+        }
+
+        // Form Q = I - V S V^H, where S = inv(SInv)
+        auto APan = A( ind2, IR(k,k+nb) );
+        V = APan;
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        Herk( LOWER, ADJOINT, Base<F>(1), V, SInv );
+        for( Int c=0; c<nb; ++c )
+            SInv.SetLocal
+            ( c, c, F(1)/householderScalars.GetLocal(k+c,0) );
+
+        // X := A22 V S^H
+        auto A22 = A( ind2, ind2 );
+        Zeros( X, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), X );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv, X );
+
+        // W := X - (1/2) V (S V^H X), stored in X
+        Gemm( ADJOINT, NORMAL, F(1), V, X, Z );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv, Z );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, Z, F(1), X );
+
+        // A22 := A22 - V W^H - W V^H
+        Her2k( LOWER, NORMAL, F(-1), V, X, Base<F>(1), A22 );
+    }
+}
+
+// Form the offsets of the reflectors of each sweep and return their total
+// number
+template<typename F>
+Int FormSweepOffsets( Int n, BulgeReflectors<F>& bulges )
+{
+    EL_DEBUG_CSE
+    const Int b = bulges.bandwidth;
+
+    // A band of width one is already tridiagonal (with a real subdiagonal)
+    const Int numSweeps = ( b > 1 ? Max(n-1,Int(0)) : 0 );
+    bulges.sweepOffsets.resize( numSweeps+1 );
+    bulges.sweepOffsets[0] = 0;
+    for( Int j=0; j<numSweeps; ++j )
+        bulges.sweepOffsets[j+1] = bulges.sweepOffsets[j] + (n-1-j+b-1)/b;
+    return bulges.sweepOffsets[numSweeps];
+}
+
+// On entry, A(i,j) is stored in ABand(i-j,j) for 0 <= i-j <= b, ABand must
+// have 2b+1 rows so that there is room for the bulges, and the sweep offsets
+// must have been formed. If 'storeReflector' is nonempty, it is passed the
+// index, scalar, and vector (without its unit head) of each reflector.
+template<typename F>
+void ChaseBulges
+( Matrix<F>& ABand,
+  const BulgeReflectors<F>& bulges,
+  Matrix<Base<F>>& d,
+  Matrix<Base<F>>& e,
+  const function<void(Int,const F&,const Matrix<F>&)>& storeReflector )
+{
+    EL_DEBUG_CSE
+    const Int n = ABand.Width();
+    const Int b = bulges.bandwidth;
+    const Int numSweeps = bulges.sweepOffsets.size()-1;
+    EL_DEBUG_ONLY(
+      if( ABand.Height() != 2*b+1 || ABand.LDim() != 2*b+1 )
+          LogicError("ABand must be a contiguous (2b+1) x n matrix");
+    )
+
+    // Since A(i,j) lives at position i+j*(2b) of the buffer, any window of
+    // the (extended) band is a dense matrix with a leading dimension of 2b
+    F* ABuf = ABand.Buffer();
+    const Int windowLDim = 2*b;
+    auto window =
+      [&]( Matrix<F>& W, Int i, Int j, Int height, Int width )
+      { W.Attach( height, width, &ABuf[i+j*windowLDim], windowLDim ); };
+
+    Matrix<F> x, u, AL, D, E, z, w;
+    for( Int j=0; j<numSweeps; ++j )
+    {
+        for( Int s=0, r0=j+1; r0<n; ++s, r0+=b )
+        {
+            const Int r1 = Min(r0+b,n);
+            const Int L = r1-r0;
+            const Int c = ( s == 0 ? j : r0-b );
+            const Int index = bulges.sweepOffsets[j] + s;
+
+            // Annihilate A(r0+1:r1,c)
+            F& alpha = ABuf[r0+c*windowLDim];
+            window( x, r0+1, c, L-1, 1 );
+            const F tau = LeftReflector( alpha, x );
+            if( storeReflector )
+                storeReflector( index, tau, x );
+            const F beta = alpha;
+            alpha = F(1);
+            window( u, r0, c, L, 1 );
+
+            // A(r0:r1,c+1:r0) := H A(r0:r1,c+1:r0)
+            if( r0 > c+1 )
+            {
+                window( AL, r0, c+1, L, r0-c-1 );
+                Zeros( z, AL.Width(), 1 );
+                Gemv( ADJOINT, F(1), AL, u, F(0), z );
+                Ger( -tau, u, z, AL );
+            }
+
+            // A(r0:r1,r0:r1) := H A(r0:r1,r0:r1) H^H
+            window( D, r0, r0, L, L );
+            Zeros( w, L, 1 );
+            Hemv( LOWER, Conj(tau), D, u, F(0), w );
+            const F gamma = -Conj(tau)*Dot( w, u )/F(2);
+            Axpy( gamma, u, w );
+            Her2( LOWER, F(-1), u, w, D );
+
+            // A(r1:r1+b,r0:r1) := A(r1:r1+b,r0:r1) H^H, which creates the
+            // next bulge
+            const Int bulgeEnd = Min(r1+b,n);
+            if( bulgeEnd > r1 )
+            {
+                window( E, r1, r0, bulgeEnd-r1, L );
+                Zeros( z, E.Height(), 1 );
+                Gemv( NORMAL, F(1), E, u, F(0), z );
+                Ger( -Conj(tau), z, u, E );
+            }
+
+            alpha = beta;
+            Zero( x );
+        }
+    }
+
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,Int(0)), 1 );
+    for( Int j=0; j<n; ++j )
+        d(j) = RealPart(ABand(0,j));
+    for( Int j=0; j<n-1; ++j )
+        e(j) = RealPart(ABand(1,j));
+}
+
+// B := Q2 B
+//
+// The reflectors from the same step of consecutive sweeps are shifted by a
+// single row, and so b of them are applied at once in compact WY form.
+// Applying the groups of b sweeps in reverse order, and the steps within each
+// group in increasing order, respects the dependencies between the
+// reflectors, since the s'th reflector of a sweep only overlaps the (s+1)'th
+// reflector of the earlier sweeps in the same group.
+//
+// The routine 'getGroup' should return copies of the columns of the
+// reflectors (and the entries of the scalars) within the given range, which
+// covers a single group of sweeps.
+template<typename F,class GetGroupType>
+void ApplyBulgeReflectors
+( const BulgeReflectors<F>& bulges,
+        Matrix<F>& B,
+  const GetGroupType& getGroup )
+{
+    EL_DEBUG_CSE
+    const Int n = B.Height();
+    const Int b = bulges.bandwidth;
+    const Int numSweeps = bulges.sweepOffsets.size()-1;
+    if( numSweeps <= 0 )
+        return;
+
+    Matrix<F> H, householderScalars, groupReflectors, groupScalars;
+    for( Int jGroup=((numSweeps-1)/b)*b; jGroup>=0; jGroup-=b )
+    {
+        const Int groupOffset = bulges.sweepOffsets[jGroup];
+        const Int groupEnd = bulges.sweepOffsets[Min(jGroup+b,numSweeps)];
+        getGroup( IR(groupOffset,groupEnd), groupReflectors, groupScalars );
+        for( Int s=0; ; ++s )
+        {
+            const Int r = jGroup+1+s*b;
+            const Int jEnd = Min(Min(jGroup+b,numSweeps),n-1-s*b);
+            if( jEnd <= jGroup )
+                break;
+            const Int numGroup = jEnd-jGroup;
+            const Int height = Min(numGroup+b-1,n-r);
+
+            Zeros( H, height, numGroup );
+            householderScalars.Resize( numGroup, 1 );
+            for( Int c=0; c<numGroup; ++c )
+            {
+                const Int index =
+                  bulges.sweepOffsets[jGroup+c] + s - groupOffset;
+                const Int L = Min(b,n-(r+c));
+                householderScalars(c) = groupScalars(index);
+                for( Int i=1; i<L; ++i )
+                    H(c+i,c) = groupReflectors(i-1,index);
+            }
+            auto BSub = B( IR(r,r+height), ALL );
+            ApplyPackedReflectors
+            ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, 0,
+              H, householderScalars, BSub );
+        }
+    }
+}
+
+template<typename F>
+void Reduce
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  BulgeReflectors<F>& bulgeReflectors,
+  Int bandwidth,
+  bool storeReflectors )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    const Int b = Bandwidth( n, bandwidth );
+    bulgeReflectors.bandwidth = b;
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+
+    ReduceToBand( A, householderScalars, b );
+
+    Matrix<F> ABand;
+    Zeros( ABand, 2*b+1, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(j+b+1,n); ++i )
+            ABand(i-j,j) = A(i,j);
+    const Int numReflectors = FormSweepOffsets( n, bulgeReflectors );
+    auto& reflectors = bulgeReflectors.reflectors;
+    auto& bulgeScalars = bulgeReflectors.householderScalars;
+    Zeros( reflectors, b-1, storeReflectors ? numReflectors : 0 );
+    Zeros( bulgeScalars, storeReflectors ? numReflectors : 0, 1 );
+    function<void(Int,const F&,const Matrix<F>&)> storeReflector;
+    if( storeReflectors )
+        storeReflector =
+          [&]( Int index, const F& tau, const Matrix<F>& x )
+          {
+              bulgeScalars(index) = tau;
+              for( Int i=0; i<x.Height(); ++i )
+                  reflectors(i,index) = x(i);
+          };
+    Matrix<Base<F>> d, e;
+    ChaseBulges( ABand, bulgeReflectors, d, e, storeReflector );
+
+    // Overwrite the band with T
+    for( Int j=0; j<n; ++j )
+    {
+        A(j,j) = d(j);
+        if( j < n-1 )
+        {
+            A(j+1,j) = e(j);
+            A(j,j+1) = e(j);
+        }
+        for( Int i=j+2; i<Min(j+b+1,n); ++i )
+            A(i,j) = 0;
+    }
+}
+
+template<typename F>
+void Reduce
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  BulgeReflectors<F>& bulgeReflectors,
+  Int bandwidth,
+  bool storeReflectors )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+
+    const Int n = A.Height();
+    const Int b = Bandwidth( n, bandwidth );
+    bulgeReflectors.bandwidth = b;
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+
+    ReduceToBand( A, householderScalars, b );
+
+    // Give every process a copy of the band
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    Matrix<F> ABand;
+    Zeros( ABand, 2*b+1, n );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i >= j && i <= j+b )
+                ABand(i-j,j) = A.GetLocal(iLoc,jLoc);
+        }
+    }
+    El::AllReduce( ABand, A.DistComm() );
+
+    // Only keep the reflectors which this process owns
+    const Int numReflectors = FormSweepOffsets( n, bulgeReflectors );
+    auto& reflectors = bulgeReflectors.distReflectors;
+    auto& bulgeScalars = bulgeReflectors.distHouseholderScalars;
+    reflectors.SetGrid( A.Grid() );
+    bulgeScalars.SetGrid( A.Grid() );
+    Zeros( reflectors, b-1, storeReflectors ? numReflectors : 0 );
+    Zeros( bulgeScalars, storeReflectors ? numReflectors : 0, 1 );
+    function<void(Int,const F&,const Matrix<F>&)> storeReflector;
+    if( storeReflectors )
+        storeReflector =
+          [&]( Int index, const F& tau, const Matrix<F>& x )
+          {
+              if( bulgeScalars.IsLocalRow(index) )
+                  bulgeScalars.SetLocal( bulgeScalars.LocalRow(index), 0, tau );
+              if( reflectors.IsLocalCol(index) )
+              {
+                  const Int indexLoc = reflectors.LocalCol(index);
+                  for( Int i=0; i<x.Height(); ++i )
+                      reflectors.SetLocal( i, indexLoc, x(i) );
+              }
+          };
+    Matrix<Base<F>> d, e;
+    ChaseBulges( ABand, bulgeReflectors, d, e, storeReflector );
+
+    // Overwrite the band with T
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == j )
+                A.SetLocal( iLoc, jLoc, d(j) );
+            else if( i == j+1 )
+                A.SetLocal( iLoc, jLoc, e(j) );
+            else if( j == i+1 )
+                A.SetLocal( iLoc, jLoc, e(i) );
+            else if( i > j && i <= j+b )
+                A.SetLocal( iLoc, jLoc, F(0) );
+        }
+    }
+}
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  BulgeReflectors<F>& bulgeReflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::Reduce
+    ( uplo, A, householderScalars, bulgeReflectors, bandwidth, true );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  BulgeReflectors<F>& bulgeReflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::Reduce
+    ( uplo, A, householderScalars, bulgeReflectors, bandwidth, true );
+}
+
+template<typename F>
+void TwoStageApplyQ
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const BulgeReflectors<F>& bulgeReflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    auto getGroup =
+      [&]( const Range<Int>& ind,
+           Matrix<F>& groupReflectors, Matrix<F>& groupScalars )
+      {
+          groupReflectors = bulgeReflectors.reflectors( ALL, ind );
+          groupScalars = bulgeReflectors.householderScalars( ind, ALL );
+      };
+    two_stage::ApplyBulgeReflectors( bulgeReflectors, B, getGroup );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED,
+      -bulgeReflectors.bandwidth, A, householderScalars, B );
+}
+
+template<typename F>
+void TwoStageApplyQ
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    // Every process applies Q2 to its own set of full columns after gathering
+    // the reflectors of each group of sweeps
+    const Grid& g = B.Grid();
+    DistMatrix<F,STAR,STAR> groupReflectors_STAR_STAR(g),
+                            groupScalars_STAR_STAR(g);
+    auto getGroup =
+      [&]( const Range<Int>& ind,
+           Matrix<F>& groupReflectors, Matrix<F>& groupScalars )
+      {
+          groupReflectors_STAR_STAR =
+            bulgeReflectors.distReflectors( ALL, ind );
+          groupScalars_STAR_STAR =
+            bulgeReflectors.distHouseholderScalars( ind, ALL );
+          groupReflectors = groupReflectors_STAR_STAR.Matrix();
+          groupScalars = groupScalars_STAR_STAR.Matrix();
+      };
+    DistMatrix<F,STAR,VR> B_STAR_VR( B );
+    two_stage::ApplyBulgeReflectors
+    ( bulgeReflectors, B_STAR_VR.Matrix(), getGroup );
+    Copy( B_STAR_VR, B );
+
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED,
+      -bulgeReflectors.bandwidth, A, householderScalars, B );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -15,6 +15,7 @@
 #include "./Cholesky/PivotedLowerVariant3.hpp"
 #include "./Cholesky/PivotedUpperVariant3.hpp"
 #include "./Cholesky/SolveAfter.hpp"
+#include "./Cholesky/OutOfCore.hpp"
 
 #include "./Cholesky/LowerMod.hpp"
 #include "./Cholesky/UpperMod.hpp"
@@ -120,6 +121,24 @@ void Cholesky
         cholesky::PivotedUpperVariant3Blocked( A, p );
 }
 
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, Matrix<F>& A, MappedFile& file,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    cholesky::OutOfCore<F>( uplo, A, file, ctrl );
+}
+
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, DistMatrix<F>& A, MappedFile& file,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    cholesky::OutOfCore<F>( uplo, A, file, ctrl );
+}
+
 template<typename F>
 void Cholesky
 ( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A )
@@ -242,7 +261,25 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   ( UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const DistPermutation& p, \
-          AbstractDistMatrix<F>& B ); 
+          AbstractDistMatrix<F>& B ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, Matrix<F>& A, MappedFile& file, \
+    const OutOfCoreCtrl& ctrl ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, DistMatrix<F>& A, MappedFile& file, \
+    const OutOfCoreCtrl& ctrl ); \
+  template void cholesky::SolveAfter \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const Matrix<F>& A, \
+          MappedFile& file, \
+          Matrix<F>& B, \
+    const OutOfCoreCtrl& ctrl ); \
+  template void cholesky::SolveAfter \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const DistMatrix<F>& A, \
+          MappedFile& file, \
+          AbstractDistMatrix<F>& B, \
+    const OutOfCoreCtrl& ctrl );
 
 #define PROTO(F) \
   PROTO_BASE(F) \
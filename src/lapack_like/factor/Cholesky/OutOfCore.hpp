@@ -0,0 +1,209 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_OUTOFCORE_HPP
+#define EL_CHOLESKY_OUTOFCORE_HPP
+
+#include "../OutOfCore.hpp"
+
+namespace El {
+namespace cholesky {
+
+// A left-looking variant over wide column panels: each panel is brought up to
+// date by streaming in all of the previously-factored panels, factored with
+// the in-core kernels, and then written back. Only the panel being updated
+// and the panel being applied to it are touched at any one time, while the
+// next panel to be applied is read ahead.
+
+template<typename F,class MatrixType>
+void LowerOutOfCore( MatrixType& A, MappedFile& file, Int panelWidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    for( Int k=0; k<n; k+=panelWidth )
+    {
+        const Int nb = Min(panelWidth,n-k);
+        const IR ind1( k, k+nb ), ind2( k+nb, n ), indB( k, n );
+
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+        ooc::Prefetch<F>( file, A, indB, ind1 );
+        if( k > 0 )
+            ooc::Prefetch<F>( file, A, indB, IR(0,Min(panelWidth,k)) );
+
+        for( Int j=0; j<k; j+=panelWidth )
+        {
+            const Int jb = Min(panelWidth,k-j);
+            const IR indj( j, j+jb );
+            if( j+jb < k )
+                ooc::Prefetch<F>
+                ( file, A, indB, IR(j+jb,Min(j+jb+panelWidth,k)) );
+
+            auto L1j = A( ind1, indj );
+            auto L2j = A( ind2, indj );
+            Herk( LOWER, NORMAL, Base<F>(-1), L1j, Base<F>(1), A11 );
+            Gemm( NORMAL, ADJOINT, F(-1), L2j, L1j, F(1), A21 );
+            ooc::Evict<F>( file, A, indB, indj );
+        }
+
+        // Overlap reading the next panel with the factorization of this one
+        if( k+nb < n )
+        {
+            const Int kNext = k+nb;
+            const IR indNext( kNext, Min(kNext+panelWidth,n) );
+            ooc::Prefetch<F>( file, A, IR(kNext,n), indNext );
+        }
+        Cholesky( LOWER, A11 );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+        ooc::Evict<F>( file, A, indB, ind1 );
+    }
+}
+
+template<typename F,class MatrixType>
+void UpperOutOfCore( MatrixType& A, MappedFile& file, Int panelWidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    for( Int k=0; k<n; k+=panelWidth )
+    {
+        const Int nb = Min(panelWidth,n-k);
+        const IR ind1( k, k+nb ), indT( 0, k+nb );
+
+        auto A11 = A( ind1, ind1 );
+        ooc::Prefetch<F>( file, A, indT, ind1 );
+        if( k > 0 )
+        {
+            const Int jb = Min(panelWidth,k);
+            ooc::Prefetch<F>( file, A, IR(0,jb), IR(0,jb) );
+        }
+
+        // Solve U01 := U00^{-H} A01 one block row at a time, accumulating
+        // A11 := A11 - U01^H U01 along the way
+        for( Int j=0; j<k; j+=panelWidth )
+        {
+            const Int jb = Min(panelWidth,k-j);
+            const IR ind0( 0, j ), indj( j, j+jb );
+            if( j+jb < k )
+            {
+                const Int jNext = j+jb;
+                const Int jbNext = Min(panelWidth,k-jNext);
+                ooc::Prefetch<F>
+                ( file, A, IR(0,jNext+jbNext), IR(jNext,jNext+jbNext) );
+            }
+
+            auto U0j = A( ind0, indj );
+            auto Ujj = A( indj, indj );
+            auto X0 = A( ind0, ind1 );
+            auto Xj = A( indj, ind1 );
+            Gemm( ADJOINT, NORMAL, F(-1), U0j, X0, F(1), Xj );
+            Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), Ujj, Xj );
+            Herk( UPPER, ADJOINT, Base<F>(-1), Xj, Base<F>(1), A11 );
+            ooc::Evict<F>( file, A, IR(0,j+jb), indj );
+        }
+
+        if( k+nb < n )
+        {
+            const Int kNext = k+nb;
+            const Int nbNext = Min(panelWidth,n-kNext);
+            ooc::Prefetch<F>
+            ( file, A, IR(0,kNext+nbNext), IR(kNext,kNext+nbNext) );
+        }
+        Cholesky( UPPER, A11 );
+        ooc::Evict<F>( file, A, indT, ind1 );
+    }
+}
+
+template<typename F,class MatrixType>
+void OutOfCore
+( UpperOrLower uplo, MatrixType& A, MappedFile& file,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Can only compute Cholesky factor of square matrices");
+    if( !file.Writable() )
+        LogicError("The factor cannot be written back to ",file.Filename());
+    const Int panelWidth = ooc::PanelWidth<F>( A, ctrl );
+    file.Advise( SEQUENTIAL_ACCESS );
+    if( uplo == LOWER )
+        LowerOutOfCore<F>( A, file, panelWidth );
+    else
+        UpperOutOfCore<F>( A, file, panelWidth );
+    file.Advise( NORMAL_ACCESS );
+}
+
+template<typename F,class MatrixType>
+void StreamedSolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const MatrixType& A,
+        MappedFile& file,
+        MatrixType& B,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != B.Height() )
+          LogicError("A and B must be the same height");
+    )
+    const Int panelWidth = ooc::PanelWidth<F>( A, ctrl );
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    if( uplo == LOWER )
+    {
+        ooc::StreamedTrsm<F>
+        ( LOWER, NORMAL, NON_UNIT, A, file, B, panelWidth );
+        ooc::StreamedTrsm<F>
+        ( LOWER, ADJOINT, NON_UNIT, A, file, B, panelWidth );
+    }
+    else
+    {
+        ooc::StreamedTrsm<F>
+        ( UPPER, ADJOINT, NON_UNIT, A, file, B, panelWidth );
+        ooc::StreamedTrsm<F>
+        ( UPPER, NORMAL, NON_UNIT, A, file, B, panelWidth );
+    }
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+}
+
+template<typename F>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<F>& A,
+        MappedFile& file,
+        Matrix<F>& B,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    StreamedSolveAfter<F>( uplo, orientation, A, file, B, ctrl );
+}
+
+template<typename F>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const DistMatrix<F>& A,
+        MappedFile& file,
+        AbstractDistMatrix<F>& BPre,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( A, BPre ))
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    StreamedSolveAfter<F>( uplo, orientation, A, file, B, ctrl );
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_OUTOFCORE_HPP
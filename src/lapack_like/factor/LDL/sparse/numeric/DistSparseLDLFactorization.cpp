@@ -42,6 +42,8 @@ void DiagonalScale
 ( const DistNodeInfo& info,
   const DistFront<Field>& front,
         DistMatrixNode<Field>& B );
+template<typename Field>
+void LocalInertia( const DistFront<Field>& front, InertiaType& inertia );
 
 } // namespace ldl
 
@@ -160,7 +162,7 @@ void DistSparseLDLFactorization<Field>::ChangeNonzeroValues
     }
     front_->Pull
     ( ANew, map_, *separator_, *info_,
-      mappedSources_, mappedTargets_, columnOffsets_ );
+      mappedSources_, mappedTargets_, columnOffsets_, front_->isHermitian );
     factored_ = false;
 }
 
@@ -527,6 +529,31 @@ void DistSparseLDLFactorization<Field>::MultiplyWithD
     }
 }
 
+template<typename Field>
+InertiaType DistSparseLDLFactorization<Field>::Inertia() const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Inertia()");
+    if( !front_->isHermitian )
+        LogicError("Inertia is only defined for Hermitian factorizations");
+    InertiaType localInertia;
+    localInertia.numPositive = localInertia.numNegative =
+      localInertia.numZero = 0;
+    ldl::LocalInertia( *front_, localInertia );
+
+    Int counts[3] =
+      { localInertia.numPositive,
+        localInertia.numNegative,
+        localInertia.numZero };
+    mpi::AllReduce( counts, 3, info_->Grid().Comm() );
+    InertiaType inertia;
+    inertia.numPositive = counts[0];
+    inertia.numNegative = counts[1];
+    inertia.numZero = counts[2];
+    return inertia;
+}
+
 template<typename Field>
 bool DistSparseLDLFactorization<Field>::Factored() const
 { return factored_; }
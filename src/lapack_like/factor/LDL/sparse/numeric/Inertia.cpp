@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// By Sylvester's law of inertia, the inertia of a Hermitian matrix with a
+// (symmetrically permuted) factorization L D L^H is that of the
+// quasi-diagonal matrix D, which is distributed over the fronts of the
+// elimination tree. Each front's contribution is accumulated into
+// 'inertia'; in the distributed case, the contributions must afterwards be
+// summed over the communicator of the root front.
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+template<typename F>
+void AccumulateDiagonal( const Matrix<F>& diag, InertiaType& inertia )
+{
+    typedef Base<F> Real;
+    const Int n = diag.Height();
+    for( Int i=0; i<n; ++i )
+    {
+        const Real delta = RealPart(diag(i));
+        if( delta > Real(0) )
+            ++inertia.numPositive;
+        else if( delta < Real(0) )
+            ++inertia.numNegative;
+        else
+            ++inertia.numZero;
+    }
+}
+
+template<typename F>
+void AccumulateQuasiDiagonal
+( const Matrix<F>& diag, const Matrix<F>& subdiag, InertiaType& inertia )
+{
+    Matrix<Base<F>> diagReal;
+    RealPart( diag, diagReal );
+    const InertiaType frontInertia = Inertia( diagReal, subdiag );
+    inertia.numPositive += frontInertia.numPositive;
+    inertia.numNegative += frontInertia.numNegative;
+    inertia.numZero += frontInertia.numZero;
+}
+
+} // anonymous namespace
+
+template<typename F>
+void LocalInertia( const Front<F>& front, InertiaType& inertia )
+{
+    EL_DEBUG_CSE
+    if( BlockFactorization(front.type) )
+        LogicError("Inertia is not available for block LDL factorizations");
+
+    for( const auto& child : front.children )
+        LocalInertia( *child, inertia );
+
+    if( PivotedFactorization(front.type) )
+        AccumulateQuasiDiagonal( front.diag, front.subdiag, inertia );
+    else
+        AccumulateDiagonal( front.diag, inertia );
+}
+
+template<typename F>
+void LocalInertia( const DistFront<F>& front, InertiaType& inertia )
+{
+    EL_DEBUG_CSE
+    if( front.child == nullptr )
+    {
+        LocalInertia( *front.duplicate, inertia );
+        return;
+    }
+    LocalInertia( *front.child, inertia );
+
+    if( BlockFactorization(front.type) )
+        LogicError("Inertia is not available for block LDL factorizations");
+    if( PivotedFactorization(front.type) )
+    {
+        // A 2x2 pivot can straddle two members of the [VC,* ] team, so the
+        // quasi-diagonal is gathered and counted by the team's root
+        const Grid& grid = front.diag.Grid();
+        DistMatrix<F,STAR,STAR> diag_STAR_STAR( front.diag ),
+                                subdiag_STAR_STAR( front.subdiag );
+        if( grid.Rank() == 0 )
+            AccumulateQuasiDiagonal
+            ( diag_STAR_STAR.LockedMatrix(), subdiag_STAR_STAR.LockedMatrix(),
+              inertia );
+    }
+    else
+        AccumulateDiagonal( front.diag.LockedMatrix(), inertia );
+}
+
+#define PROTO(F) \
+  template void LocalInertia \
+  ( const Front<F>& front, InertiaType& inertia ); \
+  template void LocalInertia \
+  ( const DistFront<F>& front, InertiaType& inertia );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
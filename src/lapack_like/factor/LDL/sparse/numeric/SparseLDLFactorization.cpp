@@ -32,6 +32,8 @@ void DiagonalScale
 ( const NodeInfo& info,
   const Front<Field>& front,
         MatrixNode<Field>& B );
+template<typename Field>
+void LocalInertia( const Front<Field>& front, InertiaType& inertia );
 
 } // namespace ldl
 
@@ -138,7 +140,7 @@ void SparseLDLFactorization<Field>::ChangeNonzeroValues
     EL_DEBUG_CSE
     if( !initialized_ )
         LogicError("Must initialize before calling 'ChangeNonzeroValues()'");
-    front_->Pull( ANew, map_, *info_ );
+    front_->Pull( ANew, map_, *info_, front_->isHermitian );
     factored_ = false;
 }
 
@@ -347,6 +349,20 @@ void SparseLDLFactorization<Field>::MultiplyWithD
     }
 }
 
+template<typename Field>
+InertiaType SparseLDLFactorization<Field>::Inertia() const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Inertia()");
+    if( !front_->isHermitian )
+        LogicError("Inertia is only defined for Hermitian factorizations");
+    InertiaType inertia;
+    inertia.numPositive = inertia.numNegative = inertia.numZero = 0;
+    ldl::LocalInertia( *front_, inertia );
+    return inertia;
+}
+
 template<typename Field>
 bool SparseLDLFactorization<Field>::Factored() const
 { return factored_; }
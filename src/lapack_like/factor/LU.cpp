@@ -13,6 +13,7 @@
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
+#include "./LU/OutOfCore.hpp"
 
 namespace El {
 
@@ -141,6 +142,27 @@ void LU( Matrix<F>& A, Permutation& P )
     }
 }
 
+template<typename F>
+void LU
+( Matrix<F>& A, Permutation& P, MappedFile& file,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Permutation PB;
+    lu::OutOfCore<F>( A, P, PB, file, ctrl );
+}
+
+template<typename F>
+void LU
+( DistMatrix<F>& A, DistPermutation& P, MappedFile& file,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    P.SetGrid( A.Grid() );
+    DistPermutation PB( A.Grid() );
+    lu::OutOfCore<F>( A, P, PB, file, ctrl );
+}
+
 template<typename F>
 void LU
 ( Matrix<F>& A,
@@ -241,6 +263,16 @@ void LU
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( Matrix<F>& A, \
+    Permutation& P, \
+    MappedFile& file, \
+    const OutOfCoreCtrl& ctrl ); \
+  template void LU \
+  ( DistMatrix<F>& A, \
+    DistPermutation& P, \
+    MappedFile& file, \
+    const OutOfCoreCtrl& ctrl ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -293,6 +325,20 @@ void LU
     const DistPermutation& P, \
           AbstractDistMatrix<F>& B ); \
   template void lu::SolveAfter \
+  ( Orientation orientation, \
+    const Matrix<F>& A, \
+    const Permutation& P, \
+          MappedFile& file, \
+          Matrix<F>& B, \
+    const OutOfCoreCtrl& ctrl ); \
+  template void lu::SolveAfter \
+  ( Orientation orientation, \
+    const DistMatrix<F>& A, \
+    const DistPermutation& P, \
+          MappedFile& file, \
+          AbstractDistMatrix<F>& B, \
+    const OutOfCoreCtrl& ctrl ); \
+  template void lu::SolveAfter \
   ( Orientation orientation, \
     const Matrix<F>& A, \
     const Permutation& P, \
@@ -0,0 +1,191 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_OUTOFCORE_HPP
+#define EL_LU_OUTOFCORE_HPP
+
+#include "../OutOfCore.hpp"
+
+namespace El {
+namespace lu {
+
+// A left-looking LU with partial pivoting over wide column panels. Each panel
+// has the row swaps found so far applied to it, is updated by streaming in
+// the previously-factored panels, and is then factored by the in-core LU.
+//
+// Rather than applying the swaps of each new panel to every panel on its
+// left (which would require an extra pass over the factor), the swaps are
+// deferred until the earlier panels are next streamed in for an update, and
+// a final pass applies whatever swaps remain.
+
+template<typename F,class MatrixType,class PermType>
+void OutOfCore
+( MatrixType& A, PermType& P, PermType& PB, MappedFile& file,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !file.Writable() )
+        LogicError("The factor cannot be written back to ",file.Filename());
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int panelWidth = ooc::PanelWidth<F>( A, ctrl );
+    file.Advise( SEQUENTIAL_ACCESS );
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    // The swaps from the factorization of each panel, and the number of them
+    // which have been applied to each factored panel
+    vector<PermType> panelSwaps;
+    vector<Int> numApplied;
+
+    // Bring factored panel p up to date with the swaps from later panels
+    auto applyDeferredSwaps = [&]( Int p )
+    {
+        const Int j = p*panelWidth;
+        const IR indj( j, Min(j+panelWidth,n) );
+        for( Int q=numApplied[p]; q<Int(panelSwaps.size()); ++q )
+        {
+            auto AB = A( IR(q*panelWidth,m), indj );
+            panelSwaps[q].PermuteRows( AB );
+        }
+        numApplied[p] = panelSwaps.size();
+    };
+
+    for( Int k=0; k<n; k+=panelWidth )
+    {
+        const Int nb = Min(panelWidth,n-k);
+        const IR ind1( k, k+nb );
+        const Int numFactored = panelSwaps.size();
+
+        ooc::Prefetch<F>( file, A, ALL, ind1 );
+        if( numFactored > 0 )
+            ooc::Prefetch<F>( file, A, ALL, IR(0,Min(panelWidth,n)) );
+
+        auto A1 = A( ALL, ind1 );
+        P.PermuteRows( A1 );
+
+        for( Int p=0; p<numFactored; ++p )
+        {
+            const Int j = p*panelWidth;
+            const Int jb = Min(panelWidth,minDim-j);
+            const IR indj( j, j+jb ), ind2( j+jb, m );
+            if( p+1 < numFactored )
+            {
+                const Int jNext = j+panelWidth;
+                ooc::Prefetch<F>
+                ( file, A, ALL, IR(jNext,Min(jNext+panelWidth,n)) );
+            }
+
+            applyDeferredSwaps( p );
+            auto Ljj = A( indj, indj );
+            auto L2j = A( ind2, indj );
+            auto X1 = A( indj, ind1 );
+            auto X2 = A( ind2, ind1 );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), Ljj, X1 );
+            Gemm( NORMAL, NORMAL, F(-1), L2j, X1, F(1), X2 );
+            ooc::Evict<F>( file, A, ALL, IR(j,Min(j+panelWidth,n)) );
+        }
+
+        if( k < minDim )
+        {
+            if( k+nb < n )
+            {
+                const IR indNext( k+nb, Min(k+nb+panelWidth,n) );
+                ooc::Prefetch<F>( file, A, ALL, indNext );
+            }
+            auto AB1 = A( IR(k,m), ind1 );
+            LU( AB1, PB );
+            P.SwapSequence( PB, k );
+            panelSwaps.push_back( PB );
+            numApplied.push_back( panelSwaps.size() );
+        }
+        ooc::Evict<F>( file, A, ALL, ind1 );
+    }
+
+    const Int numFactored = panelSwaps.size();
+    for( Int p=0; p<numFactored; ++p )
+    {
+        if( numApplied[p] == numFactored )
+            continue;
+        const Int j = p*panelWidth;
+        const IR indj( j, Min(j+panelWidth,n) );
+        applyDeferredSwaps( p );
+        ooc::Evict<F>( file, A, ALL, indj );
+    }
+    file.Advise( NORMAL_ACCESS );
+}
+
+template<typename F,class MatrixType,class PermType>
+void StreamedSolveAfter
+( Orientation orientation,
+  const MatrixType& A,
+  const PermType& P,
+        MappedFile& file,
+        MatrixType& B,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != B.Height() )
+          LogicError("A and B must be the same height");
+    )
+    const Int panelWidth = ooc::PanelWidth<F>( A, ctrl );
+    if( orientation == NORMAL )
+    {
+        P.PermuteRows( B );
+        ooc::StreamedTrsm<F>( LOWER, NORMAL, UNIT, A, file, B, panelWidth );
+        ooc::StreamedTrsm<F>
+        ( UPPER, NORMAL, NON_UNIT, A, file, B, panelWidth );
+    }
+    else
+    {
+        ooc::StreamedTrsm<F>
+        ( UPPER, orientation, NON_UNIT, A, file, B, panelWidth );
+        ooc::StreamedTrsm<F>
+        ( LOWER, orientation, UNIT, A, file, B, panelWidth );
+        P.InversePermuteRows( B );
+    }
+}
+
+template<typename F>
+void SolveAfter
+( Orientation orientation,
+  const Matrix<F>& A,
+  const Permutation& P,
+        MappedFile& file,
+        Matrix<F>& B,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    StreamedSolveAfter<F>( orientation, A, P, file, B, ctrl );
+}
+
+template<typename F>
+void SolveAfter
+( Orientation orientation,
+  const DistMatrix<F>& A,
+  const DistPermutation& P,
+        MappedFile& file,
+        AbstractDistMatrix<F>& BPre,
+  const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( A, BPre ))
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    StreamedSolveAfter<F>( orientation, A, P, file, B, ctrl );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_OUTOFCORE_HPP
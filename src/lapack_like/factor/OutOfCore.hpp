@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_OUTOFCORE_HPP
+#define EL_FACTOR_OUTOFCORE_HPP
+
+// Utilities shared by the out-of-core factorizations. The matrix is either a
+// Matrix attached to a mapped file or a DistMatrix whose local matrix is, and
+// so the same panel loops are used for both, with the in-core (sequential or
+// distributed) kernels performing the panel updates.
+
+namespace El {
+namespace ooc {
+
+template<typename F>
+inline const Matrix<F>& LocalPanel( const Matrix<F>& A ) { return A; }
+template<typename F>
+inline const Matrix<F>& LocalPanel( const ElementalMatrix<F>& A )
+{ return A.LockedMatrix(); }
+
+template<typename F>
+inline Int LocalHeightBound( const Matrix<F>& A ) { return A.Height(); }
+template<typename F>
+inline Int LocalHeightBound( const ElementalMatrix<F>& A )
+{ return MaxLength( A.Height(), A.ColStride() ); }
+
+// Keep the panel being updated, the previously-factored panel being applied
+// to it, and the panel being read ahead within the memory budget
+template<typename F,class MatrixType>
+inline Int PanelWidth( const MatrixType& A, const OutOfCoreCtrl& ctrl )
+{
+    const Int n = Max( A.Width(), Int(1) );
+    if( ctrl.panelWidth > 0 )
+        return Min( ctrl.panelWidth, n );
+    const Int bsize = Blocksize();
+    const size_t panelBytes = ctrl.memoryBudget / 3;
+    const Int localHeight = Max( LocalHeightBound(A), Int(1) );
+    const size_t columnBytes = size_t(localHeight)*sizeof(F);
+    Int panelWidth = panelBytes / columnBytes;
+    panelWidth = Max( (panelWidth/bsize)*bsize, bsize );
+    return Min( panelWidth, n );
+}
+
+// Request that the pages of A(I,J) be read in the background
+template<typename F,class MatrixType>
+inline void Prefetch
+( MappedFile& file, const MatrixType& A, Range<Int> I, Range<Int> J )
+{
+    auto APan = A( I, J );
+    file.Prefetch( LocalPanel<F>(APan) );
+}
+
+// Schedule the write-back of A(I,J) and release its pages
+template<typename F,class MatrixType>
+inline void Evict
+( MappedFile& file, const MatrixType& A, Range<Int> I, Range<Int> J )
+{
+    auto APan = A( I, J );
+    file.Evict( LocalPanel<F>(APan) );
+}
+
+// Apply the triangle of the out-of-core factor A to B from the left, i.e.,
+// B := op(tri(A))^{-1} B, reading each column panel of A exactly once. Since
+// column panels of a lower (upper) triangle contain the columns (rows) of
+// its (conjugate-)transpose, both orientations stream the same panels.
+template<typename F,class MatrixType>
+inline void StreamedTrsm
+( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
+  const MatrixType& A, MappedFile& file, MatrixType& B, Int panelWidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n == 0 )
+        return;
+    const bool forward = ( (uplo==LOWER) == (orientation==NORMAL) );
+    const Int numPanels = (n+panelWidth-1) / panelWidth;
+    for( Int step=0; step<numPanels; ++step )
+    {
+        const Int p = ( forward ? step : numPanels-1-step );
+        const Int j = p*panelWidth;
+        const Int jb = Min(panelWidth,n-j);
+        const IR ind0(0,j), ind1(j,j+jb), ind2(j+jb,n);
+        const IR indPan = ( uplo==LOWER ? IR(j,n) : IR(0,j+jb) );
+
+        if( step+1 < numPanels )
+        {
+            const Int jNext = ( forward ? j+jb : j-panelWidth );
+            const Int jbNext = Min(panelWidth,n-jNext);
+            const IR indNext = IR(jNext,jNext+jbNext);
+            if( uplo == LOWER )
+                Prefetch<F>( file, A, IR(jNext,n), indNext );
+            else
+                Prefetch<F>( file, A, IR(0,jNext+jbNext), indNext );
+        }
+
+        auto A11 = A( ind1, ind1 );
+        auto B0 = B( ind0, ALL );
+        auto B1 = B( ind1, ALL );
+        auto B2 = B( ind2, ALL );
+        if( uplo == LOWER )
+        {
+            auto A21 = A( ind2, ind1 );
+            if( orientation == NORMAL )
+            {
+                Trsm( LEFT, LOWER, NORMAL, diag, F(1), A11, B1 );
+                Gemm( NORMAL, NORMAL, F(-1), A21, B1, F(1), B2 );
+            }
+            else
+            {
+                Gemm( orientation, NORMAL, F(-1), A21, B2, F(1), B1 );
+                Trsm( LEFT, LOWER, orientation, diag, F(1), A11, B1 );
+            }
+        }
+        else
+        {
+            auto A01 = A( ind0, ind1 );
+            if( orientation == NORMAL )
+            {
+                Trsm( LEFT, UPPER, NORMAL, diag, F(1), A11, B1 );
+                Gemm( NORMAL, NORMAL, F(-1), A01, B1, F(1), B0 );
+            }
+            else
+            {
+                Gemm( orientation, NORMAL, F(-1), A01, B0, F(1), B1 );
+                Trsm( LEFT, UPPER, orientation, diag, F(1), A11, B1 );
+            }
+        }
+        Evict<F>( file, A, indPan, ind1 );
+    }
+}
+
+} // namespace ooc
+} // namespace El
+
+#endif // ifndef EL_FACTOR_OUTOFCORE_HPP
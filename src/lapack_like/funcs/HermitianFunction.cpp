@@ -8,8 +8,150 @@
 */
 #include <El.hpp>
 
+#include "./HermitianFunction/Chebyshev.hpp"
+
 namespace El {
 
+// Apply a Chebyshev expansion of the real-valued function f to B, B := f(A) B
+
+template<typename Field>
+void ApplyHermitianFunction
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+        Matrix<Field>& B,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    if( B.Height() != n )
+        LogicError("B must have as many rows as A");
+
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      { Hemm( LEFT, uplo, alpha, A, X, beta, Y ); };
+
+    const auto interval = herm_func::SpectralInterval( uplo, A, ctrl );
+    const auto centerAndRadius = herm_func::CenterAndRadius( interval );
+    const Real center = centerAndRadius.first;
+    const Real radius = centerAndRadius.second;
+    const auto coeffs =
+      herm_func::Coefficients( func, center, radius, ctrl );
+    if( ctrl.progress )
+        Output
+        ("Chebyshev expansion of degree ",coeffs.size()-1," over [",
+         center-radius,",",center+radius,"]");
+    herm_func::ApplyExpansion<Field>( applyA, coeffs, center, radius, B );
+}
+
+template<typename Field>
+void ApplyHermitianFunction
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& APre,
+  function<Base<Field>(const Base<Field>&)> func,
+        AbstractDistMatrix<Field>& BPre,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    if( B.Height() != n )
+        LogicError("B must have as many rows as A");
+
+    auto applyA =
+      [&]( Field alpha, const DistMatrix<Field>& X,
+           Field beta,        DistMatrix<Field>& Y )
+      { Hemm( LEFT, uplo, alpha, A, X, beta, Y ); };
+
+    const auto interval = herm_func::SpectralInterval( uplo, A, ctrl );
+    const auto centerAndRadius = herm_func::CenterAndRadius( interval );
+    const Real center = centerAndRadius.first;
+    const Real radius = centerAndRadius.second;
+    const auto coeffs =
+      herm_func::Coefficients( func, center, radius, ctrl );
+    if( ctrl.progress && g.Rank() == 0 )
+        Output
+        ("Chebyshev expansion of degree ",coeffs.size()-1," over [",
+         center-radius,",",center+radius,"]");
+    herm_func::ApplyExpansion<Field>( applyA, coeffs, center, radius, B );
+}
+
+template<typename Field>
+void ApplyHermitianFunction
+( const SparseMatrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+        Matrix<Field>& B,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    if( B.Height() != n )
+        LogicError("B must have as many rows as A");
+
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+
+    const auto interval = herm_func::SpectralInterval( A, ctrl );
+    const auto centerAndRadius = herm_func::CenterAndRadius( interval );
+    const Real center = centerAndRadius.first;
+    const Real radius = centerAndRadius.second;
+    const auto coeffs =
+      herm_func::Coefficients( func, center, radius, ctrl );
+    if( ctrl.progress )
+        Output
+        ("Chebyshev expansion of degree ",coeffs.size()-1," over [",
+         center-radius,",",center+radius,"]");
+    herm_func::ApplyExpansion<Field>( applyA, coeffs, center, radius, B );
+}
+
+template<typename Field>
+void ApplyHermitianFunction
+( const DistSparseMatrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+        DistMultiVec<Field>& B,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    if( B.Height() != n )
+        LogicError("B must have as many rows as A");
+
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+
+    const auto interval = herm_func::SpectralInterval( A, ctrl );
+    const auto centerAndRadius = herm_func::CenterAndRadius( interval );
+    const Real center = centerAndRadius.first;
+    const Real radius = centerAndRadius.second;
+    const auto coeffs =
+      herm_func::Coefficients( func, center, radius, ctrl );
+    if( ctrl.progress && g.Rank() == 0 )
+        Output
+        ("Chebyshev expansion of degree ",coeffs.size()-1," over [",
+         center-radius,",",center+radius,"]");
+    herm_func::ApplyExpansion<Field>( applyA, coeffs, center, radius, B );
+}
+
 // Modify the eigenvalues of A with the real-valued function f, which will
 // therefore result in a Hermitian matrix, which we store in-place.
 
@@ -17,13 +159,33 @@ template<typename Field>
 void HermitianFunction
 ( UpperOrLower uplo,
   Matrix<Field>& A,
-  function<Base<Field>(const Base<Field>&)> func )
+  function<Base<Field>(const Base<Field>&)> func,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
     typedef Base<Field> Real;
 
+    if( ctrl.chebyshev )
+    {
+        const auto interval = herm_func::SpectralInterval( uplo, A, ctrl );
+        const auto centerAndRadius = herm_func::CenterAndRadius( interval );
+        const Real center = centerAndRadius.first;
+        const Real radius = centerAndRadius.second;
+        const auto coeffs =
+          herm_func::Coefficients( func, center, radius, ctrl );
+        if( ctrl.progress )
+            Output
+            ("Chebyshev expansion of degree ",coeffs.size()-1," over [",
+             center-radius,",",center+radius,"]");
+        Matrix<Field> F;
+        herm_func::EvaluateExpansion<Field>
+        ( uplo, A, coeffs, center, radius, F );
+        A = F;
+        return;
+    }
+
     // Get the EVD of A
     Matrix<Real> w;
     Matrix<Field> Z;
@@ -40,7 +202,8 @@ template<typename Field>
 void HermitianFunction
 ( UpperOrLower uplo,
   AbstractDistMatrix<Field>& APre,
-  function<Base<Field>(const Base<Field>&)> func )
+  function<Base<Field>(const Base<Field>&)> func,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
 
@@ -51,8 +214,27 @@ void HermitianFunction
         LogicError("Hermitian matrices must be square");
     typedef Base<Field> Real;
 
-    // Get the EVD of A
     const Grid& g = A.Grid();
+    if( ctrl.chebyshev )
+    {
+        const auto interval = herm_func::SpectralInterval( uplo, A, ctrl );
+        const auto centerAndRadius = herm_func::CenterAndRadius( interval );
+        const Real center = centerAndRadius.first;
+        const Real radius = centerAndRadius.second;
+        const auto coeffs =
+          herm_func::Coefficients( func, center, radius, ctrl );
+        if( ctrl.progress && g.Rank() == 0 )
+            Output
+            ("Chebyshev expansion of degree ",coeffs.size()-1," over [",
+             center-radius,",",center+radius,"]");
+        DistMatrix<Field> F(g);
+        herm_func::EvaluateExpansion<Field>
+        ( uplo, A, coeffs, center, radius, F );
+        A = F;
+        return;
+    }
+
+    // Get the EVD of A
     DistMatrix<Real,VR,STAR> w(g);
     DistMatrix<Field> Z(g);
     HermitianEig( uplo, A, w, Z );
@@ -132,14 +314,38 @@ void HermitianFunction
 }
 
 #define PROTO_COMPLEX(Field) \
+  template void ApplyHermitianFunction \
+  ( UpperOrLower uplo, \
+    const Matrix<Field>& A, \
+    function<Base<Field>(const Base<Field>&)> func, \
+          Matrix<Field>& B, \
+    const HermitianFunctionCtrl<Base<Field>>& ctrl ); \
+  template void ApplyHermitianFunction \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+    function<Base<Field>(const Base<Field>&)> func, \
+          AbstractDistMatrix<Field>& B, \
+    const HermitianFunctionCtrl<Base<Field>>& ctrl ); \
+  template void ApplyHermitianFunction \
+  ( const SparseMatrix<Field>& A, \
+    function<Base<Field>(const Base<Field>&)> func, \
+          Matrix<Field>& B, \
+    const HermitianFunctionCtrl<Base<Field>>& ctrl ); \
+  template void ApplyHermitianFunction \
+  ( const DistSparseMatrix<Field>& A, \
+    function<Base<Field>(const Base<Field>&)> func, \
+          DistMultiVec<Field>& B, \
+    const HermitianFunctionCtrl<Base<Field>>& ctrl ); \
   template void HermitianFunction \
   ( UpperOrLower uplo, \
     Matrix<Field>& A, \
-    function<Base<Field>(const Base<Field>&)> func ); \
+    function<Base<Field>(const Base<Field>&)> func, \
+    const HermitianFunctionCtrl<Base<Field>>& ctrl ); \
   template void HermitianFunction \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<Field>& A, \
-    function<Base<Field>(const Base<Field>&)> func );
+    function<Base<Field>(const Base<Field>&)> func, \
+    const HermitianFunctionCtrl<Base<Field>>& ctrl );
 
 #define PROTO_REAL(Real) \
   PROTO_COMPLEX(Real) \
@@ -0,0 +1,519 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANFUNCTION_CHEBYSHEV_HPP
+#define EL_HERMITIANFUNCTION_CHEBYSHEV_HPP
+
+namespace El {
+namespace herm_func {
+
+// Return the union of the Gershgorin discs of a Hermitian matrix with the
+// given diagonal and off-diagonal absolute row sums, which is guaranteed to
+// contain its spectrum
+template<typename Real>
+pair<Real,Real> DiscUnion( const vector<Real>& diag, const vector<Real>& radii )
+{
+    EL_DEBUG_CSE
+    const Int n = diag.size();
+    if( n == 0 )
+        return pair<Real,Real>(0,0);
+    Real lower = diag[0]-radii[0], upper = diag[0]+radii[0];
+    for( Int i=1; i<n; ++i )
+    {
+        lower = Min( lower, diag[i]-radii[i] );
+        upper = Max( upper, diag[i]+radii[i] );
+    }
+    return pair<Real,Real>(lower,upper);
+}
+
+// Only the 'uplo' triangle of A is accessed
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+GershgorinInterval( UpperOrLower uplo, const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    vector<Real> diag(n,0), radii(n,0);
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = ( uplo==LOWER ? j+1 : 0 );
+        const Int iEnd = ( uplo==LOWER ? n : j );
+        diag[j] = RealPart(A(j,j));
+        for( Int i=iBeg; i<iEnd; ++i )
+        {
+            const Real alpha = Abs(A(i,j));
+            radii[i] += alpha;
+            radii[j] += alpha;
+        }
+    }
+    return DiscUnion( diag, radii );
+}
+
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+GershgorinInterval( UpperOrLower uplo, const DistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+
+    // Accumulate the diagonal into the first n entries and the off-diagonal
+    // absolute row sums into the last n entries
+    vector<Real> diagAndRadii(2*n,0);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == j )
+            {
+                diagAndRadii[j] = RealPart(A.GetLocal(iLoc,jLoc));
+            }
+            else if( (uplo==LOWER && i > j) || (uplo==UPPER && i < j) )
+            {
+                const Real alpha = Abs(A.GetLocal(iLoc,jLoc));
+                diagAndRadii[n+i] += alpha;
+                diagAndRadii[n+j] += alpha;
+            }
+        }
+    }
+    mpi::AllReduce( diagAndRadii.data(), 2*n, A.Grid().VCComm() );
+    vector<Real> diag( diagAndRadii.begin(), diagAndRadii.begin()+n ),
+                 radii( diagAndRadii.begin()+n, diagAndRadii.end() );
+    return DiscUnion( diag, radii );
+}
+
+// The sparse matrices are assumed to explicitly store both triangles
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+GershgorinInterval( const SparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Int numEntries = A.NumEntries();
+    vector<Real> diag(n,0), radii(n,0);
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int i = A.Row(e);
+        if( i == A.Col(e) )
+            diag[i] += RealPart(A.Value(e));
+        else
+            radii[i] += Abs(A.Value(e));
+    }
+    return DiscUnion( diag, radii );
+}
+
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+GershgorinInterval( const DistSparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    vector<Real> diag(localHeight,0), radii(localHeight,0);
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int i = A.Row(e);
+        if( i == A.Col(e) )
+            diag[i-firstLocalRow] += RealPart(A.Value(e));
+        else
+            radii[i-firstLocalRow] += Abs(A.Value(e));
+    }
+    Real lower = limits::Max<Real>(), upper = -limits::Max<Real>();
+    if( localHeight > 0 )
+    {
+        const auto interval = DiscUnion( diag, radii );
+        lower = interval.first;
+        upper = interval.second;
+    }
+    mpi::Comm comm = A.Grid().Comm();
+    lower = mpi::AllReduce( lower, mpi::MIN, comm );
+    upper = mpi::AllReduce( upper, mpi::MAX, comm );
+    return pair<Real,Real>(lower,upper);
+}
+
+// Return an estimate of the spectral interval of A given a Lanczos
+// decomposition A V = V T + beta v e_{k-1}^H. Each extremal Ritz value is
+// widened by its residual norm, |beta e_{k-1}^T s_j|, as in the bounds of
+// Zhou and Li, and then by a further 1% of the width of the interval. Since
+// the result is not guaranteed to contain the spectrum, it is intersected
+// with the given (guaranteed) bounds, but Ritz values which have not yet
+// converged can still leave eigenvalues just outside of it.
+template<typename Real>
+pair<Real,Real> RitzInterval
+( const Matrix<Real>& T, const Real& beta, const pair<Real,Real>& bounds )
+{
+    EL_DEBUG_CSE
+    const Int k = T.Height();
+    if( k == 0 )
+        return bounds;
+    Matrix<Real> TCopy( T ), w, Z;
+    HermitianEig( LOWER, TCopy, w, Z );
+    Real lower = w(0) - Abs(beta*Z(k-1,0));
+    Real upper = w(k-1) + Abs(beta*Z(k-1,k-1));
+    const Real pad = (upper-lower) / Real(100);
+    lower = Max( lower-pad, bounds.first );
+    upper = Min( upper+pad, bounds.second );
+    return pair<Real,Real>(lower,upper);
+}
+
+// Return an interval which contains the spectrum of A, which is either given
+// explicitly, the union of the Gershgorin discs, or (if a positive Lanczos
+// basis size was requested) the intersection of the latter with the
+// estimate from a Lanczos decomposition
+template<typename Field>
+pair<Base<Field>,Base<Field>> SpectralInterval
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( ctrl.lowerBound < ctrl.upperBound )
+        return pair<Real,Real>(ctrl.lowerBound,ctrl.upperBound);
+    const auto bounds = GershgorinInterval( uplo, A );
+    if( ctrl.basisSize <= 0 )
+        return bounds;
+
+    const Int n = A.Height();
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Hemm( LEFT, uplo, Field(1), A, X, Field(0), Y );
+      };
+    Matrix<Field> V, v;
+    Matrix<Real> T;
+    const Real beta =
+      LanczosDecomp<Field>( n, applyA, V, T, v, ctrl.basisSize );
+    return RitzInterval( T, beta, bounds );
+}
+
+template<typename Field>
+pair<Base<Field>,Base<Field>> SpectralInterval
+( UpperOrLower uplo,
+  const DistMatrix<Field>& A,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( ctrl.lowerBound < ctrl.upperBound )
+        return pair<Real,Real>(ctrl.lowerBound,ctrl.upperBound);
+    const auto bounds = GershgorinInterval( uplo, A );
+    if( ctrl.basisSize <= 0 )
+        return bounds;
+
+    // The Lanczos vectors are stored as DistMultiVec's
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          DistMatrix<Field> XDist(g), YDist(g);
+          Copy( X, XDist );
+          Zeros( YDist, n, X.Width() );
+          Hemm( LEFT, uplo, Field(1), A, XDist, Field(0), YDist );
+          Copy( YDist, Y );
+      };
+    DistMultiVec<Field> V(g), v(g);
+    DistMatrix<Real,STAR,STAR> T(g);
+    const Real beta =
+      LanczosDecomp<Field>( n, applyA, V, T, v, ctrl.basisSize );
+    return RitzInterval( T.Matrix(), beta, bounds );
+}
+
+template<typename Field>
+pair<Base<Field>,Base<Field>> SpectralInterval
+( const SparseMatrix<Field>& A,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( ctrl.lowerBound < ctrl.upperBound )
+        return pair<Real,Real>(ctrl.lowerBound,ctrl.upperBound);
+    const auto bounds = GershgorinInterval( A );
+    if( ctrl.basisSize <= 0 )
+        return bounds;
+
+    Matrix<Field> V, v;
+    Matrix<Real> T;
+    const Real beta = LanczosDecomp( A, V, T, v, ctrl.basisSize );
+    return RitzInterval( T, beta, bounds );
+}
+
+template<typename Field>
+pair<Base<Field>,Base<Field>> SpectralInterval
+( const DistSparseMatrix<Field>& A,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( ctrl.lowerBound < ctrl.upperBound )
+        return pair<Real,Real>(ctrl.lowerBound,ctrl.upperBound);
+    const auto bounds = GershgorinInterval( A );
+    if( ctrl.basisSize <= 0 )
+        return bounds;
+
+    const Grid& g = A.Grid();
+    DistMultiVec<Field> V(g), v(g);
+    DistMatrix<Real,STAR,STAR> T(g);
+    const Real beta = LanczosDecomp( A, V, T, v, ctrl.basisSize );
+    return RitzInterval( T.Matrix(), beta, bounds );
+}
+
+// Convert an interval containing the spectrum into the center and radius of
+// the affine map onto [-1,1], ensuring that the radius is not negligible
+template<typename Real>
+pair<Real,Real> CenterAndRadius( const pair<Real,Real>& interval )
+{
+    EL_DEBUG_CSE
+    const Real eps = limits::Epsilon<Real>();
+    const Real center = (interval.first+interval.second) / 2;
+    Real radius = (interval.second-interval.first) / 2;
+    radius = Max( radius, eps*Max(Abs(center),Real(1)) );
+    return pair<Real,Real>(center,radius);
+}
+
+// Compute the coefficients of the Chebyshev expansion of
+// f(center + radius x) over [-1,1] from its values at the Chebyshev nodes,
+//
+//   c_k = (2 - delta_{k,0})/N sum_{j=0}^{N-1} f(x_j) cos(k theta_j),
+//
+// with theta_j = pi (j+1/2) / N and x_j = cos(theta_j). Unless the degree is
+// specified, the number of nodes is doubled until the trailing coefficients
+// are negligible, and the expansion is then truncated.
+template<typename Real>
+vector<Real> Coefficients
+( const function<Real(const Real&)>& func,
+  const Real& center,
+  const Real& radius,
+  const HermitianFunctionCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Real pi = Pi<Real>();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol == Real(0) ? eps : ctrl.tol );
+
+    auto interpolate =
+      [&]( Int numNodes )
+      {
+          vector<Real> theta(numNodes), fValues(numNodes);
+          for( Int j=0; j<numNodes; ++j )
+          {
+              theta[j] = pi*(j+Real(1)/Real(2))/numNodes;
+              fValues[j] = func(center+radius*Cos(theta[j]));
+          }
+          vector<Real> coeffs(numNodes,0);
+          for( Int k=0; k<numNodes; ++k )
+          {
+              Real sum = 0;
+              for( Int j=0; j<numNodes; ++j )
+                  sum += fValues[j]*Cos(k*theta[j]);
+              coeffs[k] = 2*sum/numNodes;
+          }
+          coeffs[0] /= 2;
+          return coeffs;
+      };
+
+    vector<Real> coeffs;
+    if( ctrl.degree > 0 )
+    {
+        coeffs = interpolate( ctrl.degree+1 );
+    }
+    else
+    {
+        const Int maxNodes = Max(ctrl.maxDegree,Int(1)) + 1;
+        Int numNodes = Min( Int(16), maxNodes );
+        while( true )
+        {
+            coeffs = interpolate( numNodes );
+            Real scale = 0;
+            for( const Real& coeff : coeffs )
+                scale = Max( scale, Abs(coeff) );
+
+            // Require at least two negligible trailing coefficients so that
+            // even and odd functions are not truncated prematurely
+            Int degree = numNodes-1;
+            while( degree > 0 && Abs(coeffs[degree]) <= tol*scale )
+                --degree;
+            if( degree < numNodes-2 || numNodes == maxNodes )
+            {
+                if( degree >= numNodes-2 && ctrl.progress )
+                    Output
+                    ("WARNING: Chebyshev expansion was not resolved to ",tol,
+                     " with degree ",numNodes-1);
+                coeffs.resize( degree+1 );
+                break;
+            }
+            numNodes = Min( 2*numNodes, maxNodes );
+        }
+    }
+
+    if( ctrl.jackson )
+    {
+        const Int degree = coeffs.size()-1;
+        const Real alpha = pi/(degree+2);
+        for( Int k=1; k<=degree; ++k )
+            coeffs[k] *=
+              ((degree+2-k)*Cos(k*alpha) + Sin(k*alpha)*Cos(alpha)/Sin(alpha))
+              / (degree+2);
+    }
+    return coeffs;
+}
+
+// Overwrite B with p(A) B, where p is the Chebyshev expansion with the given
+// coefficients over [center-radius,center+radius], using the three-term
+// recurrence T_{k+1}(x) = 2 x T_k(x) - T_{k-1}(x). The routine 'applyA'
+// should compute Y := alpha A X + beta Y.
+template<typename Field,class MatrixType,class ApplyAType>
+void ApplyExpansion
+( const ApplyAType& applyA,
+  const vector<Base<Field>>& coeffs,
+  const Base<Field>& center,
+  const Base<Field>& radius,
+        MatrixType& B )
+{
+    EL_DEBUG_CSE
+    const Int degree = coeffs.size()-1;
+    MatrixType T0( B ), T1( B ), Y( B );
+    Scale( Field(coeffs[0]), Y );
+    if( degree >= 1 )
+    {
+        // T1 := (A - center I) B / radius
+        applyA( Field(1/radius), T0, Field(0), T1 );
+        Axpy( Field(-center/radius), T0, T1 );
+        Axpy( Field(coeffs[1]), T1, Y );
+    }
+
+    // Overwrite T_{k-2} with T_k := 2 ((A - center I)/radius) T_{k-1} - T_{k-2}
+    MatrixType* prev = &T0;
+    MatrixType* curr = &T1;
+    for( Int k=2; k<=degree; ++k )
+    {
+        applyA( Field(2/radius), *curr, Field(-1), *prev );
+        Axpy( Field(-2*center/radius), *curr, *prev );
+        Axpy( Field(coeffs[k]), *prev, Y );
+        std::swap( prev, curr );
+    }
+    B = Y;
+}
+
+// Overwrite F with p(A), where p is the Chebyshev expansion with the given
+// coefficients over [center-radius,center+radius] and only the 'uplo'
+// triangle of A is accessed. Rather than applying the three-term recurrence
+// to the identity, which would require d matrix-matrix products, the
+// Paterson-Stockmeyer scheme is adapted to the Chebyshev basis: for
+// X = (A - center I) / radius and s ~ sqrt(d), the "baby steps"
+// T_0(X),...,T_s(X) and the "giant steps" T_{2s}(X),T_{4s}(X),... are formed,
+// and the expansion is recursively split as p = q T_m + r, with m = 2^l s the
+// largest giant step of degree at most deg(p), via
+//
+//   T_{m+i} = 2 T_m T_i - T_{m-i},
+//
+// until the pieces have degree at most s. This requires roughly 2 sqrt(d)
+// matrix-matrix products but storing s+1 matrices of the size of A.
+template<typename Field,class MatrixType>
+void SplitExpansion
+( const vector<Base<Field>>& coeffs,
+  const vector<MatrixType>& babySteps,
+  const vector<MatrixType>& giantSteps,
+        MatrixType& P )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int s = babySteps.size()-1;
+    const Int degree = coeffs.size()-1;
+    if( degree <= s )
+    {
+        P = babySteps[0];
+        Scale( Field(coeffs[0]), P );
+        for( Int k=1; k<=degree; ++k )
+            Axpy( Field(coeffs[k]), babySteps[k], P );
+        return;
+    }
+
+    // giantSteps[l-1] holds T_{2^l s} (and babySteps[s] holds T_s)
+    Int l = 0;
+    while( (s << (l+1)) <= degree )
+        ++l;
+    const Int m = s << l;
+    const MatrixType& TM = ( l == 0 ? babySteps[s] : giantSteps[l-1] );
+
+    vector<Real> qCoeffs(degree-m+1), rCoeffs(coeffs.begin(),coeffs.begin()+m);
+    qCoeffs[0] = coeffs[m];
+    for( Int i=1; i<=degree-m; ++i )
+    {
+        qCoeffs[i] = 2*coeffs[m+i];
+        rCoeffs[m-i] -= coeffs[m+i];
+    }
+    MatrixType Q( P );
+    SplitExpansion<Field>( qCoeffs, babySteps, giantSteps, Q );
+    SplitExpansion<Field>( rCoeffs, babySteps, giantSteps, P );
+    Gemm( NORMAL, NORMAL, Field(1), Q, TM, Field(1), P );
+}
+
+template<typename Field,class MatrixType>
+void EvaluateExpansion
+( UpperOrLower uplo,
+  const MatrixType& A,
+  const vector<Base<Field>>& coeffs,
+  const Base<Field>& center,
+  const Base<Field>& radius,
+        MatrixType& F )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Int degree = coeffs.size()-1;
+    const Int s = Min( degree, Max( Int(1), Int(Round(Sqrt(Real(degree)))) ) );
+
+    // X := (A - center I) / radius
+    MatrixType X( A );
+    MakeHermitian( uplo, X );
+    ShiftDiagonal( X, Field(-center) );
+    Scale( Field(1/radius), X );
+
+    // Form the baby steps, T_0(X),...,T_s(X)
+    vector<MatrixType> babySteps( s+1, X );
+    Identity( babySteps[0], n, n );
+    for( Int k=2; k<=s; ++k )
+    {
+        babySteps[k] = babySteps[k-2];
+        Gemm
+        ( NORMAL, NORMAL,
+          Field(2), X, babySteps[k-1], Field(-1), babySteps[k] );
+    }
+    X.Empty();
+
+    // Form the giant steps, T_{2^l s}(X) = 2 T_{2^{l-1} s}(X)^2 - I
+    Int numGiantSteps = 0;
+    for( Int m=2*s; s>0 && m<=degree; m*=2 )
+        ++numGiantSteps;
+    vector<MatrixType> giantSteps( numGiantSteps, babySteps[0] );
+    for( Int l=0; l<numGiantSteps; ++l )
+    {
+        const MatrixType& TPrev = ( l == 0 ? babySteps[s] : giantSteps[l-1] );
+        Gemm
+        ( NORMAL, NORMAL, Field(2), TPrev, TPrev, Field(-1), giantSteps[l] );
+    }
+
+    F = babySteps[0];
+    SplitExpansion<Field>( coeffs, babySteps, giantSteps, F );
+}
+
+} // namespace herm_func
+} // namespace El
+
+#endif // ifndef EL_HERMITIANFUNCTION_CHEBYSHEV_HPP
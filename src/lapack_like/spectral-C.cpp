@@ -171,13 +171,37 @@ ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl )
     return EL_SUCCESS;
 }
 
+/* HermitianSliceCtrl */
+ElError ElHermitianSliceCtrlDefault_s( ElHermitianSliceCtrl_s* ctrl )
+{
+    ctrl->numSlices = 0;
+    ctrl->teamSize = 0;
+    ctrl->degree = 0;
+    ctrl->maxIts = 20;
+    ctrl->tol = 0;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+ElError ElHermitianSliceCtrlDefault_d( ElHermitianSliceCtrl_d* ctrl )
+{
+    ctrl->numSlices = 0;
+    ctrl->teamSize = 0;
+    ctrl->degree = 0;
+    ctrl->maxIts = 20;
+    ctrl->tol = 0;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+
 /* HermitianEigCtrl */
 ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl )
 {
     ElHermitianTridiagCtrlDefault_s( &ctrl->tridiagCtrl );
     ElHermitianTridiagEigCtrlDefault_s( &ctrl->tridiagEigCtrl );
     ElHermitianSDCCtrlDefault_s( &ctrl->sdcCtrl );
+    ElHermitianSliceCtrlDefault_s( &ctrl->sliceCtrl );
     ctrl->useSDC = false;
+    ctrl->useSlicing = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl )
@@ -185,7 +209,9 @@ ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl )
     ElHermitianTridiagCtrlDefault_d( &ctrl->tridiagCtrl );
     ElHermitianTridiagEigCtrlDefault_d( &ctrl->tridiagEigCtrl );
     ElHermitianSDCCtrlDefault_d( &ctrl->sdcCtrl );
+    ElHermitianSliceCtrlDefault_d( &ctrl->sliceCtrl );
     ctrl->useSDC = false;
+    ctrl->useSlicing = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianEigCtrlDefault_c( ElHermitianEigCtrl_c* ctrl )
@@ -193,7 +219,9 @@ ElError ElHermitianEigCtrlDefault_c( ElHermitianEigCtrl_c* ctrl )
     ElHermitianTridiagCtrlDefault_c( &ctrl->tridiagCtrl );
     ElHermitianTridiagEigCtrlDefault_s( &ctrl->tridiagEigCtrl );
     ElHermitianSDCCtrlDefault_s( &ctrl->sdcCtrl );
+    ElHermitianSliceCtrlDefault_s( &ctrl->sliceCtrl );
     ctrl->useSDC = false;
+    ctrl->useSlicing = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianEigCtrlDefault_z( ElHermitianEigCtrl_z* ctrl )
@@ -201,7 +229,9 @@ ElError ElHermitianEigCtrlDefault_z( ElHermitianEigCtrl_z* ctrl )
     ElHermitianTridiagCtrlDefault_z( &ctrl->tridiagCtrl );
     ElHermitianTridiagEigCtrlDefault_d( &ctrl->tridiagEigCtrl );
     ElHermitianSDCCtrlDefault_d( &ctrl->sdcCtrl );
+    ElHermitianSliceCtrlDefault_d( &ctrl->sliceCtrl );
     ctrl->useSDC = false;
+    ctrl->useSlicing = false;
     return EL_SUCCESS;
 }
 
@@ -213,11 +243,23 @@ ElError ElQDWHCtrlDefault( ElQDWHCtrl* ctrl )
     return EL_SUCCESS;
 }
 
+/* ZoloCtrl */
+ElError ElZoloCtrlDefault( ElZoloCtrl* ctrl )
+{
+    ctrl->numTerms = 0;
+    ctrl->numSubgrids = 0;
+    ctrl->maxIts = 20;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+
 /* PolarCtrl */
 ElError ElPolarCtrlDefault( ElPolarCtrl* ctrl )
 {
     ctrl->qdwh = false;
     ElQDWHCtrlDefault( &ctrl->qdwhCtrl );
+    ctrl->zolo = false;
+    ElZoloCtrlDefault( &ctrl->zoloCtrl );
     return EL_SUCCESS;
 }
 
@@ -281,6 +323,24 @@ ElError ElBidiagSVDCtrlDefault_d( ElBidiagSVDCtrl_d* ctrl )
     return EL_SUCCESS;
 }
 
+/* JacobiSVDCtrl */
+ElError ElJacobiSVDCtrlDefault_s( ElJacobiSVDCtrl_s* ctrl )
+{
+    ctrl->blocksize = 0;
+    ctrl->maxSweeps = 30;
+    ctrl->tol = 0;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+ElError ElJacobiSVDCtrlDefault_d( ElJacobiSVDCtrl_d* ctrl )
+{
+    ctrl->blocksize = 0;
+    ctrl->maxSweeps = 30;
+    ctrl->tol = 0;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+
 /* SVDCtrl */
 ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl )
 {
@@ -293,6 +353,12 @@ ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl )
     ctrl->valChanRatio = 1.2;
     ctrl->fullChanRatio = 1.5;
 
+    ctrl->twoStageBidiag = false;
+    ctrl->bidiagBandwidth = 0;
+
+    ctrl->useJacobi = false;
+    ElJacobiSVDCtrlDefault_s( &ctrl->jacobiCtrl );
+
     ElBidiagSVDCtrlDefault_s( &ctrl->bidiagSVDCtrl );
 
     return EL_SUCCESS;
@@ -308,6 +374,12 @@ ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl )
     ctrl->valChanRatio = 1.2;
     ctrl->fullChanRatio = 1.5;
 
+    ctrl->twoStageBidiag = false;
+    ctrl->bidiagBandwidth = 0;
+
+    ctrl->useJacobi = false;
+    ElJacobiSVDCtrlDefault_d( &ctrl->jacobiCtrl );
+
     ElBidiagSVDCtrlDefault_d( &ctrl->bidiagSVDCtrl );
 
     return EL_SUCCESS;
@@ -426,6 +498,8 @@ ElError ElPseudospecCtrlDefault_s( ElPseudospecCtrl_s* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->teamSize = 0;
+    ctrl->batchSize = 0;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -451,6 +525,8 @@ ElError ElPseudospecCtrlDefault_d( ElPseudospecCtrl_d* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->teamSize = 0;
+    ctrl->batchSize = 0;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -9,6 +9,8 @@
 #include <El.hpp>
 
 #include "./HermitianEig/SDC.hpp"
+#include "./Teams.hpp"
+#include "./HermitianEig/Slice.hpp"
 
 // The targeted number of pieces to break the eigenvectors into during the
 // redistribution from the [* ,VR] distribution after PMRRR to the [MC,MR]
@@ -229,8 +231,7 @@ BlackBox
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    // TODO(poulson): Extend interface to support accepting ctrl.tridiagCtrl
-    herm_tridiag::ExplicitCondensed( uplo, A );
+    herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -549,16 +550,28 @@ BlackBox
     EL_DEBUG_CSE
     HermitianEigInfo info;
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
+    // TODO(poulson): Extend interface to support the remainder of
+    // ctrl.tridiagCtrl
+    const bool twoStage = ctrl.tridiagCtrl.twoStage;
     Matrix<F> householderScalars;
-    HermitianTridiag( uplo, A, householderScalars );
+    herm_tridiag::BulgeReflectors<F> bulgeReflectors;
+    if( twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, householderScalars, bulgeReflectors,
+          ctrl.tridiagCtrl.bandwidth );
+    else
+        HermitianTridiag( uplo, A, householderScalars );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
     info.tridiagEigInfo =
       HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
 
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    if( twoStage )
+        herm_tridiag::TwoStageApplyQ
+        ( A, householderScalars, bulgeReflectors, Q );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
 
     return info;
 }
@@ -579,9 +592,17 @@ BlackBox
     DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
+    // TODO(poulson): Extend interface to support the remainder of
+    // ctrl.tridiagCtrl
+    const bool twoStage = ctrl.tridiagCtrl.twoStage;
     DistMatrix<F,VC,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars );
+    herm_tridiag::BulgeReflectors<F> bulgeReflectors;
+    if( twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, householderScalars, bulgeReflectors,
+          ctrl.tridiagCtrl.bandwidth );
+    else
+        HermitianTridiag( uplo, A, householderScalars );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -593,7 +614,12 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+        if( twoStage )
+            herm_tridiag::TwoStageApplyQ
+            ( A, householderScalars, bulgeReflectors, Q );
+        else
+            herm_tridiag::ApplyQ
+            ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     }
     else
     {
@@ -602,7 +628,12 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+        if( twoStage )
+            herm_tridiag::TwoStageApplyQ
+            ( A, householderScalars, bulgeReflectors, Q );
+        else
+            herm_tridiag::ApplyQ
+            ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     }
 
     return info;
@@ -866,7 +897,13 @@ MRRR
             timer.Start();
     }
     DistMatrix<F,STAR,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
+    herm_tridiag::BulgeReflectors<F> bulgeReflectors;
+    if( ctrl.tridiagCtrl.twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, householderScalars, bulgeReflectors,
+          ctrl.tridiagCtrl.bandwidth );
+    else
+        HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -986,7 +1023,11 @@ MRRR
             timer.Start();
         }
     }
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    if( ctrl.tridiagCtrl.twoStage )
+        herm_tridiag::TwoStageApplyQ
+        ( A, householderScalars, bulgeReflectors, Q );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -1079,7 +1120,13 @@ HermitianEig
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    if( ctrl.useSDC )
+    if( ctrl.useSlicing && subset.rangeSubset )
+    {
+        herm_eig::Slice
+        ( uplo, A, w, Q, subset.lowerBound, subset.upperBound,
+          ctrl.sliceCtrl );
+    }
+    else if( ctrl.useSDC )
     {
         herm_eig::SDC( uplo, A, w, Q, ctrl.sdcCtrl );
         herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
@@ -0,0 +1,371 @@
+/*
+   Copyright (c) 2009-2017, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANEIG_SLICE_HPP
+#define EL_HERMITIANEIG_SLICE_HPP
+
+// When only a small portion of the spectrum is desired, reducing the entire
+// matrix to tridiagonal form (and backtransforming the eigenvectors) can be
+// avoided by splitting the requested interval into slices and having teams
+// of processes compute the eigenpairs of each slice with Chebyshev-filtered
+// subspace iteration. The number of eigenvalues in each slice is determined
+// exactly from the inertia of A - sigma I at the slice boundaries, so that
+// the subspace iteration knows precisely how many eigenpairs to converge.
+//
+// Each inertia requires a dense pivoted LDL^H factorization of A - sigma I,
+// so that the numSlices+1 boundaries cost roughly (numSlices+1) n^3/3 flops
+// in total (spread over the teams). This is comparable to the tridiagonal
+// reduction itself once there are more than a handful of slices per team, so
+// the slices should be kept few and wide.
+//
+// See, for example,
+//
+//   Eric Polizzi, "Density-matrix-based algorithm for solving eigenvalue
+//   problems", Physical Review B, 79(11), 2009,
+//
+// and
+//
+//   Ruipeng Li, Yuanzhe Xi, Eugene Vecharynski, Chao Yang, and Yousef Saad,
+//   "A Thick-Restart Lanczos Algorithm with Polynomial Filtering for Hermitian
+//   Eigenvalue Problems", SIAM J. Sci. Comput., 38(4), 2016,
+//
+// for the use of Jackson-damped Chebyshev expansions of indicator functions
+// as spectral filters.
+
+namespace El {
+namespace herm_eig {
+
+namespace slice {
+
+// Return an interval [center-radius,center+radius] which contains the
+// spectrum of the (explicitly) Hermitian matrix A. Since the power iteration
+// estimates the two-norm from below, the interval is slightly padded.
+template<typename F>
+void SpectralBounds
+( const DistMatrix<F>& A, Base<F>& center, Base<F>& radius )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real normEst = HermitianTwoNormEstimate( LOWER, A );
+
+    // Both normEst I + A and normEst I - A are (nearly) positive
+    // semi-definite, so their norms yield the extremal eigenvalues of A
+    auto AShift( A );
+    ShiftDiagonal( AShift, F(normEst) );
+    const Real maxEig = HermitianTwoNormEstimate( LOWER, AShift ) - normEst;
+    AShift = A;
+    Scale( F(-1), AShift );
+    ShiftDiagonal( AShift, F(normEst) );
+    const Real minEig = normEst - HermitianTwoNormEstimate( LOWER, AShift );
+
+    center = (minEig+maxEig) / 2;
+    radius = (maxEig-minEig) / 2 + normEst/Real(100);
+}
+
+// The coefficients of the Jackson-damped Chebyshev expansion of degree
+// 'degree' of the indicator function of [alpha,beta] within [-1,1]
+template<typename Real>
+vector<Real> FilterCoefficients( Real alpha, Real beta, Int degree )
+{
+    EL_DEBUG_CSE
+    const Real pi = Pi<Real>();
+    const Real thetaAlpha = Acos( alpha );
+    const Real thetaBeta = Acos( beta );
+    const Real damp = pi / Real(degree+2);
+    vector<Real> coefs(degree+1);
+    coefs[0] = (thetaAlpha-thetaBeta) / pi;
+    for( Int j=1; j<=degree; ++j )
+    {
+        const Real jReal = Real(j);
+        const Real mu =
+          2*(Sin(jReal*thetaAlpha)-Sin(jReal*thetaBeta)) / (jReal*pi);
+        const Real jackson =
+          ((1-jReal/Real(degree+2))*Sin(damp)*Cos(jReal*damp) +
+           Cos(damp)*Sin(jReal*damp)/Real(degree+2)) / Sin(damp);
+        coefs[j] = jackson*mu;
+    }
+    return coefs;
+}
+
+// Y := p(A) X, where p is the polynomial with the given coefficients in the
+// Chebyshev basis of [center-radius,center+radius]
+template<typename F>
+void ApplyFilter
+( const DistMatrix<F>& A,
+        Base<F> center,
+        Base<F> radius,
+  const vector<Base<F>>& coefs,
+  const DistMatrix<F>& X,
+        DistMatrix<F>& Y )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int degree = coefs.size()-1;
+
+    // TPrev := T_0((A-center I)/radius) X and
+    // TCurr := T_1((A-center I)/radius) X
+    DistMatrix<F> T0( X ), T1( X );
+    Hemm( LEFT, LOWER, F(Real(1)/radius), A, X, F(-center/radius), T1 );
+    Y = X;
+    Scale( F(coefs[0]), Y );
+    Axpy( F(coefs[1]), T1, Y );
+
+    // T_{j+1} := 2 ((A-center I)/radius) T_j - T_{j-1}
+    auto* TPrev = &T0;
+    auto* TCurr = &T1;
+    for( Int j=2; j<=degree; ++j )
+    {
+        Hemm( LEFT, LOWER, F(Real(2)/radius), A, *TCurr, F(-1), *TPrev );
+        Axpy( F(-2*center/radius), *TCurr, *TPrev );
+        Axpy( F(coefs[j]), *TPrev, Y );
+        std::swap( TPrev, TCurr );
+    }
+}
+
+// Compute the 'numEigs' eigenpairs of the (explicitly) Hermitian matrix A
+// with eigenvalues in (lowerBound,upperBound] using Chebyshev-filtered
+// subspace iteration, where the spectrum of A lies within
+// [center-radius,center+radius]
+template<typename F>
+Int FilteredSubspaceIteration
+( const DistMatrix<F>& A,
+        Base<F> lowerBound,
+        Base<F> upperBound,
+        Int numEigs,
+        Base<F> center,
+        Base<F> radius,
+        DistMatrix<Base<F>,STAR,STAR>& w,
+        DistMatrix<F>& X,
+  const HermitianSliceCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol == Real(0) ? Pow(eps,Real(0.75)) : ctrl.tol );
+    const Real normA = Abs(center) + radius;
+
+    // The eigenpairs just outside of the slice are damped by the filter almost
+    // as little as those just inside, so we iterate with as many guard vectors
+    // as there are desired eigenpairs
+    const Int blockSize = Min( n, numEigs+Max(numEigs,Int(8)) );
+
+    // The filter must resolve the slice, whose width, after mapping the
+    // spectrum to [-1,1] = cos([0,pi]), is the difference of the arccosines
+    const Real alpha = Max( (lowerBound-center)/radius, Real(-1) );
+    const Real beta = Min( (upperBound-center)/radius, Real(1) );
+    const Real angleWidth = Acos(alpha) - Acos(beta);
+    const Int degree =
+      ( ctrl.degree > 0 ? ctrl.degree :
+        Max( Int(Ceil(4*Pi<Real>()/angleWidth)), Int(4) ) );
+    const auto coefs = FilterCoefficients( alpha, beta, degree );
+
+    DistMatrix<F> V(g), Y(g), AY(g), G(g), R(g);
+    DistMatrix<F,STAR,STAR> Z(g);
+    DistMatrix<Real,STAR,STAR> theta(g);
+    DistMatrix<Real,MR,STAR> residNorms(g);
+    Gaussian( V, n, blockSize );
+    for( Int it=1; it<=ctrl.maxIts; ++it )
+    {
+        // Filter and orthonormalize the basis
+        ApplyFilter( A, center, radius, coefs, V, Y );
+        qr::ExplicitUnitary( Y );
+
+        // Form the Ritz pairs from the projection Y^H A Y
+        Zeros( AY, n, blockSize );
+        Hemm( LEFT, LOWER, F(1), A, Y, F(0), AY );
+        Zeros( G, blockSize, blockSize );
+        Gemm( ADJOINT, NORMAL, F(1), Y, AY, G );
+        DistMatrix<F,STAR,STAR> G_STAR_STAR( G );
+        theta.Resize( blockSize, 1 );
+        Z.Resize( blockSize, blockSize );
+        HermitianEig( LOWER, G_STAR_STAR.Matrix(), theta.Matrix(), Z.Matrix() );
+        Gemm( NORMAL, NORMAL, F(1), Y, Z, V );
+
+        // R := A V - V diag(theta)
+        Gemm( NORMAL, NORMAL, F(1), AY, Z, R );
+        Y = V;
+        DiagonalScale( RIGHT, NORMAL, theta, Y );
+        R -= Y;
+        ColumnTwoNorms( R, residNorms );
+        DistMatrix<Real,STAR,STAR> residNorms_STAR_STAR( residNorms );
+
+        // The Ritz values are sorted in ascending order
+        Int first=0, last=0;
+        for( Int j=0; j<blockSize; ++j )
+        {
+            const Real thetaj = theta.GetLocal(j,0);
+            if( thetaj <= lowerBound )
+                first = j+1;
+            if( thetaj <= upperBound )
+                last = j+1;
+        }
+        Real maxResid = 0;
+        for( Int j=first; j<last; ++j )
+            maxResid = Max( maxResid, residNorms_STAR_STAR.GetLocal(j,0) );
+        if( ctrl.progress && g.Rank() == 0 )
+            Output
+            ("  iteration ",it," (degree ",degree,"): ",last-first," of ",
+             numEigs," Ritz values in (",lowerBound,",",upperBound,
+             "] with max residual ",maxResid);
+
+        if( last-first == numEigs && maxResid <= tol*normA )
+        {
+            auto thetaSlice = theta( IR(first,last), ALL );
+            auto VSlice = V( ALL, IR(first,last) );
+            w = thetaSlice;
+            X = VSlice;
+            return it;
+        }
+    }
+    RuntimeError
+    ("Filtered subspace iteration did not converge within ",ctrl.maxIts,
+     " iterations");
+    return ctrl.maxIts;
+}
+
+} // namespace slice
+
+// Compute the eigenpairs of the Hermitian matrix A with eigenvalues in
+// (lowerBound,upperBound]
+template<typename F>
+void Slice
+( UpperOrLower uplo,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<Base<F>>& wPre,
+        AbstractDistMatrix<F>& QPre,
+        Base<F> lowerBound,
+        Base<F> upperBound,
+  const HermitianSliceCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = APre.Grid();
+    const Int n = APre.Height();
+    mpi::Comm comm = g.VCComm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    Teams teams( g, ctrl.teamSize == 0 ? commSize : ctrl.teamSize );
+    const Int numTeams = teams.numTeams;
+    const Int numSlices = ( ctrl.numSlices == 0 ? numTeams : ctrl.numSlices );
+    if( numSlices < 1 )
+        LogicError("There must be at least one slice");
+    const Int team = teams.team;
+    const bool teamRoot = teams.Root();
+
+    DistMatrix<F> A( APre );
+    MakeHermitian( uplo, A );
+    Real center, radius;
+    slice::SpectralBounds( A, center, radius );
+
+    DistMatrix<F> ATeam(*teams.grid);
+    ReplicateToTeams( A, teams, ATeam );
+    A.Empty();
+
+    // Count the eigenvalues at most each slice boundary
+    // -------------------------------------------------
+    // Boundary b is handled by team b % numTeams. The eigenvalues of A which
+    // are at most sigma are the negative and zero entries of the quasi-diagonal
+    // of the pivoted LDL^H factorization of A - sigma I, which costs roughly
+    // n^3/3 flops over the team for every boundary.
+    const Real sliceWidth = (upperBound-lowerBound) / numSlices;
+    const Int numBoundaries = numSlices+1;
+    vector<Int> numAtMost(numBoundaries,0);
+    for( Int b=team; b<numBoundaries; b+=numTeams )
+    {
+        DistMatrix<F> AShift( ATeam );
+        ShiftDiagonal( AShift, F(-(lowerBound+b*sliceWidth)) );
+        const auto inertia = Inertia( LOWER, AShift );
+        if( teamRoot )
+            numAtMost[b] = inertia.numNegative + inertia.numZero;
+    }
+    mpi::AllReduce( numAtMost.data(), numBoundaries, comm );
+    vector<Int> sliceOffs(numSlices+1);
+    for( Int s=0; s<=numSlices; ++s )
+        sliceOffs[s] = numAtMost[s]-numAtMost[0];
+    const Int numEigs = sliceOffs[numSlices];
+    if( ctrl.progress && commRank == 0 )
+        Output
+        (numEigs," eigenvalues in (",lowerBound,",",upperBound,"] over ",
+         numSlices," slices and ",numTeams," teams");
+
+    // Compute the eigenpairs of each slice
+    // ------------------------------------
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& Q = QProx.Get();
+    Q.Resize( n, numEigs );
+    vector<Real> wAll(numEigs,0);
+    vector<Entry<F>> entries;
+    for( Int s=team; s<numSlices; s+=numTeams )
+    {
+        const Int numSliceEigs = sliceOffs[s+1]-sliceOffs[s];
+        if( numSliceEigs == 0 )
+            continue;
+        const Real sliceLower = lowerBound + s*sliceWidth;
+        const Real sliceUpper =
+          ( s == numSlices-1 ? upperBound : sliceLower+sliceWidth );
+        DistMatrix<Real,STAR,STAR> wSlice(*teams.grid);
+        DistMatrix<F> XSlice(*teams.grid);
+        const Int numIts =
+          slice::FilteredSubspaceIteration
+          ( ATeam, sliceLower, sliceUpper, numSliceEigs, center, radius,
+            wSlice, XSlice, ctrl );
+        if( ctrl.progress && teamRoot )
+            Output
+            ("slice ",s," of ",numSlices,": ",numSliceEigs," eigenpairs after ",
+             numIts," iterations");
+
+        const Int off = sliceOffs[s];
+        if( teamRoot )
+            for( Int j=0; j<numSliceEigs; ++j )
+                wAll[off+j] = wSlice.GetLocal(j,0);
+        const Int localHeight = XSlice.LocalHeight();
+        const Int localWidth = XSlice.LocalWidth();
+        entries.reserve( entries.size()+localHeight*localWidth );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = off + XSlice.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                entries.push_back
+                ( Entry<F>{ XSlice.GlobalRow(iLoc), j,
+                            XSlice.GetLocal(iLoc,jLoc) } );
+        }
+    }
+    mpi::AllReduce( wAll.data(), numEigs, comm );
+
+    // Send the eigenvectors to their owners in Q
+    // ------------------------------------------
+    // Since Q is in an [MC,MR] distribution, its owning ranks are ranks within
+    // the [VC,* ] communicator.
+    vector<int> sendCounts(commSize,0);
+    for( const auto& entry : entries )
+        ++sendCounts[Q.Owner(entry.i,entry.j)];
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Entry<F>> sendBuf(totalSend);
+    for( const auto& entry : entries )
+        sendBuf[offs[Q.Owner(entry.i,entry.j)]++] = entry;
+    SwapClear( entries );
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    SwapClear( sendBuf );
+    for( const auto& entry : recvBuf )
+        Q.SetLocal( Q.LocalRow(entry.i), Q.LocalCol(entry.j), entry.value );
+
+    DistMatrixWriteProxy<Real,Real,VR,STAR> wProx( wPre );
+    auto& w = wProx.Get();
+    w.Resize( numEigs, 1 );
+    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
+        w.SetLocal( iLoc, 0, wAll[w.GlobalRow(iLoc)] );
+}
+
+} // namespace herm_eig
+} // namespace El
+
+#endif // ifndef EL_HERMITIANEIG_SLICE_HPP
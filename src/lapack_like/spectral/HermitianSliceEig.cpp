@@ -0,0 +1,231 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./Teams.hpp"
+
+namespace El {
+
+template<typename Field>
+void HermitianSliceEig
+( const DistSparseMatrix<Field>& A,
+        Base<Field> lowerBound,
+        Base<Field> upperBound,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        DistMultiVec<Field>& X,
+  const HermitianSliceEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( lowerBound >= upperBound )
+        LogicError("The interval [",lowerBound,",",upperBound,") was empty");
+
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    Teams teams( grid, ctrl.teamSize == 0 ? commSize : ctrl.teamSize );
+    const Int numTeams = teams.numTeams;
+    const Int numSlices = ( ctrl.numSlices == 0 ? numTeams : ctrl.numSlices );
+    if( numSlices < 1 )
+        LogicError("There must be at least one slice");
+    const Int team = teams.team;
+    const bool teamRoot = teams.Root();
+
+    // Copy A to each team with an explicit diagonal so that every shift of A
+    // shares the nonzero structure of the symbolic factorization
+    // ----------------------------------------------------------------------
+    DistSparseMatrix<Field> ATeam(*teams.grid), AShift(*teams.grid);
+    ReplicateToTeams( A, teams, ATeam );
+    ShiftDiagonal( ATeam, Field(0) );
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( ATeam, true, ctrl.bisectCtrl );
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real sliceWidth = (upperBound-lowerBound) / numSlices;
+    Real factoredShift = lowerBound-1;
+    auto factor =
+      [&]( Real shift )
+      {
+          AShift = ATeam;
+          ShiftDiagonal( AShift, Field(-shift), 0, true );
+          sparseLDLFact.ChangeNonzeroValues( AShift );
+          sparseLDLFact.Factor( ctrl.frontType );
+          factoredShift = shift;
+          return sparseLDLFact.Inertia();
+      };
+
+    // Count the eigenvalues below each slice boundary
+    // -----------------------------------------------
+    // Boundary b is handled by team b % numTeams. A boundary which is
+    // (numerically) an eigenvalue is perturbed downwards so that the
+    // eigenvalue is counted in the slice above it. Each team visits its
+    // boundaries in descending order so that its final factorization is at
+    // the lower boundary of its first slice.
+    const Int numBoundaries = numSlices+1;
+    vector<Real> shifts(numBoundaries,0);
+    vector<Int> numBelow(numBoundaries,0);
+    for( Int b=numBoundaries-1; b>=0; --b )
+    {
+        if( b % numTeams != team )
+            continue;
+        Real shift = lowerBound + b*sliceWidth;
+        auto inertia = factor( shift );
+        const Real perturbation = Sqrt(eps)*Max(Abs(shift),sliceWidth);
+        for( Int attempt=1; inertia.numZero > 0; ++attempt )
+        {
+            if( attempt > 10 )
+                RuntimeError("Could not perturb shift ",shift," to be regular");
+            shift -= perturbation;
+            inertia = factor( shift );
+        }
+        if( teamRoot )
+        {
+            shifts[b] = shift;
+            numBelow[b] = inertia.numNegative;
+        }
+    }
+    mpi::AllReduce( shifts.data(), numBoundaries, comm );
+    mpi::AllReduce( numBelow.data(), numBoundaries, comm );
+    vector<Int> sliceOffs(numSlices+1);
+    for( Int s=0; s<=numSlices; ++s )
+        sliceOffs[s] = numBelow[s]-numBelow[0];
+    const Int numEigs = sliceOffs[numSlices];
+    if( ctrl.progress && commRank == 0 )
+        Output
+        (numEigs," eigenvalues in [",lowerBound,",",upperBound,") over ",
+         numSlices," slices and ",numTeams," teams");
+
+    // Compute the eigenpairs of each slice using shift-and-invert
+    // -----------------------------------------------------------
+    // The eigenvalues of the slice [sigma,tau) map to the largest eigenvalues
+    // of inv(A - sigma I), which lie in [1/(tau-sigma),infinity) and are
+    // returned in descending order; their counterparts are thus ascending.
+    //
+    // Block Lanczos only ensures that the residuals of inv(A - sigma I) are
+    // small relative to its largest Ritz value, theta_max, and the residual
+    // of (lambda,x) in the original spectrum is larger by up to a factor of
+    // theta_max/theta. When an eigenvalue lies close to sigma, this factor is
+    // large, so each slice is only accepted once
+    //
+    //   || A x - lambda x ||_2 <= tol || A ||_1
+    //
+    // for all of its eigenpairs, and is otherwise recomputed with the Lanczos
+    // tolerance reduced by (at least) theta_min/theta_max.
+    auto lanczosCtrl = ctrl.lanczosCtrl;
+    lanczosCtrl.smallest = false;
+    const Real tol =
+      ( lanczosCtrl.tol == Real(0) ? Pow(eps,Real(0.75)) : lanczosCtrl.tol );
+    const Real normA = OneNorm( ATeam );
+    const Int maxAttempts = 3;
+    auto applyInverse =
+      [&]( const DistMultiVec<Field>& Q, DistMultiVec<Field>& Y )
+      {
+          Y = Q;
+          sparseLDLFact.Solve( Y );
+      };
+    vector<Real> wAll(numEigs,0);
+    X.SetGrid( grid );
+    Zeros( X, n, numEigs );
+    for( Int s=team; s<numSlices; s+=numTeams )
+    {
+        const Int numSliceEigs = sliceOffs[s+1]-sliceOffs[s];
+        if( numSliceEigs == 0 )
+            continue;
+        const Real shift = shifts[s];
+        if( shift != factoredShift )
+            factor( shift );
+
+        DistMatrix<Real,STAR,STAR> theta(*teams.grid);
+        DistMultiVec<Field> XSlice(*teams.grid), E(*teams.grid);
+        Matrix<Real> residNorms;
+        auto sliceCtrl = lanczosCtrl;
+        sliceCtrl.tol = tol;
+        for( Int attempt=1; ; ++attempt )
+        {
+            const Int numRestarts =
+              BlockLanczos( n, applyInverse, numSliceEigs, theta, XSlice,
+                            sliceCtrl );
+
+            // E := A X - X diag(lambda)
+            Zeros( E, n, numSliceEigs );
+            Multiply( NORMAL, Field(1), ATeam, XSlice, Field(0), E );
+            auto& ELoc = E.Matrix();
+            const auto& XSliceLoc = XSlice.LockedMatrix();
+            Real thetaMin = limits::Max<Real>(), thetaMax = 0;
+            for( Int j=0; j<numSliceEigs; ++j )
+            {
+                const Real thetaj = theta.GetLocal(j,0);
+                thetaMin = Min( thetaMin, thetaj );
+                thetaMax = Max( thetaMax, thetaj );
+                const Real lambda = shift + Real(1)/thetaj;
+                for( Int iLoc=0; iLoc<XSliceLoc.Height(); ++iLoc )
+                    ELoc(iLoc,j) -= lambda*XSliceLoc(iLoc,j);
+            }
+            ColumnTwoNorms( E, residNorms );
+            const Real maxResid = MaxNorm( residNorms );
+            if( ctrl.progress && teamRoot )
+                Output
+                ("slice ",s," of ",numSlices,": ",numSliceEigs,
+                 " eigenpairs after ",numRestarts," restarts with a maximum ",
+                 "residual of ",maxResid," and Lanczos tolerance ",
+                 sliceCtrl.tol);
+            if( maxResid <= tol*normA )
+                break;
+            if( attempt == maxAttempts || sliceCtrl.tol <= eps )
+                RuntimeError
+                ("The eigenpairs of slice ",s," had a residual of ",maxResid,
+                 " rather than at most ",tol*normA);
+            const Real reduction = Min( thetaMin/thetaMax, tol*normA/maxResid );
+            sliceCtrl.tol = Max( sliceCtrl.tol*reduction, eps );
+        }
+
+        const Int off = sliceOffs[s];
+        if( teamRoot )
+            for( Int j=0; j<numSliceEigs; ++j )
+                wAll[off+j] = shift + Real(1)/theta.GetLocal(j,0);
+        const Int localHeight = XSlice.LocalHeight();
+        X.Reserve( localHeight*numSliceEigs );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = XSlice.GlobalRow(iLoc);
+            for( Int j=0; j<numSliceEigs; ++j )
+                X.QueueUpdate( i, off+j, XSlice.GetLocal(iLoc,j) );
+        }
+    }
+    X.ProcessQueues();
+    mpi::AllReduce( wAll.data(), numEigs, comm );
+
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& w = wProx.Get();
+    w.Resize( numEigs, 1 );
+    for( Int j=0; j<numEigs; ++j )
+        w.SetLocal( j, 0, wAll[j] );
+}
+
+#define PROTO(Field) \
+  template void HermitianSliceEig \
+  ( const DistSparseMatrix<Field>& A, \
+          Base<Field> lowerBound, \
+          Base<Field> upperBound, \
+          AbstractDistMatrix<Base<Field>>& w, \
+          DistMultiVec<Field>& X, \
+    const HermitianSliceEigCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -94,6 +94,51 @@ Base<Field> LanczosDecomp
     return LanczosDecomp( n, applyA, V, T, v, basisSize );
 }
 
+template<typename Field>
+Int BlockLanczos
+( const SparseMatrix<Field>& A,
+        Int numEigs,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const Matrix<Field>& Q, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, Q.Width() );
+          Multiply( NORMAL, Field(1), A, Q, Field(0), Y );
+      };
+    return BlockLanczos( n, applyA, numEigs, w, X, ctrl );
+}
+
+template<typename Field>
+Int BlockLanczos
+( const DistSparseMatrix<Field>& A,
+        Int numEigs,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const DistMultiVec<Field>& Q, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, Q.Width() );
+          Multiply( NORMAL, Field(1), A, Q, Field(0), Y );
+      };
+    X.SetGrid( A.Grid() );
+    return BlockLanczos( n, applyA, numEigs, w, X, ctrl );
+}
+
 #define PROTO(Field) \
   template void Lanczos \
   ( const SparseMatrix<Field>& A, \
@@ -114,7 +159,19 @@ Base<Field> LanczosDecomp
           DistMultiVec<Field>& V, \
           AbstractDistMatrix<Base<Field>>& T, \
           DistMultiVec<Field>& v, \
-          Int basisSize );
+          Int basisSize ); \
+  template Int BlockLanczos \
+  ( const SparseMatrix<Field>& A, \
+          Int numEigs, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& X, \
+    const BlockLanczosCtrl<Base<Field>>& ctrl ); \
+  template Int BlockLanczos \
+  ( const DistSparseMatrix<Field>& A, \
+          Int numEigs, \
+          AbstractDistMatrix<Base<Field>>& w, \
+          DistMultiVec<Field>& X, \
+    const BlockLanczosCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -10,6 +10,7 @@
 
 #include "./Polar/QDWH.hpp"
 #include "./Polar/SVD.hpp"
+#include "./Polar/Zolo.hpp"
 
 namespace El {
 
@@ -21,7 +22,9 @@ PolarInfo Polar( Matrix<Field>& A, const PolarCtrl& ctrl )
 {
     EL_DEBUG_CSE
     PolarInfo info;
-    if( ctrl.qdwh )
+    if( ctrl.zolo )
+        info.zoloInfo = polar::Zolo( A, ctrl.zoloCtrl );
+    else if( ctrl.qdwh )
         info.qdwhInfo = polar::QDWH( A, ctrl.qdwhCtrl );
     else
         polar::SVD( A );
@@ -33,7 +36,9 @@ PolarInfo Polar( AbstractDistMatrix<Field>& A, const PolarCtrl& ctrl )
 {
     EL_DEBUG_CSE
     PolarInfo info;
-    if( ctrl.qdwh )
+    if( ctrl.zolo )
+        info.zoloInfo = polar::Zolo( A, ctrl.zoloCtrl );
+    else if( ctrl.qdwh )
         info.qdwhInfo = polar::QDWH( A, ctrl.qdwhCtrl );
     else
         polar::SVD( A );
@@ -45,7 +50,9 @@ PolarInfo Polar( Matrix<Field>& A, Matrix<Field>& P, const PolarCtrl& ctrl )
 {
     EL_DEBUG_CSE
     PolarInfo info;
-    if( ctrl.qdwh )
+    if( ctrl.zolo )
+        info.zoloInfo = polar::Zolo( A, P, ctrl.zoloCtrl );
+    else if( ctrl.qdwh )
         info.qdwhInfo = polar::QDWH( A, P, ctrl.qdwhCtrl );
     else
         polar::SVD( A, P );
@@ -60,7 +67,9 @@ PolarInfo Polar
 {
     EL_DEBUG_CSE
     PolarInfo info;
-    if( ctrl.qdwh )
+    if( ctrl.zolo )
+        info.zoloInfo = polar::Zolo( A, P, ctrl.zoloCtrl );
+    else if( ctrl.qdwh )
         info.qdwhInfo = polar::QDWH( A, P, ctrl.qdwhCtrl );
     else
         polar::SVD( A, P );
@@ -75,7 +84,9 @@ PolarInfo HermitianPolar
 {
     EL_DEBUG_CSE
     PolarInfo info;
-    if( ctrl.qdwh )
+    if( ctrl.zolo )
+        info.zoloInfo = herm_polar::Zolo( uplo, A, ctrl.zoloCtrl );
+    else if( ctrl.qdwh )
         info.qdwhInfo = herm_polar::QDWH( uplo, A, ctrl.qdwhCtrl );
     else
         HermitianSign( uplo, A );
@@ -90,7 +101,9 @@ PolarInfo HermitianPolar
 {
     EL_DEBUG_CSE
     PolarInfo info;
-    if( ctrl.qdwh )
+    if( ctrl.zolo )
+        info.zoloInfo = herm_polar::Zolo( uplo, A, ctrl.zoloCtrl );
+    else if( ctrl.qdwh )
         info.qdwhInfo = herm_polar::QDWH( uplo, A, ctrl.qdwhCtrl );
     else
         HermitianSign( uplo, A );
@@ -103,7 +116,9 @@ PolarInfo HermitianPolar
 {
     EL_DEBUG_CSE
     PolarInfo info;
-    if( ctrl.qdwh )
+    if( ctrl.zolo )
+        info.zoloInfo = herm_polar::Zolo( uplo, A, P, ctrl.zoloCtrl );
+    else if( ctrl.qdwh )
         info.qdwhInfo = herm_polar::QDWH( uplo, A, P, ctrl.qdwhCtrl );
     else
         HermitianSign( uplo, A, P );
@@ -119,7 +134,9 @@ PolarInfo HermitianPolar
 {
     EL_DEBUG_CSE
     PolarInfo info;
-    if( ctrl.qdwh )
+    if( ctrl.zolo )
+        info.zoloInfo = herm_polar::Zolo( uplo, A, P, ctrl.zoloCtrl );
+    else if( ctrl.qdwh )
         info.qdwhInfo = herm_polar::QDWH( uplo, A, P, ctrl.qdwhCtrl );
     else
         HermitianSign( uplo, A, P );
@@ -0,0 +1,600 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_POLAR_ZOLO_HPP
+#define EL_POLAR_ZOLO_HPP
+
+namespace El {
+
+// An implementation of the Zolotarev-based polar decomposition (Zolo-PD) of
+// Nakatsukasa and Freund, "Computing fundamental matrix decompositions
+// accurately via the matrix sign function in two iterations: The power of
+// Zolotarev's functions", SIAM Review, 58(3), 2016.
+//
+// After scaling A so that its singular values lie in [ell,1], each iteration
+// applies the best rational approximation of type (2r+1,2r) to the sign
+// function over [ell,1],
+//
+//   Z(x) = M x prod_{j=1}^r (x^2 + c_{2j}) / (x^2 + c_{2j-1})
+//        = M x (1 + sum_{j=1}^r a_j / (x^2 + c_{2j-1})),
+//
+// to the singular values of X. Each of the r terms requires an independent
+// QR (or Cholesky) factorization, as
+//
+//   X (X^H X + c I)^{-1} = Q_1 Q_2^H / sqrt(c),  [X; sqrt(c) I] = [Q_1; Q_2] R,
+//
+// and so the terms may be computed concurrently on disjoint subgrids.
+// With r=8, two iterations suffice for condition numbers up to 1e16.
+
+namespace polar {
+
+namespace zolo {
+
+// Compute the coefficients {c_i}_{i=1}^{2r} of the Zolotarev function over
+// [ell,1], c_i = ell^2 sn^2(u_i;ell') / cn^2(u_i;ell'), u_i = i K(ell')/(2r+1),
+// where ell' = sqrt(1-ell^2).
+//
+// For ill-conditioned problems, ell' is within rounding of one, and the
+// arithmetic-geometric mean approach to sn and cn loses most of its accuracy
+// in the middle of the interval. We instead use Jacobi's imaginary
+// transformation to express the ratio in terms of theta functions of the
+// complementary nome, q' = exp(-pi K(ell')/K(ell)), which is tiny in the
+// ill-conditioned case:
+//
+//   c_i = (theta_2(q')/theta_3(q'))^2 (theta_1(i y_i)/(i theta_4(i y_i)))^2,
+//
+// with y_i = pi u_i / (2 K(ell)).
+template<typename Real>
+vector<Real> Coefficients( const Real& ell, Int numTerms )
+{
+    EL_DEBUG_CSE
+    const Real pi = Pi<Real>();
+    const Real eps = limits::Epsilon<Real>();
+    const Real ellComp = Sqrt( (1-ell)*(1+ell) );
+
+    auto ellipticK =
+      [&]( const Real& modulusComp )
+      {
+          // K(k) = pi / (2 AGM(1,k'))
+          Real a=1, b=modulusComp;
+          for( Int it=0; it<100 && Abs(a-b) > eps*a; ++it )
+          {
+              const Real aNew = (a+b)/2;
+              b = Sqrt(a*b);
+              a = aNew;
+          }
+          return pi/(2*a);
+      };
+    const Real K = ellipticK( ellComp );
+    const Real KComp = ellipticK( ell );
+    const Real logNome = -pi*KComp/K;
+
+    // Sum the terms of a theta series until they are negligible
+    auto sumSeries =
+      [&]( Int start, const function<Real(Int)>& term )
+      {
+          Real sum = 0;
+          for( Int k=start; k<start+1000; ++k )
+          {
+              const Real value = term(k);
+              sum += value;
+              if( Abs(value) <= eps*Abs(sum) )
+                  break;
+          }
+          return sum;
+      };
+    const Real theta2 =
+      sumSeries
+      ( 0,
+        [&]( Int k ) { return 2*Exp(logNome*(k+Real(1)/2)*(k+Real(1)/2)); } );
+    const Real theta3 =
+      1 + sumSeries( 1, [&]( Int k ) { return 2*Exp(logNome*k*k); } );
+    const Real thetaRatio = theta2 / theta3;
+
+    vector<Real> c(2*numTerms);
+    for( Int i=1; i<=2*numTerms; ++i )
+    {
+        const Real y = pi*(i*KComp/(2*numTerms+1))/(2*K);
+
+        // Combine the exponentials so that neither can overflow
+        const Real theta1 =
+          sumSeries
+          ( 0,
+            [&]( Int k )
+            {
+                const Real e = logNome*(k+Real(1)/2)*(k+Real(1)/2);
+                const Real term = Exp(e+(2*k+1)*y) - Exp(e-(2*k+1)*y);
+                return ( k % 2 == 0 ? term : -term );
+            } );
+        const Real theta4 =
+          1 + sumSeries
+          ( 1,
+            [&]( Int k )
+            {
+                const Real e = logNome*k*k;
+                const Real term = Exp(e+2*k*y) + Exp(e-2*k*y);
+                return ( k % 2 == 0 ? term : -term );
+            } );
+        const Real ratio = thetaRatio*theta1/theta4;
+        c[i-1] = ratio*ratio;
+    }
+    return c;
+}
+
+// The weights of the partial fraction expansion,
+//
+//   a_j = -prod_{k=1}^r (c_{2j-1} - c_{2k}) /
+//          prod_{k != j} (c_{2j-1} - c_{2k-1})
+template<typename Real>
+vector<Real> Weights( const vector<Real>& c )
+{
+    EL_DEBUG_CSE
+    const Int numTerms = c.size() / 2;
+    vector<Real> a(numTerms);
+    for( Int j=0; j<numTerms; ++j )
+    {
+        Real weight = -1;
+        for( Int k=0; k<numTerms; ++k )
+        {
+            weight *= c[2*j] - c[2*k+1];
+            if( k != j )
+                weight /= c[2*j] - c[2*k];
+        }
+        a[j] = weight;
+    }
+    return a;
+}
+
+// Evaluate the (unscaled) Zolotarev function at x
+template<typename Real>
+Real Evaluate( const Real& x, const vector<Real>& c, const vector<Real>& a )
+{
+    Real sum = 1;
+    for( size_t j=0; j<a.size(); ++j )
+        sum += a[j] / (x*x+c[2*j]);
+    return x*sum;
+}
+
+// Keep ell inside of the domain of the coefficient computation
+template<typename Real>
+Real ClipLowerBound( const Real& ell, const Real& tol )
+{ return Min( Max( ell, limits::Epsilon<Real>() ), 1-tol ); }
+
+// The lower bound on the singular values after applying the scaled
+// Zolotarev function, M Z(ell), where M = 1/Z(1)
+template<typename Real>
+Real UpdateLowerBound
+( const Real& ell, const vector<Real>& c, const vector<Real>& a )
+{ return Min( Evaluate(ell,c,a) / Evaluate(Real(1),c,a), Real(1) ); }
+
+// The smallest number of terms (up to eight) which leads to convergence in
+// two iterations, as predicted by iterating on the lower bound
+template<typename Real>
+Int ChooseNumTerms( const Real& ell, const Real& tol )
+{
+    EL_DEBUG_CSE
+    const Int maxNumTerms = 8;
+    for( Int numTerms=1; numTerms<maxNumTerms; ++numTerms )
+    {
+        Real ellIt = ell;
+        for( Int it=0; it<2; ++it )
+        {
+            ellIt = ClipLowerBound( ellIt, tol );
+            const auto c = Coefficients( ellIt, numTerms );
+            ellIt = UpdateLowerBound( ellIt, c, Weights(c) );
+        }
+        if( 1-ellIt <= tol )
+            return numTerms;
+    }
+    return maxNumTerms;
+}
+
+// Since X^H X + c I has a condition number of at most (1+c)/(ell^2+c), the
+// faster Cholesky-based update is used once this is modest for every term
+template<typename Real>
+bool UseCholesky( const Real& ell, const vector<Real>& c )
+{ return (1+c[0])/(ell*ell+c[0]) <= Real(100); }
+
+// Z := Z + sum_{j in terms} a_j X (X^H X + c_{2j-1} I)^{-1}, where Q, C, and
+// XTemp are used as workspace
+template<typename F,class MatrixType>
+void AccumulateTerms
+( const MatrixType& X,
+        MatrixType& Z,
+  const vector<Base<F>>& c,
+  const vector<Base<F>>& a,
+  const vector<Int>& terms,
+  bool cholesky,
+        MatrixType& Q,
+        MatrixType& C,
+        MatrixType& XTemp )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = X.Height();
+    const Int n = X.Width();
+    for( const Int j : terms )
+    {
+        const Real shift = c[2*j];
+        if( cholesky )
+        {
+            Zeros( C, n, n );
+            FillDiagonal( C, F(shift) );
+            Herk( LOWER, ADJOINT, Real(1), X, Real(1), C );
+            Cholesky( LOWER, C );
+            XTemp = X;
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, XTemp );
+            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, XTemp );
+            Axpy( F(a[j]), XTemp, Z );
+        }
+        else
+        {
+            Zeros( Q, m+n, n );
+            auto QT = Q( IR(0,m  ), ALL );
+            auto QB = Q( IR(m,END), ALL );
+            QT = X;
+            FillDiagonal( QB, F(Sqrt(shift)) );
+            qr::ExplicitUnitary( Q, true );
+            Gemm( NORMAL, ADJOINT, F(a[j]/Sqrt(shift)), QT, QB, F(1), Z );
+        }
+    }
+}
+
+template<typename F>
+Base<F> LowerBound( Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real twoEst = TwoNormEstimate( A );
+    A *= 1/twoEst;
+
+    Real sMinUpper;
+    Matrix<F> Y( A );
+    if( A.Height() > A.Width() )
+    {
+        qr::ExplicitTriang( Y );
+        try
+        {
+            TriangularInverse( UPPER, NON_UNIT, Y );
+            sMinUpper = Real(1) / OneNorm( Y );
+        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
+    }
+    else
+    {
+        try
+        {
+            Inverse( Y );
+            sMinUpper = Real(1) / OneNorm( Y );
+        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
+    }
+    return sMinUpper / Sqrt(Real(A.Width()));
+}
+
+template<typename F>
+Base<F> LowerBound( DistMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real twoEst = TwoNormEstimate( A );
+    A *= 1/twoEst;
+
+    Real sMinUpper;
+    DistMatrix<F> Y( A );
+    if( A.Height() > A.Width() )
+    {
+        qr::ExplicitTriang( Y );
+        try
+        {
+            TriangularInverse( UPPER, NON_UNIT, Y );
+            sMinUpper = Real(1) / OneNorm( Y );
+        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
+    }
+    else
+    {
+        try
+        {
+            Inverse( Y );
+            sMinUpper = Real(1) / OneNorm( Y );
+        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
+    }
+    return sMinUpper / Sqrt(Real(A.Width()));
+}
+
+// Split the processes of the grid into (nearly) equally-sized, contiguous
+// subgrids which share the viewing communicator of the original grid so that
+// matrices may be redistributed between them
+inline vector<unique_ptr<Grid>>
+SplitGrid( const Grid& grid, Int numSubgrids )
+{
+    EL_DEBUG_CSE
+    const int p = grid.Size();
+    vector<unique_ptr<Grid>> subgrids(numSubgrids);
+    mpi::Group group = grid.OwningGroup();
+    int offset = 0;
+    for( Int s=0; s<numSubgrids; ++s )
+    {
+        const int pSub = p/numSubgrids + ( s < p % numSubgrids ? 1 : 0 );
+        vector<int> ranks(pSub);
+        for( int q=0; q<pSub; ++q )
+            ranks[q] = offset + q;
+        offset += pSub;
+
+        mpi::Group subgroup;
+        mpi::Incl( group, pSub, ranks.data(), subgroup );
+        subgrids[s].reset
+        ( new Grid( grid.VCComm(), subgroup, Grid::DefaultHeight(pSub) ) );
+        mpi::Free( subgroup );
+    }
+    return subgrids;
+}
+
+} // namespace zolo
+
+template<typename F>
+ZoloInfo Zolo( Matrix<F>& A, const ZoloCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+        LogicError("Height cannot be less than width");
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 5*eps;
+    const Real cubeRootTol = Pow(tol,Real(1)/Real(3));
+
+    Real ell = zolo::LowerBound( A );
+
+    ZoloInfo info;
+    info.numTerms = ( ctrl.numTerms > 0 ? ctrl.numTerms :
+                      zolo::ChooseNumTerms( ell, tol ) );
+    vector<Int> terms(info.numTerms);
+    for( Int j=0; j<info.numTerms; ++j )
+        terms[j] = j;
+
+    Matrix<F> ALast, Q, C, ATemp;
+    while( info.numIts < ctrl.maxIts )
+    {
+        ALast = A;
+
+        ell = zolo::ClipLowerBound( ell, tol );
+        const auto c = zolo::Coefficients( ell, info.numTerms );
+        const auto a = zolo::Weights( c );
+        const bool cholesky = zolo::UseCholesky( ell, c );
+        if( ctrl.progress )
+            Output
+            ("Zolo-PD iteration ",info.numIts," with ell=",ell," using ",
+             info.numTerms,( cholesky ? " Cholesky" : " QR" ),
+             " factorizations");
+
+        // A := M (A + sum_j a_j A (A^H A + c_{2j-1} I)^{-1})
+        zolo::AccumulateTerms<F>
+        ( ALast, A, c, a, terms, cholesky, Q, C, ATemp );
+        A *= 1/zolo::Evaluate( Real(1), c, a );
+        ell = zolo::UpdateLowerBound( ell, c, a );
+        if( cholesky )
+            ++info.numCholIts;
+        else
+            ++info.numQRIts;
+
+        ++info.numIts;
+        ALast -= A;
+        const Real frobNormADiff = FrobeniusNorm( ALast );
+        if( frobNormADiff <= cubeRootTol && Abs(1-ell) <= tol )
+            break;
+    }
+    return info;
+}
+
+template<typename F>
+ZoloInfo Zolo( Matrix<F>& A, Matrix<F>& P, const ZoloCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> ACopy( A );
+    auto info = Zolo( A, ctrl );
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
+    MakeHermitian( LOWER, P );
+    return info;
+}
+
+template<typename F>
+ZoloInfo Zolo( AbstractDistMatrix<F>& APre, const ZoloCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+        LogicError("Height cannot be less than width");
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 5*eps;
+    const Real cubeRootTol = Pow(tol,Real(1)/Real(3));
+    const Grid& g = A.Grid();
+
+    Real ell = zolo::LowerBound( A );
+
+    ZoloInfo info;
+    info.numTerms = ( ctrl.numTerms > 0 ? ctrl.numTerms :
+                      zolo::ChooseNumTerms( ell, tol ) );
+
+    // Assign the terms to the subgrids in a round-robin manner
+    Int numSubgrids = Min( info.numTerms, Int(g.Size()) );
+    if( ctrl.numSubgrids > 0 )
+        numSubgrids = Min( numSubgrids, ctrl.numSubgrids );
+    vector<unique_ptr<Grid>> subgrids;
+    if( numSubgrids > 1 )
+        subgrids = zolo::SplitGrid( g, numSubgrids );
+    Int subgrid = 0;
+    for( Int s=1; s<numSubgrids; ++s )
+        if( subgrids[s]->InGrid() )
+            subgrid = s;
+    vector<Int> terms;
+    for( Int j=subgrid; j<info.numTerms; j+=numSubgrids )
+        terms.push_back( j );
+    const Grid& gSub = ( numSubgrids > 1 ? *subgrids[subgrid] : g );
+    if( ctrl.progress && g.Rank() == 0 )
+        Output
+        ("Zolo-PD using ",info.numTerms," terms over ",numSubgrids,
+         " subgrids");
+
+    DistMatrix<F> ALast(g), ASub(gSub), ZSub(gSub), Z(g);
+    DistMatrix<F> Q(gSub), C(gSub), ATemp(gSub);
+    while( info.numIts < ctrl.maxIts )
+    {
+        ALast = A;
+
+        ell = zolo::ClipLowerBound( ell, tol );
+        const auto c = zolo::Coefficients( ell, info.numTerms );
+        const auto a = zolo::Weights( c );
+        const bool cholesky = zolo::UseCholesky( ell, c );
+        if( ctrl.progress && g.Rank() == 0 )
+            Output
+            ("Zolo-PD iteration ",info.numIts," with ell=",ell," using ",
+             info.numTerms,( cholesky ? " Cholesky" : " QR" ),
+             " factorizations");
+
+        if( numSubgrids == 1 )
+        {
+            zolo::AccumulateTerms<F>
+            ( ALast, A, c, a, terms, cholesky, Q, C, ATemp );
+        }
+        else
+        {
+            // Push a copy of A to each subgrid
+            for( Int s=0; s<numSubgrids; ++s )
+            {
+                if( s == subgrid )
+                {
+                    ASub = ALast;
+                }
+                else
+                {
+                    DistMatrix<F> AOther(*subgrids[s]);
+                    AOther = ALast;
+                }
+            }
+
+            // Accumulate the terms assigned to this subgrid
+            Zeros( ZSub, m, n );
+            zolo::AccumulateTerms<F>
+            ( ASub, ZSub, c, a, terms, cholesky, Q, C, ATemp );
+
+            // Pull and sum the contributions from each subgrid
+            for( Int s=0; s<numSubgrids; ++s )
+            {
+                if( s == subgrid )
+                {
+                    Z = ZSub;
+                }
+                else
+                {
+                    DistMatrix<F> ZOther(*subgrids[s]);
+                    ZOther.Resize( m, n );
+                    Z = ZOther;
+                }
+                A += Z;
+            }
+        }
+        A *= 1/zolo::Evaluate( Real(1), c, a );
+        ell = zolo::UpdateLowerBound( ell, c, a );
+        if( cholesky )
+            ++info.numCholIts;
+        else
+            ++info.numQRIts;
+
+        ++info.numIts;
+        ALast -= A;
+        const Real frobNormADiff = FrobeniusNorm( ALast );
+        if( frobNormADiff <= cubeRootTol && Abs(1-ell) <= tol )
+            break;
+    }
+    return info;
+}
+
+template<typename F>
+ZoloInfo
+Zolo
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& PPre,
+  const ZoloCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MC,MR> PProx( PPre );
+    auto& A = AProx.Get();
+    auto& P = PProx.Get();
+
+    DistMatrix<F> ACopy( A );
+    auto info = Zolo( A, ctrl );
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
+    MakeHermitian( LOWER, P );
+    return info;
+}
+
+} // namespace polar
+
+namespace herm_polar {
+
+// Since the polar factor of a Hermitian matrix is its sign, Zolo-PD is simply
+// applied to the explicitly Hermitian matrix
+
+template<typename F>
+ZoloInfo Zolo( UpperOrLower uplo, Matrix<F>& A, const ZoloCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    MakeHermitian( uplo, A );
+    return polar::Zolo( A, ctrl );
+}
+
+template<typename F>
+ZoloInfo
+Zolo
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& P, const ZoloCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    MakeHermitian( uplo, A );
+    return polar::Zolo( A, P, ctrl );
+}
+
+template<typename F>
+ZoloInfo
+Zolo( UpperOrLower uplo, AbstractDistMatrix<F>& APre, const ZoloCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    MakeHermitian( uplo, A );
+    return polar::Zolo( A, ctrl );
+}
+
+template<typename F>
+ZoloInfo
+Zolo
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& P,
+  const ZoloCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    MakeHermitian( uplo, A );
+    return polar::Zolo( A, P, ctrl );
+}
+
+} // namespace herm_polar
+} // namespace El
+
+#endif // ifndef EL_POLAR_ZOLO_HPP
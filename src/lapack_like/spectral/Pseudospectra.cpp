@@ -14,6 +14,8 @@
 #include "./Pseudospectra/IRA.hpp"
 #include "./Pseudospectra/IRL.hpp"
 #include "./Pseudospectra/Analytic.hpp"
+#include "./Teams.hpp"
+#include "./Pseudospectra/Teams.hpp"
 
 // For one-norm pseudospectra. An adaptation of the more robust algorithm of
 // Higham and Tisseur will hopefully be implemented soon.
@@ -314,6 +316,21 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
         return itCounts;
     }
 
+    if( pspec::UseTeams( g, psCtrl ) )
+    {
+        Teams teams( g, psCtrl.teamSize );
+        DistMatrix<C> UTeam;
+        ReplicateToTeams( U, teams, UTeam );
+        auto batchCloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch,
+               const PseudospecCtrl<Real>& batchCtrl )
+          { return TriangularSpectralCloud
+                   ( UTeam, shiftsBatch, invNormsBatch, batchCtrl ); };
+        return pspec::TeamSpectralCloud
+               ( teams, shifts, invNorms, psCtrl, batchCloud );
+    }
+
     psCtrl.schur = true;
     if( psCtrl.norm == PS_TWO_NORM )
     {
@@ -372,6 +389,33 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
         return itCounts;
     }
 
+    if( pspec::UseTeams( g, psCtrl ) )
+    {
+        Teams teams( g, psCtrl.teamSize );
+        DistMatrix<C> UTeam;
+        ReplicateToTeams( U, teams, UTeam );
+        DistMatrix<C> QTeam;
+        if( psCtrl.norm != PS_TWO_NORM )
+        {
+            DistMatrixReadProxy<Field,C,MC,MR> QProx( QPre );
+            ReplicateToTeams( QProx.GetLocked(), teams, QTeam );
+        }
+        auto batchCloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch,
+               const PseudospecCtrl<Real>& batchCtrl )
+          {
+              if( batchCtrl.norm == PS_TWO_NORM )
+                  return TriangularSpectralCloud
+                  ( UTeam, shiftsBatch, invNormsBatch, batchCtrl );
+              else
+                  return TriangularSpectralCloud
+                  ( UTeam, QTeam, shiftsBatch, invNormsBatch, batchCtrl );
+          };
+        return pspec::TeamSpectralCloud
+               ( teams, shifts, invNorms, psCtrl, batchCloud );
+    }
+
     psCtrl.schur = true;
     if( psCtrl.norm == PS_TWO_NORM )
     {
@@ -437,6 +481,21 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
+    if( pspec::UseTeams( g, psCtrl ) )
+    {
+        Teams teams( g, psCtrl.teamSize );
+        DistMatrix<Real> UTeam;
+        ReplicateToTeams( U, teams, UTeam );
+        auto batchCloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch,
+               const PseudospecCtrl<Real>& batchCtrl )
+          { return QuasiTriangularSpectralCloud
+                   ( UTeam, shiftsBatch, invNormsBatch, batchCtrl ); };
+        return pspec::TeamSpectralCloud
+               ( teams, shifts, invNorms, psCtrl, batchCloud );
+    }
+
     return pspec::IRA( U, shifts, invNorms, psCtrl );
 }
 
@@ -483,6 +542,21 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
+    if( pspec::UseTeams( g, psCtrl ) )
+    {
+        Teams teams( g, psCtrl.teamSize );
+        DistMatrix<Real> UTeam;
+        ReplicateToTeams( U, teams, UTeam );
+        auto batchCloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch,
+               const PseudospecCtrl<Real>& batchCtrl )
+          { return QuasiTriangularSpectralCloud
+                   ( UTeam, shiftsBatch, invNormsBatch, batchCtrl ); };
+        return pspec::TeamSpectralCloud
+               ( teams, shifts, invNorms, psCtrl, batchCloud );
+    }
+
     return pspec::IRA( U, shifts, invNorms, psCtrl );
 }
 
@@ -496,6 +570,7 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     typedef Complex<Real> C;
+    const Grid& g = HPre.Grid();
 
     // Force 'H' to be complex in a [MC,MR] distribution
     DistMatrixReadProxy<Field,C,MC,MR> HProx( HPre );
@@ -507,6 +582,21 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 
     // TODO: Check if the subdiagonal is sufficiently small, and, if so, revert
     //       to TriangularSpectralCloud
+    if( pspec::UseTeams( g, psCtrl ) )
+    {
+        Teams teams( g, psCtrl.teamSize );
+        DistMatrix<C> HTeam;
+        ReplicateToTeams( H, teams, HTeam );
+        auto batchCloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch,
+               const PseudospecCtrl<Real>& batchCtrl )
+          { return HessenbergSpectralCloud
+                   ( HTeam, shiftsBatch, invNormsBatch, batchCtrl ); };
+        return pspec::TeamSpectralCloud
+               ( teams, shifts, invNorms, psCtrl, batchCloud );
+    }
+
     psCtrl.schur = false;
     if( psCtrl.norm == PS_TWO_NORM )
     {
@@ -535,6 +625,7 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     typedef Complex<Real> C;
+    const Grid& g = HPre.Grid();
 
     // Force 'H' to be complex and in a [MC,MR] distribution
     DistMatrixReadProxy<Field,C,MC,MR> HProx( HPre );
@@ -546,6 +637,33 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 
     // TODO: Check if the subdiagonal is sufficiently small, and, if so, revert
     //       to TriangularSpectralCloud
+    if( pspec::UseTeams( g, psCtrl ) )
+    {
+        Teams teams( g, psCtrl.teamSize );
+        DistMatrix<C> HTeam;
+        ReplicateToTeams( H, teams, HTeam );
+        DistMatrix<C> QTeam;
+        if( psCtrl.norm != PS_TWO_NORM )
+        {
+            DistMatrixReadProxy<Field,C,MC,MR> QProx( QPre );
+            ReplicateToTeams( QProx.GetLocked(), teams, QTeam );
+        }
+        auto batchCloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch,
+               const PseudospecCtrl<Real>& batchCtrl )
+          {
+              if( batchCtrl.norm == PS_TWO_NORM )
+                  return HessenbergSpectralCloud
+                  ( HTeam, shiftsBatch, invNormsBatch, batchCtrl );
+              else
+                  return HessenbergSpectralCloud
+                  ( HTeam, QTeam, shiftsBatch, invNormsBatch, batchCtrl );
+          };
+        return pspec::TeamSpectralCloud
+               ( teams, shifts, invNorms, psCtrl, batchCloud );
+    }
+
     psCtrl.schur = false;
     if( psCtrl.norm == PS_TWO_NORM )
     {
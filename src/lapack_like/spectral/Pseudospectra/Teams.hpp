@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_TEAMS_HPP
+#define EL_PSEUDOSPECTRA_TEAMS_HPP
+
+// Spreading the work for each shift over every process of a large grid leads
+// to the triangular/Hessenberg solves being dominated by communication for
+// moderately-sized matrices. Instead, the processes can be split into teams
+// which each store a copy of the (quasi-)triangular or Hessenberg matrix and
+// process disjoint batches of shifts. Since the number of iterations needed
+// for convergence varies greatly between shifts (and converged shifts are
+// deflated), the batches are handed out on demand by the root of the first
+// team rather than being assigned up front.
+
+namespace El {
+namespace pspec {
+
+template<typename Real>
+bool UseTeams( const Grid& g, const PseudospecCtrl<Real>& psCtrl )
+{ return psCtrl.teamSize != 0 && psCtrl.teamSize != g.Size(); }
+
+// Compute the pseudospectrum over the given shifts by handing out batches of
+// them to the teams, where 'batchCloud' computes the pseudospectrum over a
+// batch of shifts distributed over the team's grid
+template<typename Real,class BatchCloudType>
+DistMatrix<Int,VR,STAR> TeamSpectralCloud
+( const Teams& teams,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        AbstractDistMatrix<Real>& invNormsPre,
+        PseudospecCtrl<Real> psCtrl,
+  const BatchCloudType& batchCloud )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& g = shifts.Grid();
+    const Int numShifts = shifts.Height();
+    const Int numTeams = teams.numTeams;
+    const Int batchSize =
+      ( psCtrl.batchSize > 0 ? psCtrl.batchSize :
+        Max( (numShifts+4*numTeams-1)/(4*numTeams), 1 ) );
+    const Int numBatches = (numShifts+batchSize-1) / batchSize;
+
+    DistMatrix<C,STAR,STAR> shifts_STAR_STAR( shifts );
+    const auto& shiftsLoc = shifts_STAR_STAR.LockedMatrix();
+
+    // The batches are computed without intermediate snapshots, and the
+    // final snapshot is taken once the results are assembled
+    auto batchCtrl = psCtrl;
+    batchCtrl.teamSize = 0;
+    batchCtrl.snapCtrl.realSize = 0;
+    batchCtrl.snapCtrl.imagSize = 0;
+
+    vector<Real> invNormsAll(numShifts,0);
+    vector<Int> itCountsAll(numShifts,0);
+    auto processBatch =
+      [&]( Int batch )
+      {
+          Timer timer;
+          if( psCtrl.progress && teams.Root() )
+              timer.Start();
+          const Int off = batch*batchSize;
+          const Int thisBatchSize = Min(batchSize,numShifts-off);
+          DistMatrix<C,VR,STAR> shiftsBatch(*teams.grid);
+          shiftsBatch.Resize( thisBatchSize, 1 );
+          for( Int iLoc=0; iLoc<shiftsBatch.LocalHeight(); ++iLoc )
+              shiftsBatch.SetLocal
+              ( iLoc, 0, shiftsLoc(off+shiftsBatch.GlobalRow(iLoc)) );
+
+          DistMatrix<Real,VR,STAR> invNormsBatch(*teams.grid);
+          auto itCountsBatch =
+            batchCloud( shiftsBatch, invNormsBatch, batchCtrl );
+
+          DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( invNormsBatch );
+          DistMatrix<Int,STAR,STAR> itCounts_STAR_STAR( itCountsBatch );
+          if( teams.Root() )
+          {
+              for( Int i=0; i<thisBatchSize; ++i )
+              {
+                  invNormsAll[off+i] = invNorms_STAR_STAR.GetLocal(i,0);
+                  itCountsAll[off+i] = itCounts_STAR_STAR.GetLocal(i,0);
+              }
+              if( psCtrl.progress )
+                  Output
+                  ("team ",teams.team," finished batch ",batch," of ",
+                   numBatches," in ",timer.Stop()," seconds");
+          }
+      };
+
+    // Hand out the batches
+    // --------------------
+    // Each team begins with the batch matching its index and, while computing
+    // a batch, requests its next one from the dispatcher (the root of the
+    // first team), which answers requests between its own batches. A reply
+    // of 'numBatches' signals that there is no work left.
+    const int requestTag = 0, replyTag = 1;
+    const int dispatcher = teams.teamToWorld[0];
+    const bool isDispatcher = ( teams.team == 0 && teams.Root() );
+    Int nextBatch = numTeams;
+    Int numActive = Min(numTeams,numBatches) - 1;
+    auto serve =
+      [&]( bool block )
+      {
+          mpi::Status status;
+          while( numActive > 0 &&
+                 (block ||
+                  mpi::IProbe( mpi::ANY_SOURCE, requestTag, teams.comm,
+                               status )) )
+          {
+              const int requester =
+                mpi::TaggedRecv<int>( mpi::ANY_SOURCE, requestTag, teams.comm );
+              const Int reply =
+                ( nextBatch < numBatches ? nextBatch++ : numBatches );
+              if( reply == numBatches )
+                  --numActive;
+              mpi::TaggedSend( reply, requester, replyTag, teams.comm );
+          }
+      };
+
+    Int batch = teams.team;
+    while( batch < numBatches )
+    {
+        Int newBatch = numBatches;
+        mpi::Request<Int> request;
+        const bool requestAhead = ( teams.Root() && !isDispatcher );
+        if( requestAhead )
+        {
+            mpi::TaggedIRecv
+            ( &newBatch, 1, dispatcher, replyTag, teams.comm, request );
+            mpi::TaggedSend
+            ( mpi::Rank(teams.comm), dispatcher, requestTag, teams.comm );
+        }
+        processBatch( batch );
+        if( isDispatcher )
+        {
+            serve( false );
+            newBatch = ( nextBatch < numBatches ? nextBatch++ : numBatches );
+        }
+        else if( requestAhead )
+            mpi::Wait( request );
+        mpi::Broadcast( newBatch, 0, teams.grid->VCComm() );
+        batch = newBatch;
+    }
+    if( isDispatcher )
+        serve( true );
+
+    // Assemble the results
+    // --------------------
+    mpi::AllReduce( invNormsAll.data(), numShifts, teams.comm );
+    mpi::AllReduce( itCountsAll.data(), numShifts, teams.comm );
+    DistMatrix<Real,VR,STAR> invNorms(g);
+    DistMatrix<Int,VR,STAR> itCounts(g);
+    invNorms.AlignWith( shifts );
+    itCounts.AlignWith( shifts );
+    invNorms.Resize( numShifts, 1 );
+    itCounts.Resize( numShifts, 1 );
+    for( Int iLoc=0; iLoc<invNorms.LocalHeight(); ++iLoc )
+    {
+        const Int i = invNorms.GlobalRow(iLoc);
+        invNorms.SetLocal( iLoc, 0, invNormsAll[i] );
+        itCounts.SetLocal( iLoc, 0, itCountsAll[i] );
+    }
+    FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+    Copy( invNorms, invNormsPre );
+
+    return itCounts;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_TEAMS_HPP
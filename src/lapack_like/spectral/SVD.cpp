@@ -9,6 +9,7 @@
 #include <El.hpp>
 
 #include "./SVD/Chan.hpp"
+#include "./SVD/Jacobi.hpp"
 #include "./SVD/Product.hpp"
 
 namespace El {
@@ -319,7 +320,11 @@ SVDInfo SVD
     }
 
     SVDInfo info;
-    if( approach == PRODUCT_SVD )
+    if( ctrl.useJacobi && approach != PRODUCT_SVD )
+    {
+        info = svd::Jacobi( A, U, s, V, ctrl );
+    }
+    else if( approach == PRODUCT_SVD )
     {
         auto tolType = ctrl.bidiagSVDCtrl.tolType;
         if( tolType == RELATIVE_TO_SELF_SING_VAL_TOL )
@@ -560,6 +565,8 @@ SVDInfo SVD
         ctrl.bidiagSVDCtrl.approach == FULL_SVD )
     {
         DistMatrix<Field> ACopy( A );
+        if( ctrl.useJacobi )
+            return svd::Jacobi( ACopy, s, ctrl );
         return svd::Chan( ACopy, s, ctrl );
     }
     else
@@ -600,6 +607,8 @@ SVDInfo SVD
         DistMatrix<Field> ACopy( A );
         return SVD( ACopy, s, ctrlMod );
     }
+    if( ctrl.useJacobi )
+        return svd::Jacobi( A, s, ctrl );
     return svd::Chan( A, s, ctrl );
 }
 
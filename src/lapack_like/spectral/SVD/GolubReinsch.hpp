@@ -36,9 +36,16 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     Matrix<Field> householderScalarsP, householderScalarsQ;
+    bidiag::BulgeReflectors<Field> bulgeReflectors;
+    const bool twoStage = ctrl.twoStageBidiag && m >= n;
     if( ctrl.time )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( twoStage )
+        bidiag::TwoStage
+        ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+          ctrl.bidiagBandwidth );
+    else
+        Bidiag( A, householderScalarsP, householderScalarsQ );
     if( ctrl.time )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
@@ -86,8 +93,22 @@ SVDInfo GolubReinsch
     // Backtransform U and V
     if( ctrl.time )
         timer.Start();
-    if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
-    if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    if( twoStage )
+    {
+        if( !avoidU )
+            bidiag::TwoStageApplyQ
+            ( A, householderScalarsQ, bulgeReflectors, U );
+        if( !avoidV )
+            bidiag::TwoStageApplyP
+            ( A, householderScalarsP, bulgeReflectors, V );
+    }
+    else
+    {
+        if( !avoidU )
+            bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
+        if( !avoidV )
+            bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    }
     if( ctrl.time )
         Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
 
@@ -117,9 +138,16 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     DistMatrix<Field,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
+    bidiag::BulgeReflectors<Field> bulgeReflectors;
+    const bool twoStage = ctrl.twoStageBidiag && m >= n;
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( twoStage )
+        bidiag::TwoStage
+        ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+          ctrl.bidiagBandwidth );
+    else
+        Bidiag( A, householderScalarsP, householderScalarsQ );
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
@@ -173,8 +201,22 @@ SVDInfo GolubReinsch
     // Backtransform U and V
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
-    if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    if( twoStage )
+    {
+        if( !avoidU )
+            bidiag::TwoStageApplyQ
+            ( A, householderScalarsQ, bulgeReflectors, U );
+        if( !avoidV )
+            bidiag::TwoStageApplyP
+            ( A, householderScalarsP, bulgeReflectors, V );
+    }
+    else
+    {
+        if( !avoidU )
+            bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
+        if( !avoidV )
+            bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    }
     if( ctrl.time && g.Rank() == 0 )
         Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
 
@@ -213,9 +255,13 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     Matrix<Field> householderScalarsP, householderScalarsQ;
+    const bool twoStage = ctrl.twoStageBidiag && m >= n;
     if( ctrl.time )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( twoStage )
+        bidiag::TwoStage( A, ctrl.bidiagBandwidth );
+    else
+        Bidiag( A, householderScalarsP, householderScalarsQ );
     if( ctrl.time )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
@@ -249,9 +295,13 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     DistMatrix<Field,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
+    const bool twoStage = ctrl.twoStageBidiag && m >= n;
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( twoStage )
+        bidiag::TwoStage( A, ctrl.bidiagBandwidth );
+    else
+        Bidiag( A, householderScalarsP, householderScalarsQ );
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
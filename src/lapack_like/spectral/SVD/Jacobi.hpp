@@ -0,0 +1,497 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_JACOBI_HPP
+#define EL_SVD_JACOBI_HPP
+
+// A blocked one-sided Jacobi SVD: after a column-pivoted QR decomposition,
+// A Omega^T = Q R, the columns of W := R are repeatedly rotated in pairs of
+// blocks until they are mutually orthogonal, so that R V = W = U_R Sigma.
+// The columns of W (and V) are split into 2N blocks, and each of the first N
+// processes of the grid owns a 'top' and a 'bottom' block. Each round
+// orthogonalizes every pair of blocks simultaneously and then passes the
+// blocks around a ring using the round-robin ordering of Brent and Luk, so
+// that each sweep of 2N-1 rounds meets every pair of blocks exactly once.
+
+namespace El {
+namespace svd {
+namespace jacobi {
+
+// Move to the next round of the round-robin ordering: top[0] is fixed and the
+// remaining blocks rotate through
+//   top[1] -> top[2] -> ... -> top[N-1] -> bot[N-1] -> ... -> bot[0] -> top[1]
+inline void RoundRobin( vector<Int>& top, vector<Int>& bot )
+{
+    const Int numPairs = top.size();
+    if( numPairs == 1 )
+        return;
+    const Int lastTop = top[numPairs-1];
+    const Int firstBot = bot[0];
+    for( Int q=numPairs-1; q>1; --q )
+        top[q] = top[q-1];
+    for( Int q=0; q<numPairs-1; ++q )
+        bot[q] = bot[q+1];
+    bot[numPairs-1] = lastTop;
+    top[1] = firstBot;
+}
+
+// Orthogonalize the columns of the top 'height' rows of X (the local pair of
+// blocks of W) and apply the same rotation to the remaining rows (the pair of
+// blocks of V). The largest cosine between two columns of the pair before
+// the rotation is returned, and the pair is left untouched if it is already
+// below 'tol'.
+//
+// Rather than computing the SVD of the Gram matrix, W^H W = V_W Sigma^2 V_W^H,
+// which would square the condition number of the pair, its right singular
+// vectors are computed from the triangular factor of W = Q_W R_W, and
+// W V_W is formed as Q_W (U_W Sigma), which has orthogonal columns to
+// working precision.
+template<typename Field>
+Base<Field> OrthogonalizePair
+( Matrix<Field>& X,
+  Int height,
+  Base<Field> tol,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int width = X.Width();
+    if( width == 0 )
+        return Real(0);
+    auto W = X( IR(0,height), ALL );
+    auto V = X( IR(height,END), ALL );
+
+    Matrix<Field> G;
+    Zeros( G, width, width );
+    Herk( LOWER, ADJOINT, Real(1), W, Real(0), G );
+    Real off = 0;
+    for( Int j=0; j<width; ++j )
+    {
+        const Real gammaj = RealPart(G(j,j));
+        for( Int i=j+1; i<width; ++i )
+        {
+            const Real scale = Sqrt(gammaj)*Sqrt(RealPart(G(i,i)));
+            if( scale > Real(0) )
+                off = Max( off, Abs(G(i,j))/scale );
+        }
+    }
+    if( off <= tol )
+        return off;
+
+    Matrix<Field> QW( W ), householderScalars;
+    Matrix<Real> signature;
+    QR( QW, householderScalars, signature );
+    Matrix<Field> RW;
+    auto QWT = QW( IR(0,width), ALL );
+    RW = QWT;
+    MakeTrapezoidal( UPPER, RW );
+
+    SVDCtrl<Real> pairCtrl;
+    pairCtrl.overwrite = true;
+    pairCtrl.useLAPACK = ctrl.useLAPACK;
+    Matrix<Field> UW, VW;
+    Matrix<Real> sW;
+    SVD( RW, UW, sW, VW, pairCtrl );
+
+    DiagonalScale( RIGHT, NORMAL, sW, UW );
+    Zero( W );
+    auto WT = W( IR(0,width), ALL );
+    WT = UW;
+    qr::ApplyQ( LEFT, NORMAL, QW, householderScalars, signature, W );
+    if( V.Height() > 0 )
+    {
+        Matrix<Field> VCopy( V );
+        Gemm( NORMAL, NORMAL, Field(1), VCopy, VW, Field(0), V );
+    }
+    return off;
+}
+
+// Pass the blocks to their positions in the next round of the round-robin
+// ordering (see RoundRobin). Each block of X is a contiguous set of columns,
+// so it is sent as a single message.
+template<typename Field>
+void Exchange
+(       Matrix<Field>& X,
+  const vector<Int>& oldWidths,
+  const vector<Int>& newWidths,
+  int rank, Int numPairs, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int ldim = X.Height();
+    const Int oldTopWidth = oldWidths[0];
+    const Int oldBotWidth = oldWidths[1];
+    const Int newTopWidth = newWidths[0];
+    const Int newBotWidth = newWidths[1];
+    const Field* oldTopBuf = X.LockedBuffer();
+    const Field* oldBotBuf = oldTopBuf + ldim*oldTopWidth;
+
+    Matrix<Field> XNew( ldim, newTopWidth+newBotWidth );
+    Field* newTopBuf = XNew.Buffer();
+    Field* newBotBuf = newTopBuf + ldim*newTopWidth;
+
+    vector<mpi::Request<Field>> requests(4);
+    int numRequests = 0;
+    if( rank > 0 )
+        mpi::IRecv
+        ( newTopBuf, ldim*newTopWidth, rank-1, comm,
+          requests[numRequests++] );
+    if( rank < numPairs-1 )
+        mpi::IRecv
+        ( newBotBuf, ldim*newBotWidth, rank+1, comm,
+          requests[numRequests++] );
+    if( rank == 0 )
+        mpi::ISend
+        ( oldBotBuf, ldim*oldBotWidth, rank+1, comm,
+          requests[numRequests++] );
+    else
+    {
+        if( rank < numPairs-1 )
+            mpi::ISend
+            ( oldTopBuf, ldim*oldTopWidth, rank+1, comm,
+              requests[numRequests++] );
+        mpi::ISend
+        ( oldBotBuf, ldim*oldBotWidth, rank-1, comm,
+          requests[numRequests++] );
+    }
+
+    if( rank == 0 )
+        MemCopy( newTopBuf, oldTopBuf, ldim*oldTopWidth );
+    if( rank == numPairs-1 )
+        MemCopy( newBotBuf, oldTopBuf, ldim*oldTopWidth );
+
+    mpi::WaitAll( numRequests, requests.data() );
+    X = XNew;
+}
+
+// On exit, s contains the singular values of W in descending order, the
+// columns of W are overwritten with the corresponding left singular vectors
+// (if 'wantU'; columns with zero singular values are left as zero), and V
+// contains the right singular vectors (if 'wantV')
+template<typename Field>
+void OneSided
+( DistMatrix<Field>& W,
+  vector<Base<Field>>& s,
+  DistMatrix<Field>& V,
+  bool wantU,
+  bool wantV,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = W.Grid();
+    const Int height = W.Height();
+    const Int n = W.Width();
+    const auto& jacobiCtrl = ctrl.jacobiCtrl;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( jacobiCtrl.tol == Real(0) ? n*eps : jacobiCtrl.tol );
+
+    mpi::Comm comm = g.VCComm();
+    const int rank = g.VCRank();
+    const Int numProcs = g.Size();
+    const Int blocksize =
+      Max( Max(jacobiCtrl.blocksize,(n+2*numProcs-1)/(2*numProcs)), Int(1) );
+    Int numBlocks = (n+blocksize-1) / blocksize;
+    if( numBlocks % 2 == 1 )
+        ++numBlocks;
+    const Int numPairs = numBlocks / 2;
+    const bool active = ( rank < numPairs );
+    auto blockWidth =
+      [&]( Int block )
+      { return Max( Min(blocksize,n-block*blocksize), Int(0) ); };
+
+    vector<Int> top(numPairs), bot(numPairs);
+    for( Int q=0; q<numPairs; ++q )
+    {
+        top[q] = 2*q;
+        bot[q] = 2*q+1;
+    }
+    auto localWidths =
+      [&]() -> vector<Int>
+      {
+          if( !active )
+              return vector<Int>{0,0};
+          return vector<Int>{ blockWidth(top[rank]), blockWidth(bot[rank]) };
+      };
+
+    // Gather this process's pair of blocks of W and initialize V to identity
+    // ----------------------------------------------------------------------
+    const Int vHeight = ( wantV ? n : 0 );
+    auto widths = localWidths();
+    auto columnOf =
+      [&]( Int jLoc )
+      {
+          return jLoc < widths[0] ?
+            top[rank]*blocksize + jLoc :
+            bot[rank]*blocksize + (jLoc-widths[0]);
+      };
+    Matrix<Field> X;
+    Zeros( X, height+vHeight, widths[0]+widths[1] );
+    {
+        const Int localWidth = X.Width();
+        W.ReservePulls( height*localWidth );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( Int i=0; i<height; ++i )
+                W.QueuePull( i, columnOf(jLoc) );
+        vector<Field> pullBuf;
+        W.ProcessPullQueue( pullBuf );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            for( Int i=0; i<height; ++i )
+                X(i,jLoc) = pullBuf[i+jLoc*height];
+            if( wantV )
+                X(height+columnOf(jLoc),jLoc) = Field(1);
+        }
+    }
+
+    // Sweep until every pair of columns is numerically orthogonal
+    // ------------------------------------------------------------
+    Timer timer;
+    if( ctrl.time && g.Rank() == 0 )
+        timer.Start();
+    const Int numRounds = 2*numPairs-1;
+    Int sweep=0;
+    for( ; sweep<jacobiCtrl.maxSweeps; ++sweep )
+    {
+        Real maxOff = 0;
+        for( Int round=0; round<numRounds; ++round )
+        {
+            if( active )
+            {
+                const Real off = OrthogonalizePair( X, height, tol, ctrl );
+                maxOff = Max( maxOff, off );
+            }
+            RoundRobin( top, bot );
+            auto newWidths = localWidths();
+            if( active && numPairs > 1 )
+                Exchange( X, widths, newWidths, rank, numPairs, comm );
+            widths = newWidths;
+        }
+        maxOff = mpi::AllReduce( maxOff, mpi::MAX, comm );
+        if( jacobiCtrl.progress && g.Rank() == 0 )
+            Output("Jacobi sweep ",sweep,": max cosine of ",maxOff);
+        if( maxOff <= tol )
+            break;
+    }
+    if( sweep == jacobiCtrl.maxSweeps )
+        RuntimeError
+        ("Jacobi SVD did not converge within ",jacobiCtrl.maxSweeps,
+         " sweeps");
+    if( ctrl.time && g.Rank() == 0 )
+        Output("Jacobi sweeps: ",timer.Stop()," seconds");
+
+    // Sort the column norms of W in descending order
+    // ----------------------------------------------
+    const Int localWidth = X.Width();
+    vector<Real> norms(n,0);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        auto x = X( IR(0,height), IR(jLoc) );
+        norms[columnOf(jLoc)] = FrobeniusNorm( x );
+    }
+    mpi::AllReduce( norms.data(), n, comm );
+    vector<Int> order(n);
+    for( Int j=0; j<n; ++j )
+        order[j] = j;
+    std::stable_sort
+    ( order.begin(), order.end(),
+      [&]( Int j0, Int j1 ) { return norms[j0] > norms[j1]; } );
+    vector<Int> newIndex(n);
+    s.resize( n );
+    for( Int j=0; j<n; ++j )
+    {
+        newIndex[order[j]] = j;
+        s[j] = norms[order[j]];
+    }
+
+    // Scatter the sorted singular vectors
+    // -----------------------------------
+    if( wantU )
+    {
+        Zeros( W, height, n );
+        W.Reserve( height*localWidth );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = columnOf(jLoc);
+            if( norms[j] == Real(0) )
+                continue;
+            for( Int i=0; i<height; ++i )
+                W.QueueUpdate( i, newIndex[j], X(i,jLoc)/norms[j] );
+        }
+        W.ProcessQueues();
+    }
+    if( wantV )
+    {
+        Zeros( V, n, n );
+        V.Reserve( n*localWidth );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = columnOf(jLoc);
+            for( Int i=0; i<n; ++i )
+                V.QueueUpdate( i, newIndex[j], X(height+i,jLoc) );
+        }
+        V.ProcessQueues();
+    }
+}
+
+// Overwrite the (zero) columns of U(:,rank:end) with an orthonormal basis for
+// the orthogonal complement of U(:,0:rank)
+template<typename Field>
+void CompleteBasis( DistMatrix<Field>& U, Int rank )
+{
+    EL_DEBUG_CSE
+    const Int m = U.Height();
+    const Int n = U.Width();
+    if( rank == n )
+        return;
+    auto UL = U( ALL, IR(0,rank) );
+    auto UR = U( ALL, IR(rank,n) );
+    DistMatrix<Field> Z(U.Grid()), Y(U.Grid());
+    Gaussian( Z, m, n-rank );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), UL, Z, Y );
+        Gemm( NORMAL, NORMAL, Field(-1), UL, Y, Field(1), Z );
+    }
+    qr::ExplicitUnitary( Z );
+    UR = Z;
+}
+
+} // namespace jacobi
+
+template<typename Field>
+SVDInfo Jacobi
+( AbstractDistMatrix<Field>& APre,
+  AbstractDistMatrix<Field>& UPre,
+  AbstractDistMatrix<Base<Field>>& sPre,
+  AbstractDistMatrix<Field>& VPre,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    if( m < n )
+    {
+        // Compute the SVD of A^H = V Sigma U^H
+        DistMatrix<Field> AAdj( APre.Grid() );
+        Adjoint( APre, AAdj );
+        auto ctrlAdj( ctrl );
+        ctrlAdj.overwrite = true;
+        ctrlAdj.bidiagSVDCtrl.wantU = ctrl.bidiagSVDCtrl.wantV;
+        ctrlAdj.bidiagSVDCtrl.wantV = ctrl.bidiagSVDCtrl.wantU;
+        return Jacobi( AAdj, VPre, sPre, UPre, ctrlAdj );
+    }
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Grid& g = A.Grid();
+    const SVDApproach approach = ctrl.bidiagSVDCtrl.approach;
+    const bool wantU = ctrl.bidiagSVDCtrl.wantU;
+    const bool wantV = ctrl.bidiagSVDCtrl.wantV;
+
+    // Precondition with a column-pivoted QR decomposition, A Omega^T = Q R
+    // --------------------------------------------------------------------
+    SVDInfo info;
+    Timer timer;
+    DistMatrix<Field,MD,STAR> householderScalars(g);
+    DistMatrix<Real,MD,STAR> signature(g);
+    DistPermutation Omega(g);
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.colPiv = true;
+    if( ctrl.time && g.Rank() == 0 )
+        timer.Start();
+    QR( A, householderScalars, signature, Omega, qrCtrl );
+    if( ctrl.time && g.Rank() == 0 )
+        Output("Jacobi QR preconditioning: ",timer.Stop()," seconds");
+
+    DistMatrix<Field> W(g), VJ(g);
+    auto AT = A( IR(0,n), IR(0,n) );
+    W = AT;
+    MakeTrapezoidal( UPPER, W );
+    vector<Real> sVec;
+    jacobi::OneSided( W, sVec, VJ, wantU, wantV, ctrl );
+
+    Int rank = n;
+    if( approach == COMPACT_SVD )
+    {
+        const Real twoNorm = ( n > 0 ? sVec[0] : Real(0) );
+        const Real thresh =
+          bidiag_svd::APosterioriThreshold( m, n, twoNorm, ctrl.bidiagSVDCtrl );
+        for( Int j=0; j<n; ++j )
+        {
+            if( sVec[j] <= thresh )
+            {
+                rank = j;
+                break;
+            }
+        }
+    }
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> sProx( sPre );
+    auto& s = sProx.Get();
+    s.Resize( rank, 1 );
+    for( Int j=0; j<rank; ++j )
+        s.SetLocal( j, 0, sVec[j] );
+
+    if( ctrl.time && g.Rank() == 0 )
+        timer.Start();
+    if( wantU )
+    {
+        DistMatrixWriteProxy<Field,Field,MC,MR> UProx( UPre );
+        auto& U = UProx.Get();
+        if( approach == COMPACT_SVD )
+        {
+            Zeros( U, m, rank );
+            auto UT = U( IR(0,n), ALL );
+            UT = W( ALL, IR(0,rank) );
+        }
+        else
+        {
+            Int numNonzero = n;
+            while( numNonzero > 0 && sVec[numNonzero-1] == Real(0) )
+                --numNonzero;
+            jacobi::CompleteBasis( W, numNonzero );
+            if( approach == FULL_SVD )
+                Identity( U, m, m );
+            else
+                Zeros( U, m, n );
+            auto UTL = U( IR(0,n), IR(0,n) );
+            UTL = W;
+        }
+        qr::ApplyQ( LEFT, NORMAL, A, householderScalars, signature, U );
+    }
+    if( wantV )
+    {
+        DistMatrixWriteProxy<Field,Field,MC,MR> VProx( VPre );
+        auto& V = VProx.Get();
+        V = VJ( ALL, IR(0,rank) );
+        Omega.InversePermuteRows( V );
+    }
+    if( ctrl.time && g.Rank() == 0 )
+        Output("Jacobi backtransformation: ",timer.Stop()," seconds");
+
+    return info;
+}
+
+template<typename Field>
+SVDInfo Jacobi
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Field> U(A.Grid()), V(A.Grid());
+    auto ctrlMod( ctrl );
+    ctrlMod.bidiagSVDCtrl.wantU = false;
+    ctrlMod.bidiagSVDCtrl.wantV = false;
+    return Jacobi( A, U, s, V, ctrlMod );
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_JACOBI_HPP
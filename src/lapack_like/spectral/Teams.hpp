@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_TEAMS_HPP
+#define EL_SPECTRAL_TEAMS_HPP
+
+// Several of the spectral drivers (pseudospectra and spectrum slicing) split
+// the processes into equally-sized teams which each hold a copy of the input
+// matrix over their own grid and work on disjoint subproblems.
+
+namespace El {
+
+struct Teams
+{
+    Int numTeams, teamSize, team;
+
+    // A duplicate of the communicator of the full grid
+    mpi::Comm comm;
+
+    // The grid of this process's team
+    unique_ptr<Grid> grid;
+
+    // The rank (within 'comm') of the process with VC rank 'q' in team 't'
+    // is stored in entry t*teamSize+q. Since the team grids are column-major,
+    // the VC rank is also the rank within the team grid's Comm(), which
+    // distributes the rows of sparse matrices and multivectors.
+    vector<int> teamToWorld;
+
+    Teams( const Grid& g, Int teamSizeReq )
+    {
+        EL_DEBUG_CSE
+        mpi::Dup( g.Comm(), comm );
+        const int commSize = mpi::Size( comm );
+        const int commRank = mpi::Rank( comm );
+        teamSize = teamSizeReq;
+        if( teamSize < 1 || commSize % teamSize != 0 )
+            LogicError
+            ("The team size, ",teamSize,", must divide the number of "
+             "processes, ",commSize);
+        numTeams = commSize / teamSize;
+        team = commRank / teamSize;
+
+        mpi::Comm teamComm;
+        mpi::Split( comm, team, commRank, teamComm );
+        grid.reset( new Grid(teamComm) );
+        mpi::Free( teamComm );
+
+        const int teamRank = grid->VCRank();
+        vector<int> teamRanks(commSize);
+        mpi::AllGather( &teamRank, 1, teamRanks.data(), 1, comm );
+        teamToWorld.resize( commSize );
+        for( int q=0; q<commSize; ++q )
+            teamToWorld[(q/teamSize)*teamSize+teamRanks[q]] = q;
+    }
+
+    ~Teams() { mpi::Free( comm ); }
+
+    bool Root() const { return grid->VCRank() == 0; }
+};
+
+// Give each team a copy of A over its own grid
+template<typename T>
+void ReplicateToTeams
+( const DistMatrix<T>& A, const Teams& teams, DistMatrix<T>& ATeam )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    ATeam.SetGrid( *teams.grid );
+    ATeam.Resize( m, n );
+    if( teams.teamSize == 1 )
+    {
+        DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+        ATeam.Matrix() = A_STAR_STAR.LockedMatrix();
+        return;
+    }
+
+    // Compute the send counts
+    // -----------------------
+    const int commSize = mpi::Size( teams.comm );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<int> sendCounts(commSize,0);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int teamOwner = ATeam.Owner( A.GlobalRow(iLoc), j );
+            for( Int t=0; t<teams.numTeams; ++t )
+                ++sendCounts[teams.teamToWorld[t*teams.teamSize+teamOwner]];
+        }
+    }
+
+    // Pack the send data
+    // ------------------
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Entry<T>> sendBuf(totalSend);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            const int teamOwner = ATeam.Owner( i, j );
+            const T value = A.GetLocal(iLoc,jLoc);
+            for( Int t=0; t<teams.numTeams; ++t )
+            {
+                const int owner = teams.teamToWorld[t*teams.teamSize+teamOwner];
+                sendBuf[offs[owner]++] = Entry<T>{ i, j, value };
+            }
+        }
+    }
+
+    // Exchange and unpack
+    // -------------------
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, teams.comm );
+    SwapClear( sendBuf );
+    for( const auto& entry : recvBuf )
+        ATeam.SetLocal
+        ( ATeam.LocalRow(entry.i), ATeam.LocalCol(entry.j), entry.value );
+}
+
+// Give each team a copy of the sparse matrix A over its own grid. Since the
+// teams are all of the same size, they share a row distribution, and each
+// entry is sent to the owner of its row within each team.
+template<typename T>
+void ReplicateToTeams
+( const DistSparseMatrix<T>& A,
+  const Teams& teams,
+        DistSparseMatrix<T>& ATeam )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    ATeam.SetGrid( *teams.grid );
+    Zeros( ATeam, n, A.Width() );
+
+    // Compute the send counts
+    // -----------------------
+    const int commSize = mpi::Size( teams.comm );
+    const Int numLocalEntries = A.NumLocalEntries();
+    vector<int> sendCounts(commSize,0);
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const int teamOwner = ATeam.RowOwner( A.Row(e) );
+        for( Int t=0; t<teams.numTeams; ++t )
+            ++sendCounts[teams.teamToWorld[t*teams.teamSize+teamOwner]];
+    }
+
+    // Pack the send data
+    // ------------------
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Entry<T>> sendBuf(totalSend);
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int i = A.Row(e);
+        const int teamOwner = ATeam.RowOwner( i );
+        for( Int t=0; t<teams.numTeams; ++t )
+        {
+            const int owner = teams.teamToWorld[t*teams.teamSize+teamOwner];
+            sendBuf[offs[owner]++] = Entry<T>{ i, A.Col(e), A.Value(e) };
+        }
+    }
+
+    // Exchange and unpack
+    // -------------------
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, teams.comm );
+    SwapClear( sendBuf );
+    const Int firstLocalRow = ATeam.FirstLocalRow();
+    ATeam.Reserve( recvBuf.size() );
+    for( const auto& entry : recvBuf )
+        ATeam.QueueLocalUpdate( entry.i-firstLocalRow, entry.j, entry.value );
+    ATeam.ProcessLocalQueues();
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_TEAMS_HPP
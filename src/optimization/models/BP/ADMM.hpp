@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "../../solvers/ADMM.hpp"
 
 // These implementations are adaptations of the solver described at
 //    http://www.stanford.edu/~boyd/papers/admm/basis_pursuit/basis_pursuit.html
@@ -68,82 +69,58 @@ Int ADMM
         Output(" || pinv(A) b ||_1 = ",qOneNorm);
     }
 
+    // x := P*v + q
+    //    = (I-pinv(A)*A) v + q
+    //    = v - pinv(A)*A*v + q
+    // which is independent of rho
+    Matrix<Field> t;
+    auto xUpdate =
+      [&]( const Matrix<Field>& v, const Real& rho, Matrix<Field>& x )
+      {
+          x = v;
+          Gemv( NORMAL, Field(1), A, v, t );
+          if( ctrl.usePinv )
+          {
+              Gemv( NORMAL, Field(1), pinvA, t, s );
+          }
+          else if( m >= n )
+          {
+              Gemv( ADJOINT, Field(1), Q, t, s );
+              Trsv( UPPER, NORMAL, NON_UNIT, R, s );
+          }
+          else
+          {
+              Trsv( LOWER, NORMAL, NON_UNIT, L, t );
+              Gemv( ADJOINT, Field(1), Q, t, s );
+          }
+          x -= s;
+          x += q;
+      };
+    // z := SoftThresh(v,1/rho)
+    auto zUpdate =
+      [&]( const Matrix<Field>& v, const Real& rho, Matrix<Field>& z )
+      { fused::Assign( z, fused::SoftThreshold( fused::Ref(v), 1/rho ) ); };
+    auto monitor =
+      [&]( Int numIter, const Matrix<Field>& x, const Matrix<Field>& z,
+           const Real& rho, const Real& rNorm, const Real& epsPri,
+           const Real& sNorm, const Real& epsDual )
+      {
+          const Real xOneNorm = OneNorm( x );
+          Output
+          (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
+           ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual,
+           ", rho=",rho,", ||x||_1=",xOneNorm);
+      };
+
     // Start the basis pursuit
-    Int numIter=0;
-    Matrix<Field> x, u, t, zOld, xHat;
+    Matrix<Field> x, u;
     Zeros( x, n, 1 );
     Zeros( z, n, 1 );
     Zeros( u, n, 1 );
-    while( numIter < ctrl.maxIter )
-    {
-        zOld = z;
-
-        // x := P*(z-u) + q
-        //    = (I-pinv(A)*A)(z-u) + q
-        //    = (z-u) - pinv(A)*A*(z-u) + q
-        s = z;
-        s -= u;
-        x = s;
-        Gemv( NORMAL, Field(1), A, s, t );
-        if( ctrl.usePinv )
-        {
-            Gemv( NORMAL, Field(1), pinvA, t, s );
-        }
-        else if( m >= n )
-        {
-            Gemv( ADJOINT, Field(1), Q, t, s );
-            Trsv( UPPER, NORMAL, NON_UNIT, R, s );
-        }
-        else
-        {
-            Trsv( LOWER, NORMAL, NON_UNIT, L, t );
-            Gemv( ADJOINT, Field(1), Q, t, s );
-        }
-        x -= s;
-        x += q;
-
-        // xHat := alpha x + (1-alpha) zOld
-        xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := SoftThresh(xHat+u,1/rho)
-        z = xHat;
-        z += u;
-        SoftThreshold( z, 1/ctrl.rho );
-
-        // u := u + (xHat - z)
-        u += xHat;
-        u -= z;
-
-        // rNorm := || x - z ||_2
-        s = x;
-        s -= z;
-        const Real rNorm = FrobeniusNorm( s );
-
-        // sNorm := || rho*(z-zOld) ||_2
-        s = z;
-        s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
-
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
-
-        if( ctrl.progress )
-        {
-            const Real xOneNorm = OneNorm( x );
-            Output
-            (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
-             ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual,
-             ", ||x||_1=",xOneNorm);
-        }
-
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
+    const Int numIter =
+      admm::Run
+      ( xUpdate, zUpdate, monitor, x, z, u,
+        admm::MakeParams<Field>( ctrl, ctrl.progress ) );
     if( ctrl.maxIter == numIter )
         RuntimeError("Basis pursuit failed to converge");
     return numIter;
@@ -212,83 +189,58 @@ Int ADMM
             Output(" || pinv(A) b ||_1 = ",qOneNorm);
     }
 
+    // x := v - pinv(A)*A*v + q (see the sequential implementation)
+    DistMatrix<Field> t(grid);
+    auto xUpdate =
+      [&]( const DistMatrix<Field>& v, const Real& rho, DistMatrix<Field>& x )
+      {
+          x = v;
+          Gemv( NORMAL, Field(1), A, v, t );
+          if( ctrl.usePinv )
+          {
+              Gemv( NORMAL, Field(1), pinvA, t, s );
+          }
+          else if( m >= n )
+          {
+              Gemv( ADJOINT, Field(1), Q, t, s );
+              Trsv( UPPER, NORMAL, NON_UNIT, R, s );
+          }
+          else
+          {
+              Trsv( LOWER, NORMAL, NON_UNIT, L, t );
+              Gemv( ADJOINT, Field(1), Q, t, s );
+          }
+          x -= s;
+          x += q;
+      };
+    // z := SoftThresh(v,1/rho)
+    auto zUpdate =
+      [&]( const DistMatrix<Field>& v, const Real& rho, DistMatrix<Field>& z )
+      { fused::Assign( z, fused::SoftThreshold( fused::Ref(v), 1/rho ) ); };
+    auto monitor =
+      [&]( Int numIter, const DistMatrix<Field>& x, const DistMatrix<Field>& z,
+           const Real& rho, const Real& rNorm, const Real& epsPri,
+           const Real& sNorm, const Real& epsDual )
+      {
+          const Real xOneNorm = OneNorm( x );
+          if( grid.Rank() == 0 )
+              Output
+              (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
+               ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual,
+               ", rho=",rho,", ||x||_1=",xOneNorm);
+      };
+
     // Start the basis pursuit
-    Int numIter=0;
-    DistMatrix<Field> x(grid), u(grid), t(grid), zOld(grid), xHat(grid);
+    DistMatrix<Field> x(grid), u(grid);
+    x.AlignWith( z );
+    u.AlignWith( z );
     Zeros( x, n, 1 );
     Zeros( z, n, 1 );
     Zeros( u, n, 1 );
-    while( numIter < ctrl.maxIter )
-    {
-        zOld = z;
-
-        // x := P*(z-u) + q
-        //    = (I-pinv(A)*A)(z-u) + q
-        //    = (z-u) - pinv(A)*A*(z-u) + q
-        s = z;
-        s -= u;
-        x = s;
-        Gemv( NORMAL, Field(1), A, s, t );
-        if( ctrl.usePinv )
-        {
-            Gemv( NORMAL, Field(1), pinvA, t, s );
-        }
-        else if( m >= n )
-        {
-            Gemv( ADJOINT, Field(1), Q, t, s );
-            Trsv( UPPER, NORMAL, NON_UNIT, R, s );
-        }
-        else
-        {
-            Trsv( LOWER, NORMAL, NON_UNIT, L, t );
-            Gemv( ADJOINT, Field(1), Q, t, s );
-        }
-        x -= s;
-        x += q;
-
-        // xHat := alpha x + (1-alpha) zOld
-        xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := SoftThresh(xHat+u,1/rho)
-        z = xHat;
-        z += u;
-        SoftThreshold( z, 1/ctrl.rho );
-
-        // u := u + (xHat - z)
-        u += xHat;
-        u -= z;
-
-        // rNorm := || x - z ||_2
-        s = x;
-        s -= z;
-        const Real rNorm = FrobeniusNorm( s );
-
-        // sNorm := || rho*(z-zOld) ||_2
-        s = z;
-        s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
-
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
-
-        if( ctrl.progress )
-        {
-            const Real xOneNorm = OneNorm( x );
-            if( grid.Rank() == 0 )
-                Output
-                (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
-                 ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual,
-                 ", ||x||_1=",xOneNorm);
-        }
-
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
+    const Int numIter =
+      admm::Run
+      ( xUpdate, zUpdate, monitor, x, z, u,
+        admm::MakeParams<Field>( ctrl, ctrl.progress ) );
     if( ctrl.maxIter == numIter )
         RuntimeError("Basis pursuit failed to converge");
     return numIter;
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "../../solvers/ADMM.hpp"
 
 // NOTE: While this routine was originally implemented under the name Lasso,
 //       it has been moved into BPDN.
@@ -44,115 +45,71 @@ Int ADMM
     const Int m = A.Height();
     const Int n = A.Width();
 
-    Matrix<Field> P;
+    // Cache a factorization of A^H A + rho I (or A A^H + rho I), or, if rho
+    // is adapted, an eigendecomposition of A^H A (or A A^H)
+    Matrix<Field> G;
     if( m >= n )
-    {
-        Identity( P, n, n );
-        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
-    }
+        Herk( LOWER, ADJOINT, Real(1), A, G );
     else
-    {
-        Identity( P, m, m );
-        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
-    }
-    if( ctrl.inv )
-        HPDInverse( LOWER, P );
-    else
-        Cholesky( LOWER, P );
+        Herk( LOWER, NORMAL, Real(1), A, G );
+    admm::ShiftedHermitianSolver<Matrix<Field>>
+      solver( G, ctrl.rho, ctrl.accelCtrl.adaptiveRho, ctrl.inv );
 
     // Cache w := A^H b
     Matrix<Field> w;
     Gemv( ADJOINT, Field(1), A, b, w );
 
+    // x := (A^H A + rho) \ (A^H b + rho*v)
+    Matrix<Field> s;
+    auto xUpdate =
+      [&]( const Matrix<Field>& v, const Real& rho, Matrix<Field>& x )
+      {
+          x = v;
+          x *= rho;
+          x += w;
+          if( m >= n )
+          {
+              solver.Solve( rho, x );
+          }
+          else
+          {
+              Gemv( NORMAL, Field(1), A, x, s );
+              solver.Solve( rho, s );
+              Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
+              x *= 1/rho;
+          }
+      };
+    // z := SoftThresh(v,lambda/rho)
+    auto zUpdate =
+      [&]( const Matrix<Field>& v, const Real& rho, Matrix<Field>& z )
+      {
+          fused::Assign
+          ( z, fused::SoftThreshold( fused::Ref(v), lambda/rho ) );
+      };
+    auto monitor =
+      [&]( Int numIter, const Matrix<Field>& x, const Matrix<Field>& z,
+           const Real& rho, const Real& rNorm, const Real& epsPri,
+           const Real& sNorm, const Real& epsDual )
+      {
+          Matrix<Field> r( b );
+          Gemv( NORMAL, Field(-1), A, x, Field(1), r );
+          const Real resid = FrobeniusNorm( r );
+          const Real obj = Real(1)/Real(2)*resid*resid + lambda*OneNorm(z);
+          Output
+          (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
+           ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual,
+           ", rho=",rho,", objective=",obj);
+      };
+
     // Start the LASSO
-    Int numIter=0;
-    Matrix<Field> x, u, s, zOld, xHat;
+    Matrix<Field> x, u;
     Zeros( x, n, 1 );
     Zeros( z, n, 1 );
     Zeros( u, n, 1 );
-    while( numIter < ctrl.maxIter )
-    {
-        zOld = z;
-
-        // x := (A^H A + rho) \ (A^H b + rho*(z-u))
-        x = w;
-        Axpy(  ctrl.rho, z, x );
-        Axpy( -ctrl.rho, u, x );
-        if( m >= n )
-        {
-            if( ctrl.inv )
-            {
-                s = x;
-                Hemv( LOWER, Field(1), P, s, Field(0), x );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, x );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
-            }
-        }
-        else
-        {
-            Gemv( NORMAL, Field(1), A, x, s );
-            if( ctrl.inv )
-            {
-                auto t( s );
-                Hemv( LOWER, Field(1), P, t, Field(0), s );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, s );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
-            }
-            Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
-            x *= 1/ctrl.rho;
-        }
-
-        // xHat := alpha x + (1-alpha) zOld
-        xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := SoftThresh(xHat+u,lambda/rho)
-        z = xHat;
-        z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
-
-        // u := u + (xHat - z)
-        u += xHat;
-        u -= z;
-
-        // rNorm := || x - z ||_2
-        s = x;
-        s -= z;
-        const Real rNorm = FrobeniusNorm( s );
-
-        // sNorm := || rho*(z-zOld) ||_2
-        s = z;
-        s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
-
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
-
-        if( ctrl.progress )
-        {
-            s = b;
-            Gemv( NORMAL, Field(-1), A, x, Field(1), s );
-            const Real resid = FrobeniusNorm( s );
-            const Real obj = Real(1)/Real(2)*resid*resid + lambda*OneNorm(z);
-            Output
-            (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
-             ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual,
-             ", objective=",obj);
-        }
-
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
+    const Int numIter =
+      admm::Run
+      ( xUpdate, zUpdate, monitor, x, z, u,
+        admm::MakeParams<Field>( ctrl, ctrl.progress ) );
     if( ctrl.maxIter == numIter )
         RuntimeError("Lasso failed to converge");
     return numIter;
@@ -182,118 +139,76 @@ Int ADMM
     const Int n = A.Width();
     const Grid& g = A.Grid();
 
-    DistMatrix<Field> P(g);
+    // Cache a factorization of A^H A + rho I (or A A^H + rho I), or, if rho
+    // is adapted, an eigendecomposition of A^H A (or A A^H)
+    DistMatrix<Field> G(g);
     if( m >= n )
-    {
-        Identity( P, n, n );
-        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
-    }
+        Herk( LOWER, ADJOINT, Real(1), A, G );
     else
-    {
-        Identity( P, m, m );
-        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
-    }
-    if( ctrl.inv )
-        HPDInverse( LOWER, P );
-    else
-        Cholesky( LOWER, P );
+        Herk( LOWER, NORMAL, Real(1), A, G );
+    admm::ShiftedHermitianSolver<DistMatrix<Field>>
+      solver( G, ctrl.rho, ctrl.accelCtrl.adaptiveRho, ctrl.inv );
 
     // Cache w := A^H b
     DistMatrix<Field> w(g);
     Gemv( ADJOINT, Field(1), A, b, w );
 
+    // x := (A^H A + rho) \ (A^H b + rho*v)
+    DistMatrix<Field> s(g);
+    auto xUpdate =
+      [&]( const DistMatrix<Field>& v, const Real& rho, DistMatrix<Field>& x )
+      {
+          x = v;
+          x *= rho;
+          x += w;
+          if( m >= n )
+          {
+              solver.Solve( rho, x );
+          }
+          else
+          {
+              Gemv( NORMAL, Field(1), A, x, s );
+              solver.Solve( rho, s );
+              Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
+              x *= 1/rho;
+          }
+      };
+    // z := SoftThresh(v,lambda/rho)
+    auto zUpdate =
+      [&]( const DistMatrix<Field>& v, const Real& rho, DistMatrix<Field>& z )
+      {
+          fused::Assign
+          ( z, fused::SoftThreshold( fused::Ref(v), lambda/rho ) );
+      };
+    auto monitor =
+      [&]( Int numIter, const DistMatrix<Field>& x, const DistMatrix<Field>& z,
+           const Real& rho, const Real& rNorm, const Real& epsPri,
+           const Real& sNorm, const Real& epsDual )
+      {
+          DistMatrix<Field> r( b );
+          Gemv( NORMAL, Field(-1), A, x, Field(1), r );
+          const Real resid = FrobeniusNorm( r );
+          const Real obj = Real(1)/Real(2)*resid*resid + lambda*OneNorm(z);
+          if( g.Rank() == 0 )
+          {
+              Output
+              (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
+               ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual,
+               ", rho=",rho,", objective=",obj);
+          }
+      };
+
     // Start the LASSO
-    Int numIter=0;
-    DistMatrix<Field> x(g), u(g), s(g), zOld(g), xHat(g);
+    DistMatrix<Field> x(g), u(g);
+    x.AlignWith( z );
+    u.AlignWith( z );
     Zeros( x, n, 1 );
     Zeros( z, n, 1 );
     Zeros( u, n, 1 );
-    while( numIter < ctrl.maxIter )
-    {
-        zOld = z;
-
-        // x := (A^H A + rho) \ (A^H b + rho*(z-u))
-        x = w;
-        Axpy(  ctrl.rho, z, x );
-        Axpy( -ctrl.rho, u, x );
-        if( m >= n )
-        {
-            if( ctrl.inv )
-            {
-                s = x;
-                Hemv( LOWER, Field(1), P, s, Field(0), x );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, x );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
-            }
-        }
-        else
-        {
-            Gemv( NORMAL, Field(1), A, x, s );
-            if( ctrl.inv )
-            {
-                auto t( s );
-                Hemv( LOWER, Field(1), P, t, Field(0), s );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, s );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
-            }
-            Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
-            x *= 1/ctrl.rho;
-        }
-
-        // xHat := alpha x + (1-alpha) zOld
-        xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := SoftThresh(xHat+u,lambda/rho)
-        z = xHat;
-        z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
-
-        // u := u + (xHat - z)
-        u += xHat;
-        u -= z;
-
-        // rNorm := || x - z ||_2
-        s = x;
-        s -= z;
-        const Real rNorm = FrobeniusNorm( s );
-
-        // sNorm := || rho*(z-zOld) ||_2
-        s = z;
-        s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
-
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
-
-        if( ctrl.progress )
-        {
-            s = b;
-            Gemv( NORMAL, Field(-1), A, x, Field(1), s );
-            const Real resid = FrobeniusNorm( s );
-            const Real obj = Real(1)/Real(2)*resid*resid + lambda*OneNorm(z);
-            if( g.Rank() == 0 )
-            {
-                Output
-                (numIter,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
-                 ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual,
-                 ", objective=",obj);
-            }
-        }
-
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
+    const Int numIter =
+      admm::Run
+      ( xUpdate, zUpdate, monitor, x, z, u,
+        admm::MakeParams<Field>( ctrl, ctrl.progress ) );
     if( ctrl.maxIter == numIter )
         RuntimeError("Lasso failed to converge");
     return numIter;
@@ -10,6 +10,7 @@
 #include "./NNLS/SOCP.hpp"
 #include "./NNLS/QP.hpp"
 #include "./NNLS/ADMM.hpp"
+#include "./NNLS/ActiveSet.hpp"
 
 namespace El {
 
@@ -42,6 +43,13 @@ namespace El {
 // Note that the matrix A^T A is cached amongst all instances
 // (and this caching is the reason NNLS supports X and B as matrices).
 //
+// Active-set formulation
+// ----------------------
+//
+// Solve the KKT conditions of the above QP with the block principal pivoting
+// method, which, for dense matrices with many columns (e.g., within NMF), is
+// much cheaper than the conic formulations.
+//
 
 template<typename Real>
 void NNLS
@@ -55,6 +63,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        nnls::ActiveSet( A, B, X, ctrl.activeSetCtrl );
     else
         nnls::ADMM( A, B, X, ctrl.admmCtrl );
 }
@@ -71,6 +81,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        nnls::ActiveSet( A, B, X, ctrl.activeSetCtrl );
     else
         nnls::ADMM( A, B, X, ctrl.admmCtrl );
 }
@@ -87,6 +99,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        LogicError("Active-set NNLS not yet supported for sparse matrices");
     else
         LogicError("ADMM NNLS not yet supported for sparse matrices");
 }
@@ -103,6 +117,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        LogicError("Active-set NNLS not yet supported for sparse matrices");
     else
         LogicError("ADMM NNLS not yet supported for sparse matrices");
 }
@@ -0,0 +1,352 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace nnls {
+
+// The block principal pivoting method of
+//
+//   Jingu Kim and Haesun Park, "Fast nonnegative matrix factorization: An
+//   active-set-like method and comparisons", SIAM J. Sci. Comput., 33(6),
+//   pp. 3261--3281, 2011,
+//
+// applied to the KKT conditions of each of the problems
+//
+//   min (1/2) x^T G x - c^T x
+//   s.t. x >= 0,
+//
+// where G = A^T A and c = A^T b, i.e.,
+//
+//   y = G x - c, x >= 0, y >= 0, x_i y_i = 0.
+//
+// Each column maintains a passive set F, with x_F = inv(G_FF) c_F and y_F = 0,
+// and exchanges all of its infeasible variables between F and its complement
+// until the number of infeasibilities fails to decrease three consecutive
+// times, at which point only the infeasible variable with the largest index
+// is exchanged (which guarantees finite termination).
+//
+// Since G is shared by all of the columns, the columns with identical passive
+// sets are grouped so that each group requires a single Cholesky factorization
+// of G_FF, and the groups are independent of one another.
+//
+// Variables whose diagonal entry of G is (numerically) zero, i.e., those
+// corresponding to zero columns of A, have no effect upon the objective and
+// are held at zero rather than ever entering a passive set. If the remaining
+// passive columns of A are linearly dependent, then G_FF is regularized by a
+// small multiple of its largest diagonal entry.
+
+namespace active_set {
+
+template<typename Real>
+void SolvePassive
+( const Matrix<Real>& G,
+  const Matrix<Real>& C,
+  const vector<Int>& cols,
+  const char* passive,
+        Matrix<Real>& X,
+        Matrix<Real>& Y )
+{
+    EL_DEBUG_CSE
+    const Int n = G.Height();
+    const Int numCols = cols.size();
+    vector<Int> F, FComp;
+    for( Int i=0; i<n; ++i )
+    {
+        if( passive[i] )
+            F.push_back( i );
+        else
+            FComp.push_back( i );
+    }
+    const Int numPassive = F.size();
+    const Int numActive = FComp.size();
+
+    // X_F := inv(G_FF) C_F
+    Matrix<Real> GFF, XF;
+    if( numPassive > 0 )
+    {
+        GetSubmatrix( G, F, F, GFF );
+        GetSubmatrix( C, F, cols, XF );
+        try { Cholesky( LOWER, GFF ); }
+        catch( NonHPDMatrixException& )
+        {
+            GetSubmatrix( G, F, F, GFF );
+            Real maxDiag = 0;
+            for( Int iSub=0; iSub<numPassive; ++iSub )
+                maxDiag = Max( maxDiag, GFF(iSub,iSub) );
+            ShiftDiagonal
+            ( GFF, Sqrt(limits::Epsilon<Real>())*Max(maxDiag,Real(1)) );
+            Cholesky( LOWER, GFF );
+        }
+        cholesky::SolveAfter( LOWER, NORMAL, GFF, XF );
+    }
+
+    // Y_F' := G_F'F X_F - C_F'
+    Matrix<Real> GFCompF, YFComp;
+    if( numActive > 0 )
+    {
+        GetSubmatrix( C, FComp, cols, YFComp );
+        if( numPassive > 0 )
+        {
+            GetSubmatrix( G, FComp, F, GFCompF );
+            Gemm( NORMAL, NORMAL, Real(1), GFCompF, XF, Real(-1), YFComp );
+        }
+        else
+            YFComp *= Real(-1);
+    }
+
+    for( Int jSub=0; jSub<numCols; ++jSub )
+    {
+        const Int j = cols[jSub];
+        for( Int iSub=0; iSub<numPassive; ++iSub )
+        {
+            X(F[iSub],j) = XF(iSub,jSub);
+            Y(F[iSub],j) = 0;
+        }
+        for( Int iSub=0; iSub<numActive; ++iSub )
+        {
+            X(FComp[iSub],j) = 0;
+            Y(FComp[iSub],j) = YFComp(iSub,jSub);
+        }
+    }
+}
+
+// Returns the number of groups of columns with identical passive sets
+template<typename Real>
+Int SolveGroups
+( const Matrix<Real>& G,
+  const Matrix<Real>& C,
+  const vector<Int>& cols,
+  const vector<char>& passive,
+        Matrix<Real>& X,
+        Matrix<Real>& Y )
+{
+    EL_DEBUG_CSE
+    const Int n = G.Height();
+    auto lessThan =
+      [&]( const Int& j0, const Int& j1 )
+      { return std::lexicographical_compare
+               ( &passive[j0*n], &passive[(j0+1)*n],
+                 &passive[j1*n], &passive[(j1+1)*n] ); };
+    auto equal =
+      [&]( const Int& j0, const Int& j1 )
+      { return std::equal
+               ( &passive[j0*n], &passive[(j0+1)*n], &passive[j1*n] ); };
+
+    vector<Int> sortedCols( cols );
+    std::sort( sortedCols.begin(), sortedCols.end(), lessThan );
+    vector<vector<Int>> groups;
+    for( const Int& j : sortedCols )
+    {
+        if( groups.empty() || !equal(groups.back()[0],j) )
+            groups.push_back( vector<Int>() );
+        groups.back().push_back( j );
+    }
+
+    // Each group writes to a disjoint set of columns of X and Y
+    const Int numGroups = groups.size();
+    vector<char> failed( numGroups, 0 );
+    EL_PARALLEL_FOR
+    for( Int group=0; group<numGroups; ++group )
+    {
+        try
+        {
+            SolvePassive
+            ( G, C, groups[group], &passive[groups[group][0]*n], X, Y );
+        }
+        catch( exception& ) { failed[group] = 1; }
+    }
+    for( Int group=0; group<numGroups; ++group )
+        if( failed[group] )
+            RuntimeError("A passive submatrix of A^T A could not be factored");
+
+    return numGroups;
+}
+
+template<typename Real>
+Int Solve
+( const Matrix<Real>& G,
+  const Matrix<Real>& C,
+        Matrix<Real>& X,
+  const ActiveSetCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = G.Height();
+    const Int numRHS = C.Width();
+
+    // Variables with a (numerically) zero diagonal entry in G are fixed at
+    // zero, as their passive submatrices would otherwise be singular
+    Real maxDiag = 0;
+    for( Int i=0; i<n; ++i )
+        maxDiag = Max( maxDiag, G(i,i) );
+    vector<char> fixed( n );
+    for( Int i=0; i<n; ++i )
+        fixed[i] = ( G(i,i) <= limits::Epsilon<Real>()*maxDiag );
+
+    // Warm-start from the support of X if it is of the correct size (the
+    // solution does not depend upon the initial passive sets)
+    vector<char> passive( n*numRHS, 0 );
+    if( X.Height() == n && X.Width() == numRHS )
+    {
+        for( Int j=0; j<numRHS; ++j )
+            for( Int i=0; i<n; ++i )
+                passive[i+j*n] = ( !fixed[i] && X(i,j) > Real(0) );
+    }
+    X.Resize( n, numRHS );
+    Matrix<Real> Y( n, numRHS );
+
+    vector<Real> tols( numRHS );
+    for( Int j=0; j<numRHS; ++j )
+        tols[j] = ctrl.tol*MaxNorm( C(ALL,IR(j)) );
+
+    vector<Int> unsolved( numRHS );
+    for( Int j=0; j<numRHS; ++j )
+        unsolved[j] = j;
+    SolveGroups( G, C, unsolved, passive, X, Y );
+
+    // The number of consecutive full exchanges allowed without a decrease in
+    // the number of infeasibilities
+    const Int maxFullExchanges = 3;
+    vector<Int> numFullExchanges( numRHS, maxFullExchanges ),
+                minInfeasible( numRHS, n+1 );
+    Int numIter=0;
+    while( true )
+    {
+        vector<Int> stillUnsolved;
+        for( const Int& j : unsolved )
+        {
+            Int numInfeasible=0, lastInfeasible=-1;
+            for( Int i=0; i<n; ++i )
+            {
+                const bool infeasible = !fixed[i] &&
+                  ( passive[i+j*n] ? X(i,j) < Real(0) : Y(i,j) < -tols[j] );
+                if( infeasible )
+                {
+                    ++numInfeasible;
+                    lastInfeasible = i;
+                }
+            }
+            if( numInfeasible == 0 )
+                continue;
+            stillUnsolved.push_back( j );
+
+            bool fullExchange = true;
+            if( numInfeasible < minInfeasible[j] )
+            {
+                minInfeasible[j] = numInfeasible;
+                numFullExchanges[j] = maxFullExchanges;
+            }
+            else if( numFullExchanges[j] > 0 )
+                --numFullExchanges[j];
+            else
+                fullExchange = false;
+
+            if( fullExchange )
+            {
+                for( Int i=0; i<n; ++i )
+                {
+                    const bool infeasible = !fixed[i] &&
+                      ( passive[i+j*n] ?
+                        X(i,j) < Real(0) : Y(i,j) < -tols[j] );
+                    if( infeasible )
+                        passive[i+j*n] = !passive[i+j*n];
+                }
+            }
+            else
+                passive[lastInfeasible+j*n] = !passive[lastInfeasible+j*n];
+        }
+        unsolved.swap( stillUnsolved );
+        if( unsolved.empty() )
+            break;
+        if( numIter == ctrl.maxIter )
+            RuntimeError("Active-set NNLS did not converge");
+        ++numIter;
+
+        const Int numGroups = SolveGroups( G, C, unsolved, passive, X, Y );
+        if( ctrl.progress )
+            Output
+            ("iter ",numIter,": ",unsolved.size()," unsolved columns in ",
+             numGroups," groups");
+    }
+    return numIter;
+}
+
+} // namespace active_set
+
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Int
+ActiveSet
+( const Matrix<Real>& A,
+  const Matrix<Real>& B,
+        Matrix<Real>& X,
+  const ActiveSetCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> G, C;
+    Herk( LOWER, ADJOINT, Real(1), A, G );
+    MakeSymmetric( LOWER, G );
+    Gemm( ADJOINT, NORMAL, Real(1), A, B, C );
+
+    return active_set::Solve( G, C, X, ctrl );
+}
+
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Int
+ActiveSet
+( const AbstractDistMatrix<Real>& APre,
+  const AbstractDistMatrix<Real>& B,
+        AbstractDistMatrix<Real>& XPre,
+  const ActiveSetCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<Real> G(g), C(g);
+    Herk( LOWER, ADJOINT, Real(1), A, G );
+    MakeSymmetric( LOWER, G );
+    Gemm( ADJOINT, NORMAL, Real(1), A, B, C );
+
+    // Every process redundantly stores the (small) Gram matrix and solves the
+    // problems for its own set of full columns
+    DistMatrix<Real,STAR,STAR> G_STAR_STAR( G );
+    DistMatrix<Real,STAR,VR> C_STAR_VR( C );
+    DistMatrix<Real,STAR,VR> X_STAR_VR(g);
+    X_STAR_VR.AlignWith( C_STAR_VR );
+    if( XPre.Height() == C.Height() && XPre.Width() == C.Width() )
+        Copy( XPre, X_STAR_VR );
+    else
+        Zeros( X_STAR_VR, C.Height(), C.Width() );
+
+    // Agree upon failures so that no process is left waiting in a collective
+    Int numIter = 0;
+    string error;
+    try
+    {
+        numIter = active_set::Solve
+          ( G_STAR_STAR.LockedMatrix(), C_STAR_VR.LockedMatrix(),
+            X_STAR_VR.Matrix(), ctrl );
+    }
+    catch( std::exception& e ) { error = e.what(); }
+    const Int numFailed = mpi::AllReduce( Int(!error.empty()), g.Comm() );
+    if( !error.empty() )
+        RuntimeError(error);
+    if( numFailed > 0 )
+        RuntimeError
+        ("Active-set NNLS failed on ",numFailed," other process(es)");
+    Copy( X_STAR_VR, XPre );
+
+    return mpi::AllReduce( numIter, mpi::MAX, g.Comm() );
+}
+
+} // namespace nnls
+} // namespace El
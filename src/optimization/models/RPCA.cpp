@@ -59,7 +59,7 @@ void ADMM
     const Real tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    Matrix<Field> E, Y;
+    Matrix<Field> E, Y, V;
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -79,26 +79,25 @@ void ADMM
         ++numIts;
 
         // ST_{tau/beta}(M - L + Y/beta)
-        S = M;
-        S -= L;
-        Axpy( Field(1)/beta, Y, S );
-        SoftThreshold( S, tau/beta );
+        fused::Assign
+        ( S, fused::SoftThreshold
+             ( fused::Ref(M) - fused::Ref(L) + (Real(1)/beta)*fused::Ref(Y),
+               tau/beta ) );
         const Int numNonzeros = ZeroNorm( S );
 
         // SVT_{1/beta}(M - S + Y/beta)
-        L = M;
-        L -= S;
-        Axpy( Field(1)/beta, Y, L );
+        fused::Assign
+        ( L, fused::Ref(M) - fused::Ref(S) + (Real(1)/beta)*fused::Ref(Y) );
         Int rank;
-        if( ctrl.usePivQR )
+        if( ctrl.useRandomizedSVT )
+            rank = svt::Randomized( L, Real(1)/beta, V, ctrl.randSVTCtrl );
+        else if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
         else
             rank = SVT( L, Real(1)/beta );
 
         // E := M - (L + S)
-        E = M;
-        E -= L;
-        E -= S;
+        fused::Assign( E, fused::Ref(M) - fused::Ref(L) - fused::Ref(S) );
         const Real frobE = FrobeniusNorm( E );
 
         if( frobE/frobM <= tol )
@@ -165,7 +164,7 @@ void ADMM
     const Real tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    DistMatrix<Field> E( M.Grid() ), Y( M.Grid() );
+    DistMatrix<Field> E( M.Grid() ), Y( M.Grid() ), V( M.Grid() );
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -196,7 +195,9 @@ void ADMM
         L -= S;
         Axpy( Field(1)/beta, Y, L );
         Int rank;
-        if( ctrl.usePivQR )
+        if( ctrl.useRandomizedSVT )
+            rank = svt::Randomized( L, Real(1)/beta, V, ctrl.randSVTCtrl );
+        else if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
         else
             rank = SVT( L, Real(1)/beta );
@@ -285,7 +286,7 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    Matrix<Field> LLast, SLast, E;
+    Matrix<Field> LLast, SLast, E, V;
     while( true )
     {
         ++numIts;
@@ -309,7 +310,9 @@ void ALM
             L = M;
             L -= S;
             Axpy( Field(1)/beta, Y, L );
-            if( ctrl.usePivQR )
+            if( ctrl.useRandomizedSVT )
+                rank = svt::Randomized( L, Real(1)/beta, V, ctrl.randSVTCtrl );
+            else if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
             else
                 rank = SVT( L, Real(1)/beta );
@@ -434,7 +437,8 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    DistMatrix<Field> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() );
+    DistMatrix<Field> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() ),
+      V( M.Grid() );
     while( true )
     {
         ++numIts;
@@ -458,7 +462,9 @@ void ALM
             L = M;
             L -= S;
             Axpy( Field(1)/beta, Y, L );
-            if( ctrl.usePivQR )
+            if( ctrl.useRandomizedSVT )
+                rank = svt::Randomized( L, Real(1)/beta, V, ctrl.randSVTCtrl );
+            else if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
             else
                 rank = SVT( L, Real(1)/beta );
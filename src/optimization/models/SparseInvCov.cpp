@@ -35,7 +35,7 @@ Int SparseInvCov
     MakeHermitian( LOWER, S );
 
     Int numIter=0;
-    Matrix<Field> X, U, ZOld, XHat, T;
+    Matrix<Field> X, U, ZOld, XHat;
     Zeros( X, n, n );
     Zeros( Z, n, n );
     Zeros( U, n, n );
@@ -44,10 +44,8 @@ Int SparseInvCov
         ZOld = Z;
 
         // X := rho*(Z-U) - S
-        X = Z;
-        X -= U;
-        X *= ctrl.rho;
-        X -= S;
+        fused::Assign
+        ( X, ctrl.rho*(fused::Ref(Z)-fused::Ref(U)) - fused::Ref(S) );
 
         // X := f(X), f(gamma) = (gamma+sqrt(gamma+4*rho)) / (2*rho)
         auto eigMap =
@@ -60,27 +58,23 @@ Int SparseInvCov
         MakeHermitian( LOWER, X );
 
         // XHat := alpha*X + (1-alpha)*ZOld
-        XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
+        fused::Assign
+        ( XHat, ctrl.alpha*fused::Ref(X) + (1-ctrl.alpha)*fused::Ref(ZOld) );
 
         // Z := SoftThreshold(XHat+U,lambda/rho)
-        Z = XHat;
-        Z += U;
-        SoftThreshold( Z, lambda/ctrl.rho );
+        fused::Assign
+        ( Z, fused::SoftThreshold
+             ( fused::Ref(XHat)+fused::Ref(U), lambda/ctrl.rho ) );
 
         // U := U + (XHat-Z)
-        U += XHat;
-        U -= Z;
+        fused::Assign
+        ( U, fused::Ref(U) + (fused::Ref(XHat)-fused::Ref(Z)) );
 
         // rNorm := || X - Z ||_F
-        T = X;
-        T -= Z;
-        const Real rNorm = FrobeniusNorm(T);
+        const Real rNorm = fused::FrobeniusNorm( fused::Ref(X)-fused::Ref(Z) );
         // sNorm := |rho| || Z - ZOld ||_F
-        T = Z;
-        T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm(T);
+        const Real sNorm =
+          Abs(ctrl.rho)*fused::FrobeniusNorm( fused::Ref(Z)-fused::Ref(ZOld) );
 
         const Real epsPri = n*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
@@ -123,24 +117,30 @@ Int SparseInvCov
     const Grid& g = D.Grid();
     const Int n = D.Width();
 
+    // The fused updates below require all of the iterates to share the
+    // alignments of Z
     DistMatrix<Field> S(g);
+    S.AlignWith( Z );
     Covariance( D, S );
     MakeHermitian( LOWER, S );
 
     Int numIter=0;
-    DistMatrix<Field> X(g), U(g), ZOld(g), XHat(g), T(g);
+    DistMatrix<Field> X(g), U(g), ZOld(g), XHat(g);
+    X.AlignWith( Z );
+    U.AlignWith( Z );
+    ZOld.AlignWith( Z );
+    XHat.AlignWith( Z );
     Zeros( X, n, n );
     Zeros( Z, n, n );
     Zeros( U, n, n );
+    Zeros( XHat, n, n );
     while( numIter < ctrl.maxIter )
     {
         ZOld = Z;
 
         // X := rho*(Z-U) - S
-        X = Z;
-        X -= U;
-        X *= ctrl.rho;
-        X -= S;
+        fused::Assign
+        ( X, ctrl.rho*(fused::Ref(Z)-fused::Ref(U)) - fused::Ref(S) );
 
         // X := f(X), f(gamma) = (gamma+sqrt(gamma+4*rho)) / (2*rho)
         auto eigMap =
@@ -153,27 +153,23 @@ Int SparseInvCov
         MakeHermitian( LOWER, X );
 
         // XHat := alpha*X + (1-alpha)*ZOld
-        XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
+        fused::Assign
+        ( XHat, ctrl.alpha*fused::Ref(X) + (1-ctrl.alpha)*fused::Ref(ZOld) );
 
         // Z := SoftThreshold(XHat+U,lambda/rho)
-        Z = XHat;
-        Z += U;
-        SoftThreshold( Z, lambda/ctrl.rho );
+        fused::Assign
+        ( Z, fused::SoftThreshold
+             ( fused::Ref(XHat)+fused::Ref(U), lambda/ctrl.rho ) );
 
         // U := U + (XHat-Z)
-        U += XHat;
-        U -= Z;
+        fused::Assign
+        ( U, fused::Ref(U) + (fused::Ref(XHat)-fused::Ref(Z)) );
 
         // rNorm := || X - Z ||_F
-        T = X;
-        T -= Z;
-        const Real rNorm = FrobeniusNorm(T);
+        const Real rNorm = fused::FrobeniusNorm( fused::Ref(X)-fused::Ref(Z) );
         // sNorm := |rho| || Z - ZOld ||_F
-        T = Z;
-        T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm(T);
+        const Real sNorm =
+          Abs(ctrl.rho)*fused::FrobeniusNorm( fused::Ref(Z)-fused::Ref(ZOld) );
 
         const Real epsPri = n*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
@@ -18,11 +18,45 @@
 //   min (1/2) || b - x ||_2^2 + lambda 1^T t
 //   s.t. -t <= D x <= t,
 //
-// where x is in R^n and t is in R^(n-1).
+// where x is in R^n and t is in R^(n-1). Without Interior Point Method
+// controls, the problem is instead solved directly via TVProx.
 //
 
 namespace El {
 
+template<typename Real>
+void TV
+( const AbstractDistMatrix<Real>& b,
+        Real lambda,
+        AbstractDistMatrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    Copy( b, x );
+    TVProx( x, lambda );
+}
+
+template<typename Real>
+void TV
+( const Matrix<Real>& b,
+        Real lambda,
+        Matrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    x = b;
+    TVProx( x, lambda );
+}
+
+template<typename Real>
+void TV
+( const DistMultiVec<Real>& b,
+        Real lambda,
+        DistMultiVec<Real>& x )
+{
+    EL_DEBUG_CSE
+    x = b;
+    TVProx( x, lambda );
+}
+
 template<typename Real>
 void TV
 ( const AbstractDistMatrix<Real>& b,
@@ -206,6 +240,18 @@ void TV
 
 #define PROTO(Real) \
   template void TV \
+  ( const AbstractDistMatrix<Real>& b, \
+          Real lambda, \
+          AbstractDistMatrix<Real>& x ); \
+  template void TV \
+  ( const Matrix<Real>& b, \
+          Real lambda, \
+          Matrix<Real>& x ); \
+  template void TV \
+  ( const DistMultiVec<Real>& b, \
+          Real lambda, \
+          DistMultiVec<Real>& x ); \
+  template void TV \
   ( const AbstractDistMatrix<Real>& b, \
           Real lambda, \
           AbstractDistMatrix<Real>& x, \
@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVT_RANDOMIZED_HPP
+#define EL_SVT_RANDOMIZED_HPP
+
+namespace El {
+namespace svt {
+
+// Approximate the dominant singular triplets of A with a randomized subspace
+// iteration whose sample is seeded with the (approximate) right singular
+// vectors returned by the previous call, so that the work is proportional to
+// the rank of the result rather than to min(m,n). If every sampled singular
+// value (other than the oversampling) survives the threshold, then the rank
+// estimate is grown and the iteration is restarted from the current subspace.
+
+template<typename Field>
+Int Randomized
+( Matrix<Field>& A,
+  const Base<Field>& tau,
+  Matrix<Field>& V,
+  const RandomizedSVTCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( V.Height() != n )
+        V.Resize( n, 0 );
+    if( minDim == 0 )
+    {
+        V.Resize( n, 0 );
+        return 0;
+    }
+
+    Int rankEst = ( V.Width() > 0 ? V.Width() : ctrl.initialRank );
+    const Int spare = Max(ctrl.oversample,Int(1));
+
+    Matrix<Field> Omega, Y, Z, B, U, VB;
+    Matrix<Real> s;
+    Int rank;
+    while( true )
+    {
+        const Int numSamples = Min(Max(rankEst,Int(1))+ctrl.oversample,minDim);
+
+        // Omega := [V, Gaussian]
+        Gaussian( Omega, n, numSamples );
+        const Int numWarm = Min(V.Width(),numSamples);
+        if( numWarm > 0 )
+        {
+            auto OmegaWarm = Omega( ALL, IR(0,numWarm) );
+            OmegaWarm = V( ALL, IR(0,numWarm) );
+        }
+
+        // Y := orth((A A^H)^q A Omega)
+        Gemm( NORMAL, NORMAL, Field(1), A, Omega, Y );
+        for( Int it=0; it<ctrl.numPowerIts; ++it )
+        {
+            qr::ExplicitUnitary( Y );
+            Gemm( ADJOINT, NORMAL, Field(1), A, Y, Z );
+            qr::ExplicitUnitary( Z );
+            Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+        }
+        qr::ExplicitUnitary( Y );
+
+        // Y^H A = U diag(s) VB^H
+        Gemm( ADJOINT, NORMAL, Field(1), Y, A, B );
+        SVD( B, U, s, VB );
+        SoftThreshold( s, tau, ctrl.relative );
+        rank = ZeroNorm( s );
+
+        if( numSamples < minDim && rank > numSamples-spare )
+        {
+            rankEst = Max(Int(ctrl.growthFactor*rank),rank+1);
+            V = VB;
+            continue;
+        }
+        break;
+    }
+
+    if( rank == 0 )
+    {
+        Zero( A );
+        V.Resize( n, 0 );
+        return 0;
+    }
+    auto sRank = s( IR(0,rank), ALL );
+    auto URank = U( ALL, IR(0,rank) );
+    auto VRank = VB( ALL, IR(0,rank) );
+    Matrix<Field> YU;
+    Gemm( NORMAL, NORMAL, Field(1), Y, URank, YU );
+    DiagonalScale( RIGHT, NORMAL, sRank, YU );
+    Gemm( NORMAL, ADJOINT, Field(1), YU, VRank, Field(0), A );
+    V = VRank;
+
+    return rank;
+}
+
+template<typename Field>
+Int Randomized
+( AbstractDistMatrix<Field>& APre,
+  const Base<Field>& tau,
+  AbstractDistMatrix<Field>& VPre,
+  const RandomizedSVTCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre ), VProx( VPre );
+    auto& A = AProx.Get();
+    auto& V = VProx.Get();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Grid& g = A.Grid();
+    if( V.Height() != n )
+        V.Resize( n, 0 );
+    if( minDim == 0 )
+    {
+        V.Resize( n, 0 );
+        return 0;
+    }
+
+    Int rankEst = ( V.Width() > 0 ? V.Width() : ctrl.initialRank );
+    const Int spare = Max(ctrl.oversample,Int(1));
+
+    DistMatrix<Field> Omega(g), Y(g), Z(g), B(g), U(g), VB(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    Int rank;
+    while( true )
+    {
+        const Int numSamples = Min(Max(rankEst,Int(1))+ctrl.oversample,minDim);
+
+        // Omega := [V, Gaussian] (aligned with V so that the warm start is a
+        // local copy)
+        Omega.Empty();
+        Omega.AlignWith( V );
+        Gaussian( Omega, n, numSamples );
+        const Int numWarm = Min(V.Width(),numSamples);
+        if( numWarm > 0 )
+        {
+            auto OmegaWarm = Omega( ALL, IR(0,numWarm) );
+            OmegaWarm = V( ALL, IR(0,numWarm) );
+        }
+
+        // Y := orth((A A^H)^q A Omega)
+        Gemm( NORMAL, NORMAL, Field(1), A, Omega, Y );
+        for( Int it=0; it<ctrl.numPowerIts; ++it )
+        {
+            qr::ExplicitUnitary( Y );
+            Gemm( ADJOINT, NORMAL, Field(1), A, Y, Z );
+            qr::ExplicitUnitary( Z );
+            Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+        }
+        qr::ExplicitUnitary( Y );
+
+        // Y^H A = U diag(s) VB^H
+        Gemm( ADJOINT, NORMAL, Field(1), Y, A, B );
+        SVD( B, U, s, VB );
+        SoftThreshold( s, tau, ctrl.relative );
+        rank = ZeroNorm( s );
+
+        if( numSamples < minDim && rank > numSamples-spare )
+        {
+            rankEst = Max(Int(ctrl.growthFactor*rank),rank+1);
+            V = VB;
+            continue;
+        }
+        break;
+    }
+
+    if( rank == 0 )
+    {
+        Zero( A );
+        V.Resize( n, 0 );
+        return 0;
+    }
+    auto sRank = s( IR(0,rank), ALL );
+    auto URank = U( ALL, IR(0,rank) );
+    auto VRank = VB( ALL, IR(0,rank) );
+    DistMatrix<Field> YU(g);
+    Gemm( NORMAL, NORMAL, Field(1), Y, URank, YU );
+    DiagonalScale( RIGHT, NORMAL, sRank, YU );
+    Gemm( NORMAL, ADJOINT, Field(1), YU, VRank, Field(0), A );
+    V = VRank;
+
+    return rank;
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_RANDOMIZED_HPP
@@ -0,0 +1,168 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The direct algorithm of
+//
+//   Laurent Condat, "A direct algorithm for 1D total variation denoising",
+//   IEEE Signal Processing Letters, 20(11), pp. 1054--1057, 2013,
+//
+// which runs a single forward sweep over the signal while maintaining the
+// lower and upper bounds (vMin and vMax) of the value of the current segment
+// of the solution, along with the corresponding values of the dual variable
+// (uMin and uMax). Whenever the bounds become inconsistent, the segment is
+// terminated and the sweep restarts just after it. While the worst-case
+// complexity is quadratic, the complexity is linear in practice.
+
+namespace El {
+
+namespace tv {
+
+template<typename Real>
+void Condat( Int n, const Real* y, Real* x, const Real& lambda )
+{
+    if( n == 0 )
+        return;
+    const Real twoLambda = 2*lambda;
+    Int k=0, k0=0, kMinus=0, kPlus=0;
+    Real uMin=lambda, uMax=-lambda;
+    Real vMin=y[0]-lambda, vMax=y[0]+lambda;
+    while( true )
+    {
+        while( k == n-1 )
+        {
+            if( uMin < Real(0) )
+            {
+                // Terminate a segment at vMin
+                for( ; k0<=kMinus; ++k0 )
+                    x[k0] = vMin;
+                k = kMinus = k0;
+                vMin = y[k0];
+                uMin = lambda;
+                uMax = vMin + uMin - vMax;
+            }
+            else if( uMax > Real(0) )
+            {
+                // Terminate a segment at vMax
+                for( ; k0<=kPlus; ++k0 )
+                    x[k0] = vMax;
+                k = kPlus = k0;
+                vMax = y[k0];
+                uMax = -lambda;
+                uMin = vMax + uMax - vMin;
+            }
+            else
+            {
+                // The last segment
+                vMin += uMin / (k-k0+1);
+                for( ; k0<=k; ++k0 )
+                    x[k0] = vMin;
+                return;
+            }
+        }
+        uMin += y[k+1] - vMin;
+        if( uMin < -lambda )
+        {
+            // Negative jump
+            for( ; k0<=kMinus; ++k0 )
+                x[k0] = vMin;
+            k = kMinus = kPlus = k0;
+            vMin = y[k0];
+            vMax = vMin + twoLambda;
+            uMin = lambda;
+            uMax = -lambda;
+            continue;
+        }
+        uMax += y[k+1] - vMax;
+        if( uMax > lambda )
+        {
+            // Positive jump
+            for( ; k0<=kPlus; ++k0 )
+                x[k0] = vMax;
+            k = kMinus = kPlus = k0;
+            vMax = y[k0];
+            vMin = vMax - twoLambda;
+            uMin = lambda;
+            uMax = -lambda;
+            continue;
+        }
+
+        // Extend the current segment
+        ++k;
+        if( uMin >= lambda )
+        {
+            kMinus = k;
+            vMin += (uMin-lambda) / (kMinus-k0+1);
+            uMin = lambda;
+        }
+        if( uMax <= -lambda )
+        {
+            kPlus = k;
+            vMax += (uMax+lambda) / (kPlus-k0+1);
+            uMax = -lambda;
+        }
+    }
+}
+
+} // namespace tv
+
+template<typename Real>
+void TVProx( Matrix<Real>& A, const Real& lambda )
+{
+    EL_DEBUG_CSE
+    if( lambda < Real(0) )
+        LogicError("lambda must be non-negative");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int ALDim = A.LDim();
+    Real* ABuf = A.Buffer();
+
+    // The columns are independent signals
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        vector<Real> y( ABuf+j*ALDim, ABuf+j*ALDim+m );
+        tv::Condat( m, y.data(), &ABuf[j*ALDim], lambda );
+    }
+}
+
+template<typename Real>
+void TVProx( AbstractDistMatrix<Real>& APre, const Real& lambda )
+{
+    EL_DEBUG_CSE
+    // Give each process a set of full columns
+    DistMatrixReadWriteProxy<Real,Real,STAR,VR> AProx( APre );
+    auto& A = AProx.Get();
+    TVProx( A.Matrix(), lambda );
+}
+
+template<typename Real>
+void TVProx( DistMultiVec<Real>& A, const Real& lambda )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Real,STAR,VR> AFull( A.Grid() );
+    Copy( A, AFull );
+    TVProx( AFull.Matrix(), lambda );
+    Copy( AFull, A );
+}
+
+#define PROTO(Real) \
+  template void TVProx( Matrix<Real>& A, const Real& lambda ); \
+  template void TVProx( AbstractDistMatrix<Real>& A, const Real& lambda ); \
+  template void TVProx( DistMultiVec<Real>& A, const Real& lambda );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
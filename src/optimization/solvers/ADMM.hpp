@@ -0,0 +1,418 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVERS_ADMM_HPP
+#define EL_SOLVERS_ADMM_HPP
+
+// A shared driver for the scaled form of the Alternating Direction Method of
+// Multipliers (see the distributed ADMM article of Boyd et al.) for
+//
+//   min f(x) + g(z) s.t. x = z,
+//
+// which iterates
+//
+//   x    := prox_{f/rho}(z-u),
+//   xHat := alpha x + (1-alpha) z,
+//   z    := prox_{g/rho}(xHat+u),
+//   u    := u + (xHat-z),
+//
+// with residual balancing of rho and optional Anderson acceleration of the
+// fixed-point iteration in (z,u) (see ADMMAccelCtrl).
+
+namespace El {
+namespace admm {
+
+template<typename Field>
+struct Params
+{
+    typedef Base<Field> Real;
+    Real rho, alpha;
+    Int maxIter;
+    Real absTol, relTol;
+    bool progress;
+    ADMMAccelCtrl<Real> accelCtrl;
+};
+
+template<typename Field,class Ctrl>
+Params<Field> MakeParams( const Ctrl& ctrl, bool progress )
+{
+    Params<Field> params;
+    params.rho = ctrl.rho;
+    params.alpha = ctrl.alpha;
+    params.maxIter = ctrl.maxIter;
+    params.absTol = ctrl.absTol;
+    params.relTol = ctrl.relTol;
+    params.progress = progress;
+    params.accelCtrl = ctrl.accelCtrl;
+    return params;
+}
+
+// Type-II Anderson acceleration of the map w := G(w), where w = (z,u)
+template<typename Field,class MatType>
+class Anderson
+{
+public:
+    typedef Base<Field> Real;
+
+    Anderson( Int memory, Real reg ) : memory_(memory), reg_(reg) { }
+
+    void Reset()
+    {
+        last_.clear();
+        dFz_.clear();
+        dFu_.clear();
+        dGz_.clear();
+        dGu_.clear();
+    }
+
+    // Given the previous iterate (zOld,uOld) and its image (z,u), overwrite
+    // (z,u) with the accelerated iterate. The return value is the norm of the
+    // fixed-point residual, (z,u) - (zOld,uOld).
+    Real Update
+    ( const MatType& zOld, const MatType& uOld, MatType& z, MatType& u )
+    {
+        EL_DEBUG_CSE
+        MatType fz( z ), fu( u );
+        fz -= zOld;
+        fu -= uOld;
+        const Real fNorm =
+          Sqrt(Pow(FrobeniusNorm(fz),Real(2))+Pow(FrobeniusNorm(fu),Real(2)));
+
+        if( !last_.empty() )
+        {
+            if( Int(dFz_.size()) == memory_ )
+            {
+                dFz_.erase( dFz_.begin() );
+                dFu_.erase( dFu_.begin() );
+                dGz_.erase( dGz_.begin() );
+                dGu_.erase( dGu_.begin() );
+            }
+            dFz_.push_back( fz );
+            dFz_.back() -= last_[0];
+            dFu_.push_back( fu );
+            dFu_.back() -= last_[1];
+            dGz_.push_back( z );
+            dGz_.back() -= last_[2];
+            dGu_.push_back( u );
+            dGu_.back() -= last_[3];
+            last_.clear();
+        }
+        // Store (f_z,f_u,z,u) for forming the next differences
+        last_.push_back( fz );
+        last_.push_back( fu );
+        last_.push_back( z );
+        last_.push_back( u );
+
+        const Int k = dFz_.size();
+        if( k == 0 )
+            return fNorm;
+
+        // Solve the regularized least-squares problem
+        //   min || f - dF gamma ||_2
+        // through its normal equations
+        Matrix<Field> gram, gamma;
+        Zeros( gram, k, k );
+        Zeros( gamma, k, 1 );
+        Real maxDiag = 0;
+        for( Int i=0; i<k; ++i )
+        {
+            for( Int j=0; j<=i; ++j )
+            {
+                const Field gamma_ij =
+                  HilbertSchmidt( dFz_[i], dFz_[j] ) +
+                  HilbertSchmidt( dFu_[i], dFu_[j] );
+                gram(i,j) = gamma_ij;
+                gram(j,i) = Conj(gamma_ij);
+            }
+            maxDiag = Max( maxDiag, RealPart(gram(i,i)) );
+            gamma(i) = HilbertSchmidt( dFz_[i], fz ) +
+                       HilbertSchmidt( dFu_[i], fu );
+        }
+        if( maxDiag == Real(0) )
+            return fNorm;
+        ShiftDiagonal( gram, Field(reg_*maxDiag) );
+        HPDSolve( LOWER, NORMAL, gram, gamma );
+
+        for( Int i=0; i<k; ++i )
+        {
+            Axpy( -gamma(i), dGz_[i], z );
+            Axpy( -gamma(i), dGu_[i], u );
+        }
+        return fNorm;
+    }
+
+private:
+    Int memory_;
+    Real reg_;
+    vector<MatType> last_, dFz_, dFu_, dGz_, dGu_;
+};
+
+// Run the ADMM from the initial guesses (z,u), where 'x' must be of the same
+// size (and, for distributed matrices, alignments) as 'z' and 'u'.
+//
+// The proximal maps are computed by 'xUpdate(v,rho,x)' and
+// 'zUpdate(v,rho,z)', and, if 'params.progress' is true,
+// 'monitor(numIter,x,z,rho,rNorm,epsPri,sNorm,epsDual)' is called after each
+// iteration. The number of iterations is returned, which is equal to
+// 'params.maxIter' if the method failed to converge.
+template<typename Field,class MatType,
+         class XUpdate,class ZUpdate,class Monitor>
+Int Run
+( const XUpdate& xUpdate,
+  const ZUpdate& zUpdate,
+  const Monitor& monitor,
+        MatType& x,
+        MatType& z,
+        MatType& u,
+  const Params<Field>& params )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const auto& accelCtrl = params.accelCtrl;
+    const Int n = x.Height();
+    const Real sqrtN = Sqrt(Real(n));
+
+    Real rho = params.rho;
+    MatType zOld( z ), uOld( u ), xHat( x ), v( x );
+    Anderson<Field,MatType>
+      anderson( accelCtrl.andersonMemory, accelCtrl.andersonReg );
+    bool accelerated = false;
+    Real fNormLast = 0;
+
+    Int numIter=0;
+    while( numIter < params.maxIter )
+    {
+        zOld = z;
+        uOld = u;
+
+        // x := prox_{f/rho}(z-u)
+        fused::Assign( v, fused::Ref(z)-fused::Ref(u) );
+        xUpdate( v, rho, x );
+
+        // xHat := alpha x + (1-alpha) zOld
+        fused::Assign
+        ( xHat,
+          params.alpha*fused::Ref(x) + (1-params.alpha)*fused::Ref(zOld) );
+
+        // z := prox_{g/rho}(xHat+u)
+        fused::Assign( v, fused::Ref(xHat)+fused::Ref(u) );
+        zUpdate( v, rho, z );
+
+        // u := u + (xHat-z)
+        fused::Assign( u, fused::Ref(u) + (fused::Ref(xHat)-fused::Ref(z)) );
+
+        // rNorm := || x - z ||_F
+        const Real rNorm = fused::FrobeniusNorm( fused::Ref(x)-fused::Ref(z) );
+        // sNorm := |rho| || z - zOld ||_F
+        const Real sNorm =
+          Abs(rho)*fused::FrobeniusNorm( fused::Ref(z)-fused::Ref(zOld) );
+
+        const Real epsPri = sqrtN*params.absTol +
+          params.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+        const Real epsDual = sqrtN*params.absTol +
+          params.relTol*Abs(rho)*FrobeniusNorm(u);
+
+        if( params.progress )
+            monitor( numIter, x, z, rho, rNorm, epsPri, sNorm, epsDual );
+        if( rNorm < epsPri && sNorm < epsDual )
+            break;
+        ++numIter;
+
+        // Balance the primal and dual residuals
+        if( accelCtrl.adaptiveRho && numIter <= accelCtrl.maxAdaptIter )
+        {
+            Real scale = 1;
+            if( rNorm > accelCtrl.balanceRatio*sNorm )
+                scale = accelCtrl.rhoFactor;
+            else if( sNorm > accelCtrl.balanceRatio*rNorm )
+                scale = 1/accelCtrl.rhoFactor;
+            if( scale != Real(1) )
+            {
+                rho *= scale;
+                u *= 1/scale;
+                anderson.Reset();
+                accelerated = false;
+                continue;
+            }
+        }
+
+        if( accelCtrl.andersonMemory > 0 )
+        {
+            // Restart if the last accelerated step was counterproductive
+            MatType zPlain( z ), uPlain( u );
+            const Real fNorm = anderson.Update( zOld, uOld, z, u );
+            if( accelerated && fNorm > accelCtrl.andersonSafeguard*fNormLast )
+            {
+                anderson.Reset();
+                z = zPlain;
+                u = uPlain;
+                accelerated = false;
+            }
+            else
+                accelerated = true;
+            fNormLast = fNorm;
+        }
+    }
+    return numIter;
+}
+
+// Solves (G + rho I) X = B for a fixed Hermitian positive semi-definite G and
+// a varying shift rho. If 'useEig' is true, then G = V diag(w) V^H is
+// computed once so that changes of rho only change a diagonal scaling;
+// otherwise, the Cholesky factor (or, if 'inv' is true, the inverse) of
+// G + rho I is reformed whenever rho changes.
+template<class MatType>
+class ShiftedHermitianSolver;
+
+template<typename Field>
+class ShiftedHermitianSolver<Matrix<Field>>
+{
+public:
+    typedef Base<Field> Real;
+
+    ShiftedHermitianSolver
+    ( const Matrix<Field>& G, Real rho, bool useEig, bool inv )
+    : useEig_(useEig), inv_(inv), G_(G)
+    {
+        EL_DEBUG_CSE
+        if( useEig_ )
+        {
+            Matrix<Field> GCopy( G_ );
+            HermitianEig( LOWER, GCopy, w_, V_ );
+        }
+        else
+            Factor( rho );
+    }
+
+    void Solve( Real rho, Matrix<Field>& B )
+    {
+        EL_DEBUG_CSE
+        if( useEig_ )
+        {
+            Matrix<Field> T;
+            Gemm( ADJOINT, NORMAL, Field(1), V_, B, T );
+            Matrix<Real> d( w_ );
+            Shift( d, rho );
+            DiagonalSolve( LEFT, NORMAL, d, T );
+            Gemm( NORMAL, NORMAL, Field(1), V_, T, Field(0), B );
+            return;
+        }
+        if( rho != rho_ )
+            Factor( rho );
+        if( inv_ )
+        {
+            Matrix<Field> T( B );
+            Hemm( LEFT, LOWER, Field(1), F_, T, Field(0), B );
+        }
+        else
+        {
+            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), F_, B );
+            Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Field(1), F_, B );
+        }
+    }
+
+private:
+    bool useEig_, inv_;
+    Real rho_;
+    Matrix<Field> G_, F_, V_;
+    Matrix<Real> w_;
+
+    void Factor( Real rho )
+    {
+        EL_DEBUG_CSE
+        rho_ = rho;
+        F_ = G_;
+        ShiftDiagonal( F_, Field(rho) );
+        if( inv_ )
+        {
+            HPDInverse( LOWER, F_ );
+        }
+        else
+        {
+            Cholesky( LOWER, F_ );
+            MakeTrapezoidal( LOWER, F_ );
+        }
+    }
+};
+
+template<typename Field>
+class ShiftedHermitianSolver<DistMatrix<Field>>
+{
+public:
+    typedef Base<Field> Real;
+
+    ShiftedHermitianSolver
+    ( const DistMatrix<Field>& G, Real rho, bool useEig, bool inv )
+    : useEig_(useEig), inv_(inv), G_(G), F_(G.Grid()), V_(G.Grid()),
+      w_(G.Grid())
+    {
+        EL_DEBUG_CSE
+        if( useEig_ )
+        {
+            DistMatrix<Field> GCopy( G_ );
+            HermitianEig( LOWER, GCopy, w_, V_ );
+        }
+        else
+            Factor( rho );
+    }
+
+    void Solve( Real rho, DistMatrix<Field>& B )
+    {
+        EL_DEBUG_CSE
+        if( useEig_ )
+        {
+            DistMatrix<Field> T( B.Grid() );
+            Gemm( ADJOINT, NORMAL, Field(1), V_, B, T );
+            DistMatrix<Real,VR,STAR> d( w_ );
+            Shift( d, rho );
+            DiagonalSolve( LEFT, NORMAL, d, T );
+            Gemm( NORMAL, NORMAL, Field(1), V_, T, Field(0), B );
+            return;
+        }
+        if( rho != rho_ )
+            Factor( rho );
+        if( inv_ )
+        {
+            DistMatrix<Field> T( B );
+            Hemm( LEFT, LOWER, Field(1), F_, T, Field(0), B );
+        }
+        else
+        {
+            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), F_, B );
+            Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Field(1), F_, B );
+        }
+    }
+
+private:
+    bool useEig_, inv_;
+    Real rho_;
+    DistMatrix<Field> G_, F_, V_;
+    DistMatrix<Real,VR,STAR> w_;
+
+    void Factor( Real rho )
+    {
+        EL_DEBUG_CSE
+        rho_ = rho;
+        F_ = G_;
+        ShiftDiagonal( F_, Field(rho) );
+        if( inv_ )
+        {
+            HPDInverse( LOWER, F_ );
+        }
+        else
+        {
+            Cholesky( LOWER, F_ );
+            MakeTrapezoidal( LOWER, F_ );
+        }
+    }
+};
+
+} // namespace admm
+} // namespace El
+
+#endif // ifndef EL_SOLVERS_ADMM_HPP
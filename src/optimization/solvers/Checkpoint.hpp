@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVERS_CHECKPOINT_HPP
+#define EL_SOLVERS_CHECKPOINT_HPP
+
+// Periodic checkpointing of the (equilibrated) iterates of the Interior Point
+// Methods, and restarting from them, as configured by MehrotraCtrl
+
+namespace El {
+namespace ipm {
+
+template<typename Real>
+inline mpi::Comm CheckpointComm( const Matrix<Real>& x )
+{ return mpi::COMM_SELF; }
+template<typename Real>
+inline mpi::Comm CheckpointComm( const ElementalMatrix<Real>& x )
+{ return x.Grid().ViewingComm(); }
+template<typename Real>
+inline mpi::Comm CheckpointComm( const DistMultiVec<Real>& x )
+{ return x.Grid().Comm(); }
+
+// Sequential solvers may be run concurrently on several processes, each of
+// which then needs a checkpoint of its own
+template<typename Real,class VectorType>
+inline string CheckpointBasename
+( const MehrotraCtrl<Real>& ctrl, const VectorType& x )
+{ return ctrl.checkpointBasename; }
+template<typename Real>
+inline string CheckpointBasename
+( const MehrotraCtrl<Real>& ctrl, const Matrix<Real>& x )
+{
+    if( mpi::Size(mpi::COMM_WORLD) == 1 )
+        return ctrl.checkpointBasename;
+    return ctrl.checkpointBasename + "-rank" +
+      std::to_string(mpi::Rank(mpi::COMM_WORLD));
+}
+
+template<class VectorType>
+inline void CheckRestartHeight
+( const VectorType& v, Int height, const string& name,
+  const string& basename )
+{
+    if( v.Height() != height || v.Width() != 1 )
+        RuntimeError
+        ("Checkpointed ",name," in ",basename," was ",v.Height()," x ",
+         v.Width()," but the problem requires ",height," x 1");
+}
+
+// If requested (and possible), overwrite x, y, and z (and, for affine cone
+// constraints, s) with the checkpointed iterates and the iteration count.
+// The iterates are required to have the dimensions of the current problem,
+// where x has height n, y has height m, and z (and s) have height k.
+template<typename Real,class VectorType>
+inline bool Restart
+( const MehrotraCtrl<Real>& ctrl, Int& numIts,
+  Int n, Int m, Int k,
+  VectorType& x, VectorType& y, VectorType& z, VectorType* s=nullptr )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.restart )
+        return false;
+    mpi::Comm comm = CheckpointComm( x );
+    const string basename = CheckpointBasename( ctrl, x );
+    if( !CheckpointReader::Exists( basename, comm ) )
+        return false;
+    CheckpointReader checkpoint( basename, comm );
+    if( !checkpoint.Has("x") || !checkpoint.Has("y") || !checkpoint.Has("z") ||
+        (s != nullptr && !checkpoint.Has("s")) )
+        RuntimeError(basename," is not an Interior Point Method checkpoint");
+    checkpoint.Read( "x", x );
+    checkpoint.Read( "y", y );
+    checkpoint.Read( "z", z );
+    CheckRestartHeight( x, n, "x", basename );
+    CheckRestartHeight( y, m, "y", basename );
+    CheckRestartHeight( z, k, "z", basename );
+    if( s != nullptr )
+    {
+        checkpoint.Read( "s", *s );
+        CheckRestartHeight( *s, k, "s", basename );
+    }
+    numIts = checkpoint.State<Int>( "numIts" );
+    if( ctrl.print && mpi::Rank(comm) == 0 )
+        Output("Restarting from iteration ",numIts," of ",basename);
+    return true;
+}
+
+// Write the iterates at the beginning of every 'checkpointFreq'-th iteration
+// other than the first one performed by this run
+template<typename Real,class VectorType>
+inline void Checkpoint
+( const MehrotraCtrl<Real>& ctrl, Int numIts, Int firstIt,
+  const VectorType& x, const VectorType& y, const VectorType& z,
+  const VectorType* s=nullptr )
+{
+    EL_DEBUG_CSE
+    if( ctrl.checkpointFreq <= 0 || numIts == firstIt ||
+        numIts % ctrl.checkpointFreq != 0 )
+        return;
+    CheckpointWriter checkpoint
+    ( CheckpointBasename( ctrl, x ), CheckpointComm(x) );
+    checkpoint.Write( "x", x );
+    checkpoint.Write( "y", y );
+    checkpoint.Write( "z", z );
+    if( s != nullptr )
+        checkpoint.Write( "s", *s );
+    checkpoint.SetState( "numIts", numIts );
+    checkpoint.Commit();
+}
+
+} // namespace ipm
+} // namespace El
+
+#endif // ifndef EL_SOLVERS_CHECKPOINT_HPP
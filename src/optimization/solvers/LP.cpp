@@ -10,6 +10,7 @@
 #include "./LP/direct/IPM.hpp"
 #include "./LP/affine/IPM.hpp"
 #include "./LP/MPS.hpp"
+#include "./Presolve.hpp"
 
 namespace El {
 
@@ -200,10 +201,38 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
-        lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != LP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    const Int n = problem.A.Width();
+    SparseMatrix<Real> Q;
+    Zeros( Q, n, n );
+    auto solve =
+      [&]( const SparseMatrix<Real>& QRed,
+           const SparseMatrix<Real>& ARed,
+           const Matrix<Real>& bRed,
+           const Matrix<Real>& cRed,
+                 Matrix<Real>& xRed,
+                 Matrix<Real>& yRed,
+                 Matrix<Real>& zRed,
+           const MehrotraCtrl<Real>& mehrotraCtrl )
+      {
+          DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> reducedProblem;
+          DirectLPSolution<Matrix<Real>> reducedSolution;
+          reducedProblem.c = cRed;
+          reducedProblem.A = ARed;
+          reducedProblem.b = bRed;
+          lp::direct::Mehrotra
+          ( reducedProblem, reducedSolution, mehrotraCtrl );
+          xRed = reducedSolution.x;
+          yRed = reducedSolution.y;
+          zRed = reducedSolution.z;
+      };
+    if( !presolve::SolveDirect
+         ( Q, problem.A, problem.b, problem.c,
+           solution.x, solution.y, solution.z,
+           ctrl.presolveCtrl, ctrl.mehrotraCtrl, solve ) )
+        lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
 }
 
 // This interface is now deprecated.
@@ -239,10 +268,44 @@ void LP
   const lp::affine::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
-        lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != LP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    const Int n = problem.A.Width();
+    SparseMatrix<Real> Q;
+    Zeros( Q, n, n );
+    auto solve =
+      [&]( const SparseMatrix<Real>& QRed,
+           const SparseMatrix<Real>& ARed,
+           const SparseMatrix<Real>& GRed,
+           const Matrix<Real>& bRed,
+           const Matrix<Real>& cRed,
+           const Matrix<Real>& hRed,
+                 Matrix<Real>& xRed,
+                 Matrix<Real>& yRed,
+                 Matrix<Real>& zRed,
+                 Matrix<Real>& sRed,
+           const MehrotraCtrl<Real>& mehrotraCtrl )
+      {
+          AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> reducedProblem;
+          AffineLPSolution<Matrix<Real>> reducedSolution;
+          reducedProblem.c = cRed;
+          reducedProblem.A = ARed;
+          reducedProblem.b = bRed;
+          reducedProblem.G = GRed;
+          reducedProblem.h = hRed;
+          lp::affine::Mehrotra
+          ( reducedProblem, reducedSolution, mehrotraCtrl );
+          xRed = reducedSolution.x;
+          yRed = reducedSolution.y;
+          zRed = reducedSolution.z;
+          sRed = reducedSolution.s;
+      };
+    if( !presolve::Solve
+         ( Q, problem.A, problem.G, problem.b, problem.c, problem.h,
+           solution.x, solution.y, solution.z, solution.s,
+           ctrl.presolveCtrl, ctrl.mehrotraCtrl, solve ) )
+        lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
 }
 
 // This interface is now deprecated.
@@ -285,10 +348,42 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
-        lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != LP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    const Grid& grid = problem.A.Grid();
+    const Int n = problem.A.Width();
+    DistSparseMatrix<Real> Q(grid);
+    Zeros( Q, n, n );
+    auto solve =
+      [&]( const DistSparseMatrix<Real>& QRed,
+           const DistSparseMatrix<Real>& ARed,
+           const DistMultiVec<Real>& bRed,
+           const DistMultiVec<Real>& cRed,
+                 DistMultiVec<Real>& xRed,
+                 DistMultiVec<Real>& yRed,
+                 DistMultiVec<Real>& zRed,
+           const MehrotraCtrl<Real>& mehrotraCtrl )
+      {
+          DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+            reducedProblem;
+          DirectLPSolution<DistMultiVec<Real>> reducedSolution;
+          ForceSimpleAlignments( reducedProblem, grid );
+          ForceSimpleAlignments( reducedSolution, grid );
+          reducedProblem.c = cRed;
+          reducedProblem.A = ARed;
+          reducedProblem.b = bRed;
+          lp::direct::Mehrotra
+          ( reducedProblem, reducedSolution, mehrotraCtrl );
+          xRed = reducedSolution.x;
+          yRed = reducedSolution.y;
+          zRed = reducedSolution.z;
+      };
+    if( !presolve::SolveDirect
+         ( Q, problem.A, problem.b, problem.c,
+           solution.x, solution.y, solution.z,
+           ctrl.presolveCtrl, ctrl.mehrotraCtrl, solve ) )
+        lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
 }
 
 // This interface is now deprecated.
@@ -329,10 +424,48 @@ void LP
   const lp::affine::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
-        lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != LP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    const Grid& grid = problem.A.Grid();
+    const Int n = problem.A.Width();
+    DistSparseMatrix<Real> Q(grid);
+    Zeros( Q, n, n );
+    auto solve =
+      [&]( const DistSparseMatrix<Real>& QRed,
+           const DistSparseMatrix<Real>& ARed,
+           const DistSparseMatrix<Real>& GRed,
+           const DistMultiVec<Real>& bRed,
+           const DistMultiVec<Real>& cRed,
+           const DistMultiVec<Real>& hRed,
+                 DistMultiVec<Real>& xRed,
+                 DistMultiVec<Real>& yRed,
+                 DistMultiVec<Real>& zRed,
+                 DistMultiVec<Real>& sRed,
+           const MehrotraCtrl<Real>& mehrotraCtrl )
+      {
+          AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+            reducedProblem;
+          AffineLPSolution<DistMultiVec<Real>> reducedSolution;
+          ForceSimpleAlignments( reducedProblem, grid );
+          ForceSimpleAlignments( reducedSolution, grid );
+          reducedProblem.c = cRed;
+          reducedProblem.A = ARed;
+          reducedProblem.b = bRed;
+          reducedProblem.G = GRed;
+          reducedProblem.h = hRed;
+          lp::affine::Mehrotra
+          ( reducedProblem, reducedSolution, mehrotraCtrl );
+          xRed = reducedSolution.x;
+          yRed = reducedSolution.y;
+          zRed = reducedSolution.z;
+          sRed = reducedSolution.s;
+      };
+    if( !presolve::Solve
+         ( Q, problem.A, problem.G, problem.b, problem.c, problem.h,
+           solution.x, solution.y, solution.z, solution.s,
+           ctrl.presolveCtrl, ctrl.mehrotraCtrl, solve ) )
+        lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
 }
 
 // This interface is now deprecated.
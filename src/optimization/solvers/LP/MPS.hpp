@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <unordered_map>
 
 namespace El {
 
@@ -96,10 +97,10 @@ struct MPSMeta
   Int numGreaterRows=0;
   Int numEqualityRows=0;
   Int numNonconstrainingRows=0;
-  std::map<string,MPSRowData> rowDict;
+  std::unordered_map<string,MPSRowData> rowDict;
 
   // From the COLUMNS section
-  std::map<string,MPSVariableData> variableDict;
+  std::unordered_map<string,MPSVariableData> variableDict;
   Int numEqualityEntries=0;
   Int numInequalityEntries=0;
 
@@ -261,9 +262,15 @@ private:
     string token_, rowType_, rowName_, variableName_, boundMark_;
     double value_;
 
-    // For the final loop over the variable dictionary to extract the
-    // nonpositive and nonnegative bounds.
-    typename std::map<string,MPSVariableData>::const_iterator variableIter_;
+    // The dictionaries are hashed, so we separately track the rows and
+    // variables so that the constraints and bounds can be numbered in the
+    // (deterministic) lexicographic order of their names, as they were when
+    // the dictionaries were ordered maps (unordered_map nodes are never moved).
+    vector<std::pair<const string,MPSRowData>*> rowOrder_;
+    vector<std::pair<const string,MPSVariableData>*> variableOrder_;
+
+    // For the final loop over the variables to extract the bounds.
+    Int variableOrderIndex_=0;
 };
 
 MPSReader::MPSReader
@@ -295,6 +302,15 @@ MPSReader::MPSReader
     // comparison. While capital letters are used by convention, they are
     // not required.
     MPSSection section = MPS_NONE;
+    auto addRow =
+      [&]( const string& name, const MPSRowData& rowData )
+      {
+          auto result = meta_.rowDict.insert( std::make_pair(name,rowData) );
+          if( result.second )
+              rowOrder_.push_back( &*result.first );
+          else
+              result.first->second = rowData;
+      };
     string line;
     while( std::getline( file_, line ) )
     {
@@ -400,22 +416,22 @@ MPSReader::MPSReader
             if( rowType == "L" )
             {
                 rowData.type = MPS_LESSER_ROW;
-                meta_.rowDict[rowName] = rowData;
+                addRow( rowName, rowData );
             }
             else if( rowType == "G" )
             {
                 rowData.type = MPS_GREATER_ROW;
-                meta_.rowDict[rowName] = rowData;
+                addRow( rowName, rowData );
             }
             else if( rowType == "E" )
             {
                 rowData.type = MPS_EQUALITY_ROW;
-                meta_.rowDict[rowName] = rowData;
+                addRow( rowName, rowData );
             }
             else if( rowType == "N" )
             {
                 rowData.type = MPS_NONCONSTRAINING_ROW;
-                meta_.rowDict[rowName] = rowData;
+                addRow( rowName, rowData );
                 if( meta_.numNonconstrainingRows == 1 )
                     meta_.costName = rowName;
             }
@@ -432,8 +448,10 @@ MPSReader::MPSReader
             {
                 MPSVariableData variableData;
                 variableData.index = variableCounter++;
-                meta_.variableDict[variableName] = variableData;
-                variableIter = meta_.variableDict.find( variableName );
+                variableIter =
+                  meta_.variableDict.insert
+                  ( std::make_pair(variableName,variableData) ).first;
+                variableOrder_.push_back( &*variableIter );
             }
             MPSVariableData& variableData = variableIter->second;
 
@@ -662,61 +680,76 @@ MPSReader::MPSReader
         meta_.numRHS = 1;
     }
 
-    // Iterate through the row map to delete any empty rows.
-    for( auto iter=meta_.rowDict.begin(); iter!=meta_.rowDict.end(); )
+    // Number the rows and bounds in the lexicographic order of their names.
+    std::sort
+    ( rowOrder_.begin(), rowOrder_.end(),
+      []( const std::pair<const string,MPSRowData>* a,
+          const std::pair<const string,MPSRowData>* b )
+      { return a->first < b->first; } );
+    std::sort
+    ( variableOrder_.begin(), variableOrder_.end(),
+      []( const std::pair<const string,MPSVariableData>* a,
+          const std::pair<const string,MPSVariableData>* b )
+      { return a->first < b->first; } );
+
+    // Iterate through the rows to delete any empty rows.
+    for( auto rowEntry : rowOrder_ )
     {
-        if( iter->second.numNonzeros == 0 )
+        auto& rowData = rowEntry->second;
+        if( rowData.numNonzeros == 0 )
         {
-            if( iter->second.type == MPS_NONCONSTRAINING_ROW )
+            if( rowData.type == MPS_NONCONSTRAINING_ROW )
             {
                 Output("WARNING: Objective was entirely zero.");
-                iter->second.typeIndex = 0;
-                ++iter;
+                rowData.typeIndex = 0;
             }
             else
             {
-                if( iter->second.type == MPS_EQUALITY_ROW )
-                    Output("WARNING: Deleting empty equality row ",iter->first);
-                else if( iter->second.type == MPS_GREATER_ROW )
-                    Output("WARNING: Deleting empty greater row ",iter->first);
-                else if( iter->second.type == MPS_LESSER_ROW )
-                    Output("WARNING: Deleting empty lesser row ",iter->first);
+                const string& emptyName = rowEntry->first;
+                if( rowData.type == MPS_EQUALITY_ROW )
+                    Output("WARNING: Deleting empty equality row ",emptyName);
+                else if( rowData.type == MPS_GREATER_ROW )
+                    Output("WARNING: Deleting empty greater row ",emptyName);
+                else if( rowData.type == MPS_LESSER_ROW )
+                    Output("WARNING: Deleting empty lesser row ",emptyName);
                 else
                     LogicError("Unknown empty row type");
                 // Delete this entry.
-                iter = meta_.rowDict.erase(iter);
+                meta_.rowDict.erase( meta_.rowDict.find(emptyName) );
             }
         }
         else
         {
-            if( iter->second.type == MPS_EQUALITY_ROW )
+            if( rowData.type == MPS_EQUALITY_ROW )
             {
-                iter->second.typeIndex = meta_.numEqualityRows++;
+                rowData.typeIndex = meta_.numEqualityRows++;
             }
-            else if( iter->second.type == MPS_GREATER_ROW )
+            else if( rowData.type == MPS_GREATER_ROW )
             {
-                iter->second.typeIndex = meta_.numGreaterRows++;
+                rowData.typeIndex = meta_.numGreaterRows++;
             }
-            else if( iter->second.type == MPS_LESSER_ROW )
+            else if( rowData.type == MPS_LESSER_ROW )
             {
-                iter->second.typeIndex = meta_.numLesserRows++;
+                rowData.typeIndex = meta_.numLesserRows++;
             }
-            else if( iter->second.type == MPS_NONCONSTRAINING_ROW )
+            else if( rowData.type == MPS_NONCONSTRAINING_ROW )
             {
-                iter->second.typeIndex = 0;
+                rowData.typeIndex = 0;
             }
             else
                 LogicError("Unknown row type");
-            ++iter;
         }
     }
+    // The pointers to any deleted rows are now invalid.
+    rowOrder_.clear();
 
     // Now iterate through the variable map and make use of the requested
     // conventions for counting the number of bounds of each type.
     // Also warn if there are possibly conflicting bound types.
-    for( auto& entry : meta_.variableDict )
+    for( auto variableEntry : variableOrder_ )
     {
-        auto& data = entry.second;
+        const string& varName = variableEntry->first;
+        auto& data = variableEntry->second;
 
         // Handle explicit upper and lower bounds.
         if( data.upperBounded )
@@ -736,7 +769,7 @@ MPSReader::MPSReader
                     data.fixed = true;
                     data.fixedValue = data.upperBound;
                     Output
-                    ("WARNING: Fixing ",entry.first," since the lower and "
+                    ("WARNING: Fixing ",varName," since the lower and "
                      "upper bounds were both ",data.fixedValue);
                 }
                 else
@@ -744,7 +777,7 @@ MPSReader::MPSReader
                     LogicError
                     ("Cannot enforce a lower bound of ",data.lowerBound,
                      " and an upper bound of ",data.upperBound," for ",
-                     entry.first);
+                     varName);
                 }
             }
             else
@@ -771,7 +804,7 @@ MPSReader::MPSReader
                         data.fixed = true;
                         data.fixedValue = 0.;
                         Output
-                        ("WARNING: Fixing ",entry.first,
+                        ("WARNING: Fixing ",varName,
                          " at zero due to zero upper bound. If this is not "
                          "desired, please set "
                          "'keepNonnegativeWithZeroUpperBound=false'");
@@ -783,7 +816,7 @@ MPSReader::MPSReader
                         data.nonnegative = false;
                         Output
                         ("WARNING: Removing default non-negativity of ",
-                         entry.first," due to zero upper bound. If this is "
+                         varName," due to zero upper bound. If this is "
                          "not desired, please set "
                          "'keepNonnegativeWithZeroUpperBound=true'");
                     }
@@ -863,7 +896,7 @@ MPSReader::MPSReader
     // Extract the number of variables
     // (the matrix 'A' is 'm x n' and 'G' is 'k x n').
     meta_.n = meta_.variableDict.size();
-    variableIter_ = meta_.variableDict.cbegin();
+    variableOrderIndex_ = 0;
 
     //
     //   | A0 | x = | b0 |
@@ -1122,9 +1155,9 @@ bool MPSReader::QueuedEntry()
     // Now iterate through the variable map to handle the bounds.
     AffineLPEntry<double> entry;
     while( queuedEntries_.size() == 0 &&
-           variableIter_ != meta_.variableDict.end() )
+           variableOrderIndex_ < Int(variableOrder_.size()) )
     {
-        const auto& data = variableIter_->second;
+        const auto& data = variableOrder_[variableOrderIndex_]->second;
         const Int column = data.index;
 
         if( data.upperBounded )
@@ -1212,7 +1245,7 @@ bool MPSReader::QueuedEntry()
             // There is no need to explicitly set h(row) to zero.
         }
 
-        ++variableIter_;
+        ++variableOrderIndex_;
     }
     return queuedEntries_.size() > 0;
 }
@@ -1233,96 +1266,228 @@ const MPSMeta& MPSReader::Meta() const
     return meta_;
 }
 
-namespace read_mps {
+// A compact binary cache of a parsed MPS file consists of a header (a magic
+// string, a format version, the names, and the integer metadata) followed by
+// one (type,row,column,value) record per entry and a terminating marker.
+// Native endianness is used since the cache is only meant to avoid re-parsing
+// the same MPS file on the same machine.
+namespace mps_cache {
+
+const char magic[8] = {'E','l','M','P','S','B','i','n'};
+const std::int64_t version = 1;
+const unsigned char endMarker = 255;
+
+const vector<Int MPSMeta::*> integerFields =
+{ &MPSMeta::numLesserRows,
+  &MPSMeta::numGreaterRows,
+  &MPSMeta::numEqualityRows,
+  &MPSMeta::numNonconstrainingRows,
+  &MPSMeta::numEqualityEntries,
+  &MPSMeta::numInequalityEntries,
+  &MPSMeta::numUpperBounds,
+  &MPSMeta::numLowerBounds,
+  &MPSMeta::numFixedBounds,
+  &MPSMeta::numFreeBounds,
+  &MPSMeta::numNonpositiveBounds,
+  &MPSMeta::numNonnegativeBounds,
+  &MPSMeta::numRHS,
+  &MPSMeta::m,
+  &MPSMeta::n,
+  &MPSMeta::k,
+  &MPSMeta::equalityOffset,
+  &MPSMeta::fixedOffset,
+  &MPSMeta::lesserOffset,
+  &MPSMeta::greaterOffset,
+  &MPSMeta::upperBoundOffset,
+  &MPSMeta::lowerBoundOffset,
+  &MPSMeta::nonpositiveOffset,
+  &MPSMeta::nonnegativeOffset };
+
+const vector<string MPSMeta::*> stringFields =
+{ &MPSMeta::name,
+  &MPSMeta::costName,
+  &MPSMeta::boundName,
+  &MPSMeta::rhsName };
+
+template<typename T>
+void Write( std::ofstream& file, const T& value )
+{ file.write( reinterpret_cast<const char*>(&value), sizeof(T) ); }
+
+template<typename T>
+void Read( std::ifstream& file, T& value )
+{
+    if( !file.read( reinterpret_cast<char*>(&value), sizeof(T) ) )
+        RuntimeError("The MPS cache was truncated");
+}
 
-template<typename Real>
-void Helper
-( AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem,
-  const string& filename,
-  bool compressed,
-  bool minimize,
-  bool keepNonnegativeWithZeroUpperBound,
-  bool metadataSummary )
+void WriteHeader( std::ofstream& file, const MPSMeta& meta )
 {
     EL_DEBUG_CSE
-    if( compressed )
-        LogicError("Compressed MPS is not yet supported");
+    file.write( magic, sizeof(magic) );
+    Write( file, version );
+    for( auto field : stringFields )
+    {
+        const string& str = meta.*field;
+        Write( file, std::int64_t(str.size()) );
+        file.write( str.data(), str.size() );
+    }
+    for( auto field : integerFields )
+        Write( file, std::int64_t(meta.*field) );
+}
 
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
-    const MPSMeta& meta = reader.Meta();
-    if( metadataSummary )
-        meta.PrintSummary();
+void ReadHeader( std::ifstream& file, MPSMeta& meta )
+{
+    EL_DEBUG_CSE
+    char fileMagic[sizeof(magic)];
+    if( !file.read( fileMagic, sizeof(fileMagic) ) ||
+        !std::equal( fileMagic, fileMagic+sizeof(magic), magic ) )
+        RuntimeError("Not an MPS cache");
+    std::int64_t fileVersion;
+    Read( file, fileVersion );
+    if( fileVersion != version )
+        RuntimeError
+        ("MPS cache version ",fileVersion," is not supported (expected ",
+         version,")");
+    for( auto field : stringFields )
+    {
+        std::int64_t size;
+        Read( file, size );
+        string& str = meta.*field;
+        str.resize( size );
+        if( size > 0 && !file.read( &str[0], size ) )
+            RuntimeError("The MPS cache was truncated");
+    }
+    for( auto field : integerFields )
+    {
+        std::int64_t value;
+        Read( file, value );
+        meta.*field = value;
+    }
+}
 
-    Zeros( problem.c, meta.n, 1 );
-    Zeros( problem.A, meta.m, meta.n );
-    Zeros( problem.b, meta.m, 1 );
-    Zeros( problem.G, meta.k, meta.n );
-    Zeros( problem.h, meta.k, 1 );
-    while( reader.QueuedEntry() )
+} // namespace mps_cache
+
+// Streams the entries of an MPS cache with the same interface as MPSReader.
+class MPSCacheReader
+{
+public:
+    MPSCacheReader( const string& filename );
+
+    bool QueuedEntry();
+    AffineLPEntry<double> GetEntry();
+    const MPSMeta& Meta() const;
+
+private:
+    std::ifstream file_;
+    MPSMeta meta_;
+    bool queued_=false, finished_=false;
+    AffineLPEntry<double> entry_;
+};
+
+MPSCacheReader::MPSCacheReader( const string& filename )
+: file_(filename.c_str(),std::ios::binary)
+{
+    EL_DEBUG_CSE
+    if( !file_.is_open() )
+        RuntimeError("Could not open ",filename);
+    mps_cache::ReadHeader( file_, meta_ );
+    if( meta_.m < 0 || meta_.n < 0 || meta_.k < 0 )
+        RuntimeError
+        ("Invalid MPS cache dimensions: m=",meta_.m,", n=",meta_.n,
+         ", k=",meta_.k);
+}
+
+bool MPSCacheReader::QueuedEntry()
+{
+    EL_DEBUG_CSE
+    if( queued_ )
+        return true;
+    if( finished_ )
+        return false;
+
+    unsigned char type;
+    mps_cache::Read( file_, type );
+    if( type == mps_cache::endMarker )
     {
-        const AffineLPEntry<double> entry = reader.GetEntry();
-        if( entry.type == AFFINE_LP_COST_VECTOR )
-        {
-            if( problem.c(entry.row) != Real(0) )
-                LogicError
-                ("c(",entry.row,") was already ",problem.c(entry.row));
-            problem.c(entry.row) = entry.value;
-        }
-        else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
-        {
-            if( problem.A(entry.row,entry.column) != Real(0) )
-                LogicError
-                ("A(",entry.row,",",entry.column,") was already ",
-                 problem.A(entry.row,entry.column));
-            problem.A(entry.row,entry.column) = entry.value;
-        }
-        else if( entry.type == AFFINE_LP_EQUALITY_VECTOR )
-        {
-            if( problem.b(entry.row) != Real(0) )
-                LogicError
-                ("b(",entry.row,") was already ",problem.b(entry.row));
-            problem.b(entry.row) = entry.value;
-        }
-        else if( entry.type == AFFINE_LP_INEQUALITY_MATRIX )
-        {
-            if( problem.G(entry.row,entry.column) != Real(0) )
-                LogicError
-                ("G(",entry.row,",",entry.column,") was already ",
-                 problem.G(entry.row,entry.column));
-            problem.G(entry.row,entry.column) = entry.value;
-        }
-        else /* entry.type == AFFINE_LP_INEQUALITY_VECTOR */
-        {
-            if( problem.h(entry.row) != Real(0) )
-                LogicError
-                ("h(",entry.row,") was already ",problem.h(entry.row));
-            problem.h(entry.row) = entry.value;
-        }
+        finished_ = true;
+        return false;
     }
+    if( type > AFFINE_LP_INEQUALITY_VECTOR )
+        RuntimeError("Invalid MPS cache entry type ",Int(type));
+    std::int64_t row, column;
+    mps_cache::Read( file_, row );
+    mps_cache::Read( file_, column );
+    mps_cache::Read( file_, entry_.value );
+    entry_.type = static_cast<AffineLPMatrixType>(type);
+
+    // Reject entries which lie outside of the cached dimensions rather than
+    // handing them to the (unchecked) update routines
+    Int height, width;
+    if( entry_.type == AFFINE_LP_COST_VECTOR )
+    {
+        height = meta_.n;
+        width = 1;
+    }
+    else if( entry_.type == AFFINE_LP_EQUALITY_MATRIX )
+    {
+        height = meta_.m;
+        width = meta_.n;
+    }
+    else if( entry_.type == AFFINE_LP_EQUALITY_VECTOR )
+    {
+        height = meta_.m;
+        width = 1;
+    }
+    else if( entry_.type == AFFINE_LP_INEQUALITY_MATRIX )
+    {
+        height = meta_.k;
+        width = meta_.n;
+    }
+    else /* entry_.type == AFFINE_LP_INEQUALITY_VECTOR */
+    {
+        height = meta_.k;
+        width = 1;
+    }
+    if( row < 0 || row >= height || column < 0 || column >= width )
+        RuntimeError
+        ("Invalid MPS cache entry (",row,",",column,") of type ",Int(type),
+         " for a ",height," x ",width," object");
+    entry_.row = row;
+    entry_.column = column;
+    queued_ = true;
+    return true;
 }
 
-template<typename Real>
-void Helper
-( AffineLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem,
-  const string& filename,
-  bool compressed,
-  bool minimize,
-  bool keepNonnegativeWithZeroUpperBound,
-  bool metadataSummary )
+AffineLPEntry<double> MPSCacheReader::GetEntry()
+{
+    EL_DEBUG_CSE
+    if( !queued_ )
+        LogicError("No entries are currently enqueued");
+    queued_ = false;
+    return entry_;
+}
+
+const MPSMeta& MPSCacheReader::Meta() const
 {
     EL_DEBUG_CSE
+    return meta_;
+}
 
-    // TODO(poulson): Consider loading on a single process and then distributing
-    // the results instead.
+namespace read_mps {
 
-    if( compressed )
-        LogicError("Compressed MPS is not yet supported");
+// Every reader sums duplicate entries (e.g., a coefficient which is listed
+// twice within the COLUMNS section), as is done when assembling sparse
+// matrices and distributed vectors from queued updates.
 
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
+template<typename Real,class Reader>
+void Fill
+( AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem,
+  Reader& reader,
+  bool metadataSummary )
+{
+    EL_DEBUG_CSE
     const MPSMeta& meta = reader.Meta();
-    if( metadataSummary && problem.A.Grid().Rank() == 0 )
+    if( metadataSummary )
         meta.PrintSummary();
 
     Zeros( problem.c, meta.n, 1 );
@@ -1330,38 +1495,29 @@ void Helper
     Zeros( problem.b, meta.m, 1 );
     Zeros( problem.G, meta.k, meta.n );
     Zeros( problem.h, meta.k, 1 );
-
     while( reader.QueuedEntry() )
     {
         const AffineLPEntry<double> entry = reader.GetEntry();
         if( entry.type == AFFINE_LP_COST_VECTOR )
-            problem.c.Set( entry.row, 0, entry.value );
+            problem.c(entry.row) += entry.value;
         else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
-            problem.A.Set( entry.row, entry.column, entry.value );
+            problem.A(entry.row,entry.column) += entry.value;
         else if( entry.type == AFFINE_LP_EQUALITY_VECTOR )
-            problem.b.Set( entry.row, 0, entry.value );
+            problem.b(entry.row) += entry.value;
         else if( entry.type == AFFINE_LP_INEQUALITY_MATRIX )
-            problem.G.Set( entry.row, entry.column, entry.value );
+            problem.G(entry.row,entry.column) += entry.value;
         else /* entry.type == AFFINE_LP_INEQUALITY_VECTOR */
-            problem.h.Set( entry.row, 0, entry.value );
+            problem.h(entry.row) += entry.value;
     }
 }
 
-template<typename Real>
-void Helper
+template<typename Real,class Reader>
+void Fill
 ( AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
-  const string& filename,
-  bool compressed,
-  bool minimize,
-  bool keepNonnegativeWithZeroUpperBound,
+  Reader& reader,
   bool metadataSummary )
 {
     EL_DEBUG_CSE
-    if( compressed )
-        LogicError("Compressed MPS is not yet supported");
-
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
     const MPSMeta& meta = reader.Meta();
     if( metadataSummary )
         meta.PrintSummary();
@@ -1378,23 +1534,178 @@ void Helper
     {
         const AffineLPEntry<double> entry = reader.GetEntry();
         if( entry.type == AFFINE_LP_COST_VECTOR )
-            problem.c.Set( entry.row, 0, entry.value );
+            problem.c.Update( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
             problem.A.QueueUpdate( entry.row, entry.column, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_VECTOR )
-            problem.b.Set( entry.row, 0, entry.value );
+            problem.b.Update( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_INEQUALITY_MATRIX )
             problem.G.QueueUpdate( entry.row, entry.column, entry.value );
         else /* entry.type == AFFINE_LP_INEQUALITY_VECTOR */
-            problem.h.Set( entry.row, 0, entry.value );
+            problem.h.Update( entry.row, 0, entry.value );
     }
     problem.A.ProcessQueues();
     problem.G.ProcessQueues();
 }
 
+// For the distributed problems, only the root process parses the file (all
+// other processes pass a null reader). The root queues every entry and a
+// single AllToAll per matrix or vector then routes each entry to its owner.
+//
+// Any error on the root is broadcast before each collective so that every
+// process throws it rather than waiting upon the root.
+
+inline void CheckRootError( const string& error, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    Int length = error.size();
+    mpi::Broadcast( length, 0, comm );
+    if( length == 0 )
+        return;
+    vector<byte> message( error.begin(), error.end() );
+    message.resize( length );
+    mpi::Broadcast( message.data(), length, 0, comm );
+    RuntimeError( string(message.begin(),message.end()) );
+}
+
+template<typename Real,class Reader>
+void Fill
+( AffineLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem,
+  Reader* reader,
+  string error,
+  bool metadataSummary )
+{
+    EL_DEBUG_CSE
+    Int dims[3] = { 0, 0, 0 };
+    if( reader != nullptr )
+    {
+        const MPSMeta& meta = reader->Meta();
+        if( metadataSummary )
+            meta.PrintSummary();
+        dims[0] = meta.m;
+        dims[1] = meta.n;
+        dims[2] = meta.k;
+    }
+    mpi::Comm comm = problem.A.Grid().Comm();
+    CheckRootError( error, comm );
+    mpi::Broadcast( dims, 3, 0, comm );
+    const Int m = dims[0], n = dims[1], k = dims[2];
+
+    Zeros( problem.c, n, 1 );
+    Zeros( problem.A, m, n );
+    Zeros( problem.b, m, 1 );
+    Zeros( problem.G, k, n );
+    Zeros( problem.h, k, 1 );
+
+    if( reader != nullptr )
+    {
+        const MPSMeta& meta = reader->Meta();
+        problem.A.Reserve( meta.numEqualityEntries+meta.numFixedBounds );
+        problem.G.Reserve
+        ( meta.numInequalityEntries+k-meta.upperBoundOffset );
+        try
+        {
+            while( reader->QueuedEntry() )
+            {
+                const AffineLPEntry<double> entry = reader->GetEntry();
+                if( entry.type == AFFINE_LP_COST_VECTOR )
+                    problem.c.QueueUpdate( entry.row, 0, entry.value );
+                else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
+                    problem.A.QueueUpdate
+                    ( entry.row, entry.column, entry.value );
+                else if( entry.type == AFFINE_LP_EQUALITY_VECTOR )
+                    problem.b.QueueUpdate( entry.row, 0, entry.value );
+                else if( entry.type == AFFINE_LP_INEQUALITY_MATRIX )
+                    problem.G.QueueUpdate
+                    ( entry.row, entry.column, entry.value );
+                else /* entry.type == AFFINE_LP_INEQUALITY_VECTOR */
+                    problem.h.QueueUpdate( entry.row, 0, entry.value );
+            }
+        }
+        catch( std::exception& e ) { error = e.what(); }
+    }
+    CheckRootError( error, comm );
+    problem.c.ProcessQueues();
+    problem.A.ProcessQueues();
+    problem.b.ProcessQueues();
+    problem.G.ProcessQueues();
+    problem.h.ProcessQueues();
+}
+
+template<typename Real,class Reader>
+void Fill
+( AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+  Reader* reader,
+  string error,
+  bool metadataSummary )
+{
+    EL_DEBUG_CSE
+    Int dims[3] = { 0, 0, 0 };
+    if( reader != nullptr )
+    {
+        const MPSMeta& meta = reader->Meta();
+        if( metadataSummary )
+            meta.PrintSummary();
+        dims[0] = meta.m;
+        dims[1] = meta.n;
+        dims[2] = meta.k;
+    }
+    const Grid& grid = problem.A.Grid();
+    CheckRootError( error, grid.Comm() );
+    mpi::Broadcast( dims, 3, 0, grid.Comm() );
+    const Int m = dims[0], n = dims[1], k = dims[2];
+
+    Zeros( problem.c, n, 1 );
+    Zeros( problem.A, m, n );
+    Zeros( problem.b, m, 1 );
+    Zeros( problem.G, k, n );
+    Zeros( problem.h, k, 1 );
+
+    if( reader != nullptr )
+    {
+        // The root will locally own roughly 1/p of the entries
+        const MPSMeta& meta = reader->Meta();
+        const Int numAEntries = meta.numEqualityEntries+meta.numFixedBounds;
+        const Int numGEntries =
+          meta.numInequalityEntries+k-meta.upperBoundOffset;
+        const Int commSize = grid.Size();
+        problem.A.Reserve( numAEntries/commSize, numAEntries );
+        problem.G.Reserve( numGEntries/commSize, numGEntries );
+        problem.c.Reserve( n );
+        problem.b.Reserve( m );
+        problem.h.Reserve( k );
+        try
+        {
+            while( reader->QueuedEntry() )
+            {
+                const AffineLPEntry<double> entry = reader->GetEntry();
+                if( entry.type == AFFINE_LP_COST_VECTOR )
+                    problem.c.QueueUpdate( entry.row, 0, entry.value );
+                else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
+                    problem.A.QueueUpdate
+                    ( entry.row, entry.column, entry.value );
+                else if( entry.type == AFFINE_LP_EQUALITY_VECTOR )
+                    problem.b.QueueUpdate( entry.row, 0, entry.value );
+                else if( entry.type == AFFINE_LP_INEQUALITY_MATRIX )
+                    problem.G.QueueUpdate
+                    ( entry.row, entry.column, entry.value );
+                else /* entry.type == AFFINE_LP_INEQUALITY_VECTOR */
+                    problem.h.QueueUpdate( entry.row, 0, entry.value );
+            }
+        }
+        catch( std::exception& e ) { error = e.what(); }
+    }
+    CheckRootError( error, grid.Comm() );
+    problem.c.ProcessQueues();
+    problem.A.ProcessQueues();
+    problem.b.ProcessQueues();
+    problem.G.ProcessQueues();
+    problem.h.ProcessQueues();
+}
+
 template<typename Real>
 void Helper
-( AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+( AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem,
   const string& filename,
   bool compressed,
   bool minimize,
@@ -1403,41 +1714,109 @@ void Helper
 {
     EL_DEBUG_CSE
     if( compressed )
-        LogicError("Compressed MPS is not yet supported");
-
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
-    const MPSMeta& meta = reader.Meta();
-    if( metadataSummary && problem.A.Grid().Rank() == 0 )
-        meta.PrintSummary();
+    {
+        MPSCacheReader reader( filename );
+        Fill( problem, reader, metadataSummary );
+    }
+    else
+    {
+        MPSReader reader
+          ( filename, false, minimize, keepNonnegativeWithZeroUpperBound );
+        Fill( problem, reader, metadataSummary );
+    }
+}
 
-    Zeros( problem.c, meta.n, 1 );
-    Zeros( problem.A, meta.m, meta.n );
-    Zeros( problem.b, meta.m, 1 );
-    Zeros( problem.G, meta.k, meta.n );
-    Zeros( problem.h, meta.k, 1 );
+template<typename Real>
+void Helper
+( AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+  const string& filename,
+  bool compressed,
+  bool minimize,
+  bool keepNonnegativeWithZeroUpperBound,
+  bool metadataSummary )
+{
+    EL_DEBUG_CSE
+    if( compressed )
+    {
+        MPSCacheReader reader( filename );
+        Fill( problem, reader, metadataSummary );
+    }
+    else
+    {
+        MPSReader reader
+          ( filename, false, minimize, keepNonnegativeWithZeroUpperBound );
+        Fill( problem, reader, metadataSummary );
+    }
+}
 
-    bool passive=true;
-    problem.A.Reserve( meta.numEqualityEntries );
-    problem.G.Reserve( meta.numInequalityEntries );
-    while( reader.QueuedEntry() )
+template<class MatrixType,class VectorType>
+void DistHelper
+( AffineLPProblem<MatrixType,VectorType>& problem,
+  const string& filename,
+  bool compressed,
+  bool minimize,
+  bool keepNonnegativeWithZeroUpperBound,
+  bool metadataSummary )
+{
+    EL_DEBUG_CSE
+    // The root's failure to open or parse the file is passed along so that
+    // it can be reported on every process
+    string error;
+    if( problem.A.Grid().Rank() != 0 )
     {
-        const AffineLPEntry<double> entry = reader.GetEntry();
-        if( entry.type == AFFINE_LP_COST_VECTOR )
-            problem.c.Set( entry.row, 0, entry.value );
-        else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
-            problem.A.QueueUpdate
-            ( entry.row, entry.column, entry.value, passive );
-        else if( entry.type == AFFINE_LP_EQUALITY_VECTOR )
-            problem.b.Set( entry.row, 0, entry.value );
-        else if( entry.type == AFFINE_LP_INEQUALITY_MATRIX )
-            problem.G.QueueUpdate
-            ( entry.row, entry.column, entry.value, passive );
-        else /* entry.type == AFFINE_LP_INEQUALITY_VECTOR */
-            problem.h.Set( entry.row, 0, entry.value );
+        Fill
+        ( problem, static_cast<MPSReader*>(nullptr), error, metadataSummary );
+    }
+    else if( compressed )
+    {
+        std::unique_ptr<MPSCacheReader> reader;
+        try { reader.reset( new MPSCacheReader( filename ) ); }
+        catch( std::exception& e ) { error = e.what(); }
+        Fill( problem, reader.get(), error, metadataSummary );
+    }
+    else
+    {
+        std::unique_ptr<MPSReader> reader;
+        try
+        {
+            reader.reset
+            ( new MPSReader
+              ( filename, false, minimize,
+                keepNonnegativeWithZeroUpperBound ) );
+        }
+        catch( std::exception& e ) { error = e.what(); }
+        Fill( problem, reader.get(), error, metadataSummary );
     }
-    problem.A.ProcessLocalQueues();
-    problem.G.ProcessLocalQueues();
+}
+
+template<typename Real>
+void Helper
+( AffineLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem,
+  const string& filename,
+  bool compressed,
+  bool minimize,
+  bool keepNonnegativeWithZeroUpperBound,
+  bool metadataSummary )
+{
+    EL_DEBUG_CSE
+    DistHelper
+    ( problem, filename, compressed,
+      minimize, keepNonnegativeWithZeroUpperBound, metadataSummary );
+}
+
+template<typename Real>
+void Helper
+( AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+  const string& filename,
+  bool compressed,
+  bool minimize,
+  bool keepNonnegativeWithZeroUpperBound,
+  bool metadataSummary )
+{
+    EL_DEBUG_CSE
+    DistHelper
+    ( problem, filename, compressed,
+      minimize, keepNonnegativeWithZeroUpperBound, metadataSummary );
 }
 
 } // namespace read_mps
@@ -1562,10 +1941,30 @@ void WriteMPS
 }
 
 void CompressMPS
-( const string& filename, const string& compressedFilename )
+( const string& filename,
+  const string& compressedFilename,
+  bool minimize,
+  bool keepNonnegativeWithZeroUpperBound )
 {
     EL_DEBUG_CSE
-    LogicError("This routine is not yet written");
+    MPSReader reader
+      ( filename, false, minimize, keepNonnegativeWithZeroUpperBound );
+    std::ofstream file( compressedFilename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",compressedFilename);
+
+    mps_cache::WriteHeader( file, reader.Meta() );
+    while( reader.QueuedEntry() )
+    {
+        const AffineLPEntry<double> entry = reader.GetEntry();
+        mps_cache::Write( file, static_cast<unsigned char>(entry.type) );
+        mps_cache::Write( file, std::int64_t(entry.row) );
+        mps_cache::Write( file, std::int64_t(entry.column) );
+        mps_cache::Write( file, entry.value );
+    }
+    mps_cache::Write( file, mps_cache::endMarker );
+    if( !file )
+        RuntimeError("Could not write ",compressedFilename);
 }
 
 void DecompressMPS
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../Checkpoint.hpp"
+#include "../../../Workspace.hpp"
 
 namespace El {
 
@@ -447,9 +449,18 @@ void EquilibratedMehrotra
         Output("|| h ||_2 = ",hNrm2);
     }
 
+    Int numIts = 0;
+    const bool restarted =
+      ipm::Restart
+      ( ctrl, numIts, n, m, k,
+        solution.x, solution.y, solution.z, &solution.s );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     Initialize
     ( problem, solution,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+      primalInit, dualInit, ctrl.standardInitShift );
 
     Real relError = 1;
     Matrix<Real> J, d;
@@ -483,8 +494,14 @@ void EquilibratedMehrotra
     AffineLPSolution<Matrix<Real>> affineCorrection, correction;
     AffineLPResidual<Matrix<Real>> residual, error;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint
+        ( ctrl, numIts, firstIt,
+          solution.x, solution.y, solution.z, &solution.s );
+
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( solution.s );
@@ -789,9 +806,18 @@ void EquilibratedMehrotra
         }
     }
 
+    Int numIts = 0;
+    const bool restarted =
+      ipm::Restart
+      ( ctrl, numIts, n, m, k,
+        solution.x, solution.y, solution.z, &solution.s );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     Initialize
     ( problem, solution,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+      primalInit, dualInit, ctrl.standardInitShift );
 
     Real relError = 1;
     DistMatrix<Real> J(grid), d(grid);
@@ -830,8 +856,14 @@ void EquilibratedMehrotra
     ForceSimpleAlignments( correction, grid );
 
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint
+        ( ctrl, numIts, firstIt,
+          solution.x, solution.y, solution.z, &solution.s );
+
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( solution.s );
@@ -1168,21 +1200,60 @@ void EquilibratedMehrotra
     }
     regTmp *= origTwoNormEst;
 
+    // Decide whether to reduce to the normal equations
+    // =================================================
+    NormalKKTSystem<Real> normalSystem;
+    bool useNormal = false;
+    if( ctrl.system == NORMAL_KKT )
+    {
+        SparseMatrix<Real> Q;
+        Zeros( Q, n, n );
+        useNormal =
+          NormalKKTStructure( Q, problem.A, problem.G, ctrl, normalSystem );
+        if( !useNormal && ctrl.print )
+            Output("Falling back to the full KKT system");
+    }
+
     // Initialize the static portion of the KKT system
     // ===============================================
     SparseMatrix<Real> JStatic;
-    StaticKKT
-    ( problem.A, problem.G, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm,
-      JStatic, false );
-    JStatic.FreezeSparsity();
-
-    SparseLDLFactorization<Real> sparseLDLFact;
-    Initialize
-    ( problem, solution, JStatic, regTmp,
-      sparseLDLFact,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( !useNormal )
+    {
+        StaticKKT
+        ( problem.A, problem.G, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm,
+          JStatic, false );
+        JStatic.FreezeSparsity();
+    }
 
     Int numIts = 0;
+    const bool restarted =
+      ipm::Restart
+      ( ctrl, numIts, n, m, k,
+        solution.x, solution.y, solution.z, &solution.s );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
+    // Reuse the analysis of the KKT system from the last solve if possible
+    ipm::CheckKKTPattern( ctrl, useNormal ? normalSystem.N : JStatic );
+    SparseLDLFactorization<Real> ownedSparseLDLFact;
+    bool ownedAnalyzed = false;
+    auto& sparseLDLFact =
+      ctrl.workspace ? ctrl.workspace->sparseLDLFact : ownedSparseLDLFact;
+    bool& analyzed =
+      ctrl.workspace ? ctrl.workspace->analyzed : ownedAnalyzed;
+    if( useNormal )
+        qp::affine::Initialize
+        ( normalSystem, problem.b, problem.c, problem.h,
+          solution.x, solution.y, solution.z, solution.s,
+          sparseLDLFact, analyzed,
+          primalInit, dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    else
+        Initialize
+        ( problem, solution, JStatic, regTmp,
+          sparseLDLFact, analyzed,
+          primalInit, dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+
     Real relError = 1;
     Matrix<Real> dInner;
     SparseMatrix<Real> J, JOrig;
@@ -1198,16 +1269,7 @@ void EquilibratedMehrotra
             else
                 Ones( dInner, J.Height(), 1 );
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
-            {
-                const bool hermitian = true;
-                const BisectCtrl bisectCtrl;
-                sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
-            }
-            else
-            {
-                sparseLDLFact.ChangeNonzeroValues( J );
-            }
+            ipm::AnalyzeOrChange( sparseLDLFact, J, analyzed );
             sparseLDLFact.Factor();
         }
         catch(...)
@@ -1245,10 +1307,57 @@ void EquilibratedMehrotra
 
     AffineLPResidual<Matrix<Real>> residual, error;
     AffineLPSolution<Matrix<Real>> affineCorrection, correction;
+    auto attemptToFactorNormal = [&]()
+      {
+        try
+        {
+            NormalKKT( solution.s, solution.z, normalSystem );
+            FactorNormalKKT
+            ( normalSystem, sparseLDLFact, analyzed, ctrl.solveCtrl );
+        }
+        catch(...)
+        {
+            if( relError > ctrl.minTol )
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            return false;
+        }
+        return true;
+      };
+    auto attemptToSolveNormal =
+      [&]( AffineLPSolution<Matrix<Real>>& direction )
+      {
+        try
+        {
+            SolveNormalKKT
+            ( normalSystem, sparseLDLFact,
+              residual.dualEquality,
+              residual.primalEquality,
+              residual.primalConic,
+              residual.dualConic,
+              solution.s, solution.z,
+              direction.x, direction.y, direction.z, direction.s,
+              ctrl.solveCtrl );
+        }
+        catch(...)
+        {
+            if( relError > ctrl.minTol )
+                RuntimeError
+                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            return false;
+        }
+        return true;
+      };
 
     const Int indent = PushIndent();
     for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint
+        ( ctrl, numIts, firstIt,
+          solution.x, solution.y, solution.z, &solution.s );
+
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( solution.s );
@@ -1350,33 +1459,45 @@ void EquilibratedMehrotra
         residual.dualConic = solution.z;
         DiagonalScale( LEFT, NORMAL, solution.s, residual.dualConic );
 
-        // Construct the KKT system
-        // ------------------------
-        JOrig = JStatic;
-        JOrig.FreezeSparsity();
-        FinishKKT( m, n, solution.s, solution.z, JOrig );
-        KKTRHS
-        ( residual.dualEquality,
-          residual.primalEquality,
-          residual.primalConic,
-          residual.dualConic,
-          solution.z, d );
-        J = JOrig;
-        J.FreezeSparsity();
-        UpdateDiagonal( J, Real(1), regTmp );
-
-        // Solve for the direction
-        // -----------------------
-        if( !attemptToFactor(wMaxNorm) )
-            break;
-        if( !attemptToSolve(d) )
-            break;
-        ExpandSolution
-        ( m, n, d, residual.dualConic, solution.s, solution.z,
-          affineCorrection.x,
-          affineCorrection.y,
-          affineCorrection.z,
-          affineCorrection.s );
+        if( useNormal )
+        {
+            // Form, factor, and solve the normal equations
+            // --------------------------------------------
+            if( !attemptToFactorNormal() )
+                break;
+            if( !attemptToSolveNormal(affineCorrection) )
+                break;
+        }
+        else
+        {
+            // Construct the KKT system
+            // ------------------------
+            JOrig = JStatic;
+            JOrig.FreezeSparsity();
+            FinishKKT( m, n, solution.s, solution.z, JOrig );
+            KKTRHS
+            ( residual.dualEquality,
+              residual.primalEquality,
+              residual.primalConic,
+              residual.dualConic,
+              solution.z, d );
+            J = JOrig;
+            J.FreezeSparsity();
+            UpdateDiagonal( J, Real(1), regTmp );
+
+            // Solve for the direction
+            // -----------------------
+            if( !attemptToFactor(wMaxNorm) )
+                break;
+            if( !attemptToSolve(d) )
+                break;
+            ExpandSolution
+            ( m, n, d, residual.dualConic, solution.s, solution.z,
+              affineCorrection.x,
+              affineCorrection.y,
+              affineCorrection.z,
+              affineCorrection.s );
+        }
 
         if( ctrl.checkResiduals && ctrl.print )
         {
@@ -1455,21 +1576,31 @@ void EquilibratedMehrotra
             residual.dualConic += correction.z;
         }
 
-        // Construct the new KKT RHS
-        // -------------------------
-        KKTRHS
-        ( residual.dualEquality,
-          residual.primalEquality,
-          residual.primalConic,
-          residual.dualConic,
-          solution.z, d );
-        // Solve for the proposed step
-        // ---------------------------
-        if( !attemptToSolve(d) )
-            break;
-        ExpandSolution
-        ( m, n, d, residual.dualConic, solution.s, solution.z,
-          correction.x, correction.y, correction.z, correction.s );
+        if( useNormal )
+        {
+            // Solve the normal equations for the proposed step
+            // ------------------------------------------------
+            if( !attemptToSolveNormal(correction) )
+                break;
+        }
+        else
+        {
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS
+            ( residual.dualEquality,
+              residual.primalEquality,
+              residual.primalConic,
+              residual.dualConic,
+              solution.z, d );
+            // Solve for the proposed step
+            // ---------------------------
+            if( !attemptToSolve(d) )
+                break;
+            ExpandSolution
+            ( m, n, d, residual.dualConic, solution.s, solution.z,
+              correction.x, correction.y, correction.z, correction.s );
+        }
 
         // Update the current estimates
         // ============================
@@ -1506,6 +1637,17 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+
+    // Warm-start from the iterates of the last solve sharing the workspace
+    auto modCtrl = ctrl;
+    if( ipm::WarmStart
+        ( ctrl, problem.A.Height(), problem.A.Width(), problem.G.Height(),
+          solution.x, solution.y, solution.z, solution.s ) )
+    {
+        modCtrl.primalInit = true;
+        modCtrl.dualInit = true;
+    }
+
     if( ctrl.outerEquil )
     {
         AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> equilibratedProblem;
@@ -1514,14 +1656,17 @@ void Mehrotra
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution,
-          equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+          equilibration, modCtrl );
+        EquilibratedMehrotra
+        ( equilibratedProblem, equilibratedSolution, modCtrl );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        EquilibratedMehrotra( problem, solution, modCtrl );
     }
+    ipm::StoreIterates
+    ( ctrl, solution.x, solution.y, solution.z, solution.s );
 }
 
 template<typename Real>
@@ -1590,17 +1735,32 @@ void EquilibratedMehrotra
             Output("Imbalance factor of J: ",imbalanceJ);
     }
 
+    Int numIts = 0;
+    const bool restarted =
+      ipm::Restart
+      ( ctrl, numIts, n, m, k,
+        solution.x, solution.y, solution.z, &solution.s );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    DistSparseLDLFactorization<Real> sparseLDLFact;
+    // Reuse the analysis of the KKT system from the last solve if possible
+    ipm::CheckKKTPattern( ctrl, JStatic );
+    DistSparseLDLFactorization<Real> ownedSparseLDLFact;
+    bool ownedAnalyzed = false;
+    auto& sparseLDLFact =
+      ctrl.workspace ? ctrl.workspace->distSparseLDLFact : ownedSparseLDLFact;
+    bool& analyzed =
+      ctrl.workspace ? ctrl.workspace->analyzed : ownedAnalyzed;
     Initialize
     ( problem, solution, JStatic, regTmp,
-      sparseLDLFact,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+      sparseLDLFact, analyzed,
+      primalInit, dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
-    Int numIts = 0;
     Real relError = 1;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
     DistMultiVec<Real> d(grid), w(grid), dInner(grid);
@@ -1619,16 +1779,7 @@ void EquilibratedMehrotra
             if( commRank == 0 && ctrl.time )
                 Output("Equilibration: ",timer.Stop()," secs");
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
-            {
-                const bool hermitian = true;
-                const BisectCtrl bisectCtrl;
-                sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
-            }
-            else
-            {
-                sparseLDLFact.ChangeNonzeroValues( J );
-            }
+            ipm::AnalyzeOrChange( sparseLDLFact, J, analyzed );
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
@@ -1684,6 +1835,12 @@ void EquilibratedMehrotra
     const Int indent = PushIndent();
     for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint
+        ( ctrl, numIts, firstIt,
+          solution.x, solution.y, solution.z, &solution.s );
+
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( solution.s );
@@ -1945,6 +2102,17 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+
+    // Warm-start from the iterates of the last solve sharing the workspace
+    auto modCtrl = ctrl;
+    if( ipm::WarmStart
+        ( ctrl, problem.A.Height(), problem.A.Width(), problem.G.Height(),
+          solution.x, solution.y, solution.z, solution.s ) )
+    {
+        modCtrl.primalInit = true;
+        modCtrl.dualInit = true;
+    }
+
     if( ctrl.outerEquil )
     {
         const Grid& grid = problem.A.Grid();
@@ -1959,14 +2127,17 @@ void Mehrotra
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution,
-          equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+          equilibration, modCtrl );
+        EquilibratedMehrotra
+        ( equilibratedProblem, equilibratedSolution, modCtrl );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        EquilibratedMehrotra( problem, solution, modCtrl );
     }
+    ipm::StoreIterates
+    ( ctrl, solution.x, solution.y, solution.z, solution.s );
 }
 
 #define PROTO(Real) \
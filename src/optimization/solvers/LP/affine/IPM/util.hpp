@@ -32,6 +32,7 @@ void Initialize
   const SparseMatrix<Real>& JStatic,
   const Matrix<Real>& regTmp,
         SparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
   bool primalInit, bool dualInit, bool standardShift,
   const RegSolveCtrl<Real>& solveCtrl );
 template<typename Real>
@@ -41,6 +42,7 @@ void Initialize
   const DistSparseMatrix<Real>& JStatic,
   const DistMultiVec<Real>& regTmp,
         DistSparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
   bool primalInit, bool dualInit, bool standardShift,
   const RegSolveCtrl<Real>& solveCtrl );
 
@@ -101,6 +103,12 @@ void StaticKKT
 
 using qp::affine::FinishKKT;
 
+using qp::affine::NormalKKTSystem;
+using qp::affine::NormalKKTStructure;
+using qp::affine::NormalKKT;
+using qp::affine::FactorNormalKKT;
+using qp::affine::SolveNormalKKT;
+
 using qp::affine::KKTRHS;
 using qp::affine::ExpandCoreSolution;
 using qp::affine::ExpandSolution;
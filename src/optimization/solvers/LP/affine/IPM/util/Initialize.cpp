@@ -327,6 +327,7 @@ void Initialize
   const SparseMatrix<Real>& JStatic,
   const Matrix<Real>& regTmp,
         SparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
   bool primalInit,
   bool dualInit,
   bool standardShift,
@@ -337,7 +338,7 @@ void Initialize
     ( JStatic, regTmp,
       problem.b, problem.c, problem.h,
       solution.x, solution.y, solution.z, solution.s,
-      sparseLDLFact,
+      sparseLDLFact, analyzed,
       primalInit, dualInit, standardShift, solveCtrl );
 }
 
@@ -348,6 +349,7 @@ void Initialize
   const DistSparseMatrix<Real>& JStatic,
   const DistMultiVec<Real>& regTmp,
         DistSparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
   bool primalInit,
   bool dualInit,
   bool standardShift,
@@ -358,7 +360,7 @@ void Initialize
     ( JStatic, regTmp,
       problem.b, problem.c, problem.h,
       solution.x, solution.y, solution.z, solution.s,
-      sparseLDLFact,
+      sparseLDLFact, analyzed,
       primalInit, dualInit, standardShift, solveCtrl );
 }
 
@@ -381,6 +383,7 @@ void Initialize
     const SparseMatrix<Real>& JStatic, \
     const Matrix<Real>& regTmp, \
           SparseLDLFactorization<Real>& sparseLDLFact, \
+    bool& analyzed, \
     bool primalInit, \
     bool dualInit, \
     bool standardShift, \
@@ -391,6 +394,7 @@ void Initialize
     const DistSparseMatrix<Real>& JStatic, \
     const DistMultiVec<Real>& regTmp, \
           DistSparseLDLFactorization<Real>& sparseLDLFact, \
+    bool& analyzed, \
     bool primalInit, \
     bool dualInit, \
     bool standardShift, \
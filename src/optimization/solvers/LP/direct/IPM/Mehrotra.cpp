@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../Checkpoint.hpp"
 
 namespace El {
 
@@ -694,13 +695,27 @@ void EquilibratedMehrotra
 
     const Int indent = PushIndent();
     try {
+    state.numIts = 0;
+    const bool restarted =
+      ipm::Restart
+      ( ctrl, state.numIts, n, problem.A.Height(), n,
+        solution.x, solution.y, solution.z );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = state.numIts;
+
     Initialize
     ( problem, solution,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+      primalInit, dualInit, ctrl.standardInitShift );
     DirectKKTSolver<Real,Matrix<Real>,Matrix<Real>> solver;
     DirectLPSolution<Matrix<Real>> affineCorrection, correction;
-    for( state.numIts=0; state.numIts<ctrl.maxIts; ++state.numIts )
+    for( ; state.numIts<ctrl.maxIts; ++state.numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint
+        ( ctrl, state.numIts, firstIt, solution.x, solution.y, solution.z );
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( solution.x );
@@ -905,9 +920,17 @@ void EquilibratedMehrotra
         }
     }
 
+    Int numIts = 0;
+    const bool restarted =
+      ipm::Restart
+      ( ctrl, numIts, n, m, n, solution.x, solution.y, solution.z );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     Initialize
     ( problem, solution,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+      primalInit, dualInit, ctrl.standardInitShift );
 
     Real muOld = 0.1;
     Real relError = 1;
@@ -949,8 +972,13 @@ void EquilibratedMehrotra
 
     DistMatrix<Real> prod(grid);
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint
+        ( ctrl, numIts, firstIt, solution.x, solution.y, solution.z );
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( solution.x );
@@ -1394,7 +1422,16 @@ void EquilibratedMehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
+    Int numIts = 0;
+    const bool restarted =
+      ipm::Restart
+      ( ctrl, numIts, n, m, n, solution.x, solution.y, solution.z );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     SparseLDLFactorization<Real> sparseLDLFact;
+
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -1402,7 +1439,7 @@ void EquilibratedMehrotra
     {
         Initialize
         ( problem, solution, sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
     else
@@ -1410,7 +1447,7 @@ void EquilibratedMehrotra
         SparseLDLFactorization<Real> augmentedSparseLDLFact;
         Initialize
         ( problem, solution, augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
 
@@ -1452,8 +1489,13 @@ void EquilibratedMehrotra
 
     Matrix<Real> prod;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint
+        ( ctrl, numIts, firstIt, solution.x, solution.y, solution.z );
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( solution.x );
@@ -1586,9 +1628,9 @@ void EquilibratedMehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 &&
+                if( numIts == firstIt &&
                     (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                     (primalInit && dualInit)) )
                 {
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
@@ -1645,7 +1687,7 @@ void EquilibratedMehrotra
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( numIts == firstIt )
                 {
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
@@ -1985,7 +2027,16 @@ void EquilibratedMehrotra
         }
     }
 
+    Int numIts = 0;
+    const bool restarted =
+      ipm::Restart
+      ( ctrl, numIts, n, m, n, solution.x, solution.y, solution.z );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     DistSparseLDLFactorization<Real> sparseLDLFact;
+
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -1995,7 +2046,7 @@ void EquilibratedMehrotra
     {
         Initialize
         ( problem, solution, sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
     else
@@ -2003,7 +2054,7 @@ void EquilibratedMehrotra
         DistSparseLDLFactorization<Real> augmentedSparseLDLFact;
         Initialize
         ( problem, solution, augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
     if( commRank == 0 && ctrl.time )
@@ -2055,8 +2106,13 @@ void EquilibratedMehrotra
 
     DistMultiVec<Real> prod(grid);
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint
+        ( ctrl, numIts, firstIt, solution.x, solution.y, solution.z );
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( solution.x );
@@ -2165,7 +2221,7 @@ void EquilibratedMehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
-            if( numIts == 0 )
+            if( numIts == firstIt )
             {
                 metaOrig = JOrig.InitializeMultMeta();
                 meta = J.InitializeMultMeta();
@@ -2206,9 +2262,9 @@ void EquilibratedMehrotra
                 if( commRank == 0 && ctrl.time )
                     Output("Equilibration: ",timer.Stop()," secs");
 
-                if( numIts == 0 &&
+                if( numIts == firstIt &&
                     (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                     (primalInit && dualInit)) )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
@@ -2271,7 +2327,7 @@ void EquilibratedMehrotra
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
               residual.dualConic, affineCorrection.y );
-            if( numIts == 0 )
+            if( numIts == firstIt )
             {
                 if( ctrl.print )
                 {
@@ -2290,7 +2346,7 @@ void EquilibratedMehrotra
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( numIts == firstIt )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
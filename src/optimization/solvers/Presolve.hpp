@@ -0,0 +1,1323 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVERS_PRESOLVE_HPP
+#define EL_SOLVERS_PRESOLVE_HPP
+
+// Presolve and postsolve for sparse Linear and Quadratic Programs in the
+// affine conic form
+//
+//   min (1/2) x^T Q x + c^T x,
+//   s.t. A x = b, G x + s = h, s >= 0,
+//
+// whose optimality conditions include Q x + c + A^T y + G^T z = 0, z >= 0.
+// Problems in direct conic form are handled with G = -I and h = 0, which the
+// reductions below preserve. Rows of G with a single nonzero are treated as
+// bounds on their variable, and Q is assumed to be explicitly symmetric.
+//
+// Each removal of a row or column is assigned its position in a global
+// sequence, and the reductions which determine a nonzero multiplier or a
+// non-fixed primal value are pushed onto a stack. Postsolve replays the stack
+// in reverse, so that each multiplier is computed from the stationarity of a
+// removed column given the rows and columns which outlived it.
+
+namespace El {
+namespace presolve {
+
+template<typename Real>
+class Presolver
+{
+public:
+    Presolver
+    ( const SparseMatrix<Real>& Q,
+      const SparseMatrix<Real>& A,
+      const SparseMatrix<Real>& G,
+      const Matrix<Real>& b,
+      const Matrix<Real>& c,
+      const Matrix<Real>& h,
+      const PresolveCtrl<Real>& ctrl );
+
+    // Whether or not any rows or columns were removed
+    bool Reduced() const { return sequence_ > 0; }
+
+    // The reduced problem has the same form as the original, but its
+    // objective omits the (constant) contributions of the removed variables
+    void ReducedProblem
+    ( SparseMatrix<Real>& Q,
+      SparseMatrix<Real>& A,
+      SparseMatrix<Real>& G,
+      Matrix<Real>& b,
+      Matrix<Real>& c,
+      Matrix<Real>& h ) const;
+
+    // Recover a primal-dual solution of the original problem from a
+    // primal-dual solution of the reduced problem
+    void Postsolve
+    ( const Matrix<Real>& xRed,
+      const Matrix<Real>& yRed,
+      const Matrix<Real>& zRed,
+      const Matrix<Real>& sRed,
+            Matrix<Real>& x,
+            Matrix<Real>& y,
+            Matrix<Real>& z,
+            Matrix<Real>& s ) const;
+
+private:
+    // Compressed row and column copies of a sparse matrix (without explicit
+    // zeros) with the columns of each row and the rows of each column sorted
+    struct Storage
+    {
+        vector<Int> rowOffsets, rowTargets;
+        vector<Real> rowValues;
+        vector<Int> colOffsets, colSources;
+        vector<Real> colValues;
+    };
+
+    enum RecordType
+    {
+      // A column fixed at a bound (or between two coinciding bounds), whose
+      // residual is absorbed by the multiplier of one of its bounds
+      FIXED_COLUMN,
+      // A row of A with a single nonzero which fixed its column, whose
+      // multiplier absorbs the residual of the column
+      SINGLETON_ROW,
+      // A row whose extreme activity equals its right-hand side and which
+      // therefore fixed all of its columns at bounds
+      FORCING_ROW,
+      // A free column with a single nonzero in a row of A, which was
+      // substituted out of the objective using said row
+      FREE_COLUMN
+    };
+
+    struct Record
+    {
+        RecordType type;
+        Int row=-1;
+        bool rowOfG=false;
+        bool atMin=true;
+        vector<Int> cols;
+        // The multiplier and right-hand side of a substituted row
+        Real multiplier=Real(0), rhs=Real(0);
+    };
+
+    PresolveCtrl<Real> ctrl_;
+    Int n_, mA_, mG_;
+    Storage Q_, A_, G_;
+    vector<Real> b_, c_, h_, hOrig_;
+
+    // The position of each row or column in the removal sequence, or 'kept_'
+    const Int kept_ = std::numeric_limits<Int>::max();
+    Int sequence_=0;
+    vector<Int> colRemoved_, rowARemoved_, rowGRemoved_;
+
+    // The number of nonzeros of each row and column of A and G and of each
+    // column of Q which are in rows and columns that have not been removed
+    vector<Int> rowACount_, rowGCount_, colACount_, colGCount_, colQCount_;
+
+    // The rows of G which provide the tightest bounds of each column (or -1)
+    // along with the coefficient of each bounding row
+    vector<Int> lowerRow_, upperRow_;
+    vector<Real> boundCoef_;
+
+    // The rows of G which were reduced to a single nonzero by a reduction
+    // that has not yet completed. They are only registered as bounds
+    // afterwards, as the multipliers of a forcing row assume that the bounds of
+    // its columns do not change as they are fixed.
+    vector<Int> pendingBounds_;
+
+    // The values (and shifted costs) of the columns at the time of removal
+    vector<Real> xFixed_, cFixed_;
+
+    vector<Record> stack_;
+
+    static void BuildStorage( const SparseMatrix<Real>& A, Storage& S );
+
+    bool RowAKept( Int i ) const { return rowARemoved_[i] == kept_; }
+    bool RowGKept( Int k ) const { return rowGRemoved_[k] == kept_; }
+    bool ColKept( Int j ) const { return colRemoved_[j] == kept_; }
+
+    Real Tolerance( const Real& alpha ) const
+    { return ctrl_.tol*Max(Real(1),Abs(alpha)); }
+    Real Lower( Int j ) const;
+    Real Upper( Int j ) const;
+
+    void RemoveRowA( Int i );
+    void RemoveRowG( Int k );
+    void FixColumn( Int j, const Real& value );
+    void RegisterBound( Int k );
+    void RegisterPendingBounds();
+
+    bool ColumnPass();
+    bool RowPass();
+    bool DuplicateRowPass( bool rowsOfG );
+
+    // The residual of the stationarity condition of a removed column due to
+    // the rows and columns which were removed after it (or kept)
+    Real Residual
+    ( Int j, const Matrix<Real>& x, const Matrix<Real>& y,
+      const Matrix<Real>& z ) const;
+    // Absorb the residual of a removed column into one of its bounds
+    void AbsorbResidual( Int j, const Real& residual, Matrix<Real>& z ) const;
+};
+
+template<typename Real>
+void Presolver<Real>::BuildStorage( const SparseMatrix<Real>& A, Storage& S )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+
+    S.rowOffsets.assign( m+1, 0 );
+    S.colOffsets.assign( n+1, 0 );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        if( A.Value(e) != Real(0) )
+        {
+            ++S.rowOffsets[A.Row(e)+1];
+            ++S.colOffsets[A.Col(e)+1];
+        }
+    }
+    for( Int i=0; i<m; ++i )
+        S.rowOffsets[i+1] += S.rowOffsets[i];
+    for( Int j=0; j<n; ++j )
+        S.colOffsets[j+1] += S.colOffsets[j];
+
+    // The entries of a sparse matrix are sorted by row and then column
+    const Int numNonzeros = S.rowOffsets[m];
+    S.rowTargets.resize( numNonzeros );
+    S.rowValues.resize( numNonzeros );
+    S.colSources.resize( numNonzeros );
+    S.colValues.resize( numNonzeros );
+    vector<Int> rowOffs( S.rowOffsets ), colOffs( S.colOffsets );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Real& value = A.Value(e);
+        if( value == Real(0) )
+            continue;
+        const Int i = A.Row(e);
+        const Int j = A.Col(e);
+        S.rowTargets[rowOffs[i]] = j;
+        S.rowValues[rowOffs[i]++] = value;
+        S.colSources[colOffs[j]] = i;
+        S.colValues[colOffs[j]++] = value;
+    }
+}
+
+template<typename Real>
+Presolver<Real>::Presolver
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+  const PresolveCtrl<Real>& ctrl )
+: ctrl_(ctrl), n_(A.Width()), mA_(A.Height()), mG_(G.Height())
+{
+    EL_DEBUG_CSE
+    BuildStorage( Q, Q_ );
+    BuildStorage( A, A_ );
+    BuildStorage( G, G_ );
+    b_.resize( mA_ );
+    for( Int i=0; i<mA_; ++i )
+        b_[i] = b(i);
+    c_.resize( n_ );
+    for( Int j=0; j<n_; ++j )
+        c_[j] = c(j);
+    h_.resize( mG_ );
+    for( Int k=0; k<mG_; ++k )
+        h_[k] = h(k);
+    hOrig_ = h_;
+
+    colRemoved_.assign( n_, kept_ );
+    rowARemoved_.assign( mA_, kept_ );
+    rowGRemoved_.assign( mG_, kept_ );
+    rowACount_.resize( mA_ );
+    for( Int i=0; i<mA_; ++i )
+        rowACount_[i] = A_.rowOffsets[i+1] - A_.rowOffsets[i];
+    rowGCount_.resize( mG_ );
+    for( Int k=0; k<mG_; ++k )
+        rowGCount_[k] = G_.rowOffsets[k+1] - G_.rowOffsets[k];
+    colACount_.resize( n_ );
+    colGCount_.resize( n_ );
+    colQCount_.resize( n_ );
+    for( Int j=0; j<n_; ++j )
+    {
+        colACount_[j] = A_.colOffsets[j+1] - A_.colOffsets[j];
+        colGCount_[j] = G_.colOffsets[j+1] - G_.colOffsets[j];
+        colQCount_[j] = Q_.colOffsets[j+1] - Q_.colOffsets[j];
+    }
+    lowerRow_.assign( n_, -1 );
+    upperRow_.assign( n_, -1 );
+    boundCoef_.assign( mG_, Real(0) );
+    xFixed_.assign( n_, Real(0) );
+    cFixed_.assign( n_, Real(0) );
+
+    // Remove the empty rows and register the initial bounds
+    for( Int i=0; i<mA_; ++i )
+    {
+        if( rowACount_[i] == 0 )
+        {
+            if( Abs(b_[i]) > Tolerance(b_[i]) )
+                RuntimeError("Presolve: row ",i," of A is empty but b(",i,")=",
+                  b_[i]);
+            RemoveRowA( i );
+        }
+    }
+    for( Int k=0; k<mG_; ++k )
+    {
+        if( rowGCount_[k] == 0 )
+        {
+            if( h_[k] < -Tolerance(h_[k]) )
+                RuntimeError("Presolve: row ",k," of G is empty but h(",k,")=",
+                  h_[k]);
+            RemoveRowG( k );
+        }
+        else if( rowGCount_[k] == 1 && RowGKept(k) )
+            RegisterBound( k );
+    }
+
+    for( Int pass=0; pass<ctrl_.maxPasses; ++pass )
+    {
+        bool changed = ColumnPass();
+        changed = RowPass() || changed;
+        changed = DuplicateRowPass( false ) || changed;
+        changed = DuplicateRowPass( true ) || changed;
+        if( !changed )
+            break;
+    }
+
+    if( ctrl_.print )
+    {
+        Int numRemovedCols=0, numRemovedRowsA=0, numRemovedRowsG=0;
+        for( Int j=0; j<n_; ++j )
+            if( !ColKept(j) )
+                ++numRemovedCols;
+        for( Int i=0; i<mA_; ++i )
+            if( !RowAKept(i) )
+                ++numRemovedRowsA;
+        for( Int k=0; k<mG_; ++k )
+            if( !RowGKept(k) )
+                ++numRemovedRowsG;
+        Output
+        ("Presolve removed ",numRemovedCols," of ",n_," columns, ",
+         numRemovedRowsA," of ",mA_," rows of A, and ",numRemovedRowsG," of ",
+         mG_," rows of G");
+    }
+}
+
+template<typename Real>
+Real Presolver<Real>::Lower( Int j ) const
+{
+    const Int k = lowerRow_[j];
+    return k < 0 ? -limits::Infinity<Real>() : h_[k]/boundCoef_[k];
+}
+
+template<typename Real>
+Real Presolver<Real>::Upper( Int j ) const
+{
+    const Int k = upperRow_[j];
+    return k < 0 ? limits::Infinity<Real>() : h_[k]/boundCoef_[k];
+}
+
+template<typename Real>
+void Presolver<Real>::RemoveRowA( Int i )
+{
+    EL_DEBUG_CSE
+    rowARemoved_[i] = sequence_++;
+    for( Int e=A_.rowOffsets[i]; e<A_.rowOffsets[i+1]; ++e )
+        if( ColKept(A_.rowTargets[e]) )
+            --colACount_[A_.rowTargets[e]];
+}
+
+template<typename Real>
+void Presolver<Real>::RemoveRowG( Int k )
+{
+    EL_DEBUG_CSE
+    rowGRemoved_[k] = sequence_++;
+    for( Int e=G_.rowOffsets[k]; e<G_.rowOffsets[k+1]; ++e )
+        if( ColKept(G_.rowTargets[e]) )
+            --colGCount_[G_.rowTargets[e]];
+}
+
+template<typename Real>
+void Presolver<Real>::FixColumn( Int j, const Real& value )
+{
+    EL_DEBUG_CSE
+    colRemoved_[j] = sequence_++;
+    xFixed_[j] = value;
+    cFixed_[j] = c_[j];
+
+    for( Int e=Q_.colOffsets[j]; e<Q_.colOffsets[j+1]; ++e )
+    {
+        const Int l = Q_.colSources[e];
+        if( ColKept(l) )
+        {
+            c_[l] += Q_.colValues[e]*value;
+            --colQCount_[l];
+        }
+    }
+    for( Int e=A_.colOffsets[j]; e<A_.colOffsets[j+1]; ++e )
+    {
+        const Int i = A_.colSources[e];
+        if( !RowAKept(i) )
+            continue;
+        b_[i] -= A_.colValues[e]*value;
+        if( --rowACount_[i] == 0 )
+        {
+            if( Abs(b_[i]) > Tolerance(b_[i]) )
+                RuntimeError
+                ("Presolve: the problem is infeasible due to row ",i," of A");
+            RemoveRowA( i );
+        }
+    }
+    // This also removes the bounds of column j
+    for( Int e=G_.colOffsets[j]; e<G_.colOffsets[j+1]; ++e )
+    {
+        const Int k = G_.colSources[e];
+        if( !RowGKept(k) )
+            continue;
+        h_[k] -= G_.colValues[e]*value;
+        if( --rowGCount_[k] == 0 )
+        {
+            if( h_[k] < -Tolerance(h_[k]) )
+                RuntimeError
+                ("Presolve: the problem is infeasible due to row ",k," of G");
+            RemoveRowG( k );
+        }
+        else if( rowGCount_[k] == 1 )
+            pendingBounds_.push_back( k );
+    }
+}
+
+template<typename Real>
+void Presolver<Real>::RegisterBound( Int k )
+{
+    EL_DEBUG_CSE
+    Int j=-1;
+    Real coef;
+    for( Int e=G_.rowOffsets[k]; e<G_.rowOffsets[k+1]; ++e )
+    {
+        if( ColKept(G_.rowTargets[e]) )
+        {
+            j = G_.rowTargets[e];
+            coef = G_.rowValues[e];
+            break;
+        }
+    }
+    boundCoef_[k] = coef;
+    const Real bound = h_[k] / coef;
+
+    // Only the tightest upper and lower bounds are kept
+    Int& boundRow = ( coef > Real(0) ? upperRow_[j] : lowerRow_[j] );
+    if( boundRow < 0 )
+    {
+        boundRow = k;
+        return;
+    }
+    const Real oldBound = h_[boundRow] / boundCoef_[boundRow];
+    const bool tighter =
+      ( coef > Real(0) ? bound < oldBound : bound > oldBound );
+    if( tighter )
+    {
+        const Int oldRow = boundRow;
+        boundRow = k;
+        RemoveRowG( oldRow );
+    }
+    else
+        RemoveRowG( k );
+}
+
+template<typename Real>
+void Presolver<Real>::RegisterPendingBounds()
+{
+    EL_DEBUG_CSE
+    for( const Int k : pendingBounds_ )
+        if( RowGKept(k) && rowGCount_[k] == 1 )
+            RegisterBound( k );
+    pendingBounds_.clear();
+}
+
+template<typename Real>
+bool Presolver<Real>::ColumnPass()
+{
+    EL_DEBUG_CSE
+    const Int sequenceStart = sequence_;
+    for( Int j=0; j<n_; ++j )
+    {
+        if( !ColKept(j) )
+            continue;
+        const Real lower = Lower(j);
+        const Real upper = Upper(j);
+        const bool hasLower = ( lowerRow_[j] >= 0 );
+        const bool hasUpper = ( upperRow_[j] >= 0 );
+        if( hasLower && hasUpper )
+        {
+            if( lower > upper + Tolerance(upper) )
+                RuntimeError
+                ("Presolve: the bounds of column ",j," are inconsistent");
+            if( upper - lower <= Tolerance(upper) )
+            {
+                Record record;
+                record.type = FIXED_COLUMN;
+                record.cols.push_back( j );
+                stack_.push_back( record );
+                FixColumn( j, lower );
+                RegisterPendingBounds();
+                continue;
+            }
+        }
+        if( colQCount_[j] != 0 )
+            continue;
+
+        if( colACount_[j] == 0 )
+        {
+            // Determine whether the column only appears in inequalities which
+            // loosen as it decreases (or increases) so that, after accounting
+            // for its cost, it can be fixed at a bound
+            bool nonnegative=true, nonpositive=true;
+            for( Int e=G_.colOffsets[j]; e<G_.colOffsets[j+1]; ++e )
+            {
+                const Int k = G_.colSources[e];
+                if( !RowGKept(k) || k == lowerRow_[j] || k == upperRow_[j] )
+                    continue;
+                if( G_.colValues[e] > Real(0) )
+                    nonpositive = false;
+                else
+                    nonnegative = false;
+            }
+            const Real& cost = c_[j];
+            const Real costTol = Tolerance(cost);
+            Real value;
+            if( cost > costTol && nonnegative )
+            {
+                if( !hasLower )
+                    RuntimeError
+                    ("Presolve: column ",j," shows that the problem is "
+                     "unbounded (or infeasible)");
+                value = lower;
+            }
+            else if( cost < -costTol && nonpositive )
+            {
+                if( !hasUpper )
+                    RuntimeError
+                    ("Presolve: column ",j," shows that the problem is "
+                     "unbounded (or infeasible)");
+                value = upper;
+            }
+            else if( Abs(cost) <= costTol && nonnegative && hasLower )
+                value = lower;
+            else if( Abs(cost) <= costTol && nonpositive && hasUpper )
+                value = upper;
+            else if( Abs(cost) <= costTol && nonnegative && nonpositive )
+                value = Real(0);
+            else
+                continue;
+
+            Record record;
+            record.type = FIXED_COLUMN;
+            record.cols.push_back( j );
+            stack_.push_back( record );
+            FixColumn( j, value );
+            RegisterPendingBounds();
+        }
+        else if( colACount_[j] == 1 && colGCount_[j] == 0 )
+        {
+            // Substitute the free column singleton out using its row
+            Int i=-1;
+            Real coef;
+            for( Int e=A_.colOffsets[j]; e<A_.colOffsets[j+1]; ++e )
+            {
+                if( RowAKept(A_.colSources[e]) )
+                {
+                    i = A_.colSources[e];
+                    coef = A_.colValues[e];
+                    break;
+                }
+            }
+            if( rowACount_[i] < 2 )
+                continue;
+            Record record;
+            record.type = FREE_COLUMN;
+            record.row = i;
+            record.cols.push_back( j );
+            record.multiplier = -c_[j] / coef;
+            record.rhs = b_[i];
+            for( Int e=A_.rowOffsets[i]; e<A_.rowOffsets[i+1]; ++e )
+            {
+                const Int l = A_.rowTargets[e];
+                if( l != j && ColKept(l) )
+                    c_[l] += A_.rowValues[e]*record.multiplier;
+            }
+            stack_.push_back( record );
+            RemoveRowA( i );
+            colRemoved_[j] = sequence_++;
+        }
+    }
+    return sequence_ != sequenceStart;
+}
+
+template<typename Real>
+bool Presolver<Real>::RowPass()
+{
+    EL_DEBUG_CSE
+    const Int sequenceStart = sequence_;
+    const Real infinity = limits::Infinity<Real>();
+
+    // Returns the minimum and maximum activities of a row, where an infinite
+    // activity is flagged rather than accumulated
+    auto activities =
+      [&]( const Storage& S, Int i,
+           Real& minAct, bool& minInf, Real& maxAct, bool& maxInf )
+      {
+          minAct = maxAct = Real(0);
+          minInf = maxInf = false;
+          for( Int e=S.rowOffsets[i]; e<S.rowOffsets[i+1]; ++e )
+          {
+              const Int j = S.rowTargets[e];
+              if( !ColKept(j) )
+                  continue;
+              const Real& coef = S.rowValues[e];
+              const Real lower = Lower(j);
+              const Real upper = Upper(j);
+              const Real& minBound = ( coef > Real(0) ? lower : upper );
+              const Real& maxBound = ( coef > Real(0) ? upper : lower );
+              if( Abs(minBound) == infinity )
+                  minInf = true;
+              else
+                  minAct += coef*minBound;
+              if( Abs(maxBound) == infinity )
+                  maxInf = true;
+              else
+                  maxAct += coef*maxBound;
+          }
+      };
+
+    // Fix all of the columns of a row at the bounds which minimize (or
+    // maximize) its activity
+    auto force =
+      [&]( const Storage& S, Int i, bool rowOfG, bool atMin )
+      {
+          Record record;
+          record.type = FORCING_ROW;
+          record.row = i;
+          record.rowOfG = rowOfG;
+          record.atMin = atMin;
+          vector<Real> values;
+          for( Int e=S.rowOffsets[i]; e<S.rowOffsets[i+1]; ++e )
+          {
+              const Int j = S.rowTargets[e];
+              if( !ColKept(j) )
+                  continue;
+              const bool atLower = ( (S.rowValues[e] > Real(0)) == atMin );
+              record.cols.push_back( j );
+              values.push_back( atLower ? Lower(j) : Upper(j) );
+          }
+          stack_.push_back( record );
+          if( rowOfG )
+              RemoveRowG( i );
+          else
+              RemoveRowA( i );
+          for( Int t=0; t<Int(record.cols.size()); ++t )
+              FixColumn( record.cols[t], values[t] );
+          RegisterPendingBounds();
+      };
+
+    Real minAct, maxAct;
+    bool minInf, maxInf;
+    for( Int i=0; i<mA_; ++i )
+    {
+        if( !RowAKept(i) )
+            continue;
+        if( rowACount_[i] == 1 )
+        {
+            Int j=-1;
+            Real coef;
+            for( Int e=A_.rowOffsets[i]; e<A_.rowOffsets[i+1]; ++e )
+            {
+                if( ColKept(A_.rowTargets[e]) )
+                {
+                    j = A_.rowTargets[e];
+                    coef = A_.rowValues[e];
+                    break;
+                }
+            }
+            const Real value = b_[i] / coef;
+            if( value < Lower(j) - Tolerance(value) ||
+                value > Upper(j) + Tolerance(value) )
+                RuntimeError
+                ("Presolve: row ",i," of A fixes column ",j," outside of its "
+                 "bounds");
+            Record record;
+            record.type = SINGLETON_ROW;
+            record.row = i;
+            record.cols.push_back( j );
+            stack_.push_back( record );
+            RemoveRowA( i );
+            FixColumn( j, value );
+            RegisterPendingBounds();
+            continue;
+        }
+
+        activities( A_, i, minAct, minInf, maxAct, maxInf );
+        const Real tol = Tolerance(b_[i]);
+        if( (!minInf && minAct > b_[i] + tol) ||
+            (!maxInf && maxAct < b_[i] - tol) )
+            RuntimeError
+            ("Presolve: the problem is infeasible due to row ",i," of A");
+        if( !minInf && minAct >= b_[i] - tol )
+            force( A_, i, false, true );
+        else if( !maxInf && maxAct <= b_[i] + tol )
+            force( A_, i, false, false );
+    }
+
+    // Rows of G with a single nonzero have already been converted to bounds
+    for( Int k=0; k<mG_; ++k )
+    {
+        if( !RowGKept(k) || rowGCount_[k] < 2 )
+            continue;
+        activities( G_, k, minAct, minInf, maxAct, maxInf );
+        const Real tol = Tolerance(h_[k]);
+        if( !minInf && minAct > h_[k] + tol )
+            RuntimeError
+            ("Presolve: the problem is infeasible due to row ",k," of G");
+        if( !maxInf && maxAct <= h_[k] )
+            RemoveRowG( k );
+        else if( !minInf && minAct >= h_[k] - tol )
+            force( G_, k, true, true );
+    }
+    return sequence_ != sequenceStart;
+}
+
+template<typename Real>
+bool Presolver<Real>::DuplicateRowPass( bool rowsOfG )
+{
+    EL_DEBUG_CSE
+    const Int sequenceStart = sequence_;
+    const Storage& S = ( rowsOfG ? G_ : A_ );
+    const Int m = ( rowsOfG ? mG_ : mA_ );
+    const auto& rowCount = ( rowsOfG ? rowGCount_ : rowACount_ );
+    auto rowKept = [&]( Int i ) { return rowsOfG ? RowGKept(i) : RowAKept(i); };
+
+    // Sort the rows with at least two nonzeros by a hash of their patterns
+    vector<std::pair<size_t,Int>> hashes;
+    for( Int i=0; i<m; ++i )
+    {
+        if( !rowKept(i) || rowCount[i] < 2 )
+            continue;
+        size_t hash = rowCount[i];
+        for( Int e=S.rowOffsets[i]; e<S.rowOffsets[i+1]; ++e )
+            if( ColKept(S.rowTargets[e]) )
+                hash = hash*size_t(1000003) ^ size_t(S.rowTargets[e]);
+        hashes.emplace_back( hash, i );
+    }
+    std::sort( hashes.begin(), hashes.end() );
+
+    // Returns whether row i1 is ratio times row i0
+    vector<Int> cols0, cols1;
+    vector<Real> vals0, vals1;
+    auto proportional = [&]( Int i0, Int i1, Real& ratio )
+      {
+          auto pack = [&]( Int i, vector<Int>& cols, vector<Real>& vals )
+            {
+                cols.clear();
+                vals.clear();
+                for( Int e=S.rowOffsets[i]; e<S.rowOffsets[i+1]; ++e )
+                {
+                    if( ColKept(S.rowTargets[e]) )
+                    {
+                        cols.push_back( S.rowTargets[e] );
+                        vals.push_back( S.rowValues[e] );
+                    }
+                }
+            };
+          pack( i0, cols0, vals0 );
+          pack( i1, cols1, vals1 );
+          if( cols0 != cols1 )
+              return false;
+          ratio = vals1[0] / vals0[0];
+          for( Int t=1; t<Int(vals0.size()); ++t )
+              if( Abs(vals1[t]-ratio*vals0[t]) > ctrl_.tol*Abs(vals1[t]) )
+                  return false;
+          return true;
+      };
+
+    auto& rhs = ( rowsOfG ? h_ : b_ );
+    for( Int s=0; s<Int(hashes.size()); )
+    {
+        Int sEnd = s+1;
+        while( sEnd < Int(hashes.size()) &&
+               hashes[sEnd].first == hashes[s].first )
+            ++sEnd;
+        for( Int t0=s; t0<sEnd; ++t0 )
+        {
+            Int i0 = hashes[t0].second;
+            for( Int t1=t0+1; t1<sEnd && rowKept(i0); ++t1 )
+            {
+                const Int i1 = hashes[t1].second;
+                Real ratio;
+                if( !rowKept(i1) || !proportional( i0, i1, ratio ) )
+                    continue;
+                if( !rowsOfG )
+                {
+                    // Equal rows are redundant, and otherwise inconsistent
+                    if( Abs(rhs[i1]-ratio*rhs[i0]) > Tolerance(rhs[i1]) )
+                        RuntimeError
+                        ("Presolve: rows ",i0," and ",i1," of A are "
+                         "inconsistent");
+                    RemoveRowA( i1 );
+                }
+                else if( ratio > Real(0) )
+                {
+                    // Only the tighter of the two inequalities is needed
+                    if( rhs[i1]/ratio >= rhs[i0] )
+                        RemoveRowG( i1 );
+                    else
+                        RemoveRowG( i0 );
+                }
+            }
+        }
+        s = sEnd;
+    }
+    return sequence_ != sequenceStart;
+}
+
+template<typename Real>
+void Presolver<Real>::ReducedProblem
+( SparseMatrix<Real>& Q,
+  SparseMatrix<Real>& A,
+  SparseMatrix<Real>& G,
+  Matrix<Real>& b,
+  Matrix<Real>& c,
+  Matrix<Real>& h ) const
+{
+    EL_DEBUG_CSE
+    vector<Int> colMap( n_, -1 ), rowAMap( mA_, -1 ), rowGMap( mG_, -1 );
+    Int nRed=0, mARed=0, mGRed=0;
+    for( Int j=0; j<n_; ++j )
+        if( ColKept(j) )
+            colMap[j] = nRed++;
+    for( Int i=0; i<mA_; ++i )
+        if( RowAKept(i) )
+            rowAMap[i] = mARed++;
+    for( Int k=0; k<mG_; ++k )
+        if( RowGKept(k) )
+            rowGMap[k] = mGRed++;
+
+    auto extract =
+      [&]( const Storage& S, const vector<Int>& rowMap, Int mRed,
+           SparseMatrix<Real>& B )
+      {
+          Zeros( B, mRed, nRed );
+          Int numEntries = 0;
+          for( Int i=0; i<Int(rowMap.size()); ++i )
+              if( rowMap[i] >= 0 )
+                  for( Int e=S.rowOffsets[i]; e<S.rowOffsets[i+1]; ++e )
+                      if( ColKept(S.rowTargets[e]) )
+                          ++numEntries;
+          B.Reserve( numEntries );
+          for( Int i=0; i<Int(rowMap.size()); ++i )
+              if( rowMap[i] >= 0 )
+                  for( Int e=S.rowOffsets[i]; e<S.rowOffsets[i+1]; ++e )
+                      if( ColKept(S.rowTargets[e]) )
+                          B.QueueUpdate
+                          ( rowMap[i], colMap[S.rowTargets[e]],
+                            S.rowValues[e] );
+          B.ProcessQueues();
+      };
+    extract( Q_, colMap, nRed, Q );
+    extract( A_, rowAMap, mARed, A );
+    extract( G_, rowGMap, mGRed, G );
+
+    b.Resize( mARed, 1 );
+    for( Int i=0; i<mA_; ++i )
+        if( rowAMap[i] >= 0 )
+            b(rowAMap[i]) = b_[i];
+    c.Resize( nRed, 1 );
+    for( Int j=0; j<n_; ++j )
+        if( colMap[j] >= 0 )
+            c(colMap[j]) = c_[j];
+    h.Resize( mGRed, 1 );
+    for( Int k=0; k<mG_; ++k )
+        if( rowGMap[k] >= 0 )
+            h(rowGMap[k]) = h_[k];
+}
+
+template<typename Real>
+Real Presolver<Real>::Residual
+( Int j, const Matrix<Real>& x, const Matrix<Real>& y,
+  const Matrix<Real>& z ) const
+{
+    EL_DEBUG_CSE
+    const Int removed = colRemoved_[j];
+    Real residual = cFixed_[j];
+    for( Int e=Q_.colOffsets[j]; e<Q_.colOffsets[j+1]; ++e )
+        if( colRemoved_[Q_.colSources[e]] >= removed )
+            residual += Q_.colValues[e]*x(Q_.colSources[e]);
+    for( Int e=A_.colOffsets[j]; e<A_.colOffsets[j+1]; ++e )
+        if( rowARemoved_[A_.colSources[e]] > removed )
+            residual += A_.colValues[e]*y(A_.colSources[e]);
+    for( Int e=G_.colOffsets[j]; e<G_.colOffsets[j+1]; ++e )
+        if( rowGRemoved_[G_.colSources[e]] > removed )
+            residual += G_.colValues[e]*z(G_.colSources[e]);
+    return residual;
+}
+
+template<typename Real>
+void Presolver<Real>::AbsorbResidual
+( Int j, const Real& residual, Matrix<Real>& z ) const
+{
+    EL_DEBUG_CSE
+    // The multipliers must remain nonnegative, so a residual of the wrong sign
+    // (which can only be due to the inexactness of the reduced solution) is
+    // left alone
+    const Int upper = upperRow_[j];
+    const Int lower = lowerRow_[j];
+    if( residual < Real(0) && upper >= 0 )
+        z(upper) = -residual / boundCoef_[upper];
+    else if( residual > Real(0) && lower >= 0 )
+        z(lower) = -residual / boundCoef_[lower];
+}
+
+template<typename Real>
+void Presolver<Real>::Postsolve
+( const Matrix<Real>& xRed,
+  const Matrix<Real>& yRed,
+  const Matrix<Real>& zRed,
+  const Matrix<Real>& sRed,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s ) const
+{
+    EL_DEBUG_CSE
+    Zeros( x, n_, 1 );
+    Zeros( y, mA_, 1 );
+    Zeros( z, mG_, 1 );
+    Zeros( s, mG_, 1 );
+    Int jRed=0, iRed=0, kRed=0;
+    for( Int j=0; j<n_; ++j )
+        x(j) = ( ColKept(j) ? xRed(jRed++) : xFixed_[j] );
+    for( Int i=0; i<mA_; ++i )
+        if( RowAKept(i) )
+            y(i) = yRed(iRed++);
+    for( Int k=0; k<mG_; ++k )
+    {
+        if( RowGKept(k) )
+        {
+            z(k) = zRed(kRed);
+            s(k) = sRed(kRed++);
+        }
+    }
+
+    auto coefficient = [&]( const Storage& S, Int i, Int j )
+      {
+          for( Int e=S.rowOffsets[i]; e<S.rowOffsets[i+1]; ++e )
+              if( S.rowTargets[e] == j )
+                  return S.rowValues[e];
+          return Real(0);
+      };
+
+    for( auto it=stack_.rbegin(); it!=stack_.rend(); ++it )
+    {
+        const auto& record = *it;
+        if( record.type == FIXED_COLUMN )
+        {
+            const Int j = record.cols[0];
+            AbsorbResidual( j, Residual(j,x,y,z), z );
+        }
+        else if( record.type == SINGLETON_ROW )
+        {
+            const Int j = record.cols[0];
+            y(record.row) =
+              -Residual(j,x,y,z) / coefficient(A_,record.row,j);
+        }
+        else if( record.type == FORCING_ROW )
+        {
+            // Choose the multiplier of the row so that the residuals of each
+            // of its columns have the signs required by their active bounds
+            const Storage& S = ( record.rowOfG ? G_ : A_ );
+            const Int numCols = record.cols.size();
+            vector<Real> residuals(numCols), coefs(numCols);
+            // (the multiplier of an inequality must also be nonnegative)
+            Real multiplier = Real(0);
+            bool initialized = record.rowOfG;
+            for( Int t=0; t<numCols; ++t )
+            {
+                const Int j = record.cols[t];
+                residuals[t] = Residual( j, x, y, z );
+                coefs[t] = coefficient( S, record.row, j );
+                const Real candidate = -residuals[t] / coefs[t];
+                if( !initialized )
+                {
+                    multiplier = candidate;
+                    initialized = true;
+                }
+                else if( record.atMin )
+                    multiplier = Max( multiplier, candidate );
+                else
+                    multiplier = Min( multiplier, candidate );
+            }
+            if( record.rowOfG )
+                z(record.row) = multiplier;
+            else
+                y(record.row) = multiplier;
+            for( Int t=0; t<numCols; ++t )
+                AbsorbResidual
+                ( record.cols[t], residuals[t]+coefs[t]*multiplier, z );
+        }
+        else // record.type == FREE_COLUMN
+        {
+            const Int i = record.row;
+            const Int j = record.cols[0];
+            y(i) = record.multiplier;
+            Real value = record.rhs;
+            Real coef = Real(0);
+            for( Int e=A_.rowOffsets[i]; e<A_.rowOffsets[i+1]; ++e )
+            {
+                const Int l = A_.rowTargets[e];
+                if( l == j )
+                    coef = A_.rowValues[e];
+                else if( colRemoved_[l] > colRemoved_[j] )
+                    value -= A_.rowValues[e]*x(l);
+            }
+            x(j) = value / coef;
+        }
+    }
+
+    // Recompute the slacks of the removed inequalities
+    for( Int k=0; k<mG_; ++k )
+    {
+        if( RowGKept(k) )
+            continue;
+        Real slack = hOrig_[k];
+        for( Int e=G_.rowOffsets[k]; e<G_.rowOffsets[k+1]; ++e )
+            slack -= G_.rowValues[e]*x(G_.rowTargets[e]);
+        s(k) = slack;
+    }
+}
+
+// Presolve a sparse affine-form problem, solve the reduced problem using
+// solve(Q,A,G,b,c,h,x,y,z,s,mehrotraCtrl), and postsolve. If presolve is
+// disabled or does not reduce the problem, false is returned so that the
+// caller can solve the original problem itself.
+template<typename Real,typename Solver>
+bool Solve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+  const PresolveCtrl<Real>& ctrl,
+  const MehrotraCtrl<Real>& mehrotraCtrl,
+        Solver solve )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.enable )
+        return false;
+    Presolver<Real> presolver( Q, A, G, b, c, h, ctrl );
+    if( !presolver.Reduced() )
+        return false;
+
+    SparseMatrix<Real> QRed, ARed, GRed;
+    Matrix<Real> bRed, cRed, hRed, xRed, yRed, zRed, sRed;
+    presolver.ReducedProblem( QRed, ARed, GRed, bRed, cRed, hRed );
+    if( cRed.Height() > 0 )
+    {
+        // The user-provided initial points do not apply to the reduced problem
+        auto reducedCtrl( mehrotraCtrl );
+        reducedCtrl.primalInit = false;
+        reducedCtrl.dualInit = false;
+        solve
+        ( QRed, ARed, GRed, bRed, cRed, hRed, xRed, yRed, zRed, sRed,
+          reducedCtrl );
+    }
+    else
+    {
+        // Every row was removed along with the last of its columns
+        Zeros( xRed, 0, 1 );
+        Zeros( yRed, bRed.Height(), 1 );
+        Zeros( zRed, hRed.Height(), 1 );
+        Zeros( sRed, hRed.Height(), 1 );
+    }
+    presolver.Postsolve( xRed, yRed, zRed, sRed, x, y, z, s );
+    return true;
+}
+
+// Since presolve is inherently sequential, the problem is gathered onto the
+// root process, which presolves and postsolves, while the reduced problem is
+// solved in parallel
+template<typename Real,typename Solver>
+bool Solve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& G,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+  const DistMultiVec<Real>& h,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistMultiVec<Real>& s,
+  const PresolveCtrl<Real>& ctrl,
+  const MehrotraCtrl<Real>& mehrotraCtrl,
+        Solver solve )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.enable )
+        return false;
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int root = 0;
+    const bool isRoot = ( grid.Rank() == root );
+
+    SparseMatrix<Real> QLoc, ALoc, GLoc;
+    Matrix<Real> bLoc, cLoc, hLoc;
+    if( isRoot )
+    {
+        CopyFromRoot( Q, QLoc );
+        CopyFromRoot( A, ALoc );
+        CopyFromRoot( G, GLoc );
+        CopyFromRoot( b, bLoc );
+        CopyFromRoot( c, cLoc );
+        CopyFromRoot( h, hLoc );
+    }
+    else
+    {
+        CopyFromNonRoot( Q, root );
+        CopyFromNonRoot( A, root );
+        CopyFromNonRoot( G, root );
+        CopyFromNonRoot( b, root );
+        CopyFromNonRoot( c, root );
+        CopyFromNonRoot( h, root );
+    }
+
+    // The root broadcasts whether presolve failed or reduced the problem
+    // along with the dimensions of the reduced problem
+    unique_ptr<Presolver<Real>> presolver;
+    SparseMatrix<Real> QRedLoc, ARedLoc, GRedLoc;
+    Matrix<Real> bRedLoc, cRedLoc, hRedLoc;
+    string error;
+    Int info[5] = { 0, 0, 0, 0, 0 };
+    if( isRoot )
+    {
+        try
+        {
+            presolver.reset
+            ( new Presolver<Real>( QLoc, ALoc, GLoc, bLoc, cLoc, hLoc, ctrl ) );
+            if( presolver->Reduced() )
+            {
+                presolver->ReducedProblem
+                ( QRedLoc, ARedLoc, GRedLoc, bRedLoc, cRedLoc, hRedLoc );
+                info[1] = 1;
+                info[2] = ARedLoc.Height();
+                info[3] = GRedLoc.Height();
+                info[4] = ARedLoc.Width();
+            }
+        }
+        catch( std::exception& e )
+        {
+            error = e.what();
+            info[0] = 1;
+        }
+    }
+    mpi::Broadcast( info, 5, root, comm );
+    if( info[0] )
+    {
+        if( isRoot )
+            RuntimeError(error);
+        else
+            RuntimeError("Presolve failed on the root process");
+    }
+    if( !info[1] )
+        return false;
+    const Int mARed = info[2];
+    const Int mGRed = info[3];
+    const Int nRed = info[4];
+
+    auto distributeMatrix =
+      [&]( const SparseMatrix<Real>& BLoc, DistSparseMatrix<Real>& B,
+           Int height, Int width )
+      {
+          B.Resize( height, width );
+          if( isRoot )
+          {
+              const Int numEntries = BLoc.NumEntries();
+              B.Reserve( numEntries, numEntries );
+              for( Int e=0; e<numEntries; ++e )
+                  B.QueueUpdate( BLoc.Row(e), BLoc.Col(e), BLoc.Value(e) );
+          }
+          B.ProcessQueues();
+      };
+    auto distributeVector =
+      [&]( const Matrix<Real>& vLoc, DistMultiVec<Real>& v, Int height )
+      {
+          v.SetGrid( grid );
+          Zeros( v, height, 1 );
+          if( isRoot )
+          {
+              v.Reserve( height );
+              for( Int i=0; i<height; ++i )
+                  v.QueueUpdate( i, 0, vLoc(i) );
+          }
+          v.ProcessQueues();
+      };
+    auto gatherVector =
+      [&]( const DistMultiVec<Real>& v, Matrix<Real>& vLoc )
+      {
+          if( isRoot )
+              CopyFromRoot( v, vLoc );
+          else
+              CopyFromNonRoot( v, root );
+      };
+
+    DistSparseMatrix<Real> QRed(grid), ARed(grid), GRed(grid);
+    DistMultiVec<Real> bRed(grid), cRed(grid), hRed(grid),
+      xRed(grid), yRed(grid), zRed(grid), sRed(grid);
+    distributeMatrix( QRedLoc, QRed, nRed, nRed );
+    distributeMatrix( ARedLoc, ARed, mARed, nRed );
+    distributeMatrix( GRedLoc, GRed, mGRed, nRed );
+    distributeVector( bRedLoc, bRed, mARed );
+    distributeVector( cRedLoc, cRed, nRed );
+    distributeVector( hRedLoc, hRed, mGRed );
+    if( nRed > 0 )
+    {
+        auto reducedCtrl( mehrotraCtrl );
+        reducedCtrl.primalInit = false;
+        reducedCtrl.dualInit = false;
+        solve
+        ( QRed, ARed, GRed, bRed, cRed, hRed, xRed, yRed, zRed, sRed,
+          reducedCtrl );
+    }
+    else
+    {
+        Zeros( xRed, 0, 1 );
+        Zeros( yRed, mARed, 1 );
+        Zeros( zRed, mGRed, 1 );
+        Zeros( sRed, mGRed, 1 );
+    }
+
+    Matrix<Real> xRedLoc, yRedLoc, zRedLoc, sRedLoc, xLoc, yLoc, zLoc, sLoc;
+    gatherVector( xRed, xRedLoc );
+    gatherVector( yRed, yRedLoc );
+    gatherVector( zRed, zRedLoc );
+    gatherVector( sRed, sRedLoc );
+    if( isRoot )
+        presolver->Postsolve
+        ( xRedLoc, yRedLoc, zRedLoc, sRedLoc, xLoc, yLoc, zLoc, sLoc );
+    distributeVector( xLoc, x, A.Width() );
+    distributeVector( yLoc, y, A.Height() );
+    distributeVector( zLoc, z, G.Height() );
+    distributeVector( sLoc, s, G.Height() );
+    return true;
+}
+
+// The direct conic form is presolved as the affine form with G = -I and
+// h = 0 (whose structure the reductions preserve), and the reduced problem is
+// solved using solve(Q,A,b,c,x,y,z,mehrotraCtrl)
+template<typename Real,typename Solver>
+bool SolveDirect
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const PresolveCtrl<Real>& ctrl,
+  const MehrotraCtrl<Real>& mehrotraCtrl,
+        Solver solve )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.enable )
+        return false;
+    const Int n = A.Width();
+    SparseMatrix<Real> G;
+    Matrix<Real> h, s;
+    Identity( G, n, n );
+    G *= Real(-1);
+    Zeros( h, n, 1 );
+    auto affineSolve =
+      [&]( const SparseMatrix<Real>& QRed,
+           const SparseMatrix<Real>& ARed,
+           const SparseMatrix<Real>& GRed,
+           const Matrix<Real>& bRed,
+           const Matrix<Real>& cRed,
+           const Matrix<Real>& hRed,
+                 Matrix<Real>& xRed,
+                 Matrix<Real>& yRed,
+                 Matrix<Real>& zRed,
+                 Matrix<Real>& sRed,
+           const MehrotraCtrl<Real>& reducedCtrl )
+      {
+          solve( QRed, ARed, bRed, cRed, xRed, yRed, zRed, reducedCtrl );
+          // The slacks of the (negated identity) bounds are not returned by
+          // the direct-form solver, so form s := h - G x
+          sRed = hRed;
+          Multiply( NORMAL, Real(-1), GRed, xRed, Real(1), sRed );
+      };
+    return Solve
+      ( Q, A, G, b, c, h, x, y, z, s, ctrl, mehrotraCtrl, affineSolve );
+}
+
+template<typename Real,typename Solver>
+bool SolveDirect
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const PresolveCtrl<Real>& ctrl,
+  const MehrotraCtrl<Real>& mehrotraCtrl,
+        Solver solve )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.enable )
+        return false;
+    const Grid& grid = A.Grid();
+    const Int n = A.Width();
+    DistSparseMatrix<Real> G(grid);
+    DistMultiVec<Real> h(grid), s(grid);
+    Identity( G, n, n );
+    G *= Real(-1);
+    Zeros( h, n, 1 );
+    auto affineSolve =
+      [&]( const DistSparseMatrix<Real>& QRed,
+           const DistSparseMatrix<Real>& ARed,
+           const DistSparseMatrix<Real>& GRed,
+           const DistMultiVec<Real>& bRed,
+           const DistMultiVec<Real>& cRed,
+           const DistMultiVec<Real>& hRed,
+                 DistMultiVec<Real>& xRed,
+                 DistMultiVec<Real>& yRed,
+                 DistMultiVec<Real>& zRed,
+                 DistMultiVec<Real>& sRed,
+           const MehrotraCtrl<Real>& reducedCtrl )
+      {
+          solve( QRed, ARed, bRed, cRed, xRed, yRed, zRed, reducedCtrl );
+          // The slacks of the (negated identity) bounds are not returned by
+          // the direct-form solver, so form s := h - G x
+          sRed = hRed;
+          Multiply( NORMAL, Real(-1), GRed, xRed, Real(1), sRed );
+      };
+    return Solve
+      ( Q, A, G, b, c, h, x, y, z, s, ctrl, mehrotraCtrl, affineSolve );
+}
+
+} // namespace presolve
+} // namespace El
+
+#endif // ifndef EL_SOLVERS_PRESOLVE_HPP
@@ -9,6 +9,7 @@
 #include <El.hpp>
 #include "./QP/direct/IPM.hpp"
 #include "./QP/affine/IPM.hpp"
+#include "./Presolve.hpp"
 
 namespace El {
 
@@ -62,10 +63,25 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == QP_MEHROTRA )
-        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != QP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    auto solve =
+      [&]( const SparseMatrix<Real>& QRed,
+           const SparseMatrix<Real>& ARed,
+           const Matrix<Real>& bRed,
+           const Matrix<Real>& cRed,
+                 Matrix<Real>& xRed,
+                 Matrix<Real>& yRed,
+                 Matrix<Real>& zRed,
+           const MehrotraCtrl<Real>& mehrotraCtrl )
+      {
+          qp::direct::Mehrotra
+          ( QRed, ARed, bRed, cRed, xRed, yRed, zRed, mehrotraCtrl );
+      };
+    if( !presolve::SolveDirect
+         ( Q, A, b, c, x, y, z, ctrl.presolveCtrl, ctrl.mehrotraCtrl, solve ) )
+        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
 }
 
 template<typename Real>
@@ -80,10 +96,25 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == QP_MEHROTRA )
-        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != QP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    auto solve =
+      [&]( const DistSparseMatrix<Real>& QRed,
+           const DistSparseMatrix<Real>& ARed,
+           const DistMultiVec<Real>& bRed,
+           const DistMultiVec<Real>& cRed,
+                 DistMultiVec<Real>& xRed,
+                 DistMultiVec<Real>& yRed,
+                 DistMultiVec<Real>& zRed,
+           const MehrotraCtrl<Real>& mehrotraCtrl )
+      {
+          qp::direct::Mehrotra
+          ( QRed, ARed, bRed, cRed, xRed, yRed, zRed, mehrotraCtrl );
+      };
+    if( !presolve::SolveDirect
+         ( Q, A, b, c, x, y, z, ctrl.presolveCtrl, ctrl.mehrotraCtrl, solve ) )
+        qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
 }
 
 // Affine conic form
@@ -145,10 +176,30 @@ void QP
   const qp::affine::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == QP_MEHROTRA )
-        qp::affine::Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != QP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    auto solve =
+      [&]( const SparseMatrix<Real>& QRed,
+           const SparseMatrix<Real>& ARed,
+           const SparseMatrix<Real>& GRed,
+           const Matrix<Real>& bRed,
+           const Matrix<Real>& cRed,
+           const Matrix<Real>& hRed,
+                 Matrix<Real>& xRed,
+                 Matrix<Real>& yRed,
+                 Matrix<Real>& zRed,
+                 Matrix<Real>& sRed,
+           const MehrotraCtrl<Real>& mehrotraCtrl )
+      {
+          qp::affine::Mehrotra
+          ( QRed, ARed, GRed, bRed, cRed, hRed, xRed, yRed, zRed, sRed,
+            mehrotraCtrl );
+      };
+    if( !presolve::Solve
+         ( Q, A, G, b, c, h, x, y, z, s,
+           ctrl.presolveCtrl, ctrl.mehrotraCtrl, solve ) )
+        qp::affine::Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl.mehrotraCtrl );
 }
 
 template<typename Real>
@@ -166,10 +217,30 @@ void QP
   const qp::affine::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == QP_MEHROTRA )
-        qp::affine::Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl.mehrotraCtrl );
-    else
+    if( ctrl.approach != QP_MEHROTRA )
         LogicError("Unsupported solver");
+
+    auto solve =
+      [&]( const DistSparseMatrix<Real>& QRed,
+           const DistSparseMatrix<Real>& ARed,
+           const DistSparseMatrix<Real>& GRed,
+           const DistMultiVec<Real>& bRed,
+           const DistMultiVec<Real>& cRed,
+           const DistMultiVec<Real>& hRed,
+                 DistMultiVec<Real>& xRed,
+                 DistMultiVec<Real>& yRed,
+                 DistMultiVec<Real>& zRed,
+                 DistMultiVec<Real>& sRed,
+           const MehrotraCtrl<Real>& mehrotraCtrl )
+      {
+          qp::affine::Mehrotra
+          ( QRed, ARed, GRed, bRed, cRed, hRed, xRed, yRed, zRed, sRed,
+            mehrotraCtrl );
+      };
+    if( !presolve::Solve
+         ( Q, A, G, b, c, h, x, y, z, s,
+           ctrl.presolveCtrl, ctrl.mehrotraCtrl, solve ) )
+        qp::affine::Mehrotra( Q, A, G, b, c, h, x, y, z, s, ctrl.mehrotraCtrl );
 }
 
 #define PROTO(Real) \
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../Checkpoint.hpp"
+#include "../../../Workspace.hpp"
 
 namespace El {
 namespace qp {
@@ -106,9 +108,15 @@ void Mehrotra
         Output("|| h ||_2 = ",hNrm2);
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, k, x, y, z, &s );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     Initialize
     ( Q, A, G, b, c, h, x, y, z, s,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+      primalInit, dualInit, ctrl.standardInitShift );
 
     Real relError = 1;
     Matrix<Real> J, d,
@@ -119,8 +127,12 @@ void Mehrotra
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z, &s );
+
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( s );
@@ -445,11 +457,17 @@ void Mehrotra
         }
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, k, x, y, z, &s );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     if( ctrl.time && commRank == 0 )
         timer.Start();
     Initialize
     ( Q, A, G, b, c, h, x, y, z, s,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+      primalInit, dualInit, ctrl.standardInitShift );
     if( ctrl.time && commRank == 0 )
         Output("Init time: ",timer.Stop()," secs");
 
@@ -468,8 +486,12 @@ void Mehrotra
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid);
     dzError.AlignWith( s );
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z, &s );
+
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( s );
@@ -738,6 +760,10 @@ void Mehrotra
     const Int k = G.Height();
     const Int n = A.Width();
     const Int degree = k;
+
+    // Warm-start from the iterates of the last solve sharing the workspace
+    const bool warmStarted = ipm::WarmStart( ctrl, m, n, k, x, y, z, s );
+
     Matrix<Real> dRowA, dRowG, dCol;
     if( ctrl.outerEquil )
     {
@@ -750,12 +776,12 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol, Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( ctrl.primalInit || warmStarted )
         {
             DiagonalScale( LEFT, NORMAL, dCol,  x );
             DiagonalSolve( LEFT, NORMAL, dRowG, s );
         }
-        if( ctrl.dualInit )
+        if( ctrl.dualInit || warmStarted )
         {
             DiagonalScale( LEFT, NORMAL, dRowA, y );
             DiagonalScale( LEFT, NORMAL, dRowG, z );
@@ -796,18 +822,50 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
+    // Decide whether to reduce to the normal equations
+    // =================================================
+    NormalKKTSystem<Real> normalSystem;
+    bool useNormal = false;
+    if( ctrl.system == NORMAL_KKT )
+    {
+        useNormal = NormalKKTStructure( Q, A, G, ctrl, normalSystem );
+        if( !useNormal && ctrl.print )
+            Output("Falling back to the full KKT system");
+    }
+
     // Initialize the static portion of the KKT system
     // ===============================================
     SparseMatrix<Real> JStatic;
-    StaticKKT
-    ( Q, A, G, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm, JStatic, false );
-
-    SparseLDLFactorization<Real> sparseLDLFact;
-
-    Initialize
-    ( JStatic, regTmp, b, c, h, x, y, z, s,
-      sparseLDLFact,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( !useNormal )
+        StaticKKT
+        ( Q, A, G, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm,
+          JStatic, false );
+
+    // Reuse the analysis of the KKT system from the last solve if possible
+    ipm::CheckKKTPattern( ctrl, useNormal ? normalSystem.N : JStatic );
+    SparseLDLFactorization<Real> ownedSparseLDLFact;
+    bool ownedAnalyzed = false;
+    auto& sparseLDLFact =
+      ctrl.workspace ? ctrl.workspace->sparseLDLFact : ownedSparseLDLFact;
+    bool& analyzed =
+      ctrl.workspace ? ctrl.workspace->analyzed : ownedAnalyzed;
+
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, k, x, y, z, &s );
+    const bool primalInit = ctrl.primalInit || warmStarted || restarted;
+    const bool dualInit = ctrl.dualInit || warmStarted || restarted;
+    const Int firstIt = numIts;
+
+    if( useNormal )
+        Initialize
+        ( normalSystem, b, c, h, x, y, z, s,
+          sparseLDLFact, analyzed,
+          primalInit, dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    else
+        Initialize
+        ( JStatic, regTmp, b, c, h, x, y, z, s,
+          sparseLDLFact, analyzed,
+          primalInit, dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
 
     SparseMatrix<Real> J, JOrig;
     Matrix<Real> d,
@@ -820,8 +878,12 @@ void Mehrotra
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z, &s );
+
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( s );
@@ -912,60 +974,78 @@ void Mehrotra
         rmu = z;
         DiagonalScale( LEFT, NORMAL, s, rmu );
 
-        // Construct the KKT system
-        // ------------------------
-        JOrig = JStatic;
-        JOrig.FreezeSparsity();
-        FinishKKT( m, n, s, z, JOrig );
-        KKTRHS( rc, rb, rh, rmu, z, d );
-
-        // Solve for the direction
-        // -----------------------
-        try
+        if( useNormal )
         {
-            J = JOrig;
-            J.FreezeSparsity();
-            UpdateDiagonal( J, Real(1), regTmp );
-
-            if( wMaxNorm >= ctrl.ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.ruizMaxIter, ctrl.print );
-            else if( wMaxNorm >= ctrl.diagEquilTol )
-                SymmetricDiagonalEquil( J, dInner, ctrl.print );
-            else
-                Ones( dInner, n+m+k, 1 );
-
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
+            // Form, factor, and solve the normal equations
+            // --------------------------------------------
+            try
             {
-                const bool hermitian = true;
-                const BisectCtrl bisectCtrl;
-                sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                NormalKKT( s, z, normalSystem );
+                FactorNormalKKT
+                ( normalSystem, sparseLDLFact, analyzed, ctrl.solveCtrl );
+                SolveNormalKKT
+                ( normalSystem, sparseLDLFact, rc, rb, rh, rmu, s, z,
+                  dxAff, dyAff, dzAff, dsAff, ctrl.solveCtrl );
             }
-            else
+            catch(...)
             {
-                sparseLDLFact.ChangeNonzeroValues( J );
+                if( relError <= ctrl.minTol )
+                    break;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
             }
-
-            sparseLDLFact.Factor();
-
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
         }
-        catch(...)
+        else
         {
-            if( relError <= ctrl.minTol )
-                break;
-            else
-                RuntimeError
-                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            // Construct the KKT system
+            // ------------------------
+            JOrig = JStatic;
+            JOrig.FreezeSparsity();
+            FinishKKT( m, n, s, z, JOrig );
+            KKTRHS( rc, rb, rh, rmu, z, d );
+
+            // Solve for the direction
+            // -----------------------
+            try
+            {
+                J = JOrig;
+                J.FreezeSparsity();
+                UpdateDiagonal( J, Real(1), regTmp );
+
+                if( wMaxNorm >= ctrl.ruizEquilTol )
+                    SymmetricRuizEquil
+                    ( J, dInner, ctrl.ruizMaxIter, ctrl.print );
+                else if( wMaxNorm >= ctrl.diagEquilTol )
+                    SymmetricDiagonalEquil( J, dInner, ctrl.print );
+                else
+                    Ones( dInner, n+m+k, 1 );
+
+                ipm::AnalyzeOrChange( sparseLDLFact, J, analyzed );
+
+                sparseLDLFact.Factor();
+
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    break;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
         }
-        ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
 
         if( ctrl.checkResiduals && ctrl.print )
         {
@@ -1035,32 +1115,55 @@ void Mehrotra
             rmu += dz;
         }
 
-        // Set up the new KKT RHS
-        // ----------------------
-        KKTRHS( rc, rb, rh, rmu, z, d );
-        // Solve for the new direction
-        // ---------------------------
-        try
+        if( useNormal )
         {
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
+            // Solve the normal equations for the new direction
+            // ------------------------------------------------
+            try
+            {
+                SolveNormalKKT
+                ( normalSystem, sparseLDLFact, rc, rb, rh, rmu, s, z,
+                  dx, dy, dz, ds, ctrl.solveCtrl );
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    break;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
         }
-        catch(...)
+        else
         {
-            if( relError <= ctrl.minTol )
-                break;
-            else
-                RuntimeError
-                ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            // Set up the new KKT RHS
+            // ----------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Solve for the new direction
+            // ---------------------------
+            try
+            {
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    break;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
         }
-        ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
 
         // Update the current estimates
         // ============================
@@ -1094,6 +1197,7 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRowG, z );
         DiagonalScale( LEFT, NORMAL, dRowG, s );
     }
+    ipm::StoreIterates( ctrl, x, y, z, s );
 }
 
 template<typename Real>
@@ -1130,6 +1234,10 @@ void Mehrotra
     const Int k = G.Height();
     const Int n = A.Width();
     const Int degree = k;
+
+    // Warm-start from the iterates of the last solve sharing the workspace
+    const bool warmStarted = ipm::WarmStart( ctrl, m, n, k, x, y, z, s );
+
     DistMultiVec<Real> dRowA(grid), dRowG(grid), dCol(grid);
     if( ctrl.outerEquil )
     {
@@ -1147,12 +1255,12 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol, Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( ctrl.primalInit || warmStarted )
         {
             DiagonalScale( LEFT, NORMAL, dCol,  x );
             DiagonalSolve( LEFT, NORMAL, dRowG, s );
         }
-        if( ctrl.dualInit )
+        if( ctrl.dualInit || warmStarted )
         {
             DiagonalScale( LEFT, NORMAL, dRowA, y );
             DiagonalScale( LEFT, NORMAL, dRowG, z );
@@ -1218,13 +1326,26 @@ void Mehrotra
             Output("Imbalance factor of J: ",imbalanceJ);
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, k, x, y, z, &s );
+    const bool primalInit = ctrl.primalInit || warmStarted || restarted;
+    const bool dualInit = ctrl.dualInit || warmStarted || restarted;
+    const Int firstIt = numIts;
+
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    DistSparseLDLFactorization<Real> sparseLDLFact;
+    // Reuse the analysis of the KKT system from the last solve if possible
+    ipm::CheckKKTPattern( ctrl, JStatic );
+    DistSparseLDLFactorization<Real> ownedSparseLDLFact;
+    bool ownedAnalyzed = false;
+    auto& sparseLDLFact =
+      ctrl.workspace ? ctrl.workspace->distSparseLDLFact : ownedSparseLDLFact;
+    bool& analyzed =
+      ctrl.workspace ? ctrl.workspace->analyzed : ownedAnalyzed;
     Initialize
     ( JStatic, regTmp, b, c, h, x, y, z, s,
-      sparseLDLFact,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+      sparseLDLFact, analyzed,
+      primalInit, dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1238,8 +1359,12 @@ void Mehrotra
     DistMultiVec<Real> dInner(grid);
     DistMultiVec<Real> dxError(grid), dyError(grid), dzError(grid);
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z, &s );
+
         if( ctrl.time && commRank == 0 )
             iterTimer.Start();
 
@@ -1363,16 +1488,7 @@ void Mehrotra
             if( commRank == 0 && ctrl.time )
                 Output("Equilibration: ",timer.Stop()," secs");
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
-            {
-                const bool hermitian = true;
-                const BisectCtrl bisectCtrl;
-                sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
-            }
-            else
-            {
-                sparseLDLFact.ChangeNonzeroValues( J );
-            }
+            ipm::AnalyzeOrChange( sparseLDLFact, J, analyzed );
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
@@ -1541,6 +1657,7 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRowG, z );
         DiagonalScale( LEFT, NORMAL, dRowG, s );
     }
+    ipm::StoreIterates( ctrl, x, y, z, s );
 }
 
 #define PROTO(Real) \
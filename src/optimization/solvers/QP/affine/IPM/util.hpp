@@ -12,6 +12,9 @@ namespace El {
 namespace qp {
 namespace affine {
 
+template<typename Real>
+struct NormalKKTSystem;
+
 // Initialize
 // ==========
 template<typename Real>
@@ -52,6 +55,7 @@ void Initialize
         Matrix<Real>& z,
         Matrix<Real>& s,
         SparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
   bool primalInit, bool dualInit, bool standardShift,
   const RegSolveCtrl<Real>& solveCtrl );
 template<typename Real>
@@ -66,6 +70,22 @@ void Initialize
         DistMultiVec<Real>& z,
         DistMultiVec<Real>& s,
         DistSparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
+  bool primalInit, bool dualInit, bool standardShift,
+  const RegSolveCtrl<Real>& solveCtrl );
+
+template<typename Real>
+void Initialize
+(       NormalKKTSystem<Real>& system,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+        SparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
   bool primalInit, bool dualInit, bool standardShift,
   const RegSolveCtrl<Real>& solveCtrl );
 
@@ -221,6 +241,93 @@ void ExpandSolution
         DistMultiVec<Real>& dz,
         DistMultiVec<Real>& ds );
 
+// Normal equations
+// ================
+// When Q is diagonal, eliminating dz and ds from the rows of G with at most
+// one nonzero (e.g., bound constraints) leaves the diagonal matrix
+//
+//   H = Q + gamma^2 I + G_b^T inv(s_b <> z_b + beta^2 I) G_b,
+//
+// and then eliminating dx leaves the symmetric positive-definite system
+//
+//   (F inv(H) F^T + D) | dy  | = F inv(H) r_x + | r_b  |,
+//                      | dz_g|                  | -r_z |
+//
+// where F = [A; G_g] stacks A on top of the remaining rows of G,
+// D = diag(delta^2 I, s_g <> z_g + beta^2 I), r_x = -r_c + G_b^T inv(W_b) r_z,
+// and r_z = z <> r_mu - r_h. The columns of F with many nonzeros are kept out
+// of the sparse product and are instead applied through a low-rank
+// Sherman-Morrison-Woodbury correction.
+template<typename Real>
+struct NormalKKTSystem
+{
+    Int m=0, n=0, k=0;
+    Real gamma=0, delta=0, beta=0;
+
+    // The diagonal of Q
+    Matrix<Real> qDiag;
+
+    // The column and value of the nonzero of each bound row of G (the column
+    // is -1 for empty rows), and the index of each row of G within the
+    // general rows (-1 for bound rows)
+    vector<Int> boundCol;
+    Matrix<Real> boundVal;
+    vector<Int> generalIndex, generalRows;
+
+    // F with its dense columns removed (and its transpose), as well as the
+    // dense columns themselves
+    SparseMatrix<Real> FSparse, FSparseTrans;
+    vector<Int> denseCols;
+    Matrix<Real> FDense;
+
+    // The diagonals of W = s <> z + beta^2 I, H, and D for the current iterate
+    Matrix<Real> wDiag, hDiag, dDiag;
+
+    // The sparse portion of the normal matrix, F_s inv(H) F_s^T + D
+    SparseMatrix<Real> N;
+
+    // inv(N) F_d and the Cholesky factor of inv(H_d) + F_d^T inv(N) F_d
+    Matrix<Real> NInvU, capacitance;
+};
+
+// Returns false if Q is not diagonal or if there is nothing to eliminate onto
+template<typename Real>
+bool NormalKKTStructure
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const MehrotraCtrl<Real>& ctrl,
+        NormalKKTSystem<Real>& system );
+
+template<typename Real>
+void NormalKKT
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+        NormalKKTSystem<Real>& system );
+
+template<typename Real>
+void FactorNormalKKT
+(       NormalKKTSystem<Real>& system,
+        SparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
+  const RegSolveCtrl<Real>& solveCtrl );
+
+template<typename Real>
+void SolveNormalKKT
+( const NormalKKTSystem<Real>& system,
+  const SparseLDLFactorization<Real>& sparseLDLFact,
+  const Matrix<Real>& rc,
+  const Matrix<Real>& rb,
+  const Matrix<Real>& rh,
+  const Matrix<Real>& rmu,
+  const Matrix<Real>& s,
+  const Matrix<Real>& z,
+        Matrix<Real>& dx,
+        Matrix<Real>& dy,
+        Matrix<Real>& dz,
+        Matrix<Real>& ds,
+  const RegSolveCtrl<Real>& solveCtrl );
+
 } // namespace affine
 } // namespace qp
 } // namespace El
@@ -9,6 +9,7 @@
 #include <El.hpp>
 
 #include "../util.hpp"
+#include "../../../../Workspace.hpp"
 
 namespace El {
 namespace qp {
@@ -322,6 +323,7 @@ void Initialize
         Matrix<Real>& z,
         Matrix<Real>& s,
         SparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
   bool primalInit,
   bool dualInit,
   bool standardShift,
@@ -362,11 +364,10 @@ void Initialize
     J.FreezeSparsity();
     UpdateRealPartOfDiagonal( J, Real(1), regTmp );
 
-    // Analyze the sparsity pattern of the KKT system
-    // ==============================================
-    const bool hermitian = true;
-    const BisectCtrl bisectCtrl;
-    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    // Analyze the sparsity pattern of the KKT system (unless it was analyzed
+    // by a previous solve)
+    // ======================================================================
+    ipm::AnalyzeOrChange( sparseLDLFact, J, analyzed );
 
     // (Approximately) factor the KKT matrix
     // =====================================
@@ -453,6 +454,114 @@ void Initialize
     }
 }
 
+template<typename Real>
+void Initialize
+(       NormalKKTSystem<Real>& system,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Matrix<Real>& s,
+        SparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
+  bool primalInit,
+  bool dualInit,
+  bool standardShift,
+  const RegSolveCtrl<Real>& solveCtrl )
+{
+    EL_DEBUG_CSE
+    const Int m = b.Height();
+    const Int n = c.Height();
+    const Int k = h.Height();
+    if( primalInit )
+    {
+        if( x.Height() != n || x.Width() != 1 )
+            LogicError("x was of the wrong size");
+        if( s.Height() != k || s.Width() != 1 )
+            LogicError("s was of the wrong size");
+    }
+    if( dualInit )
+    {
+        if( y.Height() != m || y.Width() != 1 )
+            LogicError("y was of the wrong size");
+        if( z.Height() != k || z.Width() != 1 )
+            LogicError("z was of the wrong size");
+    }
+    if( primalInit && dualInit )
+    {
+        // TODO(poulson): Perform a consistency check
+        return;
+    }
+
+    // Form and factor the normal equations with s = z = ones(k,1)
+    // ===========================================================
+    Matrix<Real> ones;
+    Ones( ones, k, 1 );
+    NormalKKT( ones, ones, system );
+    FactorNormalKKT( system, sparseLDLFact, analyzed, solveCtrl );
+
+    // Compute the proposed steps from the normal equations
+    // ----------------------------------------------------
+    // These are the same problems solved via the full KKT system above; with
+    // r_mu = 0 and s = z = ones(k,1), the expanded ds is equal to -dz.
+    Matrix<Real> rc, rb, rh, rmu, u, v;
+    Zeros( rmu, k, 1 );
+    if( !primalInit )
+    {
+        Zeros( rc, n, 1 );
+        rb = b;
+        rb *= -1;
+        rh = h;
+        rh *= -1;
+        SolveNormalKKT
+        ( system, sparseLDLFact, rc, rb, rh, rmu, ones, ones,
+          x, u, v, s, solveCtrl );
+    }
+    if( !dualInit )
+    {
+        rc = c;
+        Zeros( rb, m, 1 );
+        Zeros( rh, k, 1 );
+        SolveNormalKKT
+        ( system, sparseLDLFact, rc, rb, rh, rmu, ones, ones,
+          u, y, z, v, solveCtrl );
+    }
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real sNorm = Nrm2( s );
+    const Real zNorm = Nrm2( z );
+    const Real gammaPrimal = Sqrt(eps)*Max(sNorm,Real(1));
+    const Real gammaDual   = Sqrt(eps)*Max(zNorm,Real(1));
+    if( standardShift )
+    {
+        // alpha_p := min { alpha : s + alpha*e >= 0 }
+        // -------------------------------------------
+        const auto sMinPair = VectorMinLoc( s );
+        const Real alphaPrimal = -sMinPair.value;
+        if( alphaPrimal >= Real(0) && primalInit )
+            RuntimeError("initialized s was non-positive");
+
+        // alpha_d := min { alpha : z + alpha*e >= 0 }
+        // -------------------------------------------
+        const auto zMinPair = VectorMinLoc( z );
+        const Real alphaDual = -zMinPair.value;
+        if( alphaDual >= Real(0) && dualInit )
+            RuntimeError("initialized z was non-positive");
+
+        if( alphaPrimal >= -gammaPrimal )
+            Shift( s, alphaPrimal+1 );
+        if( alphaDual >= -gammaDual )
+            Shift( z, alphaDual+1 );
+    }
+    else
+    {
+        LowerClip( s, gammaPrimal );
+        LowerClip( z, gammaDual   );
+    }
+}
+
 template<typename Real>
 void Initialize
 ( const DistSparseMatrix<Real>& JStatic,
@@ -465,6 +574,7 @@ void Initialize
         DistMultiVec<Real>& z,
         DistMultiVec<Real>& s,
         DistSparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
   bool primalInit,
   bool dualInit,
   bool standardShift,
@@ -509,11 +619,9 @@ void Initialize
     J.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
     UpdateRealPartOfDiagonal( J, Real(1), regTmp );
 
-    // Analyze the nonzero pattern
-    // ===========================
-    const bool hermitian = true;
-    const BisectCtrl bisectCtrl;
-    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    // Analyze the nonzero pattern (unless it was analyzed by a previous solve)
+    // ========================================================================
+    ipm::AnalyzeOrChange( sparseLDLFact, J, analyzed );
 
     // (Approximately) factor the KKT matrix
     // =====================================
@@ -640,6 +748,20 @@ void Initialize
           Matrix<Real>& z, \
           Matrix<Real>& s, \
           SparseLDLFactorization<Real>& sparseLDLFact, \
+    bool& analyzed, \
+    bool primalInit, bool dualInit, bool standardShift, \
+    const RegSolveCtrl<Real>& solveCtrl ); \
+  template void Initialize \
+  (       NormalKKTSystem<Real>& system, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+    const Matrix<Real>& h, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          Matrix<Real>& s, \
+          SparseLDLFactorization<Real>& sparseLDLFact, \
+    bool& analyzed, \
     bool primalInit, bool dualInit, bool standardShift, \
     const RegSolveCtrl<Real>& solveCtrl ); \
   template void Initialize \
@@ -653,6 +775,7 @@ void Initialize
           DistMultiVec<Real>& z, \
           DistMultiVec<Real>& s, \
           DistSparseLDLFactorization<Real>& sparseLDLFact, \
+    bool& analyzed, \
     bool primalInit, bool dualInit, bool standardShift, \
     const RegSolveCtrl<Real>& solveCtrl );
 
@@ -0,0 +1,493 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../util.hpp"
+#include "../../../../Workspace.hpp"
+
+namespace El {
+namespace qp {
+namespace affine {
+
+// See the discussion of NormalKKTSystem in ../util.hpp. The reduction follows
+// from the full KKT system
+//
+//   | Q + gamma^2 I  A^T         G^T          | | dx |   |      -rc       |
+//   |       A     -delta^2 I      0           | | dy | = |      -rb       |,
+//   |       G         0     -(s <> z + beta^2)| | dz |   | z <> rmu - rh  |
+//
+// by first eliminating the bound rows of dz and then dx.
+
+namespace {
+
+// Y := alpha F X + beta Y or Y := alpha F^T X + beta Y
+template<typename Real>
+void MultiplyF
+( Orientation orientation,
+  Real alpha,
+  const NormalKKTSystem<Real>& system,
+  const Matrix<Real>& X,
+  Real beta,
+        Matrix<Real>& Y )
+{
+    EL_DEBUG_CSE
+    const Int numDense = system.denseCols.size();
+    Multiply( orientation, alpha, system.FSparse, X, beta, Y );
+    if( numDense == 0 )
+        return;
+    Matrix<Real> t;
+    if( orientation == NORMAL )
+    {
+        t.Resize( numDense, 1 );
+        for( Int j=0; j<numDense; ++j )
+            t(j) = X(system.denseCols[j]);
+        Gemv( NORMAL, alpha, system.FDense, t, Real(1), Y );
+    }
+    else
+    {
+        Zeros( t, numDense, 1 );
+        Gemv( TRANSPOSE, alpha, system.FDense, X, Real(0), t );
+        for( Int j=0; j<numDense; ++j )
+            Y(system.denseCols[j]) += t(j);
+    }
+}
+
+// Y := alpha (F inv(H) F^T + D) X + beta Y
+template<typename Real>
+void ApplyNormalMatrix
+( Real alpha,
+  const NormalKKTSystem<Real>& system,
+  const Matrix<Real>& X,
+  Real beta,
+        Matrix<Real>& Y )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> t;
+    Zeros( t, system.n, 1 );
+    MultiplyF( TRANSPOSE, Real(1), system, X, Real(0), t );
+    DiagonalSolve( LEFT, NORMAL, system.hDiag, t );
+    Y *= beta;
+    Matrix<Real> DX( X );
+    DiagonalScale( LEFT, NORMAL, system.dDiag, DX );
+    Axpy( alpha, DX, Y );
+    MultiplyF( NORMAL, alpha, system, t, Real(1), Y );
+}
+
+// B := inv(N + F_d inv(H_d) F_d^T) B via the Sherman-Morrison-Woodbury formula
+template<typename Real>
+void SolveNormalMatrix
+( const NormalKKTSystem<Real>& system,
+  const SparseLDLFactorization<Real>& sparseLDLFact,
+        Matrix<Real>& B,
+  const RegSolveCtrl<Real>& solveCtrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> regZero;
+    Zeros( regZero, system.N.Height(), 1 );
+    reg_ldl::RegularizedSolveAfter
+    ( system.N, regZero, sparseLDLFact, B,
+      solveCtrl.relTol, solveCtrl.maxRefineIts, solveCtrl.progress );
+
+    const Int numDense = system.denseCols.size();
+    if( numDense > 0 )
+    {
+        Matrix<Real> t;
+        Zeros( t, numDense, 1 );
+        Gemv( TRANSPOSE, Real(1), system.FDense, B, Real(0), t );
+        cholesky::SolveAfter( LOWER, NORMAL, system.capacitance, t );
+        Gemv( NORMAL, Real(-1), system.NInvU, t, Real(1), B );
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real>
+bool NormalKKTStructure
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const SparseMatrix<Real>& G,
+  const MehrotraCtrl<Real>& ctrl,
+        NormalKKTSystem<Real>& system )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = G.Height();
+    system.m = m;
+    system.n = n;
+    system.k = k;
+    system.gamma = ctrl.reg0Perm;
+    system.delta = ctrl.reg1Perm;
+    system.beta = ctrl.reg2Perm;
+
+    // Extract the diagonal of Q
+    // =========================
+    Zeros( system.qDiag, n, 1 );
+    const Int numEntriesQ = Q.NumEntries();
+    for( Int e=0; e<numEntriesQ; ++e )
+    {
+        const Int i = Q.Row(e);
+        const Int j = Q.Col(e);
+        if( i == j )
+            system.qDiag(i) += Q.Value(e);
+        else if( Q.Value(e) != Real(0) )
+            return false;
+    }
+
+    // Split the rows of G into bound rows and general rows
+    // ====================================================
+    system.boundCol.assign( k, -1 );
+    Zeros( system.boundVal, k, 1 );
+    system.generalIndex.assign( k, -1 );
+    system.generalRows.clear();
+    for( Int i=0; i<k; ++i )
+    {
+        const Int offset = G.RowOffset(i);
+        const Int numConn = G.NumConnections(i);
+        if( numConn == 1 )
+        {
+            system.boundCol[i] = G.Col(offset);
+            system.boundVal(i) = G.Value(offset);
+        }
+        else if( numConn > 1 )
+        {
+            system.generalIndex[i] = system.generalRows.size();
+            system.generalRows.push_back( i );
+        }
+    }
+    const Int numGeneral = system.generalRows.size();
+    const Int height = m + numGeneral;
+    if( height == 0 )
+        return false;
+
+    // Find the dense columns of F = [A; G_g]
+    // ======================================
+    vector<Int> colCounts( n, 0 );
+    const Int numEntriesA = A.NumEntries();
+    for( Int e=0; e<numEntriesA; ++e )
+        ++colCounts[A.Col(e)];
+    for( const Int& i : system.generalRows )
+    {
+        const Int offset = G.RowOffset(i);
+        const Int numConn = G.NumConnections(i);
+        for( Int e=offset; e<offset+numConn; ++e )
+            ++colCounts[G.Col(e)];
+    }
+    const Real denseThresh =
+      Max( Real(ctrl.denseColMin), ctrl.denseColRatio*height );
+    vector<Int> candidates;
+    for( Int j=0; j<n; ++j )
+        if( colCounts[j] > denseThresh )
+            candidates.push_back( j );
+    std::stable_sort
+    ( candidates.begin(), candidates.end(),
+      [&]( const Int& a, const Int& b )
+      { return colCounts[a] > colCounts[b]; } );
+    if( Int(candidates.size()) > ctrl.maxDenseCols )
+        candidates.resize( Max(ctrl.maxDenseCols,Int(0)) );
+    std::sort( candidates.begin(), candidates.end() );
+    system.denseCols = candidates;
+    const Int numDense = system.denseCols.size();
+    vector<Int> denseIndex( n, -1 );
+    for( Int j=0; j<numDense; ++j )
+        denseIndex[system.denseCols[j]] = j;
+
+    // Form the sparse and dense portions of F
+    // =======================================
+    Zeros( system.FSparse, height, n );
+    Zeros( system.FDense, height, numDense );
+    system.FSparse.Reserve( numEntriesA + G.NumEntries() );
+    auto queueUpdate = [&]( Int i, Int j, Real value )
+      {
+        if( denseIndex[j] >= 0 )
+            system.FDense(i,denseIndex[j]) += value;
+        else
+            system.FSparse.QueueUpdate( i, j, value );
+      };
+    for( Int e=0; e<numEntriesA; ++e )
+        queueUpdate( A.Row(e), A.Col(e), A.Value(e) );
+    for( Int g=0; g<numGeneral; ++g )
+    {
+        const Int i = system.generalRows[g];
+        const Int offset = G.RowOffset(i);
+        const Int numConn = G.NumConnections(i);
+        for( Int e=offset; e<offset+numConn; ++e )
+            queueUpdate( m+g, G.Col(e), G.Value(e) );
+    }
+    system.FSparse.ProcessQueues();
+    Transpose( system.FSparse, system.FSparseTrans );
+
+    if( ctrl.print )
+        Output
+        ("Normal equations of height ",height," with ",k-numGeneral,
+         " eliminated rows of G and ",numDense," dense columns");
+
+    // Form the sparsity pattern of the normal matrix
+    // ==============================================
+    Matrix<Real> ones;
+    Ones( ones, k, 1 );
+    NormalKKT( ones, ones, system );
+
+    return true;
+}
+
+template<typename Real>
+void NormalKKT
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+        NormalKKTSystem<Real>& system )
+{
+    EL_DEBUG_CSE
+    const Int m = system.m;
+    const Int n = system.n;
+    const Int k = system.k;
+    const Int numGeneral = system.generalRows.size();
+    const Int height = m + numGeneral;
+    const Real gamma = system.gamma;
+    const Real delta = system.delta;
+    const Real beta = system.beta;
+    // The same relative diagonal inflation as the LP normal equations
+    const Real inflateRatio = Pow(limits::Epsilon<Real>(),Real(0.83));
+
+    // w := s <> z + beta^2
+    // ====================
+    system.wDiag.Resize( k, 1 );
+    for( Int i=0; i<k; ++i )
+        system.wDiag(i) = s(i)/z(i) + beta*beta;
+
+    // h := diag(Q) + gamma^2 + diag(G_b^T inv(W_b) G_b)
+    // =================================================
+    // NOTE: Free variables with no bound rows rely upon gamma being positive
+    system.hDiag = system.qDiag;
+    Shift( system.hDiag, gamma*gamma );
+    for( Int i=0; i<k; ++i )
+    {
+        const Int j = system.boundCol[i];
+        if( j >= 0 )
+        {
+            const Real value = system.boundVal(i);
+            system.hDiag(j) += value*value/system.wDiag(i);
+        }
+    }
+
+    // d := [delta^2; w_g]
+    // ===================
+    system.dDiag.Resize( height, 1 );
+    for( Int i=0; i<m; ++i )
+        system.dDiag(i) = delta*delta;
+    for( Int g=0; g<numGeneral; ++g )
+        system.dDiag(m+g) = system.wDiag(system.generalRows[g]);
+
+    // Form F_s inv(H) F_s^T + D
+    // =========================
+    Matrix<Real> hSqrt;
+    hSqrt.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+        hSqrt(j) = Sqrt(system.hDiag(j));
+    auto FScaledTrans = system.FSparseTrans;
+    DiagonalSolve( LEFT, NORMAL, hSqrt, FScaledTrans );
+    auto& N = system.N;
+    Zeros( N, height, height );
+    N.Reserve( height );
+    for( Int i=0; i<height; ++i )
+        N.QueueUpdate( i, i, system.dDiag(i) );
+    N.ProcessQueues();
+    Syrk( LOWER, TRANSPOSE, Real(1), FScaledTrans, Real(1), N );
+
+    // Inflate the diagonal in a small relative sense
+    // ==============================================
+    Real* valBuf = N.ValueBuffer();
+    for( Int i=0; i<height; ++i )
+    {
+        const Int e = N.Offset( i, i );
+        valBuf[e] = (1+inflateRatio)*Abs(valBuf[e]);
+    }
+
+    MakeSymmetric( LOWER, N );
+}
+
+template<typename Real>
+void FactorNormalKKT
+(       NormalKKTSystem<Real>& system,
+        SparseLDLFactorization<Real>& sparseLDLFact,
+  bool& analyzed,
+  const RegSolveCtrl<Real>& solveCtrl )
+{
+    EL_DEBUG_CSE
+    ipm::AnalyzeOrChange( sparseLDLFact, system.N, analyzed );
+    sparseLDLFact.Factor( LDL_2D );
+
+    const Int numDense = system.denseCols.size();
+    if( numDense == 0 )
+        return;
+
+    // inv(N) F_d
+    // ==========
+    Matrix<Real> regZero;
+    Zeros( regZero, system.N.Height(), 1 );
+    system.NInvU = system.FDense;
+    for( Int j=0; j<numDense; ++j )
+    {
+        auto NInvu = system.NInvU( ALL, IR(j) );
+        reg_ldl::RegularizedSolveAfter
+        ( system.N, regZero, sparseLDLFact, NInvu,
+          solveCtrl.relTol, solveCtrl.maxRefineIts, solveCtrl.progress );
+    }
+
+    // Factor the capacitance matrix, H_d + F_d^T inv(N) F_d
+    // =====================================================
+    Zeros( system.capacitance, numDense, numDense );
+    for( Int j=0; j<numDense; ++j )
+        system.capacitance(j,j) = system.hDiag(system.denseCols[j]);
+    Gemm
+    ( TRANSPOSE, NORMAL,
+      Real(1), system.FDense, system.NInvU,
+      Real(1), system.capacitance );
+    Cholesky( LOWER, system.capacitance );
+}
+
+template<typename Real>
+void SolveNormalKKT
+( const NormalKKTSystem<Real>& system,
+  const SparseLDLFactorization<Real>& sparseLDLFact,
+  const Matrix<Real>& rc,
+  const Matrix<Real>& rb,
+  const Matrix<Real>& rh,
+  const Matrix<Real>& rmu,
+  const Matrix<Real>& s,
+  const Matrix<Real>& z,
+        Matrix<Real>& dx,
+        Matrix<Real>& dy,
+        Matrix<Real>& dz,
+        Matrix<Real>& ds,
+  const RegSolveCtrl<Real>& solveCtrl )
+{
+    EL_DEBUG_CSE
+    const Int m = system.m;
+    const Int k = system.k;
+    const Int numGeneral = system.generalRows.size();
+
+    // r_z := z <> r_mu - r_h
+    // ======================
+    Matrix<Real> rz( rmu );
+    DiagonalSolve( LEFT, NORMAL, z, rz );
+    rz -= rh;
+
+    // r_x := -r_c + G_b^T inv(W_b) r_z
+    // ================================
+    Matrix<Real> rx( rc );
+    rx *= -1;
+    for( Int i=0; i<k; ++i )
+    {
+        const Int j = system.boundCol[i];
+        if( j >= 0 )
+            rx(j) += system.boundVal(i)*rz(i)/system.wDiag(i);
+    }
+
+    // Solve (F inv(H) F^T + D) u = F inv(H) r_x + [r_b; -r_z(g)]
+    // ==========================================================
+    Matrix<Real> rhs, u, t( rx );
+    DiagonalSolve( LEFT, NORMAL, system.hDiag, t );
+    rhs.Resize( m+numGeneral, 1 );
+    for( Int i=0; i<m; ++i )
+        rhs(i) = rb(i);
+    for( Int g=0; g<numGeneral; ++g )
+        rhs(m+g) = -rz(system.generalRows[g]);
+    MultiplyF( NORMAL, Real(1), system, t, Real(1), rhs );
+
+    // Refine against the normal matrix including its dense columns
+    u = rhs;
+    SolveNormalMatrix( system, sparseLDLFact, u, solveCtrl );
+    const Real rhsNrm2 = Nrm2( rhs );
+    Matrix<Real> res;
+    for( Int refineIt=0; refineIt<solveCtrl.maxRefineIts; ++refineIt )
+    {
+        res = rhs;
+        ApplyNormalMatrix( Real(-1), system, u, Real(1), res );
+        const Real resNrm2 = Nrm2( res );
+        if( solveCtrl.progress )
+            Output("Normal equations refinement ",refineIt,": ",resNrm2);
+        if( resNrm2 <= solveCtrl.relTol*rhsNrm2 )
+            break;
+        SolveNormalMatrix( system, sparseLDLFact, res, solveCtrl );
+        u += res;
+    }
+
+    // dx := inv(H) (r_x - F^T u)
+    // ==========================
+    dx = rx;
+    MultiplyF( TRANSPOSE, Real(-1), system, u, Real(1), dx );
+    DiagonalSolve( LEFT, NORMAL, system.hDiag, dx );
+
+    // Expand dy and dz, with dz_b := inv(W_b) (G_b dx - r_z)
+    // ======================================================
+    dy = u( IR(0,m), ALL );
+    dz.Resize( k, 1 );
+    for( Int i=0; i<k; ++i )
+    {
+        const Int g = system.generalIndex[i];
+        const Int j = system.boundCol[i];
+        if( g >= 0 )
+            dz(i) = u(m+g);
+        else if( j >= 0 )
+            dz(i) = (system.boundVal(i)*dx(j) - rz(i)) / system.wDiag(i);
+        else
+            dz(i) = -rz(i) / system.wDiag(i);
+    }
+
+    // ds := - z <> ( rmu + s o dz )
+    // =============================
+    ds = dz;
+    DiagonalScale( LEFT, NORMAL, s, ds );
+    ds += rmu;
+    DiagonalSolve( LEFT, NORMAL, z, ds );
+    ds *= -1;
+}
+
+#define PROTO(Real) \
+  template bool NormalKKTStructure \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const SparseMatrix<Real>& G, \
+    const MehrotraCtrl<Real>& ctrl, \
+          NormalKKTSystem<Real>& system ); \
+  template void NormalKKT \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& z, \
+          NormalKKTSystem<Real>& system ); \
+  template void FactorNormalKKT \
+  (       NormalKKTSystem<Real>& system, \
+          SparseLDLFactorization<Real>& sparseLDLFact, \
+    bool& analyzed, \
+    const RegSolveCtrl<Real>& solveCtrl ); \
+  template void SolveNormalKKT \
+  ( const NormalKKTSystem<Real>& system, \
+    const SparseLDLFactorization<Real>& sparseLDLFact, \
+    const Matrix<Real>& rc, \
+    const Matrix<Real>& rb, \
+    const Matrix<Real>& rh, \
+    const Matrix<Real>& rmu, \
+    const Matrix<Real>& s, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& dx, \
+          Matrix<Real>& dy, \
+          Matrix<Real>& dz, \
+          Matrix<Real>& ds, \
+    const RegSolveCtrl<Real>& solveCtrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace affine
+} // namespace qp
+} // namespace El
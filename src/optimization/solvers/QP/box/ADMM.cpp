@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "../../ADMM.hpp"
 
 // TODO: Add a conic-form ADMM (i.e., x >= 0)
 
@@ -40,97 +41,54 @@ ADMM
     const Int n = Q.Height();
     const Int k = C.Width();
 
-    // Cache the factorization of Q + rho*I
-    Matrix<Real> LMod( Q );
-    ShiftDiagonal( LMod, ctrl.rho );
-    if( ctrl.inv )
-    {
-        HPDInverse( LOWER, LMod );
-    }
-    else
-    {
-        Cholesky( LOWER, LMod );
-        MakeTrapezoidal( LOWER, LMod );
-    }
-
-    // Start the ADMM
-    Int numIter=0;
-    Matrix<Real> X, U, T, ZOld, XHat;
+    // Cache a factorization of Q + rho*I (or, if rho is adapted, an
+    // eigendecomposition of Q)
+    admm::ShiftedHermitianSolver<Matrix<Real>>
+      solver( Q, ctrl.rho, ctrl.accelCtrl.adaptiveRho, ctrl.inv );
+
+    // x := (Q+rho*I)^{-1} (rho v - c)
+    auto xUpdate =
+      [&]( const Matrix<Real>& V, const Real& rho, Matrix<Real>& X )
+      {
+          fused::Assign( X, rho*fused::Ref(V) - fused::Ref(C) );
+          solver.Solve( rho, X );
+      };
+    // z := Clip(v,lb,ub)
+    auto zUpdate =
+      [&]( const Matrix<Real>& V, const Real& rho, Matrix<Real>& Z )
+      { fused::Assign( Z, fused::Clip( fused::Ref(V), lb, ub ) ); };
+    auto monitor =
+      [&]( Int numIter, const Matrix<Real>& X, const Matrix<Real>& Z,
+           const Real& rho, const Real& rNorm, const Real& epsPri,
+           const Real& sNorm, const Real& epsDual )
+      {
+          // Form (1/2) x' Q x + c' x
+          Matrix<Real> T;
+          Zeros( T, n, k );
+          Hemm( LEFT, LOWER, Real(1), Q, X, Real(0), T );
+          const Real objective = HilbertSchmidt(X,T)/2 + HilbertSchmidt(C,X);
+
+          const Real clipDist =
+            fused::FrobeniusNorm
+            ( fused::Clip(fused::Ref(X),lb,ub) - fused::Ref(X) );
+          cout << numIter << ": "
+            << "||X-Z||_F=" << rNorm << ", "
+            << "epsPri=" << epsPri << ", "
+            << "|rho| ||Z-ZOld||_F=" << sNorm << ", "
+            << "epsDual=" << epsDual << ", "
+            << "rho=" << rho << ", "
+            << "||X-Clip(X,lb,ub)||_F=" << clipDist << ", "
+            << "(1/2) <X,Q X> + <C,X>=" << objective << endl;
+      };
+
+    Matrix<Real> X, U;
+    Zeros( X, n, k );
     Zeros( Z, n, k );
     Zeros( U, n, k );
-    Zeros( T, n, k );
-    while( numIter < ctrl.maxIter )
-    {
-        ZOld = Z;
-
-        // x := (Q+rho*I)^{-1} (rho(z-u)-q)
-        X = Z;
-        X -= U;
-        X *= ctrl.rho;
-        X -= C;
-        if( ctrl.inv )
-        {
-            auto Y( X );
-            Hemm( LEFT, LOWER, Real(1), LMod, Y, Real(0), X );
-        }
-        else
-        {
-            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), LMod, X );
-            Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Real(1), LMod, X );
-        }
-
-        // xHat := alpha*x + (1-alpha)*zOld
-        XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
-
-        // z := Clip(xHat+u,lb,ub)
-        Z = XHat;
-        Z += U;
-        Clip( Z, lb, ub );
-
-        // u := u + (xHat-z)
-        U += XHat;
-        U -= Z;
-
-        // rNorm := || x - z ||_2
-        T = X;
-        T -= Z;
-        const Real rNorm = FrobeniusNorm( T );
-
-        // sNorm := |rho| || z - zOld ||_2
-        T = Z;
-        T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( T );
-
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
-
-        if( ctrl.print )
-        {
-            // Form (1/2) x' Q x + c' x
-            Zeros( T, n, k );
-            Hemm( LEFT, LOWER, Real(1), Q, X, Real(0), T );
-            const Real objective = HilbertSchmidt(X,T)/2 + HilbertSchmidt(C,X);
-
-            T = X;
-            Clip( T, lb, ub );
-            T -= X;
-            const Real clipDist = FrobeniusNorm( T );
-            cout << numIter << ": "
-              << "||X-Z||_F=" << rNorm << ", "
-              << "epsPri=" << epsPri << ", "
-              << "|rho| ||Z-ZOld||_F=" << sNorm << ", "
-              << "epsDual=" << epsDual << ", "
-              << "||X-Clip(X,lb,ub)||_F=" << clipDist << ", "
-              << "(1/2) <X,Q X> + <C,X>=" << objective << endl;
-        }
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
+    const Int numIter =
+      admm::Run
+      ( xUpdate, zUpdate, monitor, X, Z, U,
+        admm::MakeParams<Real>( ctrl, ctrl.print ) );
     if( ctrl.maxIter == numIter )
         RuntimeError("ADMM failed to converge");
     return numIter;
@@ -162,98 +120,62 @@ ADMM
     const Int n = Q.Height();
     const Int k = C.Width();
 
-    // Cache the factorization of Q + rho*I
-    DistMatrix<Real> LMod( Q );
-    ShiftDiagonal( LMod, ctrl.rho );
-    if( ctrl.inv )
-    {
-        HPDInverse( LOWER, LMod );
-    }
-    else
-    {
-        Cholesky( LOWER, LMod );
-        MakeTrapezoidal( LOWER, LMod );
-    }
-
-    // Start the ADMM
-    Int numIter=0;
-    DistMatrix<Real> X(grid), U(grid), T(grid), ZOld(grid), XHat(grid);
+    // Cache a factorization of Q + rho*I (or, if rho is adapted, an
+    // eigendecomposition of Q)
+    admm::ShiftedHermitianSolver<DistMatrix<Real>>
+      solver( Q, ctrl.rho, ctrl.accelCtrl.adaptiveRho, ctrl.inv );
+
+    // The fused updates require the iterates (and C) to share the alignments
+    // of Z
+    DistMatrix<Real> X(grid), U(grid), CAlign(grid);
+    X.AlignWith( Z );
+    U.AlignWith( Z );
+    CAlign.AlignWith( Z );
+    CAlign = C;
+    Zeros( X, n, k );
     Zeros( Z, n, k );
     Zeros( U, n, k );
-    Zeros( T, n, k );
-    while( numIter < ctrl.maxIter )
-    {
-        ZOld = Z;
-
-        // x := (Q+rho*I)^{-1} (rho(z-u)-q)
-        X = Z;
-        X -= U;
-        X *= ctrl.rho;
-        X -= C;
-        if( ctrl.inv )
-        {
-            auto Y( X );
-            Hemm( LEFT, LOWER, Real(1), LMod, Y, Real(0), X );
-        }
-        else
-        {
-            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), LMod, X );
-            Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Real(1), LMod, X );
-        }
-
-        // xHat := alpha*x + (1-alpha)*zOld
-        XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
-
-        // z := Clip(xHat+u,lb,ub)
-        Z = XHat;
-        Z += U;
-        Clip( Z, lb, ub );
-
-        // u := u + (xHat-z)
-        U += XHat;
-        U -= Z;
-
-        // rNorm := || x - z ||_2
-        T = X;
-        T -= Z;
-        const Real rNorm = FrobeniusNorm( T );
-
-        // sNorm := |rho| || z - zOld ||_2
-        T = Z;
-        T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( T );
-
-        const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
-        const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
-
-        if( ctrl.print )
-        {
-            // Form (1/2) x' Q x + c' x
-            Zeros( T, n, k );
-            Hemm( LEFT, LOWER, Real(1), Q, X, Real(0), T );
-            const Real objective = HilbertSchmidt(X,T)/2 + HilbertSchmidt(C,X);
 
-            T = X;
-            Clip( T, lb, ub );
-            T -= X;
-            const Real clipDist = FrobeniusNorm( T );
-            if( grid.Rank() == 0 )
-                cout << numIter << ": "
-                  << "||X-Z||_F=" << rNorm << ", "
-                  << "epsPri=" << epsPri << ", "
-                  << "|rho| ||Z-ZOld||_F=" << sNorm << ", "
-                  << "epsDual=" << epsDual << ", "
-                  << "||X-Clip(X,lb,ub)||_2=" << clipDist << ", "
-                  << "(1/2) <X,Q X> + <C,X>=" << objective << endl;
-        }
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
-        ++numIter;
-    }
+    // x := (Q+rho*I)^{-1} (rho v - c)
+    auto xUpdate =
+      [&]( const DistMatrix<Real>& V, const Real& rho, DistMatrix<Real>& X )
+      {
+          fused::Assign( X, rho*fused::Ref(V) - fused::Ref(CAlign) );
+          solver.Solve( rho, X );
+      };
+    // z := Clip(v,lb,ub)
+    auto zUpdate =
+      [&]( const DistMatrix<Real>& V, const Real& rho, DistMatrix<Real>& Z )
+      { fused::Assign( Z, fused::Clip( fused::Ref(V), lb, ub ) ); };
+    auto monitor =
+      [&]( Int numIter, const DistMatrix<Real>& X, const DistMatrix<Real>& Z,
+           const Real& rho, const Real& rNorm, const Real& epsPri,
+           const Real& sNorm, const Real& epsDual )
+      {
+          // Form (1/2) x' Q x + c' x
+          DistMatrix<Real> T(grid);
+          Zeros( T, n, k );
+          Hemm( LEFT, LOWER, Real(1), Q, X, Real(0), T );
+          const Real objective = HilbertSchmidt(X,T)/2 + HilbertSchmidt(C,X);
+
+          const Real clipDist =
+            fused::FrobeniusNorm
+            ( fused::Clip(fused::Ref(X),lb,ub) - fused::Ref(X) );
+          if( grid.Rank() == 0 )
+              cout << numIter << ": "
+                << "||X-Z||_F=" << rNorm << ", "
+                << "epsPri=" << epsPri << ", "
+                << "|rho| ||Z-ZOld||_F=" << sNorm << ", "
+                << "epsDual=" << epsDual << ", "
+                << "rho=" << rho << ", "
+                << "||X-Clip(X,lb,ub)||_2=" << clipDist << ", "
+                << "(1/2) <X,Q X> + <C,X>=" << objective << endl;
+      };
+
+    const Int numIter =
+      admm::Run
+      ( xUpdate, zUpdate, monitor, X, Z, U,
+        admm::MakeParams<Real>( ctrl, ctrl.print ) );
     if( ctrl.maxIter == numIter )
         RuntimeError("ADMM failed to converge");
     return numIter;
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../Checkpoint.hpp"
 
 namespace El {
 namespace qp {
@@ -91,9 +92,15 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, n, x, y, z );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     Initialize
     ( Q, A, b, c, x, y, z,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+      primalInit, dualInit, ctrl.standardInitShift );
 
     Real relError = 1;
     Matrix<Real> J, d,
@@ -104,8 +111,12 @@ void Mehrotra
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z );
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -461,9 +472,15 @@ void Mehrotra
         }
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, n, x, y, z );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     Initialize
     ( Q, A, b, c, x, y, z,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+      primalInit, dualInit, ctrl.standardInitShift );
 
     Real relError = 1;
     DistMatrix<Real>
@@ -481,8 +498,12 @@ void Mehrotra
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z );
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -812,7 +833,14 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, n, x, y, z );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     SparseLDLFactorization<Real> sparseLDLFact;
+
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -822,7 +850,7 @@ void Mehrotra
         Initialize
         ( Q, A, b, c, x, y, z,
           sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
     else
@@ -831,7 +859,7 @@ void Mehrotra
         Initialize
         ( Q, A, b, c, x, y, z,
           augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
 
@@ -868,8 +896,12 @@ void Mehrotra
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z );
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -982,9 +1014,9 @@ void Mehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 &&
+                if( numIts == firstIt &&
                     (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit) ) )
+                     (primalInit && dualInit) ) )
                 {
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
@@ -1258,7 +1290,14 @@ void Mehrotra
         }
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, n, x, y, z );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     DistSparseLDLFactorization<Real> sparseLDLFact;
+
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -1270,7 +1309,7 @@ void Mehrotra
         Initialize
         ( Q, A, b, c, x, y, z,
           sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
     else
@@ -1279,7 +1318,7 @@ void Mehrotra
         Initialize
         ( Q, A, b, c, x, y, z,
           augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
     if( commRank == 0 && ctrl.time )
@@ -1323,8 +1362,12 @@ void Mehrotra
     DistMultiVec<Real> dInner(grid);
     DistMultiVec<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z );
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -1422,7 +1465,7 @@ void Mehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
-            if( numIts == 0 )
+            if( numIts == firstIt )
             {
                 if( ctrl.print )
                 {
@@ -1455,9 +1498,9 @@ void Mehrotra
                 if( commRank == 0 && ctrl.time )
                     Output("Equilibration: ",timer.Stop()," secs");
 
-                if( numIts == 0 &&
+                if( numIts == firstIt &&
                     (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                     (primalInit && dualInit)) )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
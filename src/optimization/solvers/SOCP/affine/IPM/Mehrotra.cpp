@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../Checkpoint.hpp"
 
 namespace El {
 namespace socp {
@@ -100,9 +101,15 @@ void Mehrotra
         Output("|| h ||_2 = ",hNrm2);
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, k, x, y, z, &s );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+      primalInit, dualInit, ctrl.standardInitShift );
 
     Real relError = 1;
     Matrix<Real> J, d,
@@ -116,8 +123,12 @@ void Mehrotra
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, dmuError;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z, &s );
+
         // Ensure that s and z are in the cone
         // ===================================
         const Real minDist = eps;
@@ -458,9 +469,15 @@ void Mehrotra
         }
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, k, x, y, z, &s );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, cutoffPar );
+      primalInit, dualInit, ctrl.standardInitShift, cutoffPar );
 
     Real relError = 1;
     DistMatrix<Real> J(grid),     d(grid),
@@ -486,8 +503,12 @@ void Mehrotra
       dxError(grid), dyError(grid), dzError(grid), dmuError(grid);
     dzError.AlignWith( s );
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z, &s );
+
         // Ensure that s and z are in the cone
         // ===================================
         const Real minDist = eps;
@@ -820,9 +841,15 @@ void Mehrotra
         Output("|| h ||_2 = ",hNrm2);
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, k, x, y, z, &s );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+      primalInit, dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
 
     // Form the offsets for the sparse embedding of the barrier's Hessian
     // ==================================================================
@@ -896,8 +923,12 @@ void Mehrotra
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, dmuError;
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z, &s );
+
         // Ensure that s and z are in the cone
         // ===================================
         const Real minDist = eps;
@@ -1288,11 +1319,17 @@ void Mehrotra
         }
     }
 
+    Int numIts = 0;
+    const bool restarted = ipm::Restart( ctrl, numIts, n, m, k, x, y, z, &s );
+    const bool primalInit = ctrl.primalInit || restarted;
+    const bool dualInit = ctrl.dualInit || restarted;
+    const Int firstIt = numIts;
+
     if( commRank == 0 && ctrl.time )
         timer.Start();
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, cutoffPar,
+      primalInit, dualInit, ctrl.standardInitShift, cutoffPar,
       ctrl.solveCtrl );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
@@ -1311,6 +1348,13 @@ void Mehrotra
       cutoffSparse );
     const Int kSparse = sparseFirstInds.Height();
 
+    // Form the metadata for the cones which straddle process boundaries
+    // =================================================================
+    // This is reused by every cone kernel within the iterations so that
+    // only the kernels involving straddling cones communicate
+    cone::DistConeMeta coneMeta;
+    coneMeta.Initialize( orders, firstInds );
+
     auto& sparseOrdersLoc = sparseOrders.LockedMatrix();
     auto& sparseFirstIndsLoc = sparseFirstInds.LockedMatrix();
     auto& sparseToOrigOrdersLoc = sparseToOrigOrders.LockedMatrix();
@@ -1390,17 +1434,21 @@ void Mehrotra
     DistMultiVec<Real> dxError(grid), dyError(grid),
                        dzError(grid), dmuError(grid);
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        // Checkpoint the current iterates
+        // ===============================
+        ipm::Checkpoint( ctrl, numIts, firstIt, x, y, z, &s );
+
         if( ctrl.time && commRank == 0 )
             iterTimer.Start();
         // Ensure that s and z are in the cone
         // ===================================
         // TODO(poulson): Let this be a function of the relative error, etc.
         const Real minDist = eps;
-        soc::PushInto( s, orders, firstInds, minDist, cutoffPar );
-        soc::PushInto( z, orders, firstInds, minDist, cutoffPar );
-        soc::NesterovTodd( s, z, w, orders, firstInds, cutoffPar );
+        soc::PushInto( s, orders, firstInds, minDist, coneMeta );
+        soc::PushInto( z, orders, firstInds, minDist, coneMeta );
+        soc::NesterovTodd( s, z, w, orders, firstInds, coneMeta );
 
         // Check for convergence
         // =====================
@@ -1485,16 +1533,16 @@ void Mehrotra
                 Output
                 ("|| w ||_max = ",wMaxNorm," was larger than ",wMaxNormLimit);
             soc::PushPairInto
-            ( s, z, w, orders, firstInds, wMaxNormLimit, cutoffPar );
-            soc::NesterovTodd( s, z, w, orders, firstInds, cutoffPar );
+            ( s, z, w, orders, firstInds, wMaxNormLimit, coneMeta );
+            soc::NesterovTodd( s, z, w, orders, firstInds, coneMeta );
             wMaxNorm = MaxNorm(w);
             if( ctrl.print && commRank == 0 )
                 Output("New || w ||_max = ",wMaxNorm);
         }
-        soc::SquareRoot( w, wRoot, orders, firstInds, cutoffPar );
-        soc::Inverse( wRoot, wRootInv, orders, firstInds, cutoffPar );
-        soc::ApplyQuadratic( wRoot, z, l, orders, firstInds, cutoffPar );
-        soc::Inverse( l, lInv, orders, firstInds, cutoffPar );
+        soc::SquareRoot( w, wRoot, orders, firstInds, coneMeta );
+        soc::Inverse( wRoot, wRootInv, orders, firstInds, coneMeta );
+        soc::ApplyQuadratic( wRoot, z, l, orders, firstInds, coneMeta );
+        soc::Inverse( l, lInv, orders, firstInds, coneMeta );
         const Real mu = Dot(s,z) / degree;
 
         // r_mu := l
@@ -1511,7 +1559,7 @@ void Mehrotra
         ( m, n, w,
           orders, firstInds,
           origToSparseOrders, origToSparseFirstInds,
-          kSparse, JOrig, onlyLower, cutoffPar );
+          kSparse, JOrig, onlyLower, coneMeta );
         if( ctrl.time && commRank == 0 )
             Output("KKT construction: ",timer.Stop()," secs");
         if( ctrl.time && commRank == 0 )
@@ -1519,7 +1567,7 @@ void Mehrotra
         KKTRHS
         ( rc, rb, rh, rmu, wRoot,
           orders, firstInds, origToSparseFirstInds, kSparse,
-          d, cutoffPar );
+          d, coneMeta );
         if( ctrl.time && commRank == 0 )
             Output("KKTRHS construction: ",timer.Stop()," secs");
         // Cache the metadata for the finalized JOrig
@@ -1585,11 +1633,11 @@ void Mehrotra
           orders, firstInds,
           sparseOrders, sparseFirstInds,
           sparseToOrigOrders, sparseToOrigFirstInds,
-          dxAff, dyAff, dzAff, dsAff, cutoffPar );
+          dxAff, dyAff, dzAff, dsAff, coneMeta );
         soc::ApplyQuadratic
-        ( wRoot, dzAff, dzAffScaled, orders, firstInds, cutoffPar );
+        ( wRoot, dzAff, dzAffScaled, orders, firstInds, coneMeta );
         soc::ApplyQuadratic
-        ( wRootInv, dsAff, dsAffScaled, orders, firstInds, cutoffPar );
+        ( wRootInv, dsAff, dsAffScaled, orders, firstInds, coneMeta );
 
         if( ctrl.checkResiduals && ctrl.print )
         {
@@ -1641,9 +1689,9 @@ void Mehrotra
         if( ctrl.time && commRank == 0 )
             timer.Start();
         Real alphaAffPri =
-          soc::MaxStep( s, dsAff, orders, firstInds, Real(1), cutoffPar );
+          soc::MaxStep( s, dsAff, orders, firstInds, Real(1), coneMeta );
         Real alphaAffDual =
-          soc::MaxStep( z, dzAff, orders, firstInds, Real(1), cutoffPar );
+          soc::MaxStep( z, dzAff, orders, firstInds, Real(1), coneMeta );
         if( ctrl.time && commRank == 0 )
             Output("Affine line search: ",timer.Stop()," secs");
         if( ctrl.forceSameStep )
@@ -1675,9 +1723,10 @@ void Mehrotra
         {
             // r_mu := l + inv(l) o ((inv(W)^T dsAff) o (W dzAff) - sigma*mu)
             // --------------------------------------------------------------
-            soc::Apply( dsAffScaled, dzAffScaled, rmu, orders, firstInds );
+            soc::Apply
+            ( dsAffScaled, dzAffScaled, rmu, orders, firstInds, coneMeta );
             soc::Shift( rmu, -sigma*mu, orders, firstInds );
-            soc::Apply( lInv, rmu, orders, firstInds );
+            soc::Apply( lInv, rmu, orders, firstInds, coneMeta );
             rmu += l;
         }
         else
@@ -1694,7 +1743,7 @@ void Mehrotra
         KKTRHS
         ( rc, rb, rh, rmu, wRoot,
           orders, firstInds, origToSparseFirstInds, kSparse,
-          d, cutoffPar );
+          d, coneMeta );
         try
         {
             if( commRank == 0 && ctrl.time )
@@ -1728,7 +1777,7 @@ void Mehrotra
           orders, firstInds,
           sparseOrders, sparseFirstInds,
           sparseToOrigOrders, sparseToOrigFirstInds,
-          dx, dy, dz, ds, cutoffPar );
+          dx, dy, dz, ds, coneMeta );
         if( ctrl.time && commRank == 0 )
             Output("ExpandSolution: ",timer.Stop()," secs");
 
@@ -1738,10 +1787,10 @@ void Mehrotra
             timer.Start();
         Real alphaPri =
           soc::MaxStep
-          ( s, ds, orders, firstInds, 1/ctrl.maxStepRatio, cutoffPar );
+          ( s, ds, orders, firstInds, 1/ctrl.maxStepRatio, coneMeta );
         Real alphaDual =
           soc::MaxStep
-          ( z, dz, orders, firstInds, 1/ctrl.maxStepRatio, cutoffPar );
+          ( z, dz, orders, firstInds, 1/ctrl.maxStepRatio, coneMeta );
         if( ctrl.time && commRank == 0 )
             Output("Combined line search: ",timer.Stop()," secs");
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
@@ -142,7 +142,7 @@ void KKT
   const DistMultiVec<Int>& origToSparseFirstInds,
         Int kSparse,
         DistSparseMatrix<Real>& J,
-  bool onlyLower=false, Int cutoffPar=1000 );
+  bool onlyLower, const cone::DistConeMeta& coneMeta );
 template<typename Real>
 void StaticKKT
 ( const DistSparseMatrix<Real>& A,
@@ -167,7 +167,7 @@ void FinishKKT
   const DistMultiVec<Int>& origToSparseFirstInds,
         Int kSparse,
         DistSparseMatrix<Real>& J,
-  bool onlyLower=false, Int cutoffPar=1000 );
+  bool onlyLower, const cone::DistConeMeta& coneMeta );
 
 template<typename Real>
 void KKTRHS
@@ -214,7 +214,7 @@ void KKTRHS
   const DistMultiVec<Int>& origToSparseFirstInds,
         Int kSparse,
         DistMultiVec<Real>& d,
-  Int cutoffPar=1000 );
+  const cone::DistConeMeta& coneMeta );
 
 template<typename Real>
 void ExpandSolution
@@ -273,7 +273,7 @@ void ExpandSolution
         DistMultiVec<Real>& dy,
         DistMultiVec<Real>& dz,
         DistMultiVec<Real>& ds,
-  Int cutoffPar=1000 );
+  const cone::DistConeMeta& coneMeta );
 
 } // namespace affine
 } // namespace socp
@@ -1065,7 +1065,7 @@ void KKT
   const DistMultiVec<Int>& origToSparseFirstInds,
         Int kSparse,
         DistSparseMatrix<Real>& J,
-  bool onlyLower, Int cutoffPar )
+  bool onlyLower, const cone::DistConeMeta& coneMeta )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -1077,10 +1077,10 @@ void KKT
     // NOTE: The following computation is a bit redundant, and the lower norms
     //       are only needed for sufficiently large cones.
     DistMultiVec<Real> wDets(grid), wLowers(grid);
-    soc::Dets( w, wDets, orders, firstInds, cutoffPar );
-    soc::LowerNorms( w, wLowers, orders, firstInds, cutoffPar );
-    cone::Broadcast( wDets, orders, firstInds, cutoffPar );
-    cone::Broadcast( wLowers, orders, firstInds, cutoffPar );
+    soc::Dets( w, wDets, orders, firstInds, coneMeta );
+    soc::LowerNorms( w, wLowers, orders, firstInds, coneMeta );
+    cone::Broadcast( wDets, orders, firstInds, coneMeta );
+    cone::Broadcast( wLowers, orders, firstInds, coneMeta );
 
     auto& wLoc = w.LockedMatrix();
     auto& wDetsLoc = wDets.LockedMatrix();
@@ -1717,7 +1717,7 @@ void FinishKKT
   const DistMultiVec<Int>& origToSparseFirstInds,
         Int kSparse,
         DistSparseMatrix<Real>& J,
-  bool onlyLower, Int cutoffPar )
+  bool onlyLower, const cone::DistConeMeta& coneMeta )
 {
     EL_DEBUG_CSE
     const Grid& grid = w.Grid();
@@ -1727,10 +1727,10 @@ void FinishKKT
     // NOTE: The following computation is a bit redundant, and the lower norms
     //       are only needed for sufficiently large cones.
     DistMultiVec<Real> wDets(grid), wLowers(grid);
-    soc::Dets( w, wDets, orders, firstInds, cutoffPar );
-    soc::LowerNorms( w, wLowers, orders, firstInds, cutoffPar );
-    cone::Broadcast( wDets, orders, firstInds, cutoffPar );
-    cone::Broadcast( wLowers, orders, firstInds, cutoffPar );
+    soc::Dets( w, wDets, orders, firstInds, coneMeta );
+    soc::LowerNorms( w, wLowers, orders, firstInds, coneMeta );
+    cone::Broadcast( wDets, orders, firstInds, coneMeta );
+    cone::Broadcast( wLowers, orders, firstInds, coneMeta );
 
     auto& wLoc = w.LockedMatrix();
     auto& wDetsLoc = wDets.LockedMatrix();
@@ -2187,7 +2187,7 @@ void KKTRHS
   const DistMultiVec<Int>& origToSparseFirstInds,
         Int kSparse,
         DistMultiVec<Real>& d,
-  Int cutoffPar )
+  const cone::DistConeMeta& coneMeta )
 {
     EL_DEBUG_CSE
     const Int n = rc.Height();
@@ -2198,7 +2198,7 @@ void KKTRHS
     Zeros( d, n+m+kSparse, 1 );
 
     DistMultiVec<Real> W_rmu( grid );
-    soc::ApplyQuadratic( wRoot, rmu, W_rmu, orders, firstInds, cutoffPar );
+    soc::ApplyQuadratic( wRoot, rmu, W_rmu, orders, firstInds, coneMeta );
 
     Int numEntries = rc.LocalHeight() + rb.LocalHeight() + rmu.LocalHeight();
     d.Reserve( numEntries );
@@ -2351,7 +2351,7 @@ void ExpandSolution
         DistMultiVec<Real>& dy,
         DistMultiVec<Real>& dz,
         DistMultiVec<Real>& ds,
-  Int cutoffPar )
+  const cone::DistConeMeta& coneMeta )
 {
     EL_DEBUG_CSE
     const Int k = wRoot.Height();
@@ -2402,9 +2402,9 @@ void ExpandSolution
     // ds := - W^T ( rmu + W dz )
     // ==========================
     ds = dz;
-    soc::ApplyQuadratic( wRoot, ds, orders, firstInds, cutoffPar );
+    soc::ApplyQuadratic( wRoot, ds, orders, firstInds, coneMeta );
     ds += rmu;
-    soc::ApplyQuadratic( wRoot, ds, orders, firstInds, cutoffPar );
+    soc::ApplyQuadratic( wRoot, ds, orders, firstInds, coneMeta );
     ds *= -1;
 }
 
@@ -2469,7 +2469,7 @@ void ExpandSolution
     const DistMultiVec<Int>& origToSparseFirstInds, \
           Int kSparse, \
           DistSparseMatrix<Real>& J, \
-    bool onlyLower, Int cutoffPar ); \
+    bool onlyLower, const cone::DistConeMeta& coneMeta ); \
   template void StaticKKT \
   ( const DistSparseMatrix<Real>& A, \
     const DistSparseMatrix<Real>& G, \
@@ -2492,7 +2492,7 @@ void ExpandSolution
     const DistMultiVec<Int>& origToSparseFirstInds, \
           Int kSparse, \
           DistSparseMatrix<Real>& J, \
-    bool onlyLower, Int cutoffPar ); \
+    bool onlyLower, const cone::DistConeMeta& coneMeta ); \
   template void KKTRHS \
   ( const Matrix<Real>& rc, \
     const Matrix<Real>& rb, \
@@ -2534,7 +2534,7 @@ void ExpandSolution
     const DistMultiVec<Int>& origToSparseFirstInds, \
           Int kSparse, \
           DistMultiVec<Real>& d, \
-    Int cutoffPar ); \
+    const cone::DistConeMeta& coneMeta ); \
   template void ExpandSolution \
   ( Int m, Int n, \
     const Matrix<Real>& d, \
@@ -2588,7 +2588,7 @@ void ExpandSolution
           DistMultiVec<Real>& dy, \
           DistMultiVec<Real>& dz, \
           DistMultiVec<Real>& ds, \
-    Int cutoffPar );
+    const cone::DistConeMeta& coneMeta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
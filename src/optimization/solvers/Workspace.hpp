@@ -0,0 +1,219 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVERS_WORKSPACE_HPP
+#define EL_SOLVERS_WORKSPACE_HPP
+
+// Reuse of the KKT analysis and warm-starting of the sparse Interior Point
+// Methods across solves which share an IPMWorkspace (see MehrotraCtrl)
+
+namespace El {
+namespace ipm {
+
+// Invalidate the stored analysis of the KKT system unless the (local) pattern
+// of the static KKT matrix matches that of the previous solve
+template<typename Real>
+inline void CheckKKTPattern
+( const MehrotraCtrl<Real>& ctrl, const SparseMatrix<Real>& JStatic )
+{
+    EL_DEBUG_CSE
+    if( ctrl.workspace == nullptr )
+        return;
+    auto& workspace = *ctrl.workspace;
+    const Int numEntries = JStatic.NumEntries();
+    const Int* sourceBuf = JStatic.LockedSourceBuffer();
+    const Int* targetBuf = JStatic.LockedTargetBuffer();
+    const bool samePattern =
+      !workspace.kktDistributed &&
+      workspace.kktHeight == JStatic.Height() &&
+      Int(workspace.kktSources.size()) == numEntries &&
+      std::equal( sourceBuf, sourceBuf+numEntries,
+                  workspace.kktSources.begin() ) &&
+      std::equal( targetBuf, targetBuf+numEntries,
+                  workspace.kktTargets.begin() );
+    if( !samePattern )
+    {
+        workspace.analyzed = false;
+        workspace.kktDistributed = false;
+        workspace.kktHeight = JStatic.Height();
+        workspace.kktSources.assign( sourceBuf, sourceBuf+numEntries );
+        workspace.kktTargets.assign( targetBuf, targetBuf+numEntries );
+    }
+    if( ctrl.print && workspace.analyzed )
+        Output("Reusing the analysis of the KKT system");
+}
+
+template<typename Real>
+inline void CheckKKTPattern
+( const MehrotraCtrl<Real>& ctrl, const DistSparseMatrix<Real>& JStatic )
+{
+    EL_DEBUG_CSE
+    if( ctrl.workspace == nullptr )
+        return;
+    auto& workspace = *ctrl.workspace;
+    const Int numLocalEntries = JStatic.NumLocalEntries();
+    const Int* sourceBuf = JStatic.LockedSourceBuffer();
+    const Int* targetBuf = JStatic.LockedTargetBuffer();
+    const bool sameLocalPattern =
+      workspace.kktDistributed &&
+      workspace.kktHeight == JStatic.Height() &&
+      Int(workspace.kktSources.size()) == numLocalEntries &&
+      std::equal( sourceBuf, sourceBuf+numLocalEntries,
+                  workspace.kktSources.begin() ) &&
+      std::equal( targetBuf, targetBuf+numLocalEntries,
+                  workspace.kktTargets.begin() );
+    const Int samePattern =
+      mpi::AllReduce( Int(sameLocalPattern), mpi::MIN, JStatic.Grid().Comm() );
+    if( !samePattern )
+    {
+        workspace.analyzed = false;
+        workspace.kktDistributed = true;
+        workspace.kktHeight = JStatic.Height();
+        workspace.kktSources.assign( sourceBuf, sourceBuf+numLocalEntries );
+        workspace.kktTargets.assign( targetBuf, targetBuf+numLocalEntries );
+    }
+    if( ctrl.print && workspace.analyzed && JStatic.Grid().Rank() == 0 )
+        Output("Reusing the analysis of the KKT system");
+}
+
+// Perform the reordering and symbolic analysis of the KKT system only if it
+// has not already been performed for its sparsity pattern
+template<typename Real>
+inline void AnalyzeOrChange
+( SparseLDLFactorization<Real>& sparseLDLFact,
+  const SparseMatrix<Real>& J,
+  bool& analyzed )
+{
+    EL_DEBUG_CSE
+    if( analyzed )
+    {
+        sparseLDLFact.ChangeNonzeroValues( J );
+    }
+    else
+    {
+        const bool hermitian = true;
+        const BisectCtrl bisectCtrl;
+        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+        analyzed = true;
+    }
+}
+
+template<typename Real>
+inline void AnalyzeOrChange
+( DistSparseLDLFactorization<Real>& sparseLDLFact,
+  const DistSparseMatrix<Real>& J,
+  bool& analyzed )
+{
+    EL_DEBUG_CSE
+    if( analyzed )
+    {
+        sparseLDLFact.ChangeNonzeroValues( J );
+    }
+    else
+    {
+        const bool hermitian = true;
+        const BisectCtrl bisectCtrl;
+        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+        analyzed = true;
+    }
+}
+
+template<typename Real>
+inline vector<Matrix<Real>*>
+StoredIterates( IPMWorkspace<Real>& workspace, const Matrix<Real>& )
+{ return { &workspace.x, &workspace.y, &workspace.z, &workspace.s }; }
+template<typename Real>
+inline vector<DistMultiVec<Real>*>
+StoredIterates( IPMWorkspace<Real>& workspace, const DistMultiVec<Real>& )
+{
+    return { &workspace.xDist, &workspace.yDist,
+             &workspace.zDist, &workspace.sDist };
+}
+
+template<typename Real>
+inline Matrix<Real>& LocalIterate( Matrix<Real>& x ) { return x; }
+template<typename Real>
+inline Matrix<Real>& LocalIterate( DistMultiVec<Real>& x )
+{ return x.Matrix(); }
+
+// Move (s,z) away from the boundary of the positive orthant and increase the
+// smaller member of each poorly-centered pair s_i z_i
+template<typename Real,class VectorType>
+inline void RecenterWarmStart
+( const MehrotraCtrl<Real>& ctrl, VectorType& s, VectorType& z )
+{
+    EL_DEBUG_CSE
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    LowerClip( s, ctrl.warmStartShift*Max(MaxNorm(s),Real(1)) );
+    LowerClip( z, ctrl.warmStartShift*Max(MaxNorm(z),Real(1)) );
+
+    const Real mu = Dot(s,z) / k;
+    const Real lowerBound = ctrl.warmStartCentrality*mu;
+    auto& sLoc = LocalIterate( s );
+    auto& zLoc = LocalIterate( z );
+    const Int kLocal = sLoc.Height();
+    for( Int iLoc=0; iLoc<kLocal; ++iLoc )
+    {
+        const Real sVal = sLoc(iLoc);
+        const Real zVal = zLoc(iLoc);
+        if( sVal*zVal >= lowerBound )
+            continue;
+        if( sVal <= zVal )
+            sLoc(iLoc) = lowerBound / zVal;
+        else
+            zLoc(iLoc) = lowerBound / sVal;
+    }
+}
+
+// Overwrite (x,y,z,s) with the recentered iterates of the previous solve if
+// warm-starting was requested and they are of the correct sizes
+template<typename Real,class VectorType>
+inline bool WarmStart
+( const MehrotraCtrl<Real>& ctrl, Int m, Int n, Int k,
+  VectorType& x, VectorType& y, VectorType& z, VectorType& s )
+{
+    EL_DEBUG_CSE
+    if( ctrl.workspace == nullptr || !ctrl.workspace->haveSolution ||
+        ctrl.primalInit || ctrl.dualInit )
+        return false;
+    auto stored = StoredIterates( *ctrl.workspace, x );
+    if( stored[0]->Height() != n || stored[1]->Height() != m ||
+        stored[2]->Height() != k )
+        return false;
+    x = *stored[0];
+    y = *stored[1];
+    z = *stored[2];
+    s = *stored[3];
+    RecenterWarmStart( ctrl, s, z );
+    return true;
+}
+
+// Keep the final iterates for warm-starting the next solve
+template<typename Real,class VectorType>
+inline void StoreIterates
+( const MehrotraCtrl<Real>& ctrl,
+  const VectorType& x, const VectorType& y,
+  const VectorType& z, const VectorType& s )
+{
+    EL_DEBUG_CSE
+    if( ctrl.workspace == nullptr )
+        return;
+    auto stored = StoredIterates( *ctrl.workspace, x );
+    *stored[0] = x;
+    *stored[1] = y;
+    *stored[2] = z;
+    *stored[3] = s;
+    ctrl.workspace->haveSolution = true;
+}
+
+} // namespace ipm
+} // namespace El
+
+#endif // ifndef EL_SOLVERS_WORKSPACE_HPP
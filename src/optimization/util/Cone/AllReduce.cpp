@@ -297,198 +297,98 @@ void AllReduce
 (       DistMultiVec<Field>& x,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  mpi::Op op, Int cutoff )
+  const DistConeMeta& meta,
+  mpi::Op op )
 {
     EL_DEBUG_CSE
     // TODO(poulson): Check that the communicators are congruent
-    const Grid& grid = x.Grid();
-    const int commSize = grid.Size();
-    const int localHeight = x.LocalHeight();
-
     const Int height = x.Height();
     if( x.Width() != 1 || orders.Width() != 1 || firstInds.Width() != 1 )
         LogicError("x, orders, and firstInds should be column vectors");
     if( orders.Height() != height || firstInds.Height() != height )
         LogicError("orders and firstInds should be of the same height as x");
+    if( !meta.ready )
+        LogicError("The cone metadata was not initialized");
 
     auto reduce = OpToReduce<Field>( op );
 
-          Field* xBuf = x.Matrix().Buffer();
+    const Int localHeight = x.LocalHeight();
+    const Int firstLocalRow = x.FirstLocalRow();
+    Field* xBuf = x.Matrix().Buffer();
     const Int* orderBuf = orders.LockedMatrix().LockedBuffer();
     const Int* firstIndBuf = firstInds.LockedMatrix().LockedBuffer();
 
-    // TODO(poulson): Find a better strategy
-    // A short-circuited ring algorithm would likely be significantly faster
-
-    // Handle all cones with order <= cutoff
-    // =====================================
-
-    // Compute the reduction of the cones on the roots
-    // -----------------------------------------------
+    // Reduce over the local portion of each cone
+    // ==========================================
+    // The cones which are entirely local are finished, while the partial
+    // results for the (at most two) straddling cones are kept
+    Field topRes=0, bottomRes=0;
+    for( Int iLoc=0; iLoc<localHeight; )
     {
-        // For now, we will simply Gather each cone to each root rather than
-        // performing a local reduction beforehand (TODO(poulson): do this)
-
-        // Compute the metadata
-        // ^^^^^^^^^^^^^^^^^^^^
-        vector<int> sendCounts(commSize,0);
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = x.GlobalRow(iLoc);
-            const Int order = orderBuf[iLoc];
-            if( order > cutoff )
-                continue;
-
-            const Int firstInd = firstIndBuf[iLoc];
-            if( i != firstInd )
-            {
-                const Int owner = firstInds.RowOwner(firstInd);
-                // TODO(poulson): Don't count this if we also own the root
-                ++sendCounts[owner];
-            }
-        }
-        vector<int> recvCounts(commSize);
-        mpi::AllToAll
-        ( sendCounts.data(), 1, recvCounts.data(), 1, grid.Comm() );
-
-        // Pack the data
-        // ^^^^^^^^^^^^^
-        vector<int> sendOffs;
-        const int totalSend = Scan( sendCounts, sendOffs );
-        vector<Field> sendBuf(totalSend);
-        auto offs = sendOffs;
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = x.GlobalRow(iLoc);
-            const Int order = orderBuf[iLoc];
-            if( order > cutoff )
-                continue;
-
-            const Int firstInd = firstIndBuf[iLoc];
-            if( i != firstInd )
-            {
-                const Int owner = firstInds.RowOwner(firstInd);
-                // TODO(poulson): Don't pack if we also own the root
-                sendBuf[offs[owner]++] = xBuf[iLoc];
-            }
-        }
-
-        // Exchange the data
-        // ^^^^^^^^^^^^^^^^^
-        vector<int> recvOffs;
-        const int totalRecv = Scan( recvCounts, recvOffs );
-        vector<Field> recvBuf(totalRecv);
-        mpi::AllToAll
-        ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
-          recvBuf.data(), recvCounts.data(), recvOffs.data(), grid.Comm() );
-
-        // Compute the maxima on the roots
-        // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
-        offs = recvOffs;
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = x.GlobalRow(iLoc);
-            const Int order = orderBuf[iLoc];
-            if( order > cutoff )
-                continue;
-
-            const Int firstInd = firstIndBuf[iLoc];
-            if( i == firstInd )
-            {
-                Field coneRes = xBuf[iLoc];
-                for( Int j=i+1; j<i+order; ++j )
-                {
-                    const Int owner = firstInds.RowOwner(j);
-                    // TODO(poulson): Pull locally if locally owned
-                    coneRes = reduce(coneRes,recvBuf[offs[owner]++]);
-                }
-                xBuf[iLoc] = coneRes;
-            }
-        }
+        const Int firstInd = firstIndBuf[iLoc];
+        const Int coneLocalEnd =
+          Min(firstInd+orderBuf[iLoc]-firstLocalRow,localHeight);
+        Field coneRes = xBuf[iLoc];
+        for( Int jLoc=iLoc+1; jLoc<coneLocalEnd; ++jLoc )
+            coneRes = reduce(coneRes,xBuf[jLoc]);
+
+        if( meta.hasTopCone && iLoc == 0 )
+            topRes = coneRes;
+        else if( meta.hasBottomCone && iLoc == meta.bottomConeLocalBeg )
+            bottomRes = coneRes;
+        else
+            for( Int jLoc=iLoc; jLoc<coneLocalEnd; ++jLoc )
+                xBuf[jLoc] = coneRes;
+        iLoc = coneLocalEnd;
     }
-
-    // Broadcast from the roots of the small cones
-    // -------------------------------------------
+    if( !meta.straddling )
+        return;
+
+    // Combine the partial results of the straddling cones
+    // ===================================================
+    mpi::Comm comm = x.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    Field sendRes[2] = { topRes, bottomRes };
+    vector<Field> partials(2*commSize);
+    mpi::AllGather( sendRes, 2, partials.data(), 2, comm );
+    // The cone with its root on process 'rootOwner' continues through the
+    // beginning of process 'lastOwner'
+    auto coneResult = [&]( int rootOwner, int lastOwner )
+      {
+          Field coneRes = partials[2*rootOwner+1];
+          for( int q=rootOwner+1; q<=lastOwner; ++q )
+              coneRes = reduce(coneRes,partials[2*q]);
+          return coneRes;
+      };
+    if( meta.hasTopCone )
     {
-        // Count the number of remote updates (and set non-root entries to zero)
-        // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
-        Int numRemoteUpdates = 0;
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = x.GlobalRow(iLoc);
-            const Int order = orderBuf[iLoc];
-            if( order > cutoff )
-                continue;
-
-            const Int firstInd = firstIndBuf[iLoc];
-            if( i == firstInd )
-            {
-                for( Int k=1; k<order; ++k )
-                    if( !x.IsLocal(i+k,0) )
-                        ++numRemoteUpdates;
-            }
-            else
-                xBuf[iLoc] = 0;
-        }
-        // Queue and process the remote updates
-        // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = x.GlobalRow(iLoc);
-            const Int order = orderBuf[iLoc];
-            if( order > cutoff )
-                continue;
-
-            const Int firstInd = firstIndBuf[iLoc];
-            if( i == firstInd )
-                for( Int k=1; k<order; ++k )
-                    x.QueueUpdate( i+k, 0, xBuf[iLoc] );
-        }
-        x.ProcessQueues();
+        const Field coneRes =
+          coneResult( meta.topConeRootOwner, meta.topConeLastOwner );
+        for( Int iLoc=0; iLoc<meta.topConeLocalEnd; ++iLoc )
+            xBuf[iLoc] = coneRes;
     }
-
-    // Handle all of the cones with order > cutoff
-    // ===========================================
-    // Allgather the list of cones with sufficiently large order
-    // ---------------------------------------------------------
-    vector<Int> sendData;
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    if( meta.hasBottomCone )
     {
-        const Int i = x.GlobalRow(iLoc);
-        const Int order = orderBuf[iLoc];
-        const Int firstInd = firstIndBuf[iLoc];
-        if( order > cutoff && i == firstInd )
-        {
-            sendData.push_back( i );
-            sendData.push_back( order );
-        }
+        const Field coneRes = coneResult( commRank, meta.bottomConeLastOwner );
+        for( Int iLoc=meta.bottomConeLocalBeg; iLoc<localHeight; ++iLoc )
+            xBuf[iLoc] = coneRes;
     }
-    const int numSendInts = sendData.size();
-    vector<int> numRecvInts(commSize);
-    mpi::AllGather( &numSendInts, 1, numRecvInts.data(), 1, grid.Comm() );
-    vector<int> recvOffs;
-    const int totalRecv = Scan( numRecvInts, recvOffs );
-    vector<Int> recvData(totalRecv);
-    mpi::AllGather
-    ( sendData.data(), numSendInts,
-      recvData.data(), numRecvInts.data(), recvOffs.data(), grid.Comm() );
-    for( Int largeCone=0; largeCone<totalRecv/2; ++largeCone )
-    {
-        const Int i = recvData[2*largeCone+0];
-        const Int order = recvData[2*largeCone+1];
-
-        // Compute our local result in this cone
-        Field localConeRes = 0;
-        const Int iFirst = x.FirstLocalRow();
-        const Int iLast = iFirst + x.LocalHeight();
-        for( Int j=Max(iFirst,i); j<Min(iLast,i+order); ++j )
-            localConeRes = reduce(localConeRes,xBuf[j-iFirst]);
+}
 
-        // Compute the maximum for this cone
-        const Field coneRes = mpi::AllReduce( localConeRes, op, grid.Comm() );
-        for( Int j=Max(iFirst,i); j<Min(iLast,i+order); ++j )
-            xBuf[j-iFirst] = coneRes;
-    }
+template<typename Field>
+void AllReduce
+(       DistMultiVec<Field>& x,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  mpi::Op op, Int cutoff )
+{
+    EL_DEBUG_CSE
+    // Since at most two cones per process straddle a process boundary, the
+    // metadata is cheap to form and the cutoff is no longer needed
+    DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    AllReduce( x, orders, firstInds, meta, op );
 }
 
 #define PROTO(Field) \
@@ -506,7 +406,13 @@ void AllReduce
   (       DistMultiVec<Field>& x, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    mpi::Op op, Int cutoff );
+    mpi::Op op, Int cutoff ); \
+  template void AllReduce \
+  (       DistMultiVec<Field>& x, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const DistConeMeta& meta, \
+    mpi::Op op );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
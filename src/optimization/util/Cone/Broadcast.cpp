@@ -157,102 +157,63 @@ template<typename Field>
 void Broadcast
 (       DistMultiVec<Field>& x,
   const DistMultiVec<Int>& orders,
-  const DistMultiVec<Int>& firstInds, Int cutoff )
+  const DistMultiVec<Int>& firstInds,
+  const DistConeMeta& meta )
 {
     EL_DEBUG_CSE
-    const Grid& grid = x.Grid();
-    const int commSize = grid.Size();
-
     // TODO(poulson): Check that the communicators are congruent
-    const Int localHeight = x.LocalHeight();
-    const Int firstLocalRow = x.FirstLocalRow();
-
     const Int height = x.Height();
     if( x.Width() != 1 || orders.Width() != 1 || firstInds.Width() != 1 )
         LogicError("x, orders, and firstInds should be column vectors");
     if( orders.Height() != height || firstInds.Height() != height )
         LogicError("orders and firstInds should be of the same height as x");
+    if( !meta.ready )
+        LogicError("The cone metadata was not initialized");
 
+    const Int localHeight = x.LocalHeight();
+    const Int firstLocalRow = x.FirstLocalRow();
     Field* xBuf = x.Matrix().Buffer();
-    const Int* orderBuf = orders.LockedMatrix().LockedBuffer();
     const Int* firstIndBuf = firstInds.LockedMatrix().LockedBuffer();
 
-    // TODO(poulson): Find a better strategy
-    // A short-circuited ring algorithm would likely be significantly faster
-
-    // Handle all cones with order <= cutoff
-    // =====================================
-    // Count the number of remote updates (and set non-root entries to zero)
-    // ---------------------------------------------------------------------
-    Int numRemoteUpdates = 0;
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = iLoc + firstLocalRow;
-        const Int order = orderBuf[iLoc];
-        if( order > cutoff )
-            continue;
-
-        const Int firstInd = firstIndBuf[iLoc];
-        if( i == firstInd )
-        {
-            for( Int k=1; k<order; ++k )
-                if( !x.IsLocal(i+k,0) )
-                    ++numRemoteUpdates;
-        }
-        else
-            xBuf[iLoc] = 0;
-    }
-    // Queue and process the remote updates
-    // ------------------------------------
+    // Handle the cones with local roots
+    // =================================
     for( Int iLoc=0; iLoc<localHeight; ++iLoc )
     {
-        const Int i = iLoc + firstLocalRow;
-        const Int order = orderBuf[iLoc];
-        if( order > cutoff )
-            continue;
-
         const Int firstInd = firstIndBuf[iLoc];
-        if( i == firstInd )
-            for( Int k=1; k<order; ++k )
-                x.QueueUpdate( i+k, 0, xBuf[iLoc] );
+        if( firstInd >= firstLocalRow && firstInd != iLoc+firstLocalRow )
+            xBuf[iLoc] = xBuf[firstInd-firstLocalRow];
     }
-    x.ProcessQueues();
-
-    // Handle all of the cones with order > cutoff
-    // ===========================================
-    // Allgather the list of cones with sufficiently large order
-    // ---------------------------------------------------------
-    vector<Entry<Field>> sendData;
-    // TODO(poulson): Count and reserve
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    if( !meta.straddling )
+        return;
+
+    // Gather the root of each cone which continues onto another process
+    // =================================================================
+    mpi::Comm comm = x.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const Field sendRoot =
+      ( meta.hasBottomCone ? xBuf[meta.bottomConeLocalBeg] : Field(0) );
+    vector<Field> roots(commSize);
+    mpi::AllGather( &sendRoot, 1, roots.data(), 1, comm );
+    if( meta.hasTopCone )
     {
-        const Int i = iLoc + firstLocalRow;
-        const Int order = orderBuf[iLoc];
-        const Int firstInd = firstIndBuf[iLoc];
-        if( order > cutoff && i == firstInd )
-            sendData.push_back( Entry<Field>{i,order,xBuf[iLoc]} );
+        const Field root = roots[meta.topConeRootOwner];
+        for( Int iLoc=0; iLoc<meta.topConeLocalEnd; ++iLoc )
+            xBuf[iLoc] = root;
     }
-    const int numSendCones = sendData.size();
-    vector<int> numRecvCones(commSize);
-    mpi::AllGather( &numSendCones, 1, numRecvCones.data(), 1, grid.Comm() );
-    vector<int> recvOffs;
-    const int totalRecv = Scan( numRecvCones, recvOffs );
-    vector<Entry<Field>> recvData(totalRecv);
-    mpi::AllGather
-    ( sendData.data(), numSendCones,
-      recvData.data(), numRecvCones.data(), recvOffs.data(), grid.Comm() );
-    for( Int largeCone=0; largeCone<totalRecv; ++largeCone )
-    {
-        const Int i = recvData[largeCone].i;
-        const Int order = recvData[largeCone].j;
-        const Field x0 = recvData[largeCone].value;
+}
 
-        // Unpack the root entry
-        const Int iFirst = firstLocalRow;
-        const Int iLast = iFirst + localHeight;
-        for( Int j=Max(iFirst,i+1); j<Min(iLast,i+order); ++j )
-            xBuf[j-iFirst] = x0;
-    }
+template<typename Field>
+void Broadcast
+(       DistMultiVec<Field>& x,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds, Int cutoff )
+{
+    EL_DEBUG_CSE
+    // Since at most two cones per process straddle a process boundary, the
+    // metadata is cheap to form and the cutoff is no longer needed
+    DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    Broadcast( x, orders, firstInds, meta );
 }
 
 #define PROTO(Field) \
@@ -267,7 +228,12 @@ void Broadcast
   template void Broadcast \
   (       DistMultiVec<Field>& x, \
     const DistMultiVec<Int>& orders, \
-    const DistMultiVec<Int>& firstInds, Int cutoff );
+    const DistMultiVec<Int>& firstInds, Int cutoff ); \
+  template void Broadcast \
+  (       DistMultiVec<Field>& x, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,68 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace cone {
+
+void DistConeMeta::Initialize
+( const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  bool checkStraddling )
+{
+    EL_DEBUG_CSE
+    const Int height = orders.Height();
+    if( orders.Width() != 1 || firstInds.Width() != 1 )
+        LogicError("orders and firstInds should be column vectors");
+    if( firstInds.Height() != height )
+        LogicError("orders and firstInds should be of the same height");
+
+    firstLocalRow = orders.FirstLocalRow();
+    localHeight = orders.LocalHeight();
+    hasTopCone = false;
+    hasBottomCone = false;
+    if( localHeight > 0 )
+    {
+        const Int* orderBuf = orders.LockedMatrix().LockedBuffer();
+        const Int* firstIndBuf = firstInds.LockedMatrix().LockedBuffer();
+        const Int lastLocalRow = firstLocalRow + localHeight;
+
+        const Int topRoot = firstIndBuf[0];
+        if( topRoot < firstLocalRow )
+        {
+            const Int topEnd = topRoot + orderBuf[0];
+            hasTopCone = true;
+            topConeLocalEnd = Min(topEnd,lastLocalRow) - firstLocalRow;
+            topConeRootOwner = orders.RowOwner( topRoot );
+            topConeLastOwner = orders.RowOwner( topEnd-1 );
+        }
+
+        const Int bottomRoot = firstIndBuf[localHeight-1];
+        const Int bottomEnd = bottomRoot + orderBuf[localHeight-1];
+        if( bottomRoot >= firstLocalRow && bottomEnd > lastLocalRow )
+        {
+            hasBottomCone = true;
+            bottomConeLocalBeg = bottomRoot - firstLocalRow;
+            bottomConeLastOwner = orders.RowOwner( bottomEnd-1 );
+        }
+    }
+
+    if( checkStraddling )
+    {
+        const Int localStraddling = ( hasTopCone || hasBottomCone ? 1 : 0 );
+        straddling =
+          mpi::AllReduce( localStraddling, mpi::MAX, orders.Grid().Comm() );
+    }
+    else
+        straddling = true;
+    ready = true;
+}
+
+} // namespace cone
+} // namespace El
@@ -97,14 +97,14 @@ void Apply
         DistMultiVec<Real>& z,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Int cutoff )
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
-    soc::Dots( x, y, z, orders, firstInds );
+    soc::Dots( x, y, z, orders, firstInds, meta );
     auto xRoots = x;
     auto yRoots = y;
-    cone::Broadcast( xRoots, orders, firstInds );
-    cone::Broadcast( yRoots, orders, firstInds );
+    cone::Broadcast( xRoots, orders, firstInds, meta );
+    cone::Broadcast( yRoots, orders, firstInds, meta );
 
     const Int firstLocalRow = x.FirstLocalRow();
     const Int localHeight = x.LocalHeight();
@@ -124,6 +124,22 @@ void Apply
     }
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Apply
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::Apply( x, y, z, orders, firstInds, meta );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsReal<Real>>*/>
 void Apply
@@ -162,15 +178,30 @@ void Apply
         DistMultiVec<Real>& y,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Int cutoff )
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
     // TODO(poulson)?: Optimize
     DistMultiVec<Real> z(x.Grid());
-    soc::Apply( x, y, z, orders, firstInds, cutoff );
+    soc::Apply( x, y, z, orders, firstInds, meta );
     y = z;
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Apply
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::Apply( x, y, orders, firstInds, meta );
+}
+
 #define PROTO(Real) \
   template void Apply \
   ( const Matrix<Real>& x, \
@@ -193,6 +224,13 @@ void Apply
     const DistMultiVec<Int>& firstInds, \
     Int cutoff ); \
   template void Apply \
+  ( const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const cone::DistConeMeta& meta ); \
+  template void Apply \
   ( const Matrix<Real>& x, \
           Matrix<Real>& y, \
     const Matrix<Int>& orders, \
@@ -208,7 +246,13 @@ void Apply
           DistMultiVec<Real>& y, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void Apply \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -103,14 +103,14 @@ void ApplyQuadratic
         DistMultiVec<Real>& z,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Int cutoff )
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
 
     // detRy := det(x) R y
     DistMultiVec<Real> d(x.Grid());
-    soc::Dets( x, d, orders, firstInds, cutoff );
-    cone::Broadcast( d, orders, firstInds, cutoff );
+    soc::Dets( x, d, orders, firstInds, meta );
+    cone::Broadcast( d, orders, firstInds, meta );
     auto Ry = y;
     soc::Reflect( Ry, orders, firstInds );
     DistMultiVec<Real> detRy(x.Grid());
@@ -118,8 +118,8 @@ void ApplyQuadratic
 
     // z := 2 (x^T y) x
     DistMultiVec<Real> xTy(x.Grid());
-    soc::Dots( x, y, xTy, orders, firstInds, cutoff );
-    cone::Broadcast( xTy, orders, firstInds, cutoff );
+    soc::Dots( x, y, xTy, orders, firstInds, meta );
+    cone::Broadcast( xTy, orders, firstInds, meta );
     Hadamard( xTy, x, z );
     z *= 2;
 
@@ -127,6 +127,22 @@ void ApplyQuadratic
     z -= detRy;
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void ApplyQuadratic
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::ApplyQuadratic( x, y, z, orders, firstInds, meta );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsReal<Real>>*/>
 void ApplyQuadratic
@@ -165,15 +181,30 @@ void ApplyQuadratic
         DistMultiVec<Real>& y,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Int cutoff )
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
     // TODO(poulson)?: Optimize
     DistMultiVec<Real> z(x.Grid());
-    soc::ApplyQuadratic( x, y, z, orders, firstInds, cutoff );
+    soc::ApplyQuadratic( x, y, z, orders, firstInds, meta );
     y = z;
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void ApplyQuadratic
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::ApplyQuadratic( x, y, orders, firstInds, meta );
+}
+
 #define PROTO(Real) \
   template void ApplyQuadratic \
   ( const Matrix<Real>& x, \
@@ -196,6 +227,13 @@ void ApplyQuadratic
     const DistMultiVec<Int>& firstInds, \
     Int cutoff ); \
   template void ApplyQuadratic \
+  ( const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const cone::DistConeMeta& meta ); \
+  template void ApplyQuadratic \
   ( const Matrix<Real>& x, \
           Matrix<Real>& y, \
     const Matrix<Int>& orders, \
@@ -211,7 +249,13 @@ void ApplyQuadratic
           DistMultiVec<Real>& y, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void ApplyQuadratic \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
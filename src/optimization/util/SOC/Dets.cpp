@@ -64,12 +64,27 @@ void Dets
 ( const DistMultiVec<Real>& x,
         DistMultiVec<Real>& d,
   const DistMultiVec<Int>& orders,
-  const DistMultiVec<Int>& firstInds, Int cutoff )
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
     auto Rx = x;
     soc::Reflect( Rx, orders, firstInds );
-    soc::Dots( x, Rx, d, orders, firstInds, cutoff );
+    soc::Dots( x, Rx, d, orders, firstInds, meta );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Dets
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& d,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds, Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::Dets( x, d, orders, firstInds, meta );
 }
 
 #define PROTO(Real) \
@@ -87,7 +102,13 @@ void Dets
   ( const DistMultiVec<Real>& x, \
           DistMultiVec<Real>& d, \
     const DistMultiVec<Int>& orders, \
-    const DistMultiVec<Int>& firstInds, Int cutoff );
+    const DistMultiVec<Int>& firstInds, Int cutoff ); \
+  template void Dets \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& d, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -178,7 +178,6 @@ void Dots
     }
 }
 
-// TODO(poulson): An alternate, trivial implementation to benchmark against
 template<typename Real,
          typename/*=EnableIf<IsReal<Real>>*/>
 void Dots
@@ -187,13 +186,11 @@ void Dots
         DistMultiVec<Real>& z,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-        Int cutoff )
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
     // TODO(poulson): Check that the communicators are congruent
     const Grid& grid = x.Grid();
-    const int commSize = grid.Size();
-
     const Int localHeight = x.LocalHeight();
     const Int firstLocalRow = x.FirstLocalRow();
 
@@ -205,6 +202,8 @@ void Dots
           LogicError("orders and firstInds should be of the same height as x");
       if( y.Height() != x.Height() || y.Width() != x.Width() )
           LogicError("x and y must be the same size");
+      if( !meta.ready )
+          LogicError("The cone metadata was not initialized");
     )
 
     z.SetGrid( grid );
@@ -216,93 +215,63 @@ void Dots
     const Int* orderBuf = orders.LockedMatrix().LockedBuffer();
     const Int* firstIndBuf = firstInds.LockedMatrix().LockedBuffer();
 
-    // Perform an mpi::AllToAll to collect all of the second-order cones of
-    // order less than or equal to the cutoff at the root locations and
-    // individually handle the remainder
-    // TODO(poulson): Find a better strategy
-
-    // Handle all second-order cones with order <= cutoff
-    // ==================================================
-    // Count the number of sends and handle the local portion of the work
-    // ------------------------------------------------------------------
-    Int numRemoteUpdates = 0;
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    // Compute the local portion of each inner product
+    // ===============================================
+    // The cones which are entirely local are finished, while the partial
+    // inner products of the (at most two) straddling cones are kept
+    Real topDot=0, bottomDot=0;
+    for( Int iLoc=0; iLoc<localHeight; )
     {
-        const Int i = iLoc + firstLocalRow;
-        const Int order = orderBuf[iLoc];
-        if( order > cutoff )
-            continue;
-
         const Int firstInd = firstIndBuf[iLoc];
-        if( i == firstInd )
-            zBuf[iLoc] = xBuf[iLoc]*yBuf[iLoc];
-        else if( !z.IsLocal(firstInd,0) )
-            ++numRemoteUpdates;
-    }
-    // Queue and process the remote updates
-    // ------------------------------------
-    z.Reserve( numRemoteUpdates );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int i = iLoc + firstLocalRow;
-        const Int order = orderBuf[iLoc];
-        if( order > cutoff )
-            continue;
+        const Int coneLocalEnd =
+          Min(firstInd+orderBuf[iLoc]-firstLocalRow,localHeight);
+        const Real localDot =
+          blas::Dot( coneLocalEnd-iLoc, &xBuf[iLoc], 1, &yBuf[iLoc], 1 );
 
-        const Int firstInd = firstIndBuf[iLoc];
-        if( i != firstInd )
-            z.QueueUpdate( firstInd, 0, xBuf[iLoc]*yBuf[iLoc] );
+        if( meta.hasTopCone && iLoc == 0 )
+            topDot = localDot;
+        else if( meta.hasBottomCone && iLoc == meta.bottomConeLocalBeg )
+            bottomDot = localDot;
+        else
+            zBuf[iLoc] = localDot;
+        iLoc = coneLocalEnd;
     }
-    z.ProcessQueues();
+    if( !meta.straddling )
+        return;
 
-    // Handle all of the second-order cones with order > cutoff
-    // ========================================================
-    // Allgather the list of cones with sufficiently large order
-    // ---------------------------------------------------------
-    vector<Int> sendPairs;
-    // TODO(poulson): Count and reserve so that the push_back's are all O(1)
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    // Sum the partial inner products of the straddling cones onto their roots
+    // =======================================================================
+    mpi::Comm comm = grid.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    Real sendDots[2] = { topDot, bottomDot };
+    vector<Real> partials(2*commSize);
+    mpi::AllGather( sendDots, 2, partials.data(), 2, comm );
+    if( meta.hasBottomCone )
     {
-        const Int i = iLoc + firstLocalRow;
-        const Int order = orderBuf[iLoc];
-        const Int firstInd = firstIndBuf[iLoc];
-        if( order > cutoff && i == firstInd )
-        {
-            sendPairs.push_back( i );
-            sendPairs.push_back( order );
-        }
+        Real dot = bottomDot;
+        for( int q=commRank+1; q<=meta.bottomConeLastOwner; ++q )
+            dot += partials[2*q];
+        zBuf[meta.bottomConeLocalBeg] = dot;
     }
-    const int numSendInts = sendPairs.size();
-    vector<int> numRecvInts(commSize);
-    mpi::AllGather( &numSendInts, 1, numRecvInts.data(), 1, grid.Comm() );
-    vector<int> recvOffs;
-    const int totalRecv = Scan( numRecvInts, recvOffs );
-    vector<Int> recvPairs(totalRecv);
-    mpi::AllGather
-    ( sendPairs.data(), numSendInts,
-      recvPairs.data(), numRecvInts.data(), recvOffs.data(), grid.Comm() );
-    const Int iFirst = firstLocalRow;
-    const Int iLast = iFirst + localHeight;
-    for( Int largeCone=0; largeCone<totalRecv/2; ++largeCone )
-    {
-        const Int i     = recvPairs[2*largeCone+0];
-        const Int order = recvPairs[2*largeCone+1];
+}
 
-        // Compute x(i:i+order)^T y(i:i+order)
-        Real localDot = 0;
-        const Int jBeg = Max(iFirst,i);
-        const Int jEnd = Min(iLast,i+order);
-        for( Int j=jBeg; j<jEnd; ++j )
-            localDot += xBuf[j-iFirst]*yBuf[j-iFirst];
-        const int owner = z.Owner(i,0);
-        if( z.IsLocal(i,0) )
-        {
-            const Real dot = mpi::Reduce( localDot, owner, grid.Comm() );
-            zBuf[i-firstLocalRow] = dot;
-        }
-        else
-            mpi::Reduce( localDot, owner, grid.Comm() );
-    }
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Dots
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+        Int cutoff )
+{
+    EL_DEBUG_CSE
+    // Since at most two cones per process straddle a process boundary, the
+    // metadata is cheap to form and the cutoff is no longer needed
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::Dots( x, y, z, orders, firstInds, meta );
 }
 
 #define PROTO(Real) \
@@ -325,7 +294,14 @@ void Dots
           DistMultiVec<Real>& z, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void Dots \
+  ( const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
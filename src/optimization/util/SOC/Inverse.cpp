@@ -82,13 +82,13 @@ void Inverse
         DistMultiVec<Real>& xInv,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Int cutoff )
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
 
     DistMultiVec<Real> dInv(x.Grid());
-    soc::Dets( x, dInv, orders, firstInds, cutoff );
-    cone::Broadcast( dInv, orders, firstInds );
+    soc::Dets( x, dInv, orders, firstInds, meta );
+    cone::Broadcast( dInv, orders, firstInds, meta );
     auto entryInv = []( const Real& alpha ) { return Real(1)/alpha; };
     EntrywiseMap( dInv, MakeFunction(entryInv) );
 
@@ -98,6 +98,21 @@ void Inverse
     Hadamard( dInv, Rx, xInv );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Inverse
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& xInv,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::Inverse( x, xInv, orders, firstInds, meta );
+}
+
 #define PROTO(Real) \
   template void Inverse \
   ( const Matrix<Real>& x, \
@@ -115,7 +130,13 @@ void Inverse
           DistMultiVec<Real>& xInv, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void Inverse \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& xInv, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
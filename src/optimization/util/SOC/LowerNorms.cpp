@@ -98,7 +98,7 @@ void LowerNorms
         DistMultiVec<Real>& lowerNorms,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Int cutoff )
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
     const Int localHeight = x.LocalHeight();
@@ -118,13 +118,28 @@ void LowerNorms
         if( xLower.GlobalRow(iLoc) == firstIndBuf[iLoc] )
             xLowerBuf[iLoc] = 0;
 
-    soc::Dots( xLower, xLower, lowerNorms, orders, firstInds, cutoff );
+    soc::Dots( xLower, xLower, lowerNorms, orders, firstInds, meta );
     Real* lowerNormBuf = lowerNorms.Matrix().Buffer();
     for( Int iLoc=0; iLoc<localHeight; ++iLoc )
         if( lowerNorms.GlobalRow(iLoc) == firstIndBuf[iLoc] )
             lowerNormBuf[iLoc] = Sqrt(lowerNormBuf[iLoc]);
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void LowerNorms
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& lowerNorms,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::LowerNorms( x, lowerNorms, orders, firstInds, meta );
+}
+
 #define PROTO(Real) \
   template void LowerNorms \
   ( const Matrix<Real>& x, \
@@ -142,7 +157,13 @@ void LowerNorms
           DistMultiVec<Real>& lowerNorms, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void LowerNorms \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& lowerNorms, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -284,7 +284,8 @@ Real MaxStep
   const DistMultiVec<Real>& y,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Real upperBound, Int cutoff )
+  Real upperBound,
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
     typedef Promote<Real> PReal;
@@ -294,12 +295,12 @@ Real MaxStep
                         xDets(grid), yDets(grid), xTRys(grid), maxSteps(grid);
     Copy( x, xProm );
     Copy( y, yProm );
-    soc::Dets( xProm, xDets, orders, firstInds, cutoff );
-    soc::Dets( yProm, yDets, orders, firstInds, cutoff );
+    soc::Dets( xProm, xDets, orders, firstInds, meta );
+    soc::Dets( yProm, yDets, orders, firstInds, meta );
 
     auto Ry = yProm;
     soc::Reflect( Ry, orders, firstInds );
-    soc::Dots( xProm, Ry, xTRys, orders, firstInds, cutoff );
+    soc::Dots( xProm, Ry, xTRys, orders, firstInds, meta );
 
     const Int localHeight = xProm.LocalHeight();
     const Int firstLocalRow = xProm.FirstLocalRow();
@@ -329,6 +330,21 @@ Real MaxStep
     return Real(mpi::AllReduce( alpha, mpi::MIN, grid.Comm() ));
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real MaxStep
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real upperBound, Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    return soc::MaxStep( x, y, orders, firstInds, upperBound, meta );
+}
+
 #define PROTO(Real) \
   template Real MaxStep \
   ( const Matrix<Real>& s, \
@@ -347,7 +363,14 @@ Real MaxStep
     const DistMultiVec<Real>& ds, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Real upperBound, Int cutoff );
+    Real upperBound, Int cutoff ); \
+  template Real MaxStep \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    Real upperBound, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
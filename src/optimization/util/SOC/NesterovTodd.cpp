@@ -119,7 +119,7 @@ void ClassicalNT
         DistMultiVec<Real>& w,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Int cutoff )
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
     typedef Promote<Real> PReal;
@@ -130,23 +130,23 @@ void ClassicalNT
     Copy( z, zProm );
 
     DistMultiVec<PReal> sRoot(grid);
-    soc::SquareRoot( sProm, sRoot, orders, firstInds, cutoff );
+    soc::SquareRoot( sProm, sRoot, orders, firstInds, meta );
 
     // a := Q_{sqrt(s)}(z)
     // -------------------
     DistMultiVec<PReal> a(grid);
-    soc::ApplyQuadratic( sRoot, zProm, a, orders, firstInds, cutoff );
+    soc::ApplyQuadratic( sRoot, zProm, a, orders, firstInds, meta );
 
     // a := inv(sqrt(a)) = inv(sqrt((Q_{sqrt(s)}(z))))
     // -----------------------------------------------
     DistMultiVec<PReal> b(grid);
-    soc::SquareRoot( a, b, orders, firstInds, cutoff );
-    soc::Inverse( b, a, orders, firstInds, cutoff );
+    soc::SquareRoot( a, b, orders, firstInds, meta );
+    soc::Inverse( b, a, orders, firstInds, meta );
 
     // w := Q_{sqrt(s)}(a)
     // -------------------
     DistMultiVec<PReal> wProm(grid);
-    soc::ApplyQuadratic( sRoot, a, wProm, orders, firstInds, cutoff );
+    soc::ApplyQuadratic( sRoot, a, wProm, orders, firstInds, meta );
     Copy( wProm, w );
 }
 
@@ -299,7 +299,8 @@ void VandenbergheNT
   const DistMultiVec<Real>& z,
         DistMultiVec<Real>& w,
   const DistMultiVec<Int>& orders,
-  const DistMultiVec<Int>& firstInds, Int cutoff )
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
     typedef Promote<Real> PReal;
@@ -313,10 +314,10 @@ void VandenbergheNT
     // ================================================
     const Int nLocal = sProm.LocalHeight();
     DistMultiVec<PReal> sDets(grid), zDets(grid);
-    soc::Dets( sProm, sDets, orders, firstInds, cutoff );
-    soc::Dets( zProm, zDets, orders, firstInds, cutoff );
-    cone::Broadcast( sDets, orders, firstInds, cutoff );
-    cone::Broadcast( zDets, orders, firstInds, cutoff );
+    soc::Dets( sProm, sDets, orders, firstInds, meta );
+    soc::Dets( zProm, zDets, orders, firstInds, meta );
+    cone::Broadcast( sDets, orders, firstInds, meta );
+    cone::Broadcast( zDets, orders, firstInds, meta );
     auto& sPromLoc = sProm.Matrix();
     auto& zPromLoc = zProm.Matrix();
     auto& sDetsLoc = sDets.LockedMatrix();
@@ -330,8 +331,8 @@ void VandenbergheNT
     // Compute the 'gamma' coefficients
     // ================================
     DistMultiVec<PReal> gammas(grid);
-    soc::Dots( zProm, sProm, gammas, orders, firstInds, cutoff );
-    cone::Broadcast( gammas, orders, firstInds, cutoff );
+    soc::Dots( zProm, sProm, gammas, orders, firstInds, meta );
+    cone::Broadcast( gammas, orders, firstInds, meta );
     auto& gammasLoc = gammas.Matrix();
     for( Int iLoc=0; iLoc<nLocal; ++iLoc )
         gammasLoc(iLoc) = Sqrt((PReal(1)+gammasLoc(iLoc))/PReal(2));
@@ -401,14 +402,30 @@ void NesterovTodd
   const DistMultiVec<Real>& z,
         DistMultiVec<Real>& w,
   const DistMultiVec<Int>& orders,
-  const DistMultiVec<Int>& firstInds, Int cutoff )
+  const DistMultiVec<Int>& firstInds,
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
     const bool useClassical = false;
     if( useClassical )
-        ClassicalNT( s, z, w, orders, firstInds, cutoff );
+        ClassicalNT( s, z, w, orders, firstInds, meta );
     else
-        VandenbergheNT( s, z, w, orders, firstInds, cutoff );
+        VandenbergheNT( s, z, w, orders, firstInds, meta );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void NesterovTodd
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& w,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds, Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::NesterovTodd( s, z, w, orders, firstInds, meta );
 }
 
 #define PROTO(Real) \
@@ -431,7 +448,14 @@ void NesterovTodd
           DistMultiVec<Real>& w, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void NesterovTodd \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& z, \
+          DistMultiVec<Real>& w, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -82,12 +82,13 @@ void PushInto
 (       DistMultiVec<Real>& x,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Real minDist, Int cutoff )
+  Real minDist,
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
 
     DistMultiVec<Real> d(x.Grid());
-    soc::LowerNorms( x, d, orders, firstInds, cutoff );
+    soc::LowerNorms( x, d, orders, firstInds, meta );
 
     const int localHeight = x.LocalHeight();
     auto& xLoc = x.Matrix();
@@ -103,6 +104,20 @@ void PushInto
     }
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void PushInto
+(       DistMultiVec<Real>& x,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real minDist, Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::PushInto( x, orders, firstInds, minDist, meta );
+}
+
 #define PROTO(Real) \
   template void PushInto \
   (       Matrix<Real>& x, \
@@ -118,7 +133,13 @@ void PushInto
   (       DistMultiVec<Real>& x, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Real minDist, Int cutoff );
+    Real minDist, Int cutoff ); \
+  template void PushInto \
+  (       DistMultiVec<Real>& x, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    Real minDist, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -106,13 +106,14 @@ void PushPairInto
   const DistMultiVec<Real>& w,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Real wMaxNormLimit, Int cutoff )
+  Real wMaxNormLimit,
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
 
     DistMultiVec<Real> sLower(s.Grid()), zLower(z.Grid());
-    soc::LowerNorms( s, sLower, orders, firstInds, cutoff );
-    soc::LowerNorms( z, zLower, orders, firstInds, cutoff );
+    soc::LowerNorms( s, sLower, orders, firstInds, meta );
+    soc::LowerNorms( z, zLower, orders, firstInds, meta );
 
     const int localHeight = s.LocalHeight();
     auto& sLoc = s.Matrix();
@@ -131,6 +132,22 @@ void PushPairInto
     }
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void PushPairInto
+(       DistMultiVec<Real>& s,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& w,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real wMaxNormLimit, Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::PushPairInto( s, z, w, orders, firstInds, wMaxNormLimit, meta );
+}
+
 #define PROTO(Real) \
   template void PushPairInto \
   (       Matrix<Real>& s, \
@@ -152,7 +169,15 @@ void PushPairInto
     const DistMultiVec<Real>& w, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Real wMaxNormLimit, Int cutoff );
+    Real wMaxNormLimit, Int cutoff ); \
+  template void PushPairInto \
+  (       DistMultiVec<Real>& s, \
+          DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& w, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    Real wMaxNormLimit, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
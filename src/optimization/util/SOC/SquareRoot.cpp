@@ -112,7 +112,7 @@ void SquareRoot
         DistMultiVec<Real>& xRoot,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
-  Int cutoff )
+  const cone::DistConeMeta& meta )
 {
     EL_DEBUG_CSE
     const Grid& grid = x.Grid();
@@ -121,12 +121,12 @@ void SquareRoot
     const Int* firstIndBuf = firstInds.LockedMatrix().LockedBuffer();
 
     DistMultiVec<Real> d(grid);
-    soc::Dets( x, d, orders, firstInds );
-    cone::Broadcast( d, orders, firstInds );
+    soc::Dets( x, d, orders, firstInds, meta );
+    cone::Broadcast( d, orders, firstInds, meta );
     const Real* dBuf = d.LockedMatrix().LockedBuffer();
 
     auto roots = x;
-    cone::Broadcast( roots, orders, firstInds );
+    cone::Broadcast( roots, orders, firstInds, meta );
     const Real* rootBuf = roots.LockedMatrix().LockedBuffer();
 
     const Int localHeight = x.LocalHeight();
@@ -146,6 +146,21 @@ void SquareRoot
     }
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void SquareRoot
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& xRoot,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    cone::DistConeMeta meta;
+    meta.Initialize( orders, firstInds, false );
+    soc::SquareRoot( x, xRoot, orders, firstInds, meta );
+}
+
 #define PROTO(Real) \
   template void SquareRoot \
   ( const Matrix<Real>& x, \
@@ -163,7 +178,13 @@ void SquareRoot
           DistMultiVec<Real>& xRoot, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void SquareRoot \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& xRoot, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    const cone::DistConeMeta& meta );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
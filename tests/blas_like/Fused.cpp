@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckClose
+( const Matrix<T>& A, const Matrix<T>& B, const string& msg )
+{
+    typedef Base<T> Real;
+    const Real tol = 10*limits::Epsilon<Real>()*Max(MaxNorm(B),Real(1));
+    Matrix<T> E( A );
+    E -= B;
+    if( MaxNorm(E) > tol )
+        LogicError(msg," failed: || E ||_max = ",MaxNorm(E));
+}
+
+template<typename T>
+void TestFused( Int m, Int n, const Grid& g, bool print )
+{
+    typedef Base<T> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    const Real rho = Real(1.7);
+    const Real tau = Real(0.3);
+    Timer timer;
+
+    DistMatrix<T> Z(g), U(g), S(g), X(g), XFused(g);
+    Uniform( Z, m, n );
+    Uniform( U, m, n );
+    Uniform( S, m, n );
+    if( print )
+    {
+        Print( Z, "Z" );
+        Print( U, "U" );
+        Print( S, "S" );
+    }
+
+    // X := SoftThreshold(rho*(Z-U) - S, tau) as a chain of passes
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    X = Z;
+    X -= U;
+    X *= rho;
+    X -= S;
+    SoftThreshold( X, tau );
+    mpi::Barrier( g.Comm() );
+    const double chainTime = timer.Stop();
+
+    // ...and as a single fused pass
+    XFused.AlignWith( Z );
+    XFused.Resize( m, n );
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    fused::Assign
+    ( XFused,
+      fused::SoftThreshold
+      ( rho*(fused::Ref(Z)-fused::Ref(U)) - fused::Ref(S), tau ) );
+    mpi::Barrier( g.Comm() );
+    const double fusedTime = timer.Stop();
+    OutputFromRoot
+    (g.Comm(),"chain: ",chainTime," secs, fused: ",fusedTime," secs");
+    CheckClose( XFused.LockedMatrix(), X.LockedMatrix(), "Fused assignment" );
+
+    // Assignment to one of the operands: U := U + (X - Z)
+    DistMatrix<T> UChain( U );
+    UChain += X;
+    UChain -= Z;
+    fused::Assign( U, fused::Ref(U) + (fused::Ref(X) - fused::Ref(Z)) );
+    CheckClose( U.LockedMatrix(), UChain.LockedMatrix(), "Aliased assignment" );
+
+    // Local Hadamard products, maps, and axpys
+    Matrix<T> A, B, C, CFused;
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    C = A;
+    Hadamard( A, B, C );
+    EntrywiseMap( C, function<T(const T&)>([]( const T& alpha )
+                                             { return alpha*alpha; }) );
+    Axpy( T(2), A, C );
+    fused::Assign
+    ( CFused,
+      fused::Axpy
+      ( T(2), fused::Ref(A),
+        fused::EntrywiseMap
+        ( fused::Hadamard(fused::Ref(A),fused::Ref(B)),
+          []( const T& alpha ) { return alpha*alpha; } ) ) );
+    CheckClose( CFused, C, "Local fused assignment" );
+
+    // Fused reductions
+    DistMatrix<T> D( X );
+    D -= Z;
+    const Real frobDiff = FrobeniusNorm( D );
+    const Real frobDiffFused =
+      fused::FrobeniusNorm( fused::Ref(X) - fused::Ref(Z) );
+    const Real maxDiff = MaxNorm( D );
+    const Real maxDiffFused = fused::MaxNorm( fused::Ref(X) - fused::Ref(Z) );
+    const Real tol = 10*limits::Epsilon<Real>()*Max(frobDiff,Real(1));
+    if( Abs(frobDiff-frobDiffFused) > tol )
+        LogicError
+        ("Fused FrobeniusNorm failed: ",frobDiffFused," vs. ",frobDiff);
+    if( Abs(maxDiff-maxDiffFused) > tol )
+        LogicError("Fused MaxNorm failed: ",maxDiffFused," vs. ",maxDiff);
+
+    OutputFromRoot(g.Comm(),"passed");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",100);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        OutputFromRoot(comm,"Testing fused entrywise expressions");
+        TestFused<float>( m, n, g, print );
+        TestFused<double>( m, n, g, print );
+        TestFused<Complex<double>>( m, n, g, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
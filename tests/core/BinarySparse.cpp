@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Overwrite the (k+1)'th row offset of a BINARY_SPARSE file
+void CorruptOffset( const string& filename, Int k, Int value )
+{
+    std::fstream file
+    ( filename.c_str(), std::ios::binary | std::ios::in | std::ios::out );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.seekp( 64 + k*sizeof(Int) );
+    file.write( (char*)&value, sizeof(Int) );
+}
+
+template<typename T>
+void TestBinarySparse( Int n1, Int n2, const Grid& grid, const string& name )
+{
+    mpi::Comm comm = grid.Comm();
+    const int commRank = mpi::Rank( comm );
+    if( commRank == 0 )
+        Output("Testing with ",TypeName<T>());
+    const string filename = name + "." + FileExtension(BINARY_SPARSE);
+
+    if( commRank == 0 )
+    {
+        SparseMatrix<T> A;
+        Helmholtz( A, n1, n2, T(1) );
+        Write( A, name, BINARY_SPARSE );
+
+        SparseMatrix<T> B;
+        Read( B, filename, BINARY_SPARSE );
+        if( B.Height() != A.Height() || B.Width() != A.Width() ||
+            B.NumEntries() != A.NumEntries() )
+            LogicError("SparseMatrix dimensions did not round-trip");
+        B -= A;
+        if( FrobeniusNorm(B) != Base<T>(0) )
+            LogicError("SparseMatrix did not round-trip");
+    }
+    mpi::Barrier( comm );
+
+    // The distributed reader and writer should agree with the sequential ones
+    DistSparseMatrix<T> A(grid), B(grid);
+    Helmholtz( A, n1, n2, T(1) );
+    Read( B, filename, BINARY_SPARSE );
+    B -= A;
+    if( FrobeniusNorm(B) != Base<T>(0) )
+        LogicError("DistSparseMatrix did not match the sequential file");
+
+    Write( A, name, BINARY_SPARSE );
+    Read( B, filename, BINARY_SPARSE );
+    B -= A;
+    if( FrobeniusNorm(B) != Base<T>(0) )
+        LogicError("DistSparseMatrix did not round-trip");
+
+    // Corrupt row offsets should be rejected on every process rather than
+    // being used to size buffers
+    mpi::Barrier( comm );
+    if( commRank == 0 )
+        CorruptOffset( filename, 1, std::numeric_limits<Int>::max() );
+    mpi::Barrier( comm );
+    bool rejected = false;
+    try { Read( B, filename, BINARY_SPARSE ); }
+    catch( std::exception& e ) { rejected = true; }
+    if( !rejected )
+        LogicError("Corrupt row offsets were not rejected");
+    if( commRank == 0 )
+    {
+        SparseMatrix<T> C;
+        rejected = false;
+        try { Read( C, filename, BINARY_SPARSE ); }
+        catch( std::exception& e ) { rejected = true; }
+        if( !rejected )
+            LogicError("Corrupt row offsets were not rejected sequentially");
+    }
+
+    if( commRank == 0 )
+        Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",12);
+        const Int n2 = Input("--n2","second grid dimension",10);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestBinarySparse<float>( n1, n2, grid, "BinarySparse-float" );
+        TestBinarySparse<double>( n1, n2, grid, "BinarySparse-double" );
+        TestBinarySparse<Complex<double>>
+        ( n1, n2, grid, "BinarySparse-complex-double" );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  const string& msg )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    auto E( A_STAR_STAR.Matrix() );
+    E -= B_STAR_STAR.Matrix();
+    if( FrobeniusNorm(E) != Base<T>(0) )
+        LogicError(msg);
+}
+
+template<typename T>
+void TestCheckpoint
+( Int m, Int n, const Grid& grid, const Grid& newGrid, const string& basename )
+{
+    mpi::Comm comm = grid.Comm();
+    const int commRank = mpi::Rank( comm );
+    if( commRank == 0 )
+        Output("Testing with ",TypeName<T>());
+
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+    DistMultiVec<T> X(grid);
+    Uniform( X, m, 3 );
+    DistSparseMatrix<T> S(grid);
+    Laplacian( S, m );
+    Matrix<T> B;
+    Uniform( B, n, 2 );
+    mpi::Broadcast( B.Buffer(), n*2, 0, comm );
+
+    // Write two generations so that the replacement of a checkpoint is tested
+    for( Int generation=0; generation<2; ++generation )
+    {
+        CheckpointWriter checkpoint( basename, comm );
+        checkpoint.Write( "A", A );
+        checkpoint.Write( "X", X );
+        checkpoint.Write( "S", S );
+        checkpoint.Write( "B", B );
+        checkpoint.SetState( "generation", generation );
+        checkpoint.Commit();
+    }
+    if( !CheckpointReader::Exists( basename, comm ) )
+        LogicError("Committed checkpoint was not found");
+
+    CheckpointReader checkpoint( basename, comm );
+    if( checkpoint.State<Int>("generation") != 1 )
+        LogicError("Checkpoint state was incorrect");
+
+    // Reading onto the same distribution
+    DistMatrix<T> ASame(grid);
+    checkpoint.Read( "A", ASame );
+    CheckEqual( A, ASame, "DistMatrix did not match on the same grid" );
+
+    // Reading onto a different grid shape and distribution
+    DistMatrix<T,VR,STAR> ANew(newGrid);
+    checkpoint.Read( "A", ANew );
+    CheckEqual( A, ANew, "DistMatrix did not match on a different grid" );
+    DistMatrix<T,STAR,MR> AStarMR(newGrid);
+    checkpoint.Read( "A", AStarMR );
+    CheckEqual( A, AStarMR, "DistMatrix did not match in [STAR,MR]" );
+
+    DistMultiVec<T> XNew(grid);
+    checkpoint.Read( "X", XNew );
+    XNew -= X;
+    if( FrobeniusNorm(XNew) != Base<T>(0) )
+        LogicError("DistMultiVec did not match");
+
+    DistSparseMatrix<T> SNew(grid);
+    checkpoint.Read( "S", SNew );
+    SNew -= S;
+    if( FrobeniusNorm(SNew) != Base<T>(0) )
+        LogicError("DistSparseMatrix did not match");
+
+    Matrix<T> BNew;
+    checkpoint.Read( "B", BNew );
+    BNew -= B;
+    if( FrobeniusNorm(BNew) != Base<T>(0) )
+        LogicError("Matrix did not match");
+
+    if( commRank == 0 )
+        Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",40);
+        ProcessInput();
+        PrintInputReport();
+
+        // A default grid and a single-row grid of the same processes
+        const Grid grid( comm );
+        const Grid newGrid( comm, 1 );
+        TestCheckpoint<float>( m, n, grid, newGrid, "Checkpoint-float" );
+        TestCheckpoint<double>( m, n, grid, newGrid, "Checkpoint-double" );
+        TestCheckpoint<Complex<double>>
+        ( m, n, grid, newGrid, "Checkpoint-complex-double" );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestMappedMatrix( Int m, Int n, const string& filename )
+{
+    Output("Testing with ",TypeName<T>());
+
+    // Fill a freshly-created file through a writable attachment
+    {
+        MappedFile file( filename, MAPPED_CREATE, m*n*sizeof(T) );
+        file.Advise( SEQUENTIAL_ACCESS );
+        Matrix<T> A;
+        AttachToFile( A, m, n, file );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                A.Set( i, j, T(i+j*m) );
+        file.Sync();
+    }
+
+    // Reread the file through a read-only attachment and a panel view
+    MappedFile file( filename, MAPPED_READ_ONLY, m*n*sizeof(T) );
+    Matrix<T> A;
+    AttachToFile( A, m, n, file );
+    if( !A.Locked() )
+        LogicError("Read-only mapping did not produce a locked matrix");
+    const Int nb = Min(n,Int(16));
+    auto APan = A( ALL, IR(0,nb) );
+    file.Prefetch( APan );
+    for( Int j=0; j<nb; ++j )
+        for( Int i=0; i<m; ++i )
+            if( APan.Get(i,j) != T(i+j*m) )
+                LogicError("Mapped matrix did not match what was written");
+    file.Evict( APan );
+
+    Matrix<T> B( m, n );
+    Read( B, filename, BINARY_FLAT );
+    B -= A;
+    if( FrobeniusNorm(B) != Base<T>(0) )
+        LogicError("Mapped matrix did not match the BINARY_FLAT reader");
+
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestMappedMatrix<float>( m, n, "MappedFile-float.dat" );
+            TestMappedMatrix<double>( m, n, "MappedFile-double.dat" );
+            TestMappedMatrix<Complex<double>>
+            ( m, n, "MappedFile-complex-double.dat" );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
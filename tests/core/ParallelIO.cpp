@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  const string& msg )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(msg," (dimensions differed)");
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    auto E( A_STAR_STAR.Matrix() );
+    E -= B_STAR_STAR.Matrix();
+    if( FrobeniusNorm(E) != Base<T>(0) )
+        LogicError(msg);
+}
+
+// Read a file written from A into the distribution of B, both collectively
+// (via MPI-IO) and sequentially
+template<typename T,Dist U,Dist V>
+void TestRead
+( const AbstractDistMatrix<T>& A, const string& filename, FileFormat format,
+  const string& label )
+{
+    DistMatrix<T,U,V> B(A.Grid());
+    if( format == BINARY_FLAT )
+        B.Resize( A.Height(), A.Width() );
+    Read( B, filename, format );
+    CheckEqual( A, B, label+" did not match after a parallel read" );
+
+    DistMatrix<T,U,V> C(A.Grid());
+    if( format == BINARY_FLAT )
+        C.Resize( A.Height(), A.Width() );
+    Read( C, filename, format, true );
+    CheckEqual( A, C, label+" did not match after a sequential read" );
+}
+
+template<typename T,Dist U,Dist V>
+void TestWrite( Int m, Int n, const Grid& grid, const string& basename )
+{
+    DistMatrix<T,U,V> A(grid);
+    Uniform( A, m, n );
+    const string label = basename + " from " + DistToString(U) + "," +
+      DistToString(V);
+
+    const FileFormat formats[2] = { BINARY, BINARY_FLAT };
+    for( const FileFormat format : formats )
+    {
+        Write( A, basename, format );
+        mpi::Barrier( grid.Comm() );
+        const string filename = basename + "." + FileExtension(format);
+        TestRead<T,MC,MR>( A, filename, format, label );
+        TestRead<T,VR,STAR>( A, filename, format, label );
+        TestRead<T,STAR,VC>( A, filename, format, label );
+        TestRead<T,MR,MC>( A, filename, format, label );
+        mpi::Barrier( grid.Comm() );
+    }
+}
+
+template<typename T>
+void TestParallelIO( Int m, Int n, const Grid& grid, const string& basename )
+{
+    const int commRank = mpi::Rank( grid.Comm() );
+    if( commRank == 0 )
+        Output("Testing with ",TypeName<T>());
+    TestWrite<T,MC,MR>( m, n, grid, basename );
+    TestWrite<T,VC,STAR>( m, n, grid, basename );
+    TestWrite<T,STAR,VR>( m, n, grid, basename );
+    TestWrite<T,MD,STAR>( m, n, grid, basename );
+    TestWrite<T,STAR,STAR>( m, n, grid, basename );
+
+    // A missing file should be reported on every process
+    DistMatrix<T> A(grid);
+    bool rejected = false;
+    try { Read( A, basename+"-missing.bin", BINARY ); }
+    catch( std::exception& e ) { rejected = true; }
+    if( !rejected )
+        LogicError("Reading a missing file did not fail");
+
+    if( commRank == 0 )
+        Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--height","height of matrix",37);
+        const Int n = Input("--width","width of matrix",23);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestParallelIO<float>( m, n, grid, "ParallelIO-float" );
+        TestParallelIO<double>( m, n, grid, "ParallelIO-double" );
+        TestParallelIO<Complex<double>>
+        ( m, n, grid, "ParallelIO-complex-double" );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
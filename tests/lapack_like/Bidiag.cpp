@@ -183,10 +183,103 @@ void TestCorrectness
         LogicError("Relative error was unacceptably large");
 }
 
+template<typename F>
+void TestTwoStage( const Matrix<F>& AOrig, Int bandwidth )
+{
+    typedef Base<F> Real;
+    const Int m = AOrig.Height();
+    const Int n = AOrig.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( AOrig );
+
+    Matrix<F> A( AOrig ), householderScalarsP, householderScalarsQ;
+    bidiag::BulgeReflectors<F> bulgeReflectors;
+    Timer timer;
+    timer.Start();
+    bidiag::TwoStage
+    ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+      bandwidth );
+    Output(timer.Stop()," seconds");
+
+    // Form Q B and P
+    Matrix<F> QB, P;
+    QB = A;
+    MakeTrapezoidal( UPPER, QB );
+    MakeTrapezoidal( LOWER, QB, 1 );
+    bidiag::TwoStageApplyQ( A, householderScalarsQ, bulgeReflectors, QB );
+    Identity( P, n, n );
+    bidiag::TwoStageApplyP( A, householderScalarsP, bulgeReflectors, P );
+
+    Matrix<F> E( AOrig );
+    Gemm( NORMAL, ADJOINT, F(1), QB, P, F(-1), E );
+    const Real relError = InfinityNorm( E ) / (eps*Max(m,n)*oneNormA);
+    Output("||A - Q B P^H||_oo / (eps max(m,n) ||A||_1) = ",relError);
+
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), P, Real(1), E );
+    const Real relOrthogError = HermitianInfinityNorm( LOWER, E ) / (eps*n);
+    Output("||I - P^H P||_oo / (eps n) = ",relOrthogError);
+
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably large");
+    if( relOrthogError > Real(10) )
+        LogicError("Relative orthogonality error was unacceptably large");
+}
+
+template<typename F>
+void TestTwoStage( const DistMatrix<F>& AOrig, Int bandwidth )
+{
+    typedef Base<F> Real;
+    const Grid& g = AOrig.Grid();
+    const Int m = AOrig.Height();
+    const Int n = AOrig.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( AOrig );
+
+    DistMatrix<F> A( AOrig );
+    DistMatrix<F,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
+    bidiag::BulgeReflectors<F> bulgeReflectors;
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    bidiag::TwoStage
+    ( A, householderScalarsP, householderScalarsQ, bulgeReflectors,
+      bandwidth );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),timer.Stop()," seconds");
+
+    // Form Q B and P
+    DistMatrix<F> QB(g), P(g);
+    QB = A;
+    MakeTrapezoidal( UPPER, QB );
+    MakeTrapezoidal( LOWER, QB, 1 );
+    bidiag::TwoStageApplyQ( A, householderScalarsQ, bulgeReflectors, QB );
+    Identity( P, n, n );
+    bidiag::TwoStageApplyP( A, householderScalarsP, bulgeReflectors, P );
+
+    DistMatrix<F> E( AOrig );
+    Gemm( NORMAL, ADJOINT, F(1), QB, P, F(-1), E );
+    const Real relError = InfinityNorm( E ) / (eps*Max(m,n)*oneNormA);
+    OutputFromRoot
+    (g.Comm(),"||A - Q B P^H||_oo / (eps max(m,n) ||A||_1) = ",relError);
+
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), P, Real(1), E );
+    const Real relOrthogError = HermitianInfinityNorm( LOWER, E ) / (eps*n);
+    OutputFromRoot
+    (g.Comm(),"||I - P^H P||_oo / (eps n) = ",relOrthogError);
+
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably large");
+    if( relOrthogError > Real(10) )
+        LogicError("Relative orthogonality error was unacceptably large");
+}
+
 template<typename F>
 void TestBidiag
 ( Int m,
   Int n,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -204,6 +297,14 @@ void TestBidiag
     if( display )
         Display( A, "A" );
 
+    if( correctness && m >= n )
+    {
+        Output("Two-stage bidiagonalization");
+        PushIndent();
+        TestTwoStage( AOrig, bandwidth );
+        PopIndent();
+    }
+
     Output("Starting bidiagonalization");
     Timer timer;
     timer.Start();
@@ -233,6 +334,7 @@ void TestBidiag
 ( const Grid& g,
   Int m,
   Int n,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -250,6 +352,14 @@ void TestBidiag
     if( display )
         Display( A, "A" );
 
+    if( correctness && m >= n )
+    {
+        OutputFromRoot(g.Comm(),"Two-stage bidiagonalization");
+        PushIndent();
+        TestTwoStage( AOrig, bandwidth );
+        PopIndent();
+    }
+
     OutputFromRoot(g.Comm(),"Starting bidiagonalization");
     mpi::Barrier( g.Comm() );
     Timer timer;
@@ -289,6 +399,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int bandwidth =
+          Input("--bandwidth","bandwidth of the two-stage reduction",8);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -314,74 +426,74 @@ main( int argc, char* argv[] )
         if( sequential && mpi::Rank() == 0 )
         {
             TestBidiag<float>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
             TestBidiag<Complex<float>>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
 
             TestBidiag<double>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
             TestBidiag<Complex<double>>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
 
 #ifdef EL_HAVE_QD
             TestBidiag<DoubleDouble>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
             TestBidiag<QuadDouble>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
             TestBidiag<Complex<DoubleDouble>>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
             TestBidiag<Complex<QuadDouble>>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestBidiag<Quad>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
             TestBidiag<Complex<Quad>>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestBidiag<BigFloat>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
             TestBidiag<Complex<BigFloat>>
-            ( m, n, correctness, print, display );
+            ( m, n, bandwidth, correctness, print, display );
 #endif
         }
 
         TestBidiag<float>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<float>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
 
         TestBidiag<double>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<double>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
 
 #ifdef EL_HAVE_QD
         TestBidiag<DoubleDouble>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<QuadDouble>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<DoubleDouble>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<QuadDouble>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestBidiag<Quad>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<Quad>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestBidiag<BigFloat>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
         TestBidiag<Complex<BigFloat>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, bandwidth, correctness, print, display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
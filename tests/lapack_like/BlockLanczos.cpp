@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestBlockLanczos
+( Int n1,
+  Int n2,
+  Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl,
+  const Grid& grid,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2 );
+    A *= Field(-1);
+    const Int n = A.Height();
+    // The two-norm of the (negated) Laplacian is at most twice its diagonal
+    const Real normA = 2*MaxNorm( A );
+
+    // The eigenvalues of the negated 2D finite-difference Laplacian are known
+    // analytically, and the computed eigenvalues are ordered starting from
+    // the wanted end of the spectrum
+    vector<Real> wTrue;
+    {
+        const Real pi = El::Pi<Real>();
+        const Real h1Inv = n1+1;
+        const Real h2Inv = n2+1;
+        for( Int i1=1; i1<=n1; ++i1 )
+        {
+            const Real lambda1 = 2*h1Inv*h1Inv*(1-Cos(i1*pi/h1Inv));
+            for( Int i2=1; i2<=n2; ++i2 )
+            {
+                const Real lambda2 = 2*h2Inv*h2Inv*(1-Cos(i2*pi/h2Inv));
+                wTrue.push_back( lambda1 + lambda2 );
+            }
+        }
+        std::sort( wTrue.begin(), wTrue.end() );
+        if( !ctrl.smallest )
+            std::reverse( wTrue.begin(), wTrue.end() );
+    }
+
+    DistMatrix<Real,STAR,STAR> w(grid);
+    DistMultiVec<Field> X(grid);
+    mpi::Barrier( grid.Comm() );
+    Timer timer;
+    timer.Start();
+    const Int numRestarts = BlockLanczos( A, numEigs, w, X, ctrl );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot
+    (grid.Comm(),numRestarts," restarts in ",timer.Stop()," seconds");
+    if( print )
+        Print( w, "w" );
+
+    Real maxError = 0;
+    for( Int j=0; j<numEigs; ++j )
+        maxError = Max( maxError, Abs(w.GetLocal(j,0)-wTrue[j]) );
+    OutputFromRoot(grid.Comm(),"max_j |w(j) - lambda_j| = ",maxError);
+
+    // || A X - X diag(w) ||_F
+    DistMultiVec<Field> E(grid);
+    Zeros( E, n, numEigs );
+    Multiply( NORMAL, Field(1), A, X, Field(0), E );
+    auto& ELoc = E.Matrix();
+    const auto& XLoc = X.LockedMatrix();
+    for( Int j=0; j<numEigs; ++j )
+        for( Int iLoc=0; iLoc<XLoc.Height(); ++iLoc )
+            ELoc(iLoc,j) -= w.GetLocal(j,0)*XLoc(iLoc,j);
+    const Real residNorm = FrobeniusNorm( E );
+    OutputFromRoot(grid.Comm(),"|| A X - X diag(w) ||_F = ",residNorm);
+
+    // || I - X^H X ||_F
+    Matrix<Field> G;
+    Zeros( G, numEigs, numEigs );
+    Herk( LOWER, ADJOINT, Real(1), XLoc, Real(0), G );
+    El::AllReduce( G, grid.Comm() );
+    ShiftDiagonal( G, Field(-1) );
+    const Real orthogError = HermitianFrobeniusNorm( LOWER, G );
+    OutputFromRoot(grid.Comm(),"|| I - X^H X ||_F = ",orthogError);
+
+    if( maxError > Pow(eps,Real(0.5))*normA )
+        LogicError("Eigenvalue error was unacceptably large");
+    if( residNorm > numEigs*Pow(eps,Real(0.5))*normA )
+        LogicError("Residual was unacceptably large");
+    if( orthogError > numEigs*Pow(eps,Real(0.5)) )
+        LogicError("Orthogonality error was unacceptably large");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",30);
+        const Int n2 = Input("--n2","second grid dimension",30);
+        const Int numEigs = Input("--numEigs","number of eigenpairs",10);
+        const Int blockSize = Input("--blockSize","block size",4);
+        const Int basisSize = Input("--basisSize","maximum basis size",0);
+        const Int maxRestarts =
+          Input("--maxRestarts","maximum number of restarts",1000);
+        const bool smallest =
+          Input("--smallest","smallest eigenvalues?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print eigenvalues?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        ComplainIfDebug();
+
+        BlockLanczosCtrl<double> ctrl;
+        ctrl.blockSize = blockSize;
+        ctrl.basisSize = basisSize;
+        ctrl.maxRestarts = maxRestarts;
+        ctrl.smallest = smallest;
+        ctrl.progress = progress;
+        TestBlockLanczos<double>( n1, n2, numEigs, ctrl, grid, print );
+        TestBlockLanczos<Complex<double>>( n1, n2, numEigs, ctrl, grid, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
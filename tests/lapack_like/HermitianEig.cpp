@@ -253,6 +253,17 @@ void TestSuite
         OutputFromRoot(g.Comm(),"Nonstandard distributions:");
         TestHermitianEig<F,MR,MC,MC>
         ( m, uplo, onlyEigvals, clustered, correctness, print, g, ctrl );
+
+        if( ctrlDbl.useSlicing && subset.rangeSubset && !onlyEigvals )
+        {
+            OutputFromRoot(g.Comm(),"Spectrum slicing:");
+            ctrl.useSlicing = true;
+            ctrl.sliceCtrl.numSlices = ctrlDbl.sliceCtrl.numSlices;
+            ctrl.sliceCtrl.teamSize = ctrlDbl.sliceCtrl.teamSize;
+            ctrl.sliceCtrl.progress = ctrlDbl.sliceCtrl.progress;
+            TestHermitianEig<F>
+            ( m, uplo, onlyEigvals, clustered, correctness, print, g, ctrl );
+        }
     }
 
     PopIndent();
@@ -289,6 +300,10 @@ main( int argc, char* argv[] )
           Input("--avoidTrmv","avoid Trmv based Symv",true);
         const bool useScaLAPACK =
           Input("--useScaLAPACK","test ScaLAPACK?",false);
+        const bool useSlicing =
+          Input("--useSlicing","test spectrum slicing of value ranges?",true);
+        const Int numSlices = Input("--numSlices","number of slices",0);
+        const Int teamSize = Input("--teamSize","processes per slice team",0);
         const Int algInt = Input("--algInt","0: QR, 1: D&C, 2: MRRR",1);
         const bool sequential =
           Input("--sequential","test sequential?",true);
@@ -344,6 +359,10 @@ main( int argc, char* argv[] )
         ctrl.tridiagEigCtrl.alg = alg;
         ctrl.tridiagEigCtrl.subset = subset;
         ctrl.tridiagEigCtrl.progress = progress;
+        ctrl.useSlicing = useSlicing;
+        ctrl.sliceCtrl.numSlices = numSlices;
+        ctrl.sliceCtrl.teamSize = teamSize;
+        ctrl.sliceCtrl.progress = progress;
 
         if( testReal )
         {
@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the Chebyshev expansions of exp(-x) against the corresponding
+// functions formed from eigendecompositions. The spectrum of the dense test
+// matrix is known, whereas the sparse test relies upon the Gershgorin discs.
+
+template<typename Field>
+void TestDense
+( Int n,
+  Int numRHS,
+  HermitianFunctionCtrl<Base<Field>> ctrl,
+  const Grid& grid,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(grid.Comm(),"Testing dense with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(grid);
+    HermitianUniformSpectrum( A, n, Real(-1), Real(2) );
+    ctrl.lowerBound = Real(-1);
+    ctrl.upperBound = Real(2);
+    auto func = []( const Real& x ) { return Exp(-x); };
+    if( print )
+        Print( A, "A" );
+
+    // Form f(A) from an eigendecomposition
+    DistMatrix<Field> FEig( A );
+    Timer timer;
+    timer.Start();
+    HermitianFunction( LOWER, FEig, MakeFunction(func) );
+    MakeHermitian( LOWER, FEig );
+    OutputFromRoot
+    (grid.Comm(),"Eigendecomposition: ",timer.Stop()," seconds");
+    const Real normF = FrobeniusNorm( FEig );
+
+    // Form f(A) from a Chebyshev expansion
+    auto chebCtrl = ctrl;
+    chebCtrl.chebyshev = true;
+    DistMatrix<Field> FCheb( A );
+    timer.Start();
+    HermitianFunction( LOWER, FCheb, MakeFunction(func), chebCtrl );
+    OutputFromRoot(grid.Comm(),"Chebyshev: ",timer.Stop()," seconds");
+    FCheb -= FEig;
+    const Real fError = FrobeniusNorm( FCheb ) / normF;
+    OutputFromRoot
+    (grid.Comm(),"|| f_cheb(A) - f(A) ||_F / || f(A) ||_F = ",fError);
+
+    // Apply f(A) to a set of vectors
+    DistMatrix<Field> B(grid), X(grid), Y(grid);
+    Gaussian( B, n, numRHS );
+    X = B;
+    timer.Start();
+    ApplyHermitianFunction( LOWER, A, MakeFunction(func), X, ctrl );
+    OutputFromRoot
+    (grid.Comm(),"Chebyshev application: ",timer.Stop()," seconds");
+    Gemm( NORMAL, NORMAL, Field(1), FEig, B, Y );
+    const Real normY = FrobeniusNorm( Y );
+    X -= Y;
+    const Real applyError = FrobeniusNorm( X ) / normY;
+    OutputFromRoot
+    (grid.Comm(),"|| f_cheb(A) B - f(A) B ||_F / || f(A) B ||_F = ",
+     applyError);
+
+    const Real tol = n*Max(ctrl.tol,eps);
+    if( fError > tol )
+        LogicError("Chebyshev function error was unacceptably large");
+    if( applyError > tol )
+        LogicError("Chebyshev application error was unacceptably large");
+    PopIndent();
+}
+
+template<typename Field>
+void TestSparse
+( Int n1,
+  Int n2,
+  Int numRHS,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl,
+  const Grid& grid,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(grid.Comm(),"Testing sparse with ",TypeName<Field>());
+    PushIndent();
+
+    DistSparseMatrix<Field> A(grid);
+    Helmholtz( A, n1, n2, Field(0) );
+    const Int n = A.Height();
+    const Real scale = 1/(8*MaxNorm(A));
+    auto func = [&]( const Real& x ) { return Exp(-scale*x); };
+
+    DistMultiVec<Field> B(grid), X(grid);
+    Gaussian( B, n, numRHS );
+    X = B;
+    Timer timer;
+    timer.Start();
+    ApplyHermitianFunction( A, MakeFunction(func), X, ctrl );
+    OutputFromRoot
+    (grid.Comm(),"Chebyshev application: ",timer.Stop()," seconds");
+    if( print )
+        Print( X, "f(A) B" );
+
+    // Compare against f(A) B formed from the eigendecomposition of A
+    DistMatrix<Field> ADense(grid), BDense(grid), XDense(grid), Y(grid);
+    Copy( A, ADense );
+    Copy( B, BDense );
+    Copy( X, XDense );
+    HermitianFunction( LOWER, ADense, MakeFunction(func) );
+    MakeHermitian( LOWER, ADense );
+    Gemm( NORMAL, NORMAL, Field(1), ADense, BDense, Y );
+    const Real normY = FrobeniusNorm( Y );
+    XDense -= Y;
+    const Real applyError = FrobeniusNorm( XDense ) / normY;
+    OutputFromRoot
+    (grid.Comm(),"|| f_cheb(A) B - f(A) B ||_F / || f(A) B ||_F = ",
+     applyError);
+
+    if( applyError > n*Max(ctrl.tol,eps) )
+        LogicError("Chebyshev application error was unacceptably large");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","dense matrix size",200);
+        const Int n1 = Input("--n1","first grid dimension",15);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        const Int degree = Input("--degree","expansion degree (0=auto)",0);
+        const double tol = Input("--tol","expansion tolerance",1e-12);
+        const bool jackson = Input("--jackson","Jackson damping?",false);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        ComplainIfDebug();
+
+        HermitianFunctionCtrl<double> ctrl;
+        ctrl.degree = degree;
+        ctrl.tol = tol;
+        ctrl.jackson = jackson;
+        ctrl.progress = progress;
+        TestDense<double>( n, numRHS, ctrl, grid, print );
+        TestDense<Complex<double>>( n, numRHS, ctrl, grid, print );
+        TestSparse<double>( n1, n2, numRHS, ctrl, grid, print );
+        TestSparse<Complex<double>>( n1, n2, numRHS, ctrl, grid, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
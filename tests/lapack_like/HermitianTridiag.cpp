@@ -164,6 +164,103 @@ void TestCorrectness
         LogicError("Relative orthogonality error was unacceptably large");
 }
 
+template<typename Field>
+void TestTwoStage
+( UpperOrLower uplo, const Matrix<Field>& AOrig, Int bandwidth )
+{
+    typedef Base<Field> Real;
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = HermitianOneNorm( uplo, AOrig );
+
+    Matrix<Field> A( AOrig ), householderScalars;
+    herm_tridiag::BulgeReflectors<Field> bulgeReflectors;
+    Timer timer;
+    timer.Start();
+    herm_tridiag::TwoStage
+    ( uplo, A, householderScalars, bulgeReflectors, bandwidth );
+    Output(timer.Stop()," seconds");
+
+    // Form Q and Q T
+    Matrix<Field> Q, QT;
+    Identity( Q, m, m );
+    herm_tridiag::TwoStageApplyQ( A, householderScalars, bulgeReflectors, Q );
+    QT = A;
+    MakeTrapezoidal( LOWER, QT, 1 );
+    MakeTrapezoidal( UPPER, QT, -1 );
+    herm_tridiag::TwoStageApplyQ
+    ( A, householderScalars, bulgeReflectors, QT );
+
+    // Compare the appropriate triangle of AOrig and Q T Q^H
+    Matrix<Field> B( AOrig );
+    Gemm( NORMAL, ADJOINT, Field(1), QT, Q, Field(-1), B );
+    MakeTrapezoidal( uplo, B );
+    const Real relError =
+      HermitianInfinityNorm( uplo, B ) / (eps*m*oneNormA);
+    Output("||A - Q T Q^H||_oo / (eps m ||A||_1) = ",relError);
+
+    Identity( B, m, m );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), B );
+    const Real relOrthogError = HermitianInfinityNorm( LOWER, B ) / (eps*m);
+    Output("||I - Q^H Q||_oo / (eps m) = ",relOrthogError);
+
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably large");
+    if( relOrthogError > Real(10) )
+        LogicError("Relative orthogonality error was unacceptably large");
+}
+
+template<typename Field>
+void TestTwoStage
+( UpperOrLower uplo, const DistMatrix<Field>& AOrig, Int bandwidth )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = AOrig.Grid();
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = HermitianOneNorm( uplo, AOrig );
+
+    DistMatrix<Field> A( AOrig );
+    DistMatrix<Field,STAR,STAR> householderScalars(grid);
+    herm_tridiag::BulgeReflectors<Field> bulgeReflectors;
+    mpi::Barrier( grid.Comm() );
+    Timer timer;
+    timer.Start();
+    herm_tridiag::TwoStage
+    ( uplo, A, householderScalars, bulgeReflectors, bandwidth );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot(grid.Comm(),timer.Stop()," seconds");
+
+    // Form Q and Q T
+    DistMatrix<Field> Q(grid), QT(grid);
+    Identity( Q, m, m );
+    herm_tridiag::TwoStageApplyQ( A, householderScalars, bulgeReflectors, Q );
+    QT = A;
+    MakeTrapezoidal( LOWER, QT, 1 );
+    MakeTrapezoidal( UPPER, QT, -1 );
+    herm_tridiag::TwoStageApplyQ
+    ( A, householderScalars, bulgeReflectors, QT );
+
+    // Compare the appropriate triangle of AOrig and Q T Q^H
+    DistMatrix<Field> B( AOrig );
+    Gemm( NORMAL, ADJOINT, Field(1), QT, Q, Field(-1), B );
+    MakeTrapezoidal( uplo, B );
+    const Real relError =
+      HermitianInfinityNorm( uplo, B ) / (eps*m*oneNormA);
+    OutputFromRoot
+    (grid.Comm(),"||A - Q T Q^H||_oo / (eps m ||A||_1) = ",relError);
+
+    Identity( B, m, m );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), B );
+    const Real relOrthogError = HermitianInfinityNorm( LOWER, B ) / (eps*m);
+    OutputFromRoot(grid.Comm(),"||I - Q^H Q||_oo / (eps m) = ",relOrthogError);
+
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably large");
+    if( relOrthogError > Real(10) )
+        LogicError("Relative orthogonality error was unacceptably large");
+}
+
 template<typename Field>
 void InnerTestHermitianTridiag
 ( UpperOrLower uplo,
@@ -246,6 +343,7 @@ template<typename Field>
 void TestHermitianTridiag
 ( UpperOrLower uplo,
   Int m,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -267,6 +365,11 @@ void TestHermitianTridiag
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, correctness, print, display );
 
+    Output("Two-stage algorithm:");
+    PushIndent();
+    TestTwoStage( uplo, A, bandwidth );
+    PopIndent();
+
     PopIndent();
 }
 
@@ -277,6 +380,7 @@ void TestHermitianTridiag
   Int m,
   Int nbLocal,
   bool avoidTrmv,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -314,6 +418,11 @@ void TestHermitianTridiag
     ctrl.order = COLUMN_MAJOR;
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, ctrl, correctness, print, display );
+
+    OutputFromRoot(grid.Comm(),"Two-stage algorithm:");
+    PushIndent();
+    TestTwoStage( uplo, A, bandwidth );
+    PopIndent();
     PopIndent();
 }
 
@@ -333,6 +442,8 @@ main( int argc, char* argv[] )
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool avoidTrmv =
           Input("--avoidTrmv","avoid Trmv local Symv",true);
+        const Int bandwidth =
+          Input("--bandwidth","bandwidth of the two-stage reduction",8);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -364,95 +475,106 @@ main( int argc, char* argv[] )
         {
             if( testReal )
                 TestHermitianTridiag<float>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<float>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
             if( testReal )
                 TestHermitianTridiag<double>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<double>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
 #ifdef EL_HAVE_QD
             if( testReal )
             {
                 TestHermitianTridiag<DoubleDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<QuadDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
             if( testCpx )
             {
                 TestHermitianTridiag<Complex<DoubleDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<Complex<QuadDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
 #endif
 
 #ifdef EL_HAVE_QUAD
             if( testReal )
                 TestHermitianTridiag<Quad>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<Quad>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
             if( testReal )
                 TestHermitianTridiag<BigFloat>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
         }
 
         if( testReal )
             TestHermitianTridiag<float>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<float>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
         if( testReal )
             TestHermitianTridiag<double>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<double>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
 #ifdef EL_HAVE_QD
         if( testReal )
         {
             TestHermitianTridiag<DoubleDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<QuadDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
         if( testCpx )
         {
             TestHermitianTridiag<Complex<DoubleDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<Complex<QuadDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
 #endif
 
 #ifdef EL_HAVE_QUAD
         if( testReal )
             TestHermitianTridiag<Quad>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<Quad>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         if( testReal )
             TestHermitianTridiag<BigFloat>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void CheckResidual
+( const Matrix<Field>& AOrig, const Matrix<Field>& X, const Matrix<Field>& Y )
+{
+    typedef Base<Field> Real;
+    const Int n = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( AOrig );
+    const Real oneNormY = OneNorm( Y );
+    auto E( X );
+    Gemm( NORMAL, NORMAL, Field(-1), AOrig, Y, Field(1), E );
+    const Real relError =
+      InfinityNorm( E ) / (eps*n*Max(oneNormA,oneNormY));
+    Output("|| A Y - X ||_oo / (eps n Max(||A||_1,||Y||_1)) = ",relError);
+    if( relError > Real(100) )
+        LogicError("Relative error was unacceptably large");
+}
+
+template<typename Field>
+void TestOutOfCore
+( Int n, Int panelWidth, Int numRHS, const string& filename )
+{
+    Output("Testing with ",TypeName<Field>());
+    PushIndent();
+
+    OutOfCoreCtrl ctrl;
+    ctrl.panelWidth = panelWidth;
+
+    Matrix<Field> X;
+    Uniform( X, n, numRHS );
+
+    for( const UpperOrLower uplo : {LOWER,UPPER} )
+    {
+        Output("Testing ",(uplo==LOWER?"lower":"upper")," Cholesky");
+        PushIndent();
+        Matrix<Field> AOrig;
+        HermitianUniformSpectrum( AOrig, n, 1, 10 );
+        {
+            MappedFile file( filename, MAPPED_CREATE, n*n*sizeof(Field) );
+            Matrix<Field> A;
+            AttachToFile( A, n, n, file );
+            A = AOrig;
+            Cholesky( uplo, A, file, ctrl );
+            auto Y( X );
+            cholesky::SolveAfter( uplo, NORMAL, A, file, Y, ctrl );
+            CheckResidual( AOrig, X, Y );
+        }
+        PopIndent();
+    }
+
+    Output("Testing LU with partial pivoting");
+    PushIndent();
+    Matrix<Field> AOrig;
+    Uniform( AOrig, n, n );
+    {
+        MappedFile file( filename, MAPPED_CREATE, n*n*sizeof(Field) );
+        Matrix<Field> A;
+        AttachToFile( A, n, n, file );
+        A = AOrig;
+        Permutation P;
+        LU( A, P, file, ctrl );
+        auto Y( X );
+        lu::SolveAfter( NORMAL, A, P, file, Y, ctrl );
+        CheckResidual( AOrig, X, Y );
+    }
+    PopIndent();
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--size","size of matrix",100);
+        const Int panelWidth = Input("--panelWidth","width of panels",24);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestOutOfCore<double>( n, panelWidth, numRHS, "OutOfCore.dat" );
+            TestOutOfCore<Complex<double>>
+            ( n, panelWidth, numRHS, "OutOfCore.dat" );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Singular values which are geometrically distributed over [1/cond,1]
+template<typename Field>
+void SingularValues( Matrix<Base<Field>>& s, Int minDim, Base<Field> cond )
+{
+    typedef Base<Field> Real;
+    s.Resize( minDim, 1 );
+    for( Int i=0; i<minDim; ++i )
+    {
+        const Real exponent = ( minDim > 1 ? Real(i)/Real(minDim-1) : 0 );
+        s(i) = Pow( 1/cond, exponent );
+    }
+}
+
+// Overwrite A with U diag(s) V^H, where U and V have random orthonormal
+// columns
+template<typename Field>
+void Build( Matrix<Field>& A, Int m, Int n, Base<Field> cond )
+{
+    const Int minDim = Min(m,n);
+    Matrix<Base<Field>> s;
+    SingularValues<Field>( s, minDim, cond );
+    Matrix<Field> U, V;
+    Gaussian( U, m, minDim );
+    Gaussian( V, n, minDim );
+    qr::ExplicitUnitary( U );
+    qr::ExplicitUnitary( V );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, Field(1), U, V, A );
+}
+
+template<typename Field>
+void Build( DistMatrix<Field>& A, Int m, Int n, Base<Field> cond )
+{
+    const Grid& g = A.Grid();
+    const Int minDim = Min(m,n);
+    DistMatrix<Base<Field>,STAR,STAR> s(g);
+    s.Resize( minDim, 1 );
+    SingularValues<Field>( s.Matrix(), minDim, cond );
+    DistMatrix<Field> U(g), V(g);
+    Gaussian( U, m, minDim );
+    Gaussian( V, n, minDim );
+    qr::ExplicitUnitary( U );
+    qr::ExplicitUnitary( V );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, Field(1), U, V, A );
+}
+
+template<typename Field>
+Base<Field> MinEig( const Matrix<Field>& P )
+{
+    auto PCopy( P );
+    Matrix<Base<Field>> w;
+    HermitianEig( LOWER, PCopy, w );
+    return w(0);
+}
+
+template<typename Field>
+Base<Field> MinEig( const DistMatrix<Field>& P )
+{
+    auto PCopy( P );
+    DistMatrix<Base<Field>,VR,STAR> w(P.Grid());
+    HermitianEig( LOWER, PCopy, w );
+    return w.Get(0,0);
+}
+
+template<typename Field,class MatrixType>
+void TestCorrectness
+( const MatrixType& A,
+  const MatrixType& Q,
+  const MatrixType& P,
+  mpi::Comm comm,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real frobA = FrobeniusNorm( A );
+
+    MatrixType E( A );
+    Gemm( NORMAL, NORMAL, Field(-1), Q, P, Field(1), E );
+    if( print )
+        Print( E, "A - Q P" );
+    const Real relError = FrobeniusNorm( E ) / (frobA*eps*m);
+    OutputFromRoot(comm,"|| A - Q P ||_F / (eps m || A ||_F) = ",relError);
+
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), E );
+    const Real orthogError = HermitianFrobeniusNorm( LOWER, E ) / (eps*n);
+    OutputFromRoot(comm,"|| I - Q^H Q ||_F / (eps n) = ",orthogError);
+
+    // The Hermitian factor should be positive semi-definite
+    const Real minEig = MinEig( P );
+    OutputFromRoot
+    (comm,"min(eig(P)) / (eps || A ||_F) = ",minEig/(eps*frobA));
+
+    if( relError > Real(100) )
+        LogicError("Relative error was unacceptably large");
+    if( orthogError > Real(100) )
+        LogicError("Orthogonality error was unacceptably large");
+    if( minEig < -100*eps*frobA )
+        LogicError("P was not positive semi-definite");
+}
+
+template<typename Field,class MatrixType>
+void TestPolar
+( MatrixType& A,
+  Base<Field> cond,
+  const PolarCtrl& ctrl,
+  mpi::Comm comm,
+  bool print )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Build( A, m, n, cond );
+    if( print )
+        Print( A, "A" );
+
+    MatrixType Q( A ), P( A );
+    Timer timer;
+    mpi::Barrier( comm );
+    timer.Start();
+    auto info = Polar( Q, P, ctrl );
+    mpi::Barrier( comm );
+    OutputFromRoot(comm,"Polar: ",timer.Stop()," seconds");
+    if( ctrl.zolo )
+        OutputFromRoot
+        (comm,"Zolo-PD took ",info.zoloInfo.numIts," iterations with ",
+         info.zoloInfo.numTerms," terms");
+    else if( ctrl.qdwh )
+        OutputFromRoot(comm,"QDWH took ",info.qdwhInfo.numIts," iterations");
+    TestCorrectness<Field>( A, Q, P, comm, print );
+}
+
+template<typename Field>
+void TestPolar
+( Int m,
+  Int n,
+  Base<Field> cond,
+  const PolarCtrl& ctrl,
+  bool testSeq,
+  const Grid& g,
+  bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    if( testSeq && g.Rank() == 0 )
+    {
+        Output("Sequential:");
+        PushIndent();
+        Matrix<Field> A( m, n );
+        TestPolar<Field>( A, cond, ctrl, mpi::COMM_SELF, print );
+        PopIndent();
+    }
+
+    OutputFromRoot(g.Comm(),"Distributed:");
+    PushIndent();
+    DistMatrix<Field> A( m, n, g );
+    TestPolar<Field>( A, cond, ctrl, g.Comm(), print );
+    PopIndent();
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",80);
+        const double cond = Input("--cond","condition number",1e8);
+        const bool qdwh = Input("--qdwh","use QDWH?",false);
+        const bool zolo = Input("--zolo","use Zolo-PD?",true);
+        const Int numTerms = Input("--numTerms","Zolo-PD terms (0=auto)",0);
+        const Int numSubgrids =
+          Input("--numSubgrids","max Zolo-PD subgrids (0=auto)",0);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool testSeq = Input("--testSeq","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, gridHeight, order );
+        ComplainIfDebug();
+
+        PolarCtrl ctrl;
+        ctrl.qdwh = qdwh;
+        ctrl.zolo = zolo;
+        ctrl.zoloCtrl.numTerms = numTerms;
+        ctrl.zoloCtrl.numSubgrids = numSubgrids;
+        ctrl.zoloCtrl.progress = progress;
+
+        TestPolar<float>( m, n, Min(cond,1e4), ctrl, testSeq, g, print );
+        TestPolar<Complex<float>>
+        ( m, n, Min(cond,1e4), ctrl, testSeq, g, print );
+        TestPolar<double>( m, n, cond, ctrl, testSeq, g, print );
+        TestPolar<Complex<double>>( m, n, cond, ctrl, testSeq, g, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
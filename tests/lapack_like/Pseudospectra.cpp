@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Since the Arnoldi iterations are started from random vectors, the
+// estimates computed by different teams can only be expected to agree to
+// roughly the convergence tolerance
+template<typename Real>
+void CheckAgreement
+( const DistMatrix<Real,VR,STAR>& invNorms,
+  const DistMatrix<Real,VR,STAR>& invNormsRef,
+  const string& label )
+{
+    DistMatrix<Real,VR,STAR> diff( invNorms );
+    diff -= invNormsRef;
+    const Real relError = MaxNorm( diff ) / MaxNorm( invNormsRef );
+    OutputFromRoot
+    (invNorms.Grid().Comm(),label,": || invNorms - invNormsRef ||_max / ",
+     "|| invNormsRef ||_max = ",relError);
+    if( relError > Real(1e-5) )
+        LogicError(label," did not match the single-team result");
+}
+
+// Compute the cloud with a single team and then with teams of size one and
+// two using batches which are small enough that every team must request
+// several of them
+template<typename Real,class CloudFunction>
+void TestTeams
+( const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+  Int batchSize,
+  const CloudFunction& cloud,
+  const string& label )
+{
+    const Grid& grid = shifts.Grid();
+    PseudospecCtrl<Real> psCtrl;
+    psCtrl.tol = Real(1e-10);
+    psCtrl.maxIts = 500;
+
+    DistMatrix<Real,VR,STAR> invNormsRef(grid);
+    cloud( invNormsRef, psCtrl );
+
+    psCtrl.batchSize = batchSize;
+    for( const Int teamSize : { 1, 2 } )
+    {
+        if( grid.Size() % teamSize != 0 )
+            continue;
+        psCtrl.teamSize = teamSize;
+        DistMatrix<Real,VR,STAR> invNorms(grid);
+        cloud( invNorms, psCtrl );
+        CheckAgreement
+        ( invNorms, invNormsRef,
+          label+" with teams of size "+std::to_string(teamSize) );
+    }
+}
+
+template<typename Real>
+void TestPseudospectra
+( Int n, Int numShifts, Int batchSize, const Grid& grid )
+{
+    typedef Complex<Real> C;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Real>());
+    PushIndent();
+
+    DistMatrix<C,VR,STAR> shifts(grid);
+    Uniform( shifts, numShifts, 1, C(0), Real(2) );
+
+    // An upper-triangular matrix
+    DistMatrix<C> U(grid);
+    Uniform( U, n, n );
+    MakeTrapezoidal( UPPER, U );
+    TestTeams<Real>
+    ( shifts, batchSize,
+      [&]( DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& psCtrl )
+      { TriangularSpectralCloud( U, shifts, invNorms, psCtrl ); },
+      "Triangular" );
+
+    // An upper-Hessenberg matrix
+    DistMatrix<C> H(grid);
+    Uniform( H, n, n );
+    MakeTrapezoidal( UPPER, H, -1 );
+    TestTeams<Real>
+    ( shifts, batchSize,
+      [&]( DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& psCtrl )
+      { HessenbergSpectralCloud( H, shifts, invNorms, psCtrl ); },
+      "Hessenberg" );
+
+    // A real quasi-triangular matrix with a 2x2 block (with eigenvalues
+    // d +- i) at every fourth diagonal position
+    DistMatrix<Real> T(grid);
+    Uniform( T, n, n );
+    MakeTrapezoidal( UPPER, T );
+    for( Int k=0; k+1<n; k+=4 )
+    {
+        T.Set( k+1, k+1, T.Get(k,k) );
+        T.Set( k, k+1, Real(1) );
+        T.Set( k+1, k, Real(-1) );
+    }
+    TestTeams<Real>
+    ( shifts, batchSize,
+      [&]( DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& psCtrl )
+      { QuasiTriangularSpectralCloud( T, shifts, invNorms, psCtrl ); },
+      "Quasi-triangular" );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int n = Input("--n","matrix size",40);
+        const Int numShifts = Input("--numShifts","number of shifts",25);
+        const Int batchSize = Input("--batchSize","shifts per batch",2);
+        ProcessInput();
+        PrintInputReport();
+
+        // The teams are only formed when there is more than one process
+        const Grid grid( comm );
+        TestPseudospectra<double>( n, numShifts, batchSize, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -166,6 +166,7 @@ void TestDistributedSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool useJacobi,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -203,6 +204,8 @@ void TestDistributedSVD
 
     ctrl.time = time;
     ctrl.useScaLAPACK = scalapack;
+    ctrl.useJacobi = useJacobi;
+    ctrl.jacobiCtrl.progress = progress;
     mpi::Barrier( mpi::COMM_WORLD );
     if( commRank == 0 )
         timer.Start();
@@ -344,6 +347,7 @@ void TestSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool useJacobi,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -359,7 +363,8 @@ void TestSVD
     {
         TestDistributedSVD<F> 
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          wantU, wantV, useQR, penalizeDerivative, divideCutoff, print );
+          wantU, wantV, useQR, useJacobi, penalizeDerivative, divideCutoff,
+          print );
     }
 }
 
@@ -394,6 +399,8 @@ main( int argc, char* argv[] )
         const bool wantU = Input("--wantU","compute U?",true);
         const bool wantV = Input("--wantV","compute V?",true);
         const bool useQR = Input("--useQR","force use of QR algorithm?",false);
+        const bool useJacobi =
+          Input("--useJacobi","use Jacobi for distributed SVD?",false);
         const bool penalizeDerivative =
           Input
           ("--penalizeDerivative","penalize secular derivative in D&C?",false);
@@ -421,62 +428,62 @@ main( int argc, char* argv[] )
 
         TestSVD<float>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<float>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 
         TestSVD<double>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<double>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 
 #ifdef EL_HAVE_QD
         TestSVD<DoubleDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<DoubleDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 
         TestSVD<QuadDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<QuadDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestSVD<Quad>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<Quad>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestSVD<BigFloat>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<BigFloat>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
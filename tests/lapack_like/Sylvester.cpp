@@ -0,0 +1,207 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void SetGrid( Matrix<F>& A, const Grid& grid ) { }
+
+template<typename F>
+void SetGrid( DistMatrix<F>& A, const Grid& grid ) { A.SetGrid( grid ); }
+
+template<typename F>
+void FullSchur( Matrix<F>& T, Matrix<F>& Q )
+{
+    SchurCtrl<Base<F>> ctrl;
+    ctrl.hessSchurCtrl.fullTriangle = true;
+    Matrix<Complex<Base<F>>> w;
+    Schur( T, w, Q, ctrl );
+}
+
+template<typename F>
+void FullSchur( DistMatrix<F>& T, DistMatrix<F>& Q )
+{
+    SchurCtrl<Base<F>> ctrl;
+    ctrl.hessSchurCtrl.fullTriangle = true;
+    DistMatrix<Complex<Base<F>>,VR,STAR> w( T.Grid() );
+    Schur( T, w, Q, ctrl );
+}
+
+// Form an n x n upper (quasi-)triangular matrix whose eigenvalues have real
+// parts near two. In the real case, 2x2 diagonal blocks (with eigenvalues
+// 2 +- i) are placed at both ends, near the quarter point, and straddling
+// the middle so that the first split of the recursion must be moved off of
+// the midpoint to avoid separating the block.
+template<typename F,class MatType>
+void QuasiTriangular( MatType& T, Int n )
+{
+    typedef Base<F> Real;
+    Uniform( T, n, n, F(0), Real(1)/Real(n) );
+    MakeTrapezoidal( UPPER, T );
+    if( IsComplex<F>::value )
+    {
+        ShiftDiagonal( T, F(2) );
+        return;
+    }
+
+    FillDiagonal( T, F(2) );
+    const vector<Int> blockStarts = { 0, 3, n/4-1, n/2-1, n-2 };
+    Int nextFree = 0;
+    for( const Int k : blockStarts )
+    {
+        if( k < nextFree || k+1 >= n )
+            continue;
+        T.Set( k, k+1, F(1) );
+        T.Set( k+1, k, F(-1) );
+        nextFree = k+2;
+    }
+}
+
+template<typename F,class MatType>
+void CheckResidual
+( Orientation orientB,
+  const MatType& A,
+  const MatType& B,
+  const MatType& C,
+  const MatType& X,
+  const string& label,
+  mpi::Comm comm )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int n = Max( C.Height(), C.Width() );
+    MatType R( C );
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    Gemm( NORMAL, orientB, F(-1), X, B, F(1), R );
+    const Real scale =
+      (FrobeniusNorm(A)+FrobeniusNorm(B))*FrobeniusNorm(X) + FrobeniusNorm(C);
+    const Real relError = FrobeniusNorm( R ) / (eps*n*scale);
+    OutputFromRoot
+    (comm,label,": || C - A X - X op(B) ||_F / (eps n (( || A ||_F + ",
+     "|| B ||_F) || X ||_F + || C ||_F)) = ",relError);
+    if( relError > Real(100) )
+        LogicError(label," residual was unacceptably large");
+}
+
+// A X + X op(B) = C for (quasi-)triangular A and B, using every orientation
+// of B (which reverses the order in which the block columns are solved for)
+// and both the given cutoff and a cutoff which reduces to a single leaf
+template<typename F,class MatType>
+void TestTriangular( Int m, Int n, Int cutoff, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    MatType A, B, C;
+    SetGrid( A, grid );
+    SetGrid( B, grid );
+    SetGrid( C, grid );
+    QuasiTriangular<F>( A, m );
+    QuasiTriangular<F>( B, n );
+    Uniform( C, m, n );
+
+    const vector<Orientation> orients = { NORMAL, TRANSPOSE, ADJOINT };
+    const vector<string> orientNames = { "NORMAL", "TRANSPOSE", "ADJOINT" };
+    for( Int j=0; j<3; ++j )
+    {
+        for( const Int leafCutoff : { cutoff, Max(m,n) } )
+        {
+            MatType X( C );
+            TriangularSylvester( orients[j], A, B, X, leafCutoff );
+            CheckResidual<F>
+            ( orients[j], A, B, C, X,
+              "TriangularSylvester("+orientNames[j]+") with cutoff="+
+              std::to_string(leafCutoff), comm );
+        }
+    }
+}
+
+// A X + X B = C, A X + X A^H = C, and the latter given the Schur
+// decomposition of A. The eigenvalues of A and B lie roughly within the unit
+// disc centered at two, so that the spectra of A and -B are well-separated.
+template<typename F,class MatType>
+void TestDense( Int m, Int n, Int cutoff, const Grid& grid )
+{
+    typedef Base<F> Real;
+    mpi::Comm comm = grid.Comm();
+    MatType A, B, C, CSquare, X;
+    SetGrid( A, grid );
+    SetGrid( B, grid );
+    SetGrid( C, grid );
+    SetGrid( CSquare, grid );
+    SetGrid( X, grid );
+    Gaussian( A, m, m, F(0), Real(1)/Sqrt(Real(2*m)) );
+    ShiftDiagonal( A, F(2) );
+    Gaussian( B, n, n, F(0), Real(1)/Sqrt(Real(2*n)) );
+    ShiftDiagonal( B, F(2) );
+    Uniform( C, m, n );
+    Uniform( CSquare, m, m );
+
+    SylvesterCtrl<Real> ctrl;
+    ctrl.cutoff = cutoff;
+
+    Sylvester( A, B, C, X, ctrl );
+    CheckResidual<F>( NORMAL, A, B, C, X, "Sylvester", comm );
+
+    Lyapunov( A, CSquare, X, ctrl );
+    CheckResidual<F>( ADJOINT, A, A, CSquare, X, "Lyapunov", comm );
+
+    MatType T( A ), Q;
+    SetGrid( Q, grid );
+    FullSchur( T, Q );
+    LyapunovFromSchur( T, Q, CSquare, X, ctrl );
+    CheckResidual<F>( ADJOINT, A, A, CSquare, X, "LyapunovFromSchur", comm );
+}
+
+template<typename F,class MatType>
+void TestSylvester
+( Int m, Int n, Int cutoff, const Grid& grid, const string& label )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing ",label," with ",TypeName<F>());
+    PushIndent();
+    TestTriangular<F,MatType>( m, n, cutoff, grid );
+    TestDense<F,MatType>( m, n, cutoff, grid );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of solution",30);
+        const Int n = Input("--n","width of solution",25);
+        const Int cutoff = Input("--cutoff","maximum leaf size",4);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool distributed =
+          Input("--distributed","test distributed?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        if( sequential && mpi::Rank(comm) == 0 )
+        {
+            TestSylvester<double,Matrix<double>>
+            ( m, n, cutoff, Grid::Trivial(), "sequential" );
+            TestSylvester<Complex<double>,Matrix<Complex<double>>>
+            ( m, n, cutoff, Grid::Trivial(), "sequential" );
+        }
+        if( distributed )
+        {
+            TestSylvester<double,DistMatrix<double>>
+            ( m, n, cutoff, grid, "distributed" );
+            TestSylvester<Complex<double>,DistMatrix<Complex<double>>>
+            ( m, n, cutoff, grid, "distributed" );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,255 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The ADMMs only converge to modest accuracy, and so each is checked
+// against either an optimality condition or an Interior Point Method with a
+// loose tolerance.
+
+template<typename Real>
+void SetGrid( Matrix<Real>& A, const Grid& grid ) { }
+
+template<typename Real>
+void SetGrid( DistMatrix<Real>& A, const Grid& grid ) { A.SetGrid( grid ); }
+
+template<typename Real>
+void SetADMMCtrl( ADMMAccelCtrl<Real>& accelCtrl, bool adaptive )
+{
+    accelCtrl.adaptiveRho = adaptive;
+    accelCtrl.andersonMemory = ( adaptive ? 5 : 0 );
+}
+
+template<typename Real>
+void CheckAgreement
+( Real value, Real reference, const string& label, mpi::Comm comm )
+{
+    const Real tol = Real(1e-2);
+    const Real relError = Abs(value-reference) / (1+Abs(reference));
+    OutputFromRoot(comm,label,": ADMM=",value,", IPM=",reference,
+      ", relative error=",relError);
+    if( relError > tol )
+        LogicError(label," of the ADMM did not match the IPM");
+}
+
+template<typename Real,class MatType>
+void CheckFeasibility
+( const MatType& A, const MatType& x, const MatType& b, const string& label,
+  mpi::Comm comm )
+{
+    const Real tol = Real(1e-2);
+    MatType r( b );
+    Gemv( NORMAL, Real(-1), A, x, Real(1), r );
+    const Real relError = FrobeniusNorm( r ) / (1+FrobeniusNorm( b ));
+    OutputFromRoot(comm,label,": || b - A x ||_2 / (1 + || b ||_2) = ",
+      relError);
+    if( relError > tol )
+        LogicError(label," was not feasible");
+}
+
+// min || x ||_1 s.t. A x = b
+template<typename Real,class MatType>
+void TestBP( Int m, Int n, bool adaptive, const Grid& grid, bool progress )
+{
+    mpi::Comm comm = grid.Comm();
+    MatType A, b, x, xIPM;
+    SetGrid( A, grid );
+    SetGrid( b, grid );
+    SetGrid( x, grid );
+    SetGrid( xIPM, grid );
+    Gaussian( A, m, n );
+    Gaussian( b, m, 1 );
+
+    BPCtrl<Real> ctrl(false);
+    ctrl.lpIPMCtrl.mehrotraCtrl.print = progress;
+    BP( A, b, xIPM, ctrl );
+
+    ctrl.useIPM = false;
+    ctrl.admmCtrl.maxIter = 10000;
+    ctrl.admmCtrl.absTol = Real(1e-8);
+    ctrl.admmCtrl.relTol = Real(1e-6);
+    ctrl.admmCtrl.progress = progress;
+    SetADMMCtrl( ctrl.admmCtrl.accelCtrl, adaptive );
+    BP( A, b, x, ctrl );
+
+    CheckFeasibility<Real>( A, x, b, "BP", comm );
+    CheckAgreement
+    ( EntrywiseNorm(x,Real(1)), EntrywiseNorm(xIPM,Real(1)), "BP || x ||_1",
+      comm );
+}
+
+// min (1/2) || b - A x ||_2^2 + lambda || x ||_1
+template<typename Real,class MatType>
+void TestBPDN( Int m, Int n, bool adaptive, const Grid& grid, bool progress )
+{
+    mpi::Comm comm = grid.Comm();
+    MatType A, b, x, xIPM;
+    SetGrid( A, grid );
+    SetGrid( b, grid );
+    SetGrid( x, grid );
+    SetGrid( xIPM, grid );
+    Gaussian( A, m, n );
+    Gaussian( b, m, 1 );
+    const Real lambda = Real(1)/Real(2);
+
+    auto objective = [&]( const MatType& x )
+    {
+        MatType r( b );
+        Gemv( NORMAL, Real(-1), A, x, Real(1), r );
+        return Pow(FrobeniusNorm(r),Real(2))/2 + lambda*EntrywiseNorm(x,1);
+    };
+
+    BPDNCtrl<Real> ctrl;
+    ctrl.ipmCtrl.mehrotraCtrl.print = progress;
+    BPDN( A, b, lambda, xIPM, ctrl );
+
+    ctrl.useIPM = false;
+    ctrl.admmCtrl.maxIter = 10000;
+    ctrl.admmCtrl.absTol = Real(1e-8);
+    ctrl.admmCtrl.relTol = Real(1e-6);
+    ctrl.admmCtrl.progress = progress;
+    SetADMMCtrl( ctrl.admmCtrl.accelCtrl, adaptive );
+    BPDN( A, b, lambda, x, ctrl );
+
+    CheckAgreement( objective(x), objective(xIPM), "BPDN objective", comm );
+}
+
+// min c^T x s.t. A x = b, x >= 0
+template<typename Real,class MatType>
+void TestLP( Int m, Int n, bool adaptive, const Grid& grid, bool progress )
+{
+    mpi::Comm comm = grid.Comm();
+    DirectLPProblem<MatType,MatType> problem;
+    DirectLPSolution<MatType> solution, solutionIPM;
+    SetGrid( problem.A, grid );
+    SetGrid( problem.b, grid );
+    SetGrid( problem.c, grid );
+
+    // Build a feasible, bounded LP from a nonnegative primal point, x0, and
+    // a dual point (y0,z0), with z0 >= 0
+    MatType x0, y0, z0;
+    SetGrid( x0, grid );
+    SetGrid( y0, grid );
+    SetGrid( z0, grid );
+    Uniform( x0, n, 1, Real(1)/Real(2), Real(1)/Real(2) );
+    Gaussian( y0, m, 1 );
+    Uniform( z0, n, 1, Real(1)/Real(2), Real(1)/Real(2) );
+    Gaussian( problem.A, m, n );
+    Zeros( problem.b, m, 1 );
+    Gemv( NORMAL, Real(1), problem.A, x0, Real(0), problem.b );
+    problem.c = z0;
+    Gemv( ADJOINT, Real(-1), problem.A, y0, Real(1), problem.c );
+
+    lp::direct::Ctrl<Real> ctrl(false);
+    ctrl.mehrotraCtrl.print = progress;
+    LP( problem, solutionIPM, ctrl );
+
+    ctrl.approach = LP_ADMM;
+    ctrl.admmCtrl.maxIter = 10000;
+    ctrl.admmCtrl.absTol = Real(1e-8);
+    ctrl.admmCtrl.relTol = Real(1e-6);
+    ctrl.admmCtrl.print = progress;
+    SetADMMCtrl( ctrl.admmCtrl.accelCtrl, adaptive );
+    LP( problem, solution, ctrl );
+
+    CheckFeasibility<Real>
+    ( problem.A, solution.x, problem.b, "LP", comm );
+    CheckAgreement
+    ( Dot(problem.c,solution.x), Dot(problem.c,solutionIPM.x),
+      "LP objective", comm );
+}
+
+// min (1/2) x^T Q x + c^T x s.t. lb <= x <= ub (for each column of C)
+template<typename Real,class MatType>
+void TestBoxQP
+( Int n, Int k, bool adaptive, const Grid& grid, bool progress )
+{
+    mpi::Comm comm = grid.Comm();
+    MatType B, Q, C, X;
+    SetGrid( B, grid );
+    SetGrid( Q, grid );
+    SetGrid( C, grid );
+    SetGrid( X, grid );
+    Gaussian( B, n, n );
+    Zeros( Q, n, n );
+    Herk( LOWER, ADJOINT, Real(1)/Real(n), B, Real(0), Q );
+    MakeHermitian( LOWER, Q );
+    ShiftDiagonal( Q, Real(1) );
+    Gaussian( C, n, k );
+    const Real lb = -1, ub = 1;
+
+    ADMMCtrl<Real> ctrl;
+    ctrl.maxIter = 10000;
+    ctrl.absTol = Real(1e-8);
+    ctrl.relTol = Real(1e-6);
+    ctrl.print = progress;
+    SetADMMCtrl( ctrl.accelCtrl, adaptive );
+    qp::box::ADMM( Q, C, lb, ub, X, ctrl );
+
+    // The solution is a fixed point of the projected gradient map,
+    //   X = Clip(X - (Q X + C), lb, ub)
+    MatType R( X );
+    Gemm( NORMAL, NORMAL, Real(-1), Q, X, Real(1), R );
+    R -= C;
+    Clip( R, lb, ub );
+    R -= X;
+    const Real tol = Real(1e-2);
+    const Real relError = FrobeniusNorm( R ) / (1+FrobeniusNorm( C ));
+    OutputFromRoot(comm,"Box QP: || X - Clip(X-(Q X+C)) ||_F / ",
+      "(1 + || C ||_F) = ",relError);
+    if( relError > tol )
+        LogicError("Box QP solution was not optimal");
+}
+
+template<typename Real,class MatType>
+void TestADMMs
+( Int m, Int n, Int k, bool adaptive, const Grid& grid, bool progress,
+  const string& label )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing ",label," with ",TypeName<Real>(),
+     " and adaptiveRho=",adaptive);
+    PushIndent();
+    TestBP<Real,MatType>( m, n, adaptive, grid, progress );
+    TestBPDN<Real,MatType>( m, n, adaptive, grid, progress );
+    TestLP<Real,MatType>( m, n, adaptive, grid, progress );
+    TestBoxQP<Real,MatType>( n, k, adaptive, grid, progress );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of constraint matrix",20);
+        const Int n = Input("--n","width of constraint matrix",50);
+        const Int k = Input("--k","number of box QP right-hand sides",2);
+        const bool testSeq = Input("--testSeq","test sequential?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        for( const bool adaptive : { false, true } )
+        {
+            if( testSeq && mpi::Rank(comm) == 0 )
+                TestADMMs<double,Matrix<double>>
+                ( m, n, k, adaptive, Grid::Trivial(), progress,
+                  "sequential" );
+            TestADMMs<double,DistMatrix<double>>
+            ( m, n, k, adaptive, grid, progress, "distributed" );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
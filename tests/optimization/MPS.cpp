@@ -0,0 +1,256 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The rows and columns are declared out of lexicographic order so that the
+// numbering of the constraints and bounds is exercised
+void WriteTestMPS( const string& filename )
+{
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "NAME          ROUNDTRIP\n"
+         << "ROWS\n"
+         << " N  COST\n"
+         << " L  LIMB\n"
+         << " L  LIMA\n"
+         << " G  LOWER\n"
+         << " E  EQN\n"
+         << "COLUMNS\n"
+         << "    YB        COST         1   LIMB         2\n"
+         << "    YB        LIMA         3   EQN          1\n"
+         << "    XA        COST        -2   LIMB         4\n"
+         << "    XA        LOWER        5\n"
+         << "    ZC        COST         3   LIMA         6\n"
+         << "    ZC        LOWER        7   EQN          8\n"
+         << "RHS\n"
+         << "    RHS       LIMB        10   LIMA        11\n"
+         << "    RHS       LOWER       12   EQN         13\n"
+         << "BOUNDS\n"
+         << " UP BND       YB           4\n"
+         << " UP BND       XA           9\n"
+         << "ENDATA\n";
+}
+
+// The variables are numbered in the order of their declaration (YB, XA, ZC),
+// whereas the rows of each type, and the bounds, are numbered in the
+// lexicographic order of their names:
+//
+//   A = | 1 0 8 |, b = | 13 |,
+//
+//   G = | 3  0  6 |, h = |  11 |   (LIMA)
+//       | 2  4  0 |      |  10 |   (LIMB)
+//       | 0 -5 -7 |      | -12 |   (LOWER)
+//       | 0  1  0 |      |   9 |   (XA <= 9)
+//       | 1  0  0 |      |   4 |   (YB <= 4)
+//       | 0 -1  0 |      |   0 |   (XA >= 0)
+//       |-1  0  0 |      |   0 |   (YB >= 0)
+//       | 0  0 -1 |      |   0 |   (ZC >= 0)
+//
+// and c = [1; -2; 3].
+void ExpectedProblem( AffineLPProblem<Matrix<double>,Matrix<double>>& problem )
+{
+    Zeros( problem.A, 1, 3 );
+    problem.A(0,0) = 1; problem.A(0,2) = 8;
+    Zeros( problem.b, 1, 1 );
+    problem.b(0) = 13;
+
+    Zeros( problem.G, 8, 3 );
+    problem.G(0,0) = 3; problem.G(0,2) = 6;
+    problem.G(1,0) = 2; problem.G(1,1) = 4;
+    problem.G(2,1) = -5; problem.G(2,2) = -7;
+    problem.G(3,1) = 1;
+    problem.G(4,0) = 1;
+    problem.G(5,1) = -1;
+    problem.G(6,0) = -1;
+    problem.G(7,2) = -1;
+    Zeros( problem.h, 8, 1 );
+    problem.h(0) = 11;
+    problem.h(1) = 10;
+    problem.h(2) = -12;
+    problem.h(3) = 9;
+    problem.h(4) = 4;
+
+    Zeros( problem.c, 3, 1 );
+    problem.c(0) = 1;
+    problem.c(1) = -2;
+    problem.c(2) = 3;
+}
+
+// Replace the end marker of an MPS cache with an entry of A (type 1) whose
+// row index is out of bounds
+void CorruptCache( const string& filename )
+{
+    std::fstream file
+    ( filename.c_str(), std::ios::binary | std::ios::in | std::ios::out );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.seekp( -1, std::ios::end );
+    const unsigned char type = 1, endMarker = 255;
+    const std::int64_t row = 1000, column = 0;
+    const double value = 1;
+    file.write( (const char*)&type, sizeof(type) );
+    file.write( (const char*)&row, sizeof(row) );
+    file.write( (const char*)&column, sizeof(column) );
+    file.write( (const char*)&value, sizeof(value) );
+    file.write( (const char*)&endMarker, sizeof(endMarker) );
+}
+
+void CheckEqual
+( const Matrix<double>& A, const Matrix<double>& AExpected,
+  const string& label )
+{
+    if( A.Height() != AExpected.Height() || A.Width() != AExpected.Width() )
+        LogicError
+        (label," was ",A.Height()," x ",A.Width()," rather than ",
+         AExpected.Height()," x ",AExpected.Width());
+    Matrix<double> E( A );
+    E -= AExpected;
+    if( FrobeniusNorm(E) != 0. )
+        LogicError(label," did not match");
+}
+
+void ToDense( const Matrix<double>& A, Matrix<double>& ADense )
+{ ADense = A; }
+
+void ToDense( const SparseMatrix<double>& A, Matrix<double>& ADense )
+{ Copy( A, ADense ); }
+
+void ToDense( const DistMatrix<double>& A, Matrix<double>& ADense )
+{
+    DistMatrix<double,STAR,STAR> A_STAR_STAR( A );
+    ADense = A_STAR_STAR.Matrix();
+}
+
+void ToDense( const DistSparseMatrix<double>& A, Matrix<double>& ADense )
+{
+    DistMatrix<double,STAR,STAR> A_STAR_STAR( A.Grid() );
+    Copy( A, A_STAR_STAR );
+    ADense = A_STAR_STAR.Matrix();
+}
+
+void ToDense( const DistMultiVec<double>& A, Matrix<double>& ADense )
+{
+    DistMatrix<double,STAR,STAR> A_STAR_STAR( A.Grid() );
+    Copy( A, A_STAR_STAR );
+    ADense = A_STAR_STAR.Matrix();
+}
+
+template<class MatrixType,class VectorType>
+void CheckProblem
+( const AffineLPProblem<MatrixType,VectorType>& problem,
+  const string& label )
+{
+    AffineLPProblem<Matrix<double>,Matrix<double>> expected, dense;
+    ExpectedProblem( expected );
+    ToDense( problem.A, dense.A );
+    ToDense( problem.b, dense.b );
+    ToDense( problem.G, dense.G );
+    ToDense( problem.h, dense.h );
+    ToDense( problem.c, dense.c );
+    CheckEqual( dense.A, expected.A, label+" A" );
+    CheckEqual( dense.b, expected.b, label+" b" );
+    CheckEqual( dense.G, expected.G, label+" G" );
+    CheckEqual( dense.h, expected.h, label+" h" );
+    CheckEqual( dense.c, expected.c, label+" c" );
+}
+
+template<class MatrixType,class VectorType>
+void TestRead
+( const string& filename, const string& cacheFilename, const Grid& grid,
+  const string& label )
+{
+    OutputFromRoot(grid.Comm(),"Testing ",label);
+    AffineLPProblem<MatrixType,VectorType> problem, cachedProblem;
+    ForceSimpleAlignments( problem, grid );
+    ForceSimpleAlignments( cachedProblem, grid );
+    ReadMPS( problem, filename );
+    CheckProblem( problem, label+" from "+filename );
+    ReadMPS( cachedProblem, cacheFilename, true );
+    CheckProblem( cachedProblem, label+" from "+cacheFilename );
+}
+
+template<class MatrixType,class VectorType>
+void TestCorruptCache
+( const string& cacheFilename, const Grid& grid, const string& label )
+{
+    AffineLPProblem<MatrixType,VectorType> problem;
+    ForceSimpleAlignments( problem, grid );
+    bool rejected = false;
+    try { ReadMPS( problem, cacheFilename, true ); }
+    catch( std::exception& e ) { rejected = true; }
+    if( !rejected )
+        LogicError("The corrupt MPS cache was not rejected by the ",label);
+
+    // A missing file should also be reported on every process
+    rejected = false;
+    try { ReadMPS( problem, cacheFilename+"-missing" ); }
+    catch( std::exception& e ) { rejected = true; }
+    if( !rejected )
+        LogicError("The missing MPS file was not rejected by the ",label);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    try
+    {
+        const string basename =
+          Input("--basename","basename of the test files","MPS-roundtrip");
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        const string filename = basename + ".mps";
+        const string cacheFilename = basename + ".bin";
+        if( commRank == 0 )
+        {
+            WriteTestMPS( filename );
+            CompressMPS( filename, cacheFilename );
+        }
+        mpi::Barrier( comm );
+
+        if( commRank == 0 )
+        {
+            TestRead<Matrix<double>,Matrix<double>>
+            ( filename, cacheFilename, Grid::Trivial(), "Matrix" );
+            TestRead<SparseMatrix<double>,Matrix<double>>
+            ( filename, cacheFilename, Grid::Trivial(), "SparseMatrix" );
+        }
+        TestRead<DistMatrix<double>,DistMatrix<double>>
+        ( filename, cacheFilename, grid, "DistMatrix" );
+        TestRead<DistSparseMatrix<double>,DistMultiVec<double>>
+        ( filename, cacheFilename, grid, "DistSparseMatrix" );
+
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+            CorruptCache( cacheFilename );
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+        {
+            TestCorruptCache<Matrix<double>,Matrix<double>>
+            ( cacheFilename, Grid::Trivial(), "Matrix reader" );
+            TestCorruptCache<SparseMatrix<double>,Matrix<double>>
+            ( cacheFilename, Grid::Trivial(), "SparseMatrix reader" );
+        }
+        TestCorruptCache<DistMatrix<double>,DistMatrix<double>>
+        ( cacheFilename, grid, "DistMatrix reader" );
+        TestCorruptCache<DistSparseMatrix<double>,DistMultiVec<double>>
+        ( cacheFilename, grid, "DistSparseMatrix reader" );
+
+        OutputFromRoot(comm,"passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
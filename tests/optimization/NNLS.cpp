@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Real>
+void CheckKKT
+( const DistMatrix<Real>& A,
+  const DistMatrix<Real>& B,
+  const DistMatrix<Real>& X )
+{
+    // Y := A^T (A X - B) should be non-negative and complementary to X
+    DistMatrix<Real> R( B ), Y(A.Grid());
+    Gemm( NORMAL, NORMAL, Real(1), A, X, Real(-1), R );
+    Gemm( ADJOINT, NORMAL, Real(1), A, R, Y );
+
+    DistMatrix<Real> ATB(A.Grid());
+    Gemm( ADJOINT, NORMAL, Real(1), A, B, ATB );
+    const Real tol =
+      Pow(limits::Epsilon<Real>(),Real(0.5))*Max(MaxNorm(ATB),Real(1));
+
+    DistMatrix<Real> XNeg( X ), YNeg( Y ), XY( X );
+    UpperClip( XNeg, Real(0) );
+    UpperClip( YNeg, Real(0) );
+    Hadamard( X, Y, XY );
+    const Real primalInfeas = MaxNorm( XNeg );
+    const Real dualInfeas = MaxNorm( YNeg );
+    const Real complement = MaxNorm( XY );
+    OutputFromRoot
+    (A.Grid().Comm(),"primal infeas: ",primalInfeas,", dual infeas: ",
+     dualInfeas,", complementarity: ",complement);
+    if( primalInfeas > 0 )
+        LogicError("Active-set NNLS solution was not non-negative");
+    if( dualInfeas > tol || complement > tol*Max(MaxNorm(X),Real(1)) )
+        LogicError("Active-set NNLS solution did not satisfy the KKT system");
+}
+
+template<typename Real>
+void TestNNLS( Int m, Int n, Int numRHS, const Grid& grid, bool print )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Real>());
+    PushIndent();
+
+    DistMatrix<Real> A(grid), B(grid), X(grid);
+    Gaussian( A, m, n );
+    Gaussian( B, m, numRHS );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+
+    NNLSCtrl<Real> ctrl;
+    ctrl.approach = NNLS_ACTIVE_SET;
+    Timer timer;
+    for( Int solve=0; solve<2; ++solve )
+    {
+        // The second solve is warm-started from the solution of a perturbed
+        // problem
+        if( solve == 1 )
+        {
+            DistMatrix<Real> E(grid);
+            Gaussian( E, m, numRHS, Real(0), Real(1)/10 );
+            B += E;
+        }
+        mpi::Barrier( grid.Comm() );
+        timer.Start();
+        NNLS( A, B, X, ctrl );
+        mpi::Barrier( grid.Comm() );
+        OutputFromRoot
+        (grid.Comm(),"solve ",solve,": ",timer.Stop()," seconds");
+        if( print )
+            Print( X, "X" );
+        CheckKKT( A, B, X );
+    }
+
+    // A zero column of A should be held at zero rather than making the
+    // passive submatrices of A^T A singular (the warm start places it in
+    // every initial passive set)
+    if( n > 1 )
+    {
+        DistMatrix<Real> AZero( A ), XZero(grid);
+        auto a1 = AZero( ALL, IR(1) );
+        Zero( a1 );
+        Ones( XZero, n, numRHS );
+        NNLS( AZero, B, XZero, ctrl );
+        CheckKKT( AZero, B, XZero );
+        const Real x1Norm = MaxNorm( XZero(IR(1),ALL) );
+        OutputFromRoot(grid.Comm(),"|| X(1,:) ||_max = ",x1Norm);
+        if( x1Norm != Real(0) )
+            LogicError("The variable of a zero column was not held at zero");
+    }
+
+    // The sequential implementation should agree
+    if( grid.Size() == 1 )
+    {
+        Matrix<Real> XSeq;
+        NNLS( A.LockedMatrix(), B.LockedMatrix(), XSeq, ctrl );
+        XSeq -= X.LockedMatrix();
+        const Real diff = FrobeniusNorm( XSeq );
+        OutputFromRoot(grid.Comm(),"|| XSeq - X ||_F = ",diff);
+        if( diff > Pow(limits::Epsilon<Real>(),Real(0.5)) )
+            LogicError("Sequential and distributed solutions differed");
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",200);
+        const Int n = Input("--n","width of A",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",500);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestNNLS<float>( m, n, numRHS, g, print );
+        TestNNLS<double>( m, n, numRHS, g, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
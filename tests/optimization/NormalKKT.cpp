@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Build a sparse affine QP,
+//
+//   min (1/2) x^T Q x + c^T x, s.t. A x = b, G x + s = h, s >= 0,
+//
+// with a positive diagonal Q and a known, strictly complementary solution.
+// The rows of G consist of lower bounds on every variable, upper bounds on
+// the first half of the variables, and 'numGeneral' general inequalities,
+// half of which are active. The first column of A and G is dense so that
+// it is split off from the normal equations when 'denseColMin' is small.
+template<typename Real>
+void BuildQP
+( Int n, Int m, Int numGeneral,
+  SparseMatrix<Real>& Q, SparseMatrix<Real>& A, SparseMatrix<Real>& G,
+  Matrix<Real>& b, Matrix<Real>& c, Matrix<Real>& h,
+  Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z, Matrix<Real>& s )
+{
+    const Int numUpper = n/2;
+    const Int k = n + numUpper + numGeneral;
+    const Real upper = 2;
+
+    Zeros( Q, n, n );
+    Q.Reserve( n );
+    for( Int j=0; j<n; ++j )
+        Q.QueueUpdate( j, j, Real(1+j%3) );
+    Q.ProcessQueues();
+
+    Zeros( A, m, n );
+    A.Reserve( m*n );
+    for( Int i=0; i<m; ++i )
+        for( Int j=0; j<n; ++j )
+            if( j == 0 || (i+j) % 5 == 0 )
+                A.QueueUpdate( i, j, Sin(Real(3*i+7*j+1)) );
+    A.ProcessQueues();
+
+    Zeros( G, k, n );
+    G.Reserve( n + numUpper + numGeneral*n );
+    for( Int j=0; j<n; ++j )
+        G.QueueUpdate( j, j, Real(-1) );
+    for( Int j=0; j<numUpper; ++j )
+        G.QueueUpdate( n+j, j, Real(1) );
+    for( Int i=0; i<numGeneral; ++i )
+        for( Int j=0; j<n; ++j )
+            if( j == 0 || (2*i+j) % 7 == 0 )
+                G.QueueUpdate( n+numUpper+i, j, Cos(Real(5*i+2*j+1)) );
+    G.ProcessQueues();
+
+    // Every fourth variable sits on its lower bound, and, within the first
+    // half, every fourth (shifted) variable sits on its upper bound
+    Zeros( x, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        if( j % 4 == 0 )
+            x(j) = 0;
+        else if( j % 4 == 1 && j < numUpper )
+            x(j) = upper;
+        else
+            x(j) = Real(1)/Real(2) + Abs(Sin(Real(j+1)));
+    }
+
+    Zeros( y, m, 1 );
+    for( Int i=0; i<m; ++i )
+        y(i) = Cos( Real(2*i+1) );
+
+    Zeros( z, k, 1 );
+    Zeros( s, k, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        s(j) = x(j);
+        if( x(j) == Real(0) )
+            z(j) = 1 + Abs(Cos(Real(j+1)));
+    }
+    for( Int j=0; j<numUpper; ++j )
+    {
+        s(n+j) = upper - x(j);
+        if( x(j) == upper )
+            z(n+j) = 1 + Abs(Sin(Real(j+2)));
+    }
+    for( Int i=0; i<numGeneral; ++i )
+    {
+        if( i < numGeneral/2 )
+            z(n+numUpper+i) = 1 + Abs(Sin(Real(i+3)));
+        else
+            s(n+numUpper+i) = 1;
+    }
+
+    // b := A x, h := G x + s, and c := -(Q x + A^T y + G^T z)
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x, Real(0), b );
+    h = s;
+    Multiply( NORMAL, Real(1), G, x, Real(1), h );
+    Zeros( c, n, 1 );
+    Multiply( NORMAL, Real(-1), Q, x, Real(0), c );
+    Multiply( TRANSPOSE, Real(-1), A, y, Real(1), c );
+    Multiply( TRANSPOSE, Real(-1), G, z, Real(1), c );
+}
+
+template<typename Real>
+void CheckMatch
+( const Matrix<Real>& vNormal, const Matrix<Real>& v, const string& name )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    Matrix<Real> diff( v );
+    diff -= vNormal;
+    const Real relError = FrobeniusNorm( diff ) / (1+FrobeniusNorm( v ));
+    Output
+    ("|| ",name,"_normal - ",name," ||_2 / (1 + || ",name," ||_2) = ",
+     relError);
+    if( relError > tol )
+        LogicError("Normal-equation ",name," did not match");
+}
+
+template<typename Real>
+void TestNormalKKT
+( Int n, Int m, Int numGeneral, Int denseColMin, bool progress )
+{
+    Output
+    ("Testing with ",TypeName<Real>()," and denseColMin=",denseColMin);
+    PushIndent();
+
+    SparseMatrix<Real> Q, A, G;
+    Matrix<Real> b, c, h, xTrue, yTrue, zTrue, sTrue;
+    BuildQP
+    ( n, m, numGeneral, Q, A, G, b, c, h, xTrue, yTrue, zTrue, sTrue );
+
+    qp::affine::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = progress;
+    ctrl.mehrotraCtrl.system = FULL_KKT;
+    Matrix<Real> x, y, z, s;
+    QP( Q, A, G, b, c, h, x, y, z, s, ctrl );
+
+    ctrl.mehrotraCtrl.system = NORMAL_KKT;
+    ctrl.mehrotraCtrl.denseColMin = denseColMin;
+    Matrix<Real> xNormal, yNormal, zNormal, sNormal;
+    QP( Q, A, G, b, c, h, xNormal, yNormal, zNormal, sNormal, ctrl );
+
+    CheckMatch( xNormal, x, "x" );
+    CheckMatch( yNormal, y, "y" );
+    CheckMatch( zNormal, z, "z" );
+    CheckMatch( sNormal, s, "s" );
+    CheckMatch( xNormal, xTrue, "x" );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int n = Input("--n","number of variables",40);
+        const Int m = Input("--m","number of equality constraints",4);
+        const Int numGeneral =
+          Input("--numGeneral","number of general inequalities",6);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // The normal-equation path is only available sequentially
+        if( mpi::Rank(comm) == 0 )
+        {
+            // Split the dense first column off of the normal equations
+            TestNormalKKT<double>( n, m, numGeneral, 3, progress );
+            // Keep every column within the sparse factorization
+            TestNormalKKT<double>( n, m, numGeneral, n+1, progress );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
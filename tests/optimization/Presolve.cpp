@@ -0,0 +1,226 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Build a direct-form LP or QP,
+//
+//   min (1/2) x^T Q x + c^T x, s.t. A x = b, x >= 0,
+//
+// with a unique, strictly complementary solution (x,y,z) such that presolve
+// has something to remove: the variable n0 is fixed by the singleton row m0
+// (and also appears in row 0), and the variable n0+1 is an empty column
+// with a positive cost. The entries are deterministic so that every process
+// builds the same problem.
+template<typename Real>
+void BuildProblem
+( Int m0, Int n0, bool quadratic,
+  Matrix<Real>& Q, Matrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    const Int m = m0+1;
+    const Int n = n0+2;
+    const Int fixedCol = n0;
+    const Int emptyCol = n0+1;
+    // A QP can have more positive variables than equality constraints
+    const Int supportSize = ( quadratic ? m0+2 : m0 );
+
+    Zeros( A, m, n );
+    for( Int j=0; j<n0; ++j )
+        for( Int i=0; i<m0; ++i )
+            A(i,j) = Sin( Real(7*i+3*j+1) );
+    A(0,fixedCol) = 1;
+    A(m0,fixedCol) = 1;
+
+    Zeros( Q, n, n );
+    if( quadratic )
+        for( Int j=0; j<n0; ++j )
+            Q(j,j) = 1;
+
+    Matrix<Real> x, y, z;
+    Zeros( x, n, 1 );
+    Zeros( z, n, 1 );
+    Zeros( y, m, 1 );
+    for( Int j=0; j<n0; ++j )
+    {
+        if( j < supportSize )
+            x(j) = 1 + Abs(Cos(Real(j+1)));
+        else
+            z(j) = 1 + Abs(Sin(Real(j+1)));
+    }
+    x(fixedCol) = Real(3)/Real(2);
+    z(emptyCol) = 1;
+    for( Int i=0; i<m; ++i )
+        y(i) = Cos( Real(5*i+2) );
+
+    // b := A x and c := z - A^T y - Q x
+    Gemv( NORMAL, Real(1), A, x, b );
+    c = z;
+    Gemv( ADJOINT, Real(-1), A, y, Real(1), c );
+    Gemv( NORMAL, Real(-1), Q, x, Real(1), c );
+}
+
+template<typename Real>
+void ToSparse
+( const Matrix<Real>& ADense, SparseMatrix<Real>& A, const Grid& grid )
+{
+    const Int m = ADense.Height();
+    const Int n = ADense.Width();
+    Zeros( A, m, n );
+    A.Reserve( m*n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( ADense(i,j) != Real(0) )
+                A.QueueUpdate( i, j, ADense(i,j) );
+    A.ProcessQueues();
+}
+
+template<typename Real>
+void ToSparse
+( const Matrix<Real>& ADense, DistSparseMatrix<Real>& A, const Grid& grid )
+{
+    const Int m = ADense.Height();
+    const Int n = ADense.Width();
+    A.SetGrid( grid );
+    Zeros( A, m, n );
+    if( A.Grid().Rank() == 0 )
+    {
+        A.Reserve( m*n, m*n );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( ADense(i,j) != Real(0) )
+                    A.QueueUpdate( i, j, ADense(i,j) );
+    }
+    A.ProcessQueues();
+}
+
+template<typename Real>
+void ToVector
+( const Matrix<Real>& vDense, Matrix<Real>& v, const Grid& grid )
+{ v = vDense; }
+
+template<typename Real>
+void ToVector
+( const Matrix<Real>& vDense, DistMultiVec<Real>& v, const Grid& grid )
+{
+    const Int height = vDense.Height();
+    v.SetGrid( grid );
+    Zeros( v, height, 1 );
+    if( v.Grid().Rank() == 0 )
+    {
+        v.Reserve( height );
+        for( Int i=0; i<height; ++i )
+            v.QueueUpdate( i, 0, vDense(i) );
+    }
+    v.ProcessQueues();
+}
+
+template<typename Real,class VectorType>
+void CheckMatch
+( const VectorType& vPre, const VectorType& v, const string& name,
+  mpi::Comm comm )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    VectorType diff( v );
+    Axpy( Real(-1), vPre, diff );
+    const Real relError = FrobeniusNorm( diff ) / (1+FrobeniusNorm( v ));
+    OutputFromRoot(comm,"|| ",name,"_pre - ",name," ||_2 / (1 + || ",name,
+      " ||_2) = ",relError);
+    if( relError > tol )
+        LogicError("Presolved ",name," did not match");
+}
+
+template<typename Real,class MatrixType,class VectorType>
+void TestPresolve
+( Int m0, Int n0, bool quadratic, const Grid& grid, bool progress,
+  const string& label )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot(comm,"Testing ",label," with ",TypeName<Real>());
+    PushIndent();
+
+    Matrix<Real> QDense, ADense, bDense, cDense;
+    BuildProblem( m0, n0, quadratic, QDense, ADense, bDense, cDense );
+    MatrixType Q, A;
+    VectorType b, c;
+    ToSparse( QDense, Q, grid );
+    ToSparse( ADense, A, grid );
+    ToVector( bDense, b, grid );
+    ToVector( cDense, c, grid );
+
+    VectorType x, y, z, xPre, yPre, zPre;
+    if( quadratic )
+    {
+        qp::direct::Ctrl<Real> ctrl;
+        ctrl.mehrotraCtrl.print = progress;
+        QP( Q, A, b, c, x, y, z, ctrl );
+        ctrl.presolveCtrl.enable = true;
+        ctrl.presolveCtrl.print = progress;
+        QP( Q, A, b, c, xPre, yPre, zPre, ctrl );
+    }
+    else
+    {
+        DirectLPProblem<MatrixType,VectorType> problem;
+        problem.A = A;
+        problem.b = b;
+        problem.c = c;
+        DirectLPSolution<VectorType> solution, solutionPre;
+        lp::direct::Ctrl<Real> ctrl(true);
+        ctrl.mehrotraCtrl.print = progress;
+        LP( problem, solution, ctrl );
+        ctrl.presolveCtrl.enable = true;
+        ctrl.presolveCtrl.print = progress;
+        LP( problem, solutionPre, ctrl );
+        x = solution.x; y = solution.y; z = solution.z;
+        xPre = solutionPre.x; yPre = solutionPre.y; zPre = solutionPre.z;
+    }
+    CheckMatch<Real>( xPre, x, "x", comm );
+    CheckMatch<Real>( yPre, y, "y", comm );
+    CheckMatch<Real>( zPre, z, "z", comm );
+
+    PopIndent();
+}
+
+template<typename Real>
+void TestPresolve
+( Int m0, Int n0, bool testSeq, const Grid& grid, bool progress )
+{
+    if( testSeq && grid.Rank() == 0 )
+    {
+        TestPresolve<Real,SparseMatrix<Real>,Matrix<Real>>
+        ( m0, n0, false, Grid::Trivial(), progress, "sequential LP" );
+        TestPresolve<Real,SparseMatrix<Real>,Matrix<Real>>
+        ( m0, n0, true, Grid::Trivial(), progress, "sequential QP" );
+    }
+    TestPresolve<Real,DistSparseMatrix<Real>,DistMultiVec<Real>>
+    ( m0, n0, false, grid, progress, "distributed LP" );
+    TestPresolve<Real,DistSparseMatrix<Real>,DistMultiVec<Real>>
+    ( m0, n0, true, grid, progress, "distributed QP" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m0 = Input("--m0","number of dense equality rows",8);
+        const Int n0 = Input("--n0","number of dense columns",20);
+        const bool testSeq = Input("--testSeq","test sequential?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestPresolve<double>( m0, n0, testSeq, grid, progress );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestRandomizedSVT
+( Int m,
+  Int n,
+  Int rank,
+  Base<F> tau,
+  const Grid& grid,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    // A := X Y^H has rank 'rank'
+    DistMatrix<F> X(grid), Y(grid), A(grid);
+    Gaussian( X, m, rank );
+    Gaussian( Y, n, rank );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, A );
+    if( print )
+        Print( A, "A" );
+
+    RandomizedSVTCtrl<Real> ctrl;
+    ctrl.initialRank = 1;
+    DistMatrix<F> V(grid);
+    for( Int solve=0; solve<2; ++solve )
+    {
+        if( solve == 1 )
+        {
+            // Perturb A within its column space for the warm-started solve
+            DistMatrix<F> Z(grid);
+            Gaussian( Z, rank, rank );
+            Z *= F(Real(1)/10);
+            DistMatrix<F> XZ(grid);
+            Gemm( NORMAL, NORMAL, F(1), X, Z, XZ );
+            Gemm( NORMAL, ADJOINT, F(1), XZ, Y, F(1), A );
+        }
+
+        DistMatrix<F> B( A ), BRand( A );
+        const Int normalRank = svt::Normal( B, tau );
+
+        mpi::Barrier( grid.Comm() );
+        Timer timer;
+        timer.Start();
+        const Int randRank = svt::Randomized( BRand, tau, V, ctrl );
+        mpi::Barrier( grid.Comm() );
+        const double runTime = timer.Stop();
+        if( print )
+            Print( BRand, "BRand" );
+        OutputFromRoot
+        (grid.Comm(),"solve ",solve,": rank=",randRank," (vs. ",normalRank,
+         ") in ",runTime," seconds");
+
+        BRand -= B;
+        const Real BFrob = FrobeniusNorm( B );
+        const Real errorFrob = FrobeniusNorm( BRand );
+        OutputFromRoot
+        (grid.Comm(),"|| B ||_F = ",BFrob,", || E ||_F = ",errorFrob);
+        if( randRank != normalRank )
+            LogicError("Randomized SVT computed the wrong rank");
+        if( errorFrob > Sqrt(eps)*Max(BFrob,Real(1)) )
+            LogicError("Randomized SVT was not sufficiently accurate");
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",200);
+        const Int n = Input("--width","width of matrix",150);
+        const Int rank = Input("--rank","rank of matrix",15);
+        const double tau = Input("--tau","soft-threshold parameter",0.5);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestRandomizedSVT<double>( m, n, rank, tau, g, print );
+        TestRandomizedSVT<Complex<double>>( m, n, rank, tau, g, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Real>
+Real TVObjective
+( const Matrix<Real>& b, const Matrix<Real>& x, const Real& lambda )
+{
+    const Int n = b.Height();
+    Real diffNorm=0, tv=0;
+    for( Int i=0; i<n; ++i )
+        diffNorm += (x(i)-b(i))*(x(i)-b(i));
+    for( Int i=0; i<n-1; ++i )
+        tv += Abs(x(i+1)-x(i));
+    return diffNorm/2 + lambda*tv;
+}
+
+template<typename Real>
+void TestTV( Int n, Real lambda, bool print )
+{
+    Output("Testing with ",TypeName<Real>());
+    PushIndent();
+
+    // A piecewise-constant signal plus noise
+    Matrix<Real> b;
+    Gaussian( b, n, 1, Real(0), Real(1)/4 );
+    for( Int i=0; i<n; ++i )
+        b(i) += Real((4*i)/n);
+    if( print )
+        Print( b, "b" );
+
+    Timer timer;
+    Matrix<Real> x, xIPM;
+    timer.Start();
+    TV( b, lambda, x );
+    Output("Direct TV: ",timer.Stop()," seconds");
+    timer.Start();
+    qp::affine::Ctrl<Real> ctrl;
+    TV( b, lambda, xIPM, ctrl );
+    Output("IPM TV:    ",timer.Stop()," seconds");
+    if( print )
+    {
+        Print( x, "x" );
+        Print( xIPM, "xIPM" );
+    }
+
+    // The direct solution is exact, so it should be at least as good as the
+    // Interior Point Method's
+    const Real objective = TVObjective( b, x, lambda );
+    const Real objectiveIPM = TVObjective( b, xIPM, lambda );
+    Output("objective: ",objective," (vs. ",objectiveIPM,")");
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    if( objective > objectiveIPM + tol*Max(objectiveIPM,Real(1)) )
+        LogicError("Direct TV was less accurate than the IPM");
+    xIPM -= x;
+    const Real diffNorm = FrobeniusNorm( xIPM );
+    Output("|| x - xIPM ||_2 = ",diffNorm);
+    if( diffNorm > tol*Max(FrobeniusNorm(x),Real(1)) )
+        LogicError("Direct and IPM TV solutions differed");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","length of signal",200);
+        const double lambda = Input("--lambda","TV regularization",1.);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        TestTV<double>( n, lambda, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}